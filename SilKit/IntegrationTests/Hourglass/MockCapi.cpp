@@ -884,6 +884,14 @@ extern "C"
         return globalCapi->SilKit_RpcClient_CallWithTimeout(self, argumentData, timeout, userContext);
     }
 
+    SilKit_ReturnCode SilKitCALL SilKit_Experimental_RpcClient_CallBatch(SilKit_RpcClient* self,
+                                                                        const SilKit_ByteVector* argumentData,
+                                                                        void* const* userContexts,
+                                                                        size_t numberOfCalls)
+    {
+        return globalCapi->SilKit_Experimental_RpcClient_CallBatch(self, argumentData, userContexts, numberOfCalls);
+    }
+
     SilKit_ReturnCode SilKitCALL SilKit_RpcClient_SetCallResultHandler(SilKit_RpcClient* self, void* context,
                                                                        SilKit_RpcCallResultHandler_t handler)
     {
@@ -479,6 +479,10 @@ public:
                 (SilKit_RpcClient * self, const SilKit_ByteVector* argumentData, SilKit_NanosecondsTime timeout,
                  void* userContext));
 
+    MOCK_METHOD(SilKit_ReturnCode, SilKit_Experimental_RpcClient_CallBatch,
+                (SilKit_RpcClient * self, const SilKit_ByteVector* argumentData, void* const* userContexts,
+                 size_t numberOfCalls));
+
     MOCK_METHOD(SilKit_ReturnCode, SilKit_RpcClient_SetCallResultHandler,
                 (SilKit_RpcClient * self, void* context, SilKit_RpcCallResultHandler_t handler));
 
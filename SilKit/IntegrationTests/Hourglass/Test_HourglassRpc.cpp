@@ -27,6 +27,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "silkit/capi/SilKit.h"
 
 #include "silkit/SilKit.hpp"
+#include "silkit/experimental/services/rpc/RpcClientExtensions.hpp"
 #include "silkit/detail/impl/ThrowOnError.hpp"
 #include "silkit/util/Span.hpp"
 
@@ -240,6 +241,34 @@ TEST_F(Test_HourglassRpc, SilKit_RpcClient_Call)
     rpcClient.Call(byteSpan, nullptr);
 }
 
+TEST_F(Test_HourglassRpc, SilKit_Experimental_RpcClient_CallBatch)
+{
+    auto* const participant = reinterpret_cast<SilKit_Participant*>(uintptr_t(123456));
+
+    SilKit::DETAIL_SILKIT_DETAIL_NAMESPACE_NAME::Impl::Services::Rpc::RpcClient rpcClient{
+        participant, "RpcClient1", RpcSpec{"FunctionName1", "MediaType1"}, [](IRpcClient*, const RpcCallResultEvent&) {
+        // do nothing
+    }};
+
+    std::vector<uint8_t> bytes1{1, 2, 3};
+    std::vector<uint8_t> bytes2{4, 5, 6, 7};
+    const std::vector<Span<const uint8_t>> data{bytes1, bytes2};
+    const std::vector<void*> userContexts{reinterpret_cast<void*>(uintptr_t(1)), reinterpret_cast<void*>(uintptr_t(2))};
+
+    EXPECT_CALL(capi, SilKit_Experimental_RpcClient_CallBatch(mockRpcClient, testing::_, testing::_, 2))
+        .WillOnce([&](SilKit_RpcClient*, const SilKit_ByteVector* argumentData, void* const* cUserContexts, size_t) {
+        EXPECT_EQ(argumentData[0].data, bytes1.data());
+        EXPECT_EQ(argumentData[0].size, bytes1.size());
+        EXPECT_EQ(argumentData[1].data, bytes2.data());
+        EXPECT_EQ(argumentData[1].size, bytes2.size());
+        EXPECT_EQ(cUserContexts[0], userContexts[0]);
+        EXPECT_EQ(cUserContexts[1], userContexts[1]);
+        return SilKit_ReturnCode_SUCCESS;
+    });
+
+    SilKit::Experimental::Services::Rpc::CallBatch(&rpcClient, data, userContexts);
+}
+
 TEST_F(Test_HourglassRpc, SilKit_RpcClient_SetCallResultHandler)
 {
     auto* const participant = reinterpret_cast<SilKit_Participant*>(uintptr_t(123456));
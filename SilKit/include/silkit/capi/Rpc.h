@@ -204,6 +204,24 @@ typedef SilKit_ReturnCode(SilKitFPTR* SilKit_RpcClient_CallWithTimeout_t)(SilKit
                                                                           SilKit_NanosecondsTime timeout,
                                                                           void* userContext);
 
+/*! \brief Dispatch multiple calls to one or multiple corresponding RPC servers in a single message
+ *
+ * Each call is handled like a call of \ref SilKit_RpcClient_Call and yields its own call result.
+ *
+ * \param self The RPC client that should trigger the remote procedure calls.
+ * \param argumentData An array of numberOfCalls data blocks, which are transmitted to the RPC server, one per call.
+ * \param userContexts An optional array of numberOfCalls user provided context pointers, which are passed to the
+ *  result handler when the result of the corresponding call is received. May be NULL.
+ * \param numberOfCalls The number of calls in the batch.
+ */
+SilKitAPI SilKit_ReturnCode SilKitCALL SilKit_Experimental_RpcClient_CallBatch(SilKit_RpcClient* self,
+                                                                              const SilKit_ByteVector* argumentData,
+                                                                              void* const* userContexts,
+                                                                              size_t numberOfCalls);
+
+typedef SilKit_ReturnCode(SilKitFPTR* SilKit_Experimental_RpcClient_CallBatch_t)(
+    SilKit_RpcClient* self, const SilKit_ByteVector* argumentData, void* const* userContexts, size_t numberOfCalls);
+
 /*! \brief Overwrite the call result handler of this client
  * \param self The RPC client that should trigger the remote procedure call.
  * \param context A user provided context pointer that is passed to the handler on call.
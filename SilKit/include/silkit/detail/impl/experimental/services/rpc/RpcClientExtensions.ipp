@@ -0,0 +1,42 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "silkit/capi/Rpc.h"
+
+#include "silkit/detail/impl/services/rpc/RpcClient.hpp"
+
+
+namespace SilKit {
+DETAIL_SILKIT_DETAIL_VN_NAMESPACE_BEGIN
+namespace Experimental {
+namespace Services {
+namespace Rpc {
+
+void CallBatch(SilKit::Services::Rpc::IRpcClient* rpcClient,
+               SilKit::Util::Span<const SilKit::Util::Span<const uint8_t>> data,
+               SilKit::Util::Span<void* const> userContexts)
+{
+    auto& cppRpcClient = dynamic_cast<Impl::Services::Rpc::RpcClient&>(*rpcClient);
+
+    cppRpcClient.ExperimentalCallBatch(data, userContexts);
+}
+
+} // namespace Rpc
+} // namespace Services
+} // namespace Experimental
+DETAIL_SILKIT_DETAIL_VN_NAMESPACE_CLOSE
+} // namespace SilKit
+
+
+namespace SilKit {
+namespace Experimental {
+namespace Services {
+namespace Rpc {
+using SilKit::DETAIL_SILKIT_DETAIL_NAMESPACE_NAME::Experimental::Services::Rpc::CallBatch;
+} // namespace Rpc
+} // namespace Services
+} // namespace Experimental
+} // namespace SilKit
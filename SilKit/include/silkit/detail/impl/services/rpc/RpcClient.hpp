@@ -26,6 +26,8 @@
 
 #include "silkit/services/rpc/IRpcClient.hpp"
 
+#include <vector>
+
 
 namespace SilKit {
 DETAIL_SILKIT_DETAIL_VN_NAMESPACE_BEGIN
@@ -51,6 +53,9 @@ public:
 
     inline void SetCallResultHandler(SilKit::Services::Rpc::RpcCallResultHandler handler) override;
 
+    inline void ExperimentalCallBatch(SilKit::Util::Span<const SilKit::Util::Span<const uint8_t>> data,
+                                      SilKit::Util::Span<void* const> userContexts);
+
 private:
     inline static void SilKitCALL TheRpcCallResultHandler(void* context, SilKit_RpcClient* server,
                                                           const SilKit_RpcCallResultEvent* rpcCallResultEvent);
@@ -129,6 +134,26 @@ void RpcClient::CallWithTimeout(SilKit::Util::Span<const uint8_t> data, std::chr
     ThrowOnError(returnCode);
 }
 
+void RpcClient::ExperimentalCallBatch(SilKit::Util::Span<const SilKit::Util::Span<const uint8_t>> data,
+                                      SilKit::Util::Span<void* const> userContexts)
+{
+    if (!userContexts.empty() && userContexts.size() != data.size())
+    {
+        throw SilKit::SilKitError{"The number of user contexts must match the number of calls"};
+    }
+
+    std::vector<SilKit_ByteVector> cData;
+    cData.reserve(data.size());
+    for (const auto& callData : data)
+    {
+        cData.emplace_back(SilKit::Util::ToSilKitByteVector(callData));
+    }
+
+    const auto returnCode = SilKit_Experimental_RpcClient_CallBatch(
+        _rpcClient, cData.data(), userContexts.empty() ? nullptr : userContexts.data(), cData.size());
+    ThrowOnError(returnCode);
+}
+
 void RpcClient::SetCallResultHandler(SilKit::Services::Rpc::RpcCallResultHandler handler)
 {
     auto handlerData = std::make_unique<HandlerData<RpcCallResultHandler>>();
@@ -0,0 +1,47 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "silkit/services/rpc/IRpcClient.hpp"
+#include "silkit/util/Span.hpp"
+
+#include "silkit/detail/macros.hpp"
+
+
+namespace SilKit {
+DETAIL_SILKIT_DETAIL_VN_NAMESPACE_BEGIN
+namespace Experimental {
+namespace Services {
+namespace Rpc {
+
+/*! \brief Dispatch multiple calls to one or multiple corresponding RPC servers in a single message.
+ *
+ * Each call is handled like a call of \ref SilKit::Services::Rpc::IRpcClient::Call and yields its own
+ * \ref SilKit::Services::Rpc::RpcCallResultEvent in the call result handler of the client.
+ * If a server does not support receiving batches (e.g., it uses an older version of SIL Kit), the calls are
+ * dispatched individually.
+ * Only the calls are batched, the servers still send the result of each call in a message of its own.
+ *
+ * \param rpcClient The RPC client to dispatch the calls.
+ * \param data The argument data of the calls, one entry per call.
+ * \param userContexts The user contexts of the calls, which are passed to the call result handler. Either empty, or
+ *  one entry per call.
+ *
+ * \throws SilKit::SilKitError if userContexts is neither empty nor has the same size as data.
+ */
+DETAIL_SILKIT_CPP_API void CallBatch(SilKit::Services::Rpc::IRpcClient* rpcClient,
+                                     SilKit::Util::Span<const SilKit::Util::Span<const uint8_t>> data,
+                                     SilKit::Util::Span<void* const> userContexts = {});
+
+} // namespace Rpc
+} // namespace Services
+} // namespace Experimental
+DETAIL_SILKIT_DETAIL_VN_NAMESPACE_CLOSE
+} // namespace SilKit
+
+
+//! \cond DOCUMENT_HEADER_ONLY_DETAILS
+#include "silkit/detail/impl/experimental/services/rpc/RpcClientExtensions.ipp"
+//! \endcond
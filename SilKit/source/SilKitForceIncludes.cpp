@@ -22,6 +22,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "silkit/config/IParticipantConfiguration.hpp"
 #include "silkit/experimental/participant/ParticipantExtensions.hpp"
 #include "silkit/experimental/services/lin/LinControllerExtensions.hpp"
+#include "silkit/experimental/services/rpc/RpcClientExtensions.hpp"
 #include "silkit/SilKitMacros.hpp"
 
 #include "extensions/SilKitExtensionImpl/CreateMdf4Tracing.hpp"
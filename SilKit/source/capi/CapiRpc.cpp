@@ -19,6 +19,8 @@ LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
 OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
 WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
+#include "services/rpc/RpcClientExtensionsImpl.hpp"
+
 #include "silkit/capi/SilKit.h"
 #include "silkit/SilKit.hpp"
 #include "silkit/services/logging/ILogger.hpp"
@@ -33,6 +35,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include <algorithm>
 #include <map>
 #include <mutex>
+#include <vector>
 #include <cstring>
 
 
@@ -174,6 +177,36 @@ try
 }
 CAPI_CATCH_EXCEPTIONS
 
+SilKit_ReturnCode SilKitCALL SilKit_Experimental_RpcClient_CallBatch(SilKit_RpcClient* self,
+                                                                    const SilKit_ByteVector* argumentData,
+                                                                    void* const* userContexts, size_t numberOfCalls)
+try
+{
+    ASSERT_VALID_POINTER_PARAMETER(self);
+    if (numberOfCalls != 0)
+    {
+        ASSERT_VALID_POINTER_PARAMETER(argumentData);
+    }
+
+    std::vector<SilKit::Util::Span<const uint8_t>> cppArgumentData;
+    cppArgumentData.reserve(numberOfCalls);
+    for (size_t index = 0; index < numberOfCalls; ++index)
+    {
+        cppArgumentData.emplace_back(SilKit::Util::ToSpan(argumentData[index]));
+    }
+
+    SilKit::Util::Span<void* const> cppUserContexts;
+    if (userContexts != nullptr)
+    {
+        cppUserContexts = SilKit::Util::Span<void* const>{userContexts, numberOfCalls};
+    }
+
+    auto cppClient = reinterpret_cast<SilKit::Services::Rpc::IRpcClient*>(self);
+    SilKit::Experimental::Services::Rpc::CallBatchImpl(cppClient, cppArgumentData, cppUserContexts);
+    return SilKit_ReturnCode_SUCCESS;
+}
+CAPI_CATCH_EXCEPTIONS
+
 
 SilKit_ReturnCode SilKitCALL SilKit_RpcClient_SetCallResultHandler(SilKit_RpcClient* self, void* context,
                                                                    SilKit_RpcCallResultHandler_t handler)
@@ -135,6 +135,7 @@ TEST(Test_CapiSymbols, DISABLED_link_all_public_symbols)
     (void)SilKit_RpcServer_SetCallHandler(nullptr, nullptr, nullptr);
     (void)SilKit_RpcClient_Create(nullptr, nullptr, "", nullptr, nullptr, nullptr);
     (void)SilKit_RpcClient_Call(nullptr, nullptr, nullptr);
+    (void)SilKit_Experimental_RpcClient_CallBatch(nullptr, nullptr, nullptr, 0);
     (void)SilKit_RpcClient_SetCallResultHandler(nullptr, nullptr, nullptr);
     (void)SilKit_ReturnCodeToString(nullptr, SilKit_ReturnCode_BADPARAMETER);
     (void)SilKit_Participant_GetLogger(nullptr, nullptr);
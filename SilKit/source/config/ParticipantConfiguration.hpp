@@ -62,6 +62,13 @@ struct InternalController
 //  CAN controller service
 // ================================================================================
 
+//! \brief Acceptance filter of a CAN controller, a frame is accepted if (canId & mask) == (id & mask)
+struct CanAcceptanceFilter
+{
+    uint32_t id{0};
+    uint32_t mask{0};
+};
+
 //! \brief CAN controller service
 struct CanController
 {
@@ -73,6 +80,9 @@ struct CanController
     std::string name;
     SilKit::Util::Optional<std::string> network;
 
+    //! Received frames are accepted if any of the filters accepts them. Without filters, all frames are accepted.
+    std::vector<CanAcceptanceFilter> acceptanceFilters;
+
     std::vector<std::string> useTraceSinks;
     Replay replay;
 };
@@ -182,6 +192,17 @@ struct DataPublisher
     Replay replay;
 };
 
+//! \brief Content filter of a DataSubscriber, which is applied by the publishers before the data is sent
+struct DataSubscriberFilter
+{
+    //! Offset of the pattern in the serialized payload
+    uint64_t payloadOffset{0};
+    //! The payload matches if it contains these bytes at the offset, an empty pattern matches every payload
+    std::vector<uint8_t> payloadPattern;
+    //! Only every n-th matching message of a publisher is delivered
+    uint64_t decimation{1};
+};
+
 //! \brief Subscriber configuration for the Data communication service
 struct DataSubscriber
 {
@@ -193,6 +214,7 @@ struct DataSubscriber
     std::string name;
     SilKit::Util::Optional<std::string> topic;
     SilKit::Util::Optional<std::vector<Label>> labels;
+    SilKit::Util::Optional<DataSubscriberFilter> filter;
 
     std::vector<std::string> useTraceSinks;
     Replay replay;
@@ -295,6 +317,15 @@ struct Extensions
 //  VAsio Middleware
 // ================================================================================
 
+//! What a participant does with a user data message, if the send queue to another participant is full
+enum class SendQueueOverflowPolicy : uint8_t
+{
+    Block, //!< Block the sending thread until the queue is below the limits
+    DropOldest, //!< Drop the oldest queued user data messages
+    DropNewest, //!< Drop the message that is sent
+    Error, //!< Drop the message that is sent and log an error
+};
+
 struct Middleware
 {
     std::string registryUri{}; //!< Registry URI to connect to (configuration has priority)
@@ -312,6 +343,25 @@ struct Middleware
     bool experimentalRemoteParticipantConnection{true};
     //! Timeout for individual connection attempts (TCP, Local-Domain) and handshakes.
     double connectTimeoutSeconds{5.0};
+    //! Upper bound of bytes which are gathered from the send queue of a peer into a single write.
+    int maxBytesPerWrite{1024 * 1024};
+    //! Upper bound of messages which are gathered from the send queue of a peer into a single write.
+    int maxBuffersPerWrite{64};
+    //! Number of threads performing the socket I/O of the connections to other participants.
+    int ioWorkerThreads{1};
+    //! Upper bound of messages queued for sending to another participant, 0 is unlimited.
+    int sendQueueMaxMessages{0};
+    //! Upper bound of bytes queued for sending to another participant, 0 is unlimited.
+    int sendQueueMaxBytes{0};
+    //! Upper bound of user data messages handed over for sending, but not yet queued by the peers (Block overflow
+    //! policy), 0 is unlimited.
+    int sendQueueMaxPendingMessages{0};
+    //! Applied to user data messages (PubSub, RPC, CAN, and Ethernet), if the send queue is full.
+    SendQueueOverflowPolicy sendQueueOverflowPolicy{SendQueueOverflowPolicy::Block};
+    //! Transfer messages to participants on the same host through shared memory, if both sides enable it.
+    bool enableSharedMemory{false};
+    //! Capacity (in bytes) of the shared memory ring of each direction of a connection.
+    int sharedMemoryRingCapacity{1024 * 1024};
 };
 
 
@@ -319,11 +369,28 @@ struct Middleware
 //  TimeSynchronization
 // ================================================================================
 
+//! \brief Guaranteed minimum delay between a simulation step and its effect on a network
+struct MinimumReactionDelay
+{
+    std::string network;
+    std::chrono::nanoseconds delay{0};
+};
+
 //! \brief Structure that contains experimental TimeSynchronization settings
 struct TimeSynchronization
 {
     double animationFactor{0.0};
     Aggregation enableMessageAggregation{Aggregation::Off};
+    //! Aggregated messages are sent as soon as they exceed this number of bytes.
+    int messageAggregationMaxBytes{100 * 1000};
+    //! Upper bound of the time (in milliseconds) messages are held back by the aggregation.
+    int messageAggregationMaxDelayMs{50};
+    //! Messages sent in a simulation step at time t take effect at t + delay or later. The smallest delay is
+    //! advertised to the other participants, which may then execute their simulation steps ahead up to that delay.
+    std::vector<MinimumReactionDelay> minimumReactionDelays;
+    //! Name of the participant which aggregates the time synchronization. The participant with this name acts as the
+    //! aggregator, all others send their next simulation step only to it and wait for its time grants.
+    std::string aggregator;
 };
 
 // ================================================================================
@@ -378,11 +445,13 @@ struct ParticipantConfiguration : public IParticipantConfiguration
     Experimental experimental;
 };
 
+bool operator==(const CanAcceptanceFilter& lhs, const CanAcceptanceFilter& rhs);
 bool operator==(const CanController& lhs, const CanController& rhs);
 bool operator==(const LinController& lhs, const LinController& rhs);
 bool operator==(const EthernetController& lhs, const EthernetController& rhs);
 bool operator==(const FlexrayController& lhs, const FlexrayController& rhs);
 bool operator==(const DataPublisher& lhs, const DataPublisher& rhs);
+bool operator==(const DataSubscriberFilter& lhs, const DataSubscriberFilter& rhs);
 bool operator==(const DataSubscriber& lhs, const DataSubscriber& rhs);
 bool operator==(const RpcServer& lhs, const RpcServer& rhs);
 bool operator==(const RpcClient& lhs, const RpcClient& rhs);
@@ -393,12 +462,14 @@ bool operator==(const Metrics& lhs, const Metrics& rhs);
 bool operator==(const Extensions& lhs, const Extensions& rhs);
 bool operator==(const Middleware& lhs, const Middleware& rhs);
 bool operator==(const ParticipantConfiguration& lhs, const ParticipantConfiguration& rhs);
+bool operator==(const MinimumReactionDelay& lhs, const MinimumReactionDelay& rhs);
 bool operator==(const TimeSynchronization& lhs, const TimeSynchronization& rhs);
 bool operator==(const Experimental& lhs, const Experimental& rhs);
 bool operator==(const Label& lhs, const Label& rhs);
 
 auto operator<<(std::ostream& out, const Label::Kind& kind) -> std::ostream&;
 auto operator<<(std::ostream& out, const Label& label) -> std::ostream&;
+auto operator<<(std::ostream& out, const SendQueueOverflowPolicy& policy) -> std::ostream&;
 
 bool operator<(const MetricsSink& lhs, const MetricsSink& rhs);
 bool operator>(const MetricsSink& lhs, const MetricsSink& rhs);
@@ -54,6 +54,15 @@ struct MiddlewareCache
     SilKit::Util::Optional<int> connectAttempts;
     SilKit::Util::Optional<int> tcpReceiveBufferSize;
     SilKit::Util::Optional<int> tcpSendBufferSize;
+    SilKit::Util::Optional<int> maxBytesPerWrite;
+    SilKit::Util::Optional<int> maxBuffersPerWrite;
+    SilKit::Util::Optional<int> ioWorkerThreads;
+    SilKit::Util::Optional<int> sendQueueMaxMessages;
+    SilKit::Util::Optional<int> sendQueueMaxBytes;
+    SilKit::Util::Optional<int> sendQueueMaxPendingMessages;
+    SilKit::Util::Optional<SendQueueOverflowPolicy> sendQueueOverflowPolicy;
+    SilKit::Util::Optional<bool> enableSharedMemory;
+    SilKit::Util::Optional<int> sharedMemoryRingCapacity;
     SilKit::Util::Optional<bool> tcpNoDelay;
     SilKit::Util::Optional<bool> tcpQuickAck;
     SilKit::Util::Optional<bool> enableDomainSockets;
@@ -75,6 +84,10 @@ struct TimeSynchronizationCache
 {
     SilKit::Util::Optional<double> animationFactor;
     SilKit::Util::Optional<Aggregation> enableMessageAggregation;
+    SilKit::Util::Optional<int> messageAggregationMaxBytes;
+    SilKit::Util::Optional<int> messageAggregationMaxDelayMs;
+    std::map<std::string, MinimumReactionDelay> minimumReactionDelays;
+    SilKit::Util::Optional<std::string> aggregator;
 };
 
 struct MetricsCache
@@ -313,6 +326,15 @@ void CacheMiddleware(const YAML::Node& root, MiddlewareCache& cache)
     PopulateCacheField(root, "Middleware", "ExperimentalRemoteParticipantConnection",
                        cache.experimentalRemoteParticipantConnection);
     PopulateCacheField(root, "Middleware", "ConnectTimeoutSeconds", cache.connectTimeoutSeconds);
+    PopulateCacheField(root, "Middleware", "MaxBytesPerWrite", cache.maxBytesPerWrite);
+    PopulateCacheField(root, "Middleware", "MaxBuffersPerWrite", cache.maxBuffersPerWrite);
+    PopulateCacheField(root, "Middleware", "IoWorkerThreads", cache.ioWorkerThreads);
+    PopulateCacheField(root, "Middleware", "SendQueueMaxMessages", cache.sendQueueMaxMessages);
+    PopulateCacheField(root, "Middleware", "SendQueueMaxBytes", cache.sendQueueMaxBytes);
+    PopulateCacheField(root, "Middleware", "SendQueueMaxPendingMessages", cache.sendQueueMaxPendingMessages);
+    PopulateCacheField(root, "Middleware", "SendQueueOverflowPolicy", cache.sendQueueOverflowPolicy);
+    PopulateCacheField(root, "Middleware", "EnableSharedMemory", cache.enableSharedMemory);
+    PopulateCacheField(root, "Middleware", "SharedMemoryRingCapacity", cache.sharedMemoryRingCapacity);
 }
 
 void CacheLoggingOptions(const YAML::Node& root, GlobalLogCache& cache)
@@ -377,6 +399,29 @@ void CacheTimeSynchronization(const YAML::Node& root, TimeSynchronizationCache&
 {
     PopulateCacheField(root, "TimeSynchronization", "AnimationFactor", cache.animationFactor);
     PopulateCacheField(root, "TimeSynchronization", "EnableMessageAggregation", cache.enableMessageAggregation);
+    PopulateCacheField(root, "TimeSynchronization", "MessageAggregationMaxBytes", cache.messageAggregationMaxBytes);
+    PopulateCacheField(root, "TimeSynchronization", "MessageAggregationMaxDelayMs", cache.messageAggregationMaxDelayMs);
+    PopulateCacheField(root, "TimeSynchronization", "Aggregator", cache.aggregator);
+
+    if (root["MinimumReactionDelays"])
+    {
+        for (const auto& delayNode : root["MinimumReactionDelays"])
+        {
+            auto minimumReactionDelay = parse_as<MinimumReactionDelay>(delayNode);
+            auto it = cache.minimumReactionDelays.find(minimumReactionDelay.network);
+            if (it == cache.minimumReactionDelays.end())
+            {
+                cache.minimumReactionDelays.emplace(minimumReactionDelay.network, minimumReactionDelay);
+            }
+            else if (!(it->second == minimumReactionDelay))
+            {
+                std::stringstream error_msg;
+                error_msg << "MinimumReactionDelay of network " << minimumReactionDelay.network
+                          << " already set to " << it->second.delay.count() << "ns!";
+                throw SilKit::ConfigurationError(error_msg.str());
+            }
+        }
+    }
 }
 
 void CacheMetrics(const YAML::Node& root, MetricsCache& cache)
@@ -530,6 +575,15 @@ void MergeMiddleware(const MiddlewareCache& cache, Middleware& middleware)
     MergeCacheField(cache.registryAsFallbackProxy, middleware.registryAsFallbackProxy);
     MergeCacheField(cache.experimentalRemoteParticipantConnection, middleware.experimentalRemoteParticipantConnection);
     MergeCacheField(cache.connectTimeoutSeconds, middleware.connectTimeoutSeconds);
+    MergeCacheField(cache.maxBytesPerWrite, middleware.maxBytesPerWrite);
+    MergeCacheField(cache.maxBuffersPerWrite, middleware.maxBuffersPerWrite);
+    MergeCacheField(cache.ioWorkerThreads, middleware.ioWorkerThreads);
+    MergeCacheField(cache.sendQueueMaxMessages, middleware.sendQueueMaxMessages);
+    MergeCacheField(cache.sendQueueMaxBytes, middleware.sendQueueMaxBytes);
+    MergeCacheField(cache.sendQueueMaxPendingMessages, middleware.sendQueueMaxPendingMessages);
+    MergeCacheField(cache.sendQueueOverflowPolicy, middleware.sendQueueOverflowPolicy);
+    MergeCacheField(cache.enableSharedMemory, middleware.enableSharedMemory);
+    MergeCacheField(cache.sharedMemoryRingCapacity, middleware.sharedMemoryRingCapacity);
 
     middleware.acceptorUris = cache.acceptorUris;
 }
@@ -555,6 +609,13 @@ void MergeTimeSynchronizationCache(const TimeSynchronizationCache& cache, TimeSy
 {
     MergeCacheField(cache.animationFactor, timeSynchronization.animationFactor);
     MergeCacheField(cache.enableMessageAggregation, timeSynchronization.enableMessageAggregation);
+    MergeCacheField(cache.messageAggregationMaxBytes, timeSynchronization.messageAggregationMaxBytes);
+    MergeCacheField(cache.messageAggregationMaxDelayMs, timeSynchronization.messageAggregationMaxDelayMs);
+    MergeCacheField(cache.aggregator, timeSynchronization.aggregator);
+    for (const auto& kv : cache.minimumReactionDelays)
+    {
+        timeSynchronization.minimumReactionDelays.push_back(kv.second);
+    }
 }
 
 void MergeMetricsCache(const MetricsCache& cache, Metrics& metrics)
@@ -704,10 +765,15 @@ auto ParticipantConfigurationFromXImpl(const std::string& text,
 // ================================================================================
 //  Implementation data types
 // ================================================================================
+bool operator==(const CanAcceptanceFilter& lhs, const CanAcceptanceFilter& rhs)
+{
+    return lhs.id == rhs.id && lhs.mask == rhs.mask;
+}
+
 bool operator==(const CanController& lhs, const CanController& rhs)
 {
-    return lhs.name == rhs.name && lhs.network == rhs.network && lhs.replay == rhs.replay
-           && lhs.useTraceSinks == rhs.useTraceSinks;
+    return lhs.name == rhs.name && lhs.network == rhs.network && lhs.acceptanceFilters == rhs.acceptanceFilters
+           && lhs.replay == rhs.replay && lhs.useTraceSinks == rhs.useTraceSinks;
 }
 
 bool operator==(const LinController& lhs, const LinController& rhs)
@@ -734,9 +800,15 @@ bool operator==(const DataPublisher& lhs, const DataPublisher& rhs)
     return lhs.useTraceSinks == rhs.useTraceSinks && lhs.replay == rhs.replay;
 }
 
+bool operator==(const DataSubscriberFilter& lhs, const DataSubscriberFilter& rhs)
+{
+    return lhs.payloadOffset == rhs.payloadOffset && lhs.payloadPattern == rhs.payloadPattern
+           && lhs.decimation == rhs.decimation;
+}
+
 bool operator==(const DataSubscriber& lhs, const DataSubscriber& rhs)
 {
-    return lhs.useTraceSinks == rhs.useTraceSinks && lhs.replay == rhs.replay;
+    return lhs.filter == rhs.filter && lhs.useTraceSinks == rhs.useTraceSinks && lhs.replay == rhs.replay;
 }
 
 bool operator==(const RpcServer& lhs, const RpcServer& rhs)
@@ -780,7 +852,14 @@ bool operator==(const Middleware& lhs, const Middleware& rhs)
     return lhs.registryUri == rhs.registryUri && lhs.connectAttempts == rhs.connectAttempts
            && lhs.enableDomainSockets == rhs.enableDomainSockets && lhs.tcpNoDelay == rhs.tcpNoDelay
            && lhs.tcpQuickAck == rhs.tcpQuickAck && lhs.tcpReceiveBufferSize == rhs.tcpReceiveBufferSize
-           && lhs.tcpSendBufferSize == rhs.tcpSendBufferSize && lhs.acceptorUris == rhs.acceptorUris;
+           && lhs.tcpSendBufferSize == rhs.tcpSendBufferSize && lhs.acceptorUris == rhs.acceptorUris
+           && lhs.maxBytesPerWrite == rhs.maxBytesPerWrite && lhs.maxBuffersPerWrite == rhs.maxBuffersPerWrite
+           && lhs.ioWorkerThreads == rhs.ioWorkerThreads && lhs.sendQueueMaxMessages == rhs.sendQueueMaxMessages
+           && lhs.sendQueueMaxBytes == rhs.sendQueueMaxBytes
+           && lhs.sendQueueMaxPendingMessages == rhs.sendQueueMaxPendingMessages
+           && lhs.sendQueueOverflowPolicy == rhs.sendQueueOverflowPolicy
+           && lhs.enableSharedMemory == rhs.enableSharedMemory
+           && lhs.sharedMemoryRingCapacity == rhs.sharedMemoryRingCapacity;
 }
 
 bool operator==(const ParticipantConfiguration& lhs, const ParticipantConfiguration& rhs)
@@ -793,9 +872,17 @@ bool operator==(const ParticipantConfiguration& lhs, const ParticipantConfigurat
            && lhs.tracing == rhs.tracing && lhs.extensions == rhs.extensions && lhs.experimental == rhs.experimental;
 }
 
+bool operator==(const MinimumReactionDelay& lhs, const MinimumReactionDelay& rhs)
+{
+    return lhs.network == rhs.network && lhs.delay == rhs.delay;
+}
+
 bool operator==(const TimeSynchronization& lhs, const TimeSynchronization& rhs)
 {
-    return lhs.animationFactor == rhs.animationFactor && lhs.enableMessageAggregation == rhs.enableMessageAggregation;
+    return lhs.animationFactor == rhs.animationFactor && lhs.enableMessageAggregation == rhs.enableMessageAggregation
+           && lhs.messageAggregationMaxBytes == rhs.messageAggregationMaxBytes
+           && lhs.messageAggregationMaxDelayMs == rhs.messageAggregationMaxDelayMs
+           && lhs.minimumReactionDelays == rhs.minimumReactionDelays && lhs.aggregator == rhs.aggregator;
 }
 
 bool operator==(const Experimental& lhs, const Experimental& rhs)
@@ -836,6 +923,23 @@ auto operator<<(std::ostream& out, const Label& label) -> std::ostream&
     return out << "MatchingLabel{" << label.key << ", " << label.value << ", " << label.kind << "}";
 }
 
+auto operator<<(std::ostream& out, const SendQueueOverflowPolicy& policy) -> std::ostream&
+{
+    switch (policy)
+    {
+    case SendQueueOverflowPolicy::Block:
+        return out << "Block";
+    case SendQueueOverflowPolicy::DropOldest:
+        return out << "DropOldest";
+    case SendQueueOverflowPolicy::DropNewest:
+        return out << "DropNewest";
+    case SendQueueOverflowPolicy::Error:
+        return out << "Error";
+    default:
+        return out << "SendQueueOverflowPolicy(" << static_cast<int>(policy) << ")";
+    }
+}
+
 } // namespace v1
 
 
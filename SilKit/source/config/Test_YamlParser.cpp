@@ -59,6 +59,9 @@ CanControllers:
   - Sink1
 - Name: MyCAN2
   Network: CAN2
+  AcceptanceFilters:
+  - Id: 256
+    Mask: 1792
 LinControllers:
 - Name: SimpleEcu1_LIN1
   Network: LIN1
@@ -163,6 +166,10 @@ DataPublishers:
 DataSubscribers:
 - Name: Subscriber1
   Topic: Temperature
+  Filter:
+    PayloadOffset: 4
+    PayloadPattern: [0x01, 255]
+    Decimation: 100
   UseTraceSinks:
   - Sink1
 RpcServers:
@@ -223,6 +230,10 @@ TEST_F(Test_YamlParser, yaml_complete_configuration)
     EXPECT_TRUE(config.canControllers.at(1).name == "MyCAN2");
     EXPECT_TRUE(config.canControllers.at(1).network.has_value()
                 && config.canControllers.at(1).network.value() == "CAN2");
+    EXPECT_TRUE(config.canControllers.at(0).acceptanceFilters.empty());
+    EXPECT_TRUE(config.canControllers.at(1).acceptanceFilters.size() == 1);
+    EXPECT_TRUE(config.canControllers.at(1).acceptanceFilters.at(0).id == 0x100);
+    EXPECT_TRUE(config.canControllers.at(1).acceptanceFilters.at(0).mask == 0x700);
 
     EXPECT_TRUE(config.linControllers.size() == 1);
     EXPECT_TRUE(config.linControllers.at(0).name == "SimpleEcu1_LIN1");
@@ -238,6 +249,12 @@ TEST_F(Test_YamlParser, yaml_complete_configuration)
     EXPECT_TRUE(config.dataPublishers.at(0).topic.has_value()
                 && config.dataPublishers.at(0).topic.value() == "Temperature");
 
+    EXPECT_TRUE(config.dataSubscribers.size() == 1);
+    EXPECT_TRUE(config.dataSubscribers.at(0).filter.has_value());
+    EXPECT_TRUE(config.dataSubscribers.at(0).filter.value().payloadOffset == 4);
+    EXPECT_TRUE(config.dataSubscribers.at(0).filter.value().payloadPattern == (std::vector<uint8_t>{0x01, 0xFF}));
+    EXPECT_TRUE(config.dataSubscribers.at(0).filter.value().decimation == 100);
+
     EXPECT_TRUE(config.logging.sinks.size() == 1);
     EXPECT_TRUE(config.logging.sinks.at(0).type == Sink::Type::File);
     EXPECT_TRUE(config.logging.sinks.at(0).level == SilKit::Services::Logging::Level::Critical);
@@ -364,7 +381,16 @@ TEST_F(Test_YamlParser, middleware_convert)
             "TcpSendBufferSize": 3456,
             "TcpReceiveBufferSize": 3456,
             "EnableDomainSockets": false,
-            "RegistryAsFallbackProxy": false
+            "RegistryAsFallbackProxy": false,
+            "MaxBytesPerWrite": 4096,
+            "MaxBuffersPerWrite": 16,
+            "IoWorkerThreads": 4,
+            "SendQueueMaxMessages": 1000,
+            "SendQueueMaxBytes": 1048576,
+            "SendQueueMaxPendingMessages": 100,
+            "SendQueueOverflowPolicy": "DropOldest",
+            "EnableSharedMemory": true,
+            "SharedMemoryRingCapacity": 65536
         }
     )");
     auto config = node.as<Middleware>();
@@ -377,6 +403,41 @@ TEST_F(Test_YamlParser, middleware_convert)
     EXPECT_EQ(config.tcpSendBufferSize, 3456);
     EXPECT_EQ(config.tcpReceiveBufferSize, 3456);
     EXPECT_EQ(config.registryAsFallbackProxy, false);
+    EXPECT_EQ(config.maxBytesPerWrite, 4096);
+    EXPECT_EQ(config.maxBuffersPerWrite, 16);
+    EXPECT_EQ(config.ioWorkerThreads, 4);
+    EXPECT_EQ(config.sendQueueMaxMessages, 1000);
+    EXPECT_EQ(config.sendQueueMaxBytes, 1048576);
+    EXPECT_EQ(config.sendQueueMaxPendingMessages, 100);
+    EXPECT_EQ(config.sendQueueOverflowPolicy, SendQueueOverflowPolicy::DropOldest);
+    EXPECT_EQ(config.enableSharedMemory, true);
+    EXPECT_EQ(config.sharedMemoryRingCapacity, 65536);
+}
+
+TEST_F(Test_YamlParser, time_synchronization_convert)
+{
+    auto node = YAML::Load(R"(
+        {
+            "AnimationFactor": 1.5,
+            "MinimumReactionDelays": [
+                { "Network": "CAN1", "DelayNs": 1000000 },
+                { "Network": "ETH1", "DelayNs": 50000 }
+            ],
+            "Aggregator": "TimeSyncAggregator"
+        }
+    )");
+    auto config = node.as<TimeSynchronization>();
+    EXPECT_EQ(config.animationFactor, 1.5);
+    ASSERT_EQ(config.minimumReactionDelays.size(), 2u);
+    EXPECT_EQ(config.minimumReactionDelays[0].network, "CAN1");
+    EXPECT_EQ(config.minimumReactionDelays[0].delay, std::chrono::milliseconds{1});
+    EXPECT_EQ(config.minimumReactionDelays[1].network, "ETH1");
+    EXPECT_EQ(config.minimumReactionDelays[1].delay, std::chrono::microseconds{50});
+    EXPECT_EQ(config.aggregator, "TimeSyncAggregator");
+
+    YAML::Node node2;
+    node2 = config;
+    EXPECT_TRUE(config == node2.as<TimeSynchronization>());
 }
 
 TEST_F(Test_YamlParser, map_serdes)
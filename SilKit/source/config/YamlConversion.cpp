@@ -357,6 +357,22 @@ bool Converter::decode(const Node& node, Replay::Direction& obj)
     return true;
 }
 
+template <>
+Node Converter::encode(const CanAcceptanceFilter& obj)
+{
+    Node node;
+    node["Id"] = obj.id;
+    node["Mask"] = obj.mask;
+    return node;
+}
+template <>
+bool Converter::decode(const Node& node, CanAcceptanceFilter& obj)
+{
+    obj.id = parse_as<uint32_t>(node["Id"]);
+    obj.mask = parse_as<uint32_t>(node["Mask"]);
+    return true;
+}
+
 template <>
 Node Converter::encode(const CanController& obj)
 {
@@ -364,6 +380,7 @@ Node Converter::encode(const CanController& obj)
     Node node;
     node["Name"] = obj.name;
     optional_encode(obj.network, node, "Network");
+    optional_encode(obj.acceptanceFilters, node, "AcceptanceFilters");
     optional_encode(obj.useTraceSinks, node, "UseTraceSinks");
     optional_encode(obj.replay, node, "Replay");
     return node;
@@ -373,6 +390,7 @@ bool Converter::decode(const Node& node, CanController& obj)
 {
     obj.name = parse_as<std::string>(node["Name"]);
     optional_decode(obj.network, node, "Network");
+    optional_decode(obj.acceptanceFilters, node, "AcceptanceFilters");
     optional_decode(obj.useTraceSinks, node, "UseTraceSinks");
     optional_decode(obj.replay, node, "Replay");
     return true;
@@ -787,6 +805,45 @@ bool Converter::decode(const Node& node, DataPublisher& obj)
     return true;
 }
 
+template <>
+Node Converter::encode(const DataSubscriberFilter& obj)
+{
+    static const DataSubscriberFilter defaultObj{};
+    Node node;
+    non_default_encode(obj.payloadOffset, node, "PayloadOffset", defaultObj.payloadOffset);
+    if (!obj.payloadPattern.empty())
+    {
+        // encode the bytes as integers, not as characters
+        node["PayloadPattern"] = std::vector<uint32_t>{obj.payloadPattern.begin(), obj.payloadPattern.end()};
+    }
+    non_default_encode(obj.decimation, node, "Decimation", defaultObj.decimation);
+    return node;
+}
+template <>
+bool Converter::decode(const Node& node, DataSubscriberFilter& obj)
+{
+    optional_decode(obj.payloadOffset, node, "PayloadOffset");
+    if (node.IsMap() && node["PayloadPattern"])
+    {
+        obj.payloadPattern.clear();
+        for (const auto value : parse_as<std::vector<uint32_t>>(node["PayloadPattern"]))
+        {
+            if (value > 0xFF)
+            {
+                throw ConversionError(node["PayloadPattern"], "DataSubscriber::Filter::PayloadPattern must only "
+                                                              "contain byte values in the range [0, 255].");
+            }
+            obj.payloadPattern.push_back(static_cast<uint8_t>(value));
+        }
+    }
+    optional_decode(obj.decimation, node, "Decimation");
+    if (obj.decimation == 0)
+    {
+        throw ConversionError(node, "DataSubscriber::Filter::Decimation must be at least 1.");
+    }
+    return true;
+}
+
 template <>
 Node Converter::encode(const DataSubscriber& obj)
 {
@@ -795,6 +852,7 @@ Node Converter::encode(const DataSubscriber& obj)
     node["Name"] = obj.name;
     optional_encode(obj.topic, node, "Topic");
     optional_encode(obj.labels, node, "Labels");
+    optional_encode(obj.filter, node, "Filter");
     optional_encode(obj.useTraceSinks, node, "UseTraceSinks");
     optional_encode(obj.replay, node, "Replay");
     return node;
@@ -805,6 +863,7 @@ bool Converter::decode(const Node& node, DataSubscriber& obj)
     obj.name = parse_as<std::string>(node["Name"]);
     optional_decode(obj.topic, node, "Topic");
     optional_decode(obj.labels, node, "Labels");
+    optional_decode(obj.filter, node, "Filter");
     optional_decode(obj.useTraceSinks, node, "UseTraceSinks");
     optional_decode(obj.replay, node, "Replay");
     return true;
@@ -1127,6 +1186,48 @@ bool Converter::decode(const Node& node, Extensions& obj)
 }
 
 
+template <>
+Node Converter::encode(const SendQueueOverflowPolicy& obj)
+{
+    Node node;
+    switch (obj)
+    {
+    case SendQueueOverflowPolicy::Block:
+        node = "Block";
+        break;
+    case SendQueueOverflowPolicy::DropOldest:
+        node = "DropOldest";
+        break;
+    case SendQueueOverflowPolicy::DropNewest:
+        node = "DropNewest";
+        break;
+    case SendQueueOverflowPolicy::Error:
+        node = "Error";
+        break;
+    default:
+        throw ConfigurationError{"Unknown SendQueueOverflowPolicy"};
+    }
+    return node;
+}
+template <>
+bool Converter::decode(const Node& node, SendQueueOverflowPolicy& obj)
+{
+    auto&& str = parse_as<std::string>(node);
+    if (str == "Block" || str == "")
+        obj = SendQueueOverflowPolicy::Block;
+    else if (str == "DropOldest")
+        obj = SendQueueOverflowPolicy::DropOldest;
+    else if (str == "DropNewest")
+        obj = SendQueueOverflowPolicy::DropNewest;
+    else if (str == "Error")
+        obj = SendQueueOverflowPolicy::Error;
+    else
+    {
+        throw ConversionError(node, "Unknown SendQueueOverflowPolicy: " + str + ".");
+    }
+    return true;
+}
+
 template <>
 Node Converter::encode(const Middleware& obj)
 {
@@ -1145,6 +1246,18 @@ Node Converter::encode(const Middleware& obj)
     non_default_encode(obj.experimentalRemoteParticipantConnection, node, "ExperimentalRemoteParticipantConnection",
                        defaultObj.experimentalRemoteParticipantConnection);
     non_default_encode(obj.connectTimeoutSeconds, node, "ConnectTimeoutSeconds", defaultObj.connectTimeoutSeconds);
+    non_default_encode(obj.maxBytesPerWrite, node, "MaxBytesPerWrite", defaultObj.maxBytesPerWrite);
+    non_default_encode(obj.maxBuffersPerWrite, node, "MaxBuffersPerWrite", defaultObj.maxBuffersPerWrite);
+    non_default_encode(obj.ioWorkerThreads, node, "IoWorkerThreads", defaultObj.ioWorkerThreads);
+    non_default_encode(obj.sendQueueMaxMessages, node, "SendQueueMaxMessages", defaultObj.sendQueueMaxMessages);
+    non_default_encode(obj.sendQueueMaxBytes, node, "SendQueueMaxBytes", defaultObj.sendQueueMaxBytes);
+    non_default_encode(obj.sendQueueMaxPendingMessages, node, "SendQueueMaxPendingMessages",
+                       defaultObj.sendQueueMaxPendingMessages);
+    non_default_encode(obj.sendQueueOverflowPolicy, node, "SendQueueOverflowPolicy",
+                       defaultObj.sendQueueOverflowPolicy);
+    non_default_encode(obj.enableSharedMemory, node, "EnableSharedMemory", defaultObj.enableSharedMemory);
+    non_default_encode(obj.sharedMemoryRingCapacity, node, "SharedMemoryRingCapacity",
+                       defaultObj.sharedMemoryRingCapacity);
     return node;
 }
 template <>
@@ -1161,6 +1274,15 @@ bool Converter::decode(const Node& node, Middleware& obj)
     optional_decode(obj.registryAsFallbackProxy, node, "RegistryAsFallbackProxy");
     optional_decode(obj.experimentalRemoteParticipantConnection, node, "ExperimentalRemoteParticipantConnection");
     optional_decode(obj.connectTimeoutSeconds, node, "ConnectTimeoutSeconds");
+    optional_decode(obj.maxBytesPerWrite, node, "MaxBytesPerWrite");
+    optional_decode(obj.maxBuffersPerWrite, node, "MaxBuffersPerWrite");
+    optional_decode(obj.ioWorkerThreads, node, "IoWorkerThreads");
+    optional_decode(obj.sendQueueMaxMessages, node, "SendQueueMaxMessages");
+    optional_decode(obj.sendQueueMaxBytes, node, "SendQueueMaxBytes");
+    optional_decode(obj.sendQueueMaxPendingMessages, node, "SendQueueMaxPendingMessages");
+    optional_decode(obj.sendQueueOverflowPolicy, node, "SendQueueOverflowPolicy");
+    optional_decode(obj.enableSharedMemory, node, "EnableSharedMemory");
+    optional_decode(obj.sharedMemoryRingCapacity, node, "SharedMemoryRingCapacity");
     return true;
 }
 
@@ -1201,6 +1323,22 @@ bool Converter::decode(const Node& node, Aggregation& obj)
     return true;
 }
 
+template <>
+Node Converter::encode(const MinimumReactionDelay& obj)
+{
+    Node node;
+    node["Network"] = obj.network;
+    node["DelayNs"] = obj.delay;
+    return node;
+}
+template <>
+bool Converter::decode(const Node& node, MinimumReactionDelay& obj)
+{
+    obj.network = parse_as<std::string>(node["Network"]);
+    obj.delay = parse_as<std::chrono::nanoseconds>(node["DelayNs"]);
+    return true;
+}
+
 template <>
 Node Converter::encode(const TimeSynchronization& obj)
 {
@@ -1209,6 +1347,12 @@ Node Converter::encode(const TimeSynchronization& obj)
     non_default_encode(obj.animationFactor, node, "AnimationFactor", defaultObj.animationFactor);
     non_default_encode(obj.enableMessageAggregation, node, "EnableMessageAggregation",
                        defaultObj.enableMessageAggregation);
+    non_default_encode(obj.messageAggregationMaxBytes, node, "MessageAggregationMaxBytes",
+                       defaultObj.messageAggregationMaxBytes);
+    non_default_encode(obj.messageAggregationMaxDelayMs, node, "MessageAggregationMaxDelayMs",
+                       defaultObj.messageAggregationMaxDelayMs);
+    optional_encode(obj.minimumReactionDelays, node, "MinimumReactionDelays");
+    non_default_encode(obj.aggregator, node, "Aggregator", defaultObj.aggregator);
     return node;
 }
 template <>
@@ -1216,6 +1360,10 @@ bool Converter::decode(const Node& node, TimeSynchronization& obj)
 {
     optional_decode(obj.animationFactor, node, "AnimationFactor");
     optional_decode(obj.enableMessageAggregation, node, "EnableMessageAggregation");
+    optional_decode(obj.messageAggregationMaxBytes, node, "MessageAggregationMaxBytes");
+    optional_decode(obj.messageAggregationMaxDelayMs, node, "MessageAggregationMaxDelayMs");
+    optional_decode(obj.minimumReactionDelays, node, "MinimumReactionDelays");
+    optional_decode(obj.aggregator, node, "Aggregator");
     return true;
 }
 
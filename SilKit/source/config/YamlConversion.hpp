@@ -48,6 +48,7 @@ DEFINE_SILKIT_CONVERT(MdfChannel);
 DEFINE_SILKIT_CONVERT(Replay);
 DEFINE_SILKIT_CONVERT(Replay::Direction);
 
+DEFINE_SILKIT_CONVERT(CanAcceptanceFilter);
 DEFINE_SILKIT_CONVERT(CanController);
 
 DEFINE_SILKIT_CONVERT(LinController);
@@ -69,6 +70,7 @@ DEFINE_SILKIT_CONVERT(SilKit::Services::MatchingLabel);
 DEFINE_SILKIT_CONVERT(Label::Kind);
 DEFINE_SILKIT_CONVERT(Label);
 DEFINE_SILKIT_CONVERT(DataPublisher);
+DEFINE_SILKIT_CONVERT(DataSubscriberFilter);
 DEFINE_SILKIT_CONVERT(DataSubscriber);
 DEFINE_SILKIT_CONVERT(RpcServer);
 DEFINE_SILKIT_CONVERT(RpcClient);
@@ -85,11 +87,13 @@ DEFINE_SILKIT_CONVERT(MetricsSink);
 DEFINE_SILKIT_CONVERT(MetricsSink::Type);
 DEFINE_SILKIT_CONVERT(Metrics);
 
+DEFINE_SILKIT_CONVERT(SendQueueOverflowPolicy);
 DEFINE_SILKIT_CONVERT(Middleware);
 
 DEFINE_SILKIT_CONVERT(Extensions);
 
 DEFINE_SILKIT_CONVERT(Experimental);
+DEFINE_SILKIT_CONVERT(MinimumReactionDelay);
 DEFINE_SILKIT_CONVERT(TimeSynchronization);
 DEFINE_SILKIT_CONVERT(Aggregation);
 
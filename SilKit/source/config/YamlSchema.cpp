@@ -148,7 +148,14 @@ auto MakeYamlSchema() -> YamlSchemaElem
         {"Description"},
         {"ParticipantName"},
         {"Includes", {{"SearchPathHints"}, {"Files"}}},
-        {"CanControllers", {{"Name"}, {"Network"}, {"UseTraceSinks"}, replay}},
+        {"CanControllers",
+         {
+             {"Name"},
+             {"Network"},
+             {"AcceptanceFilters", {{"Id"}, {"Mask"}}},
+             {"UseTraceSinks"},
+             replay,
+         }},
         {"LinControllers", {{"Name"}, {"Network"}, {"UseTraceSinks"}, replay}},
         {"FlexrayControllers", flexrayControllerElements},
         {"FlexRayControllers", flexrayControllerElements}, // deprecated (renamed to FlexrayControllers)
@@ -166,6 +173,7 @@ auto MakeYamlSchema() -> YamlSchemaElem
              {"Name"},
              {"Topic"},
              {"Labels"},
+             {"Filter", {{"PayloadOffset"}, {"PayloadPattern"}, {"Decimation"}}},
              {"UseTraceSinks"},
              replay,
          }},
@@ -206,10 +214,29 @@ auto MakeYamlSchema() -> YamlSchemaElem
              {"RegistryAsFallbackProxy"},
              {"ExperimentalRemoteParticipantConnection"},
              {"ConnectTimeoutSeconds"},
+             {"MaxBytesPerWrite"},
+             {"MaxBuffersPerWrite"},
+             {"IoWorkerThreads"},
+             {"SendQueueMaxMessages"},
+             {"SendQueueMaxBytes"},
+             {"SendQueueMaxPendingMessages"},
+             {"SendQueueOverflowPolicy"},
+             {"EnableSharedMemory"},
+             {"SharedMemoryRingCapacity"},
          }},
         {"Experimental",
          {
-             {"TimeSynchronization", {{"AnimationFactor"}, {"EnableMessageAggregation"}}},
+             {"TimeSynchronization",
+              {{"AnimationFactor"},
+               {"EnableMessageAggregation"},
+               {"MessageAggregationMaxBytes"},
+               {"MessageAggregationMaxDelayMs"},
+               {"MinimumReactionDelays",
+                {
+                    {"Network"},
+                    {"DelayNs"},
+                }},
+               {"Aggregator"}}},
              {"Metrics",
               {
                   metricsSinks,
@@ -22,6 +22,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #pragma once
 
 #include <atomic>
+#include <map>
 
 #include "silkit/participant/IParticipant.hpp"
 #include "silkit/experimental/services/orchestration/ISystemController.hpp"
@@ -152,12 +153,16 @@ public:
 
     virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const Services::Rpc::FunctionCall& msg) = 0;
     virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, Services::Rpc::FunctionCall&& msg) = 0;
+    virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const Services::Rpc::FunctionCallBatch& msg) = 0;
+    virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, Services::Rpc::FunctionCallBatch&& msg) = 0;
     virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from,
                          const Services::Rpc::FunctionCallResponse& msg) = 0;
     virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, Services::Rpc::FunctionCallResponse&& msg) = 0;
 
     virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from,
                          const Services::Orchestration::NextSimTask& msg) = 0;
+    virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from,
+                         const Services::Orchestration::UserDataMessageCounts& msg) = 0;
     virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from,
                          const Services::Orchestration::ParticipantStatus& msg) = 0;
     virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from,
@@ -167,8 +172,11 @@ public:
 
     virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const Services::Logging::LogMsg& msg) = 0;
     virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, Services::Logging::LogMsg&& msg) = 0;
+    virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const Services::Logging::LogMsgBatch& msg) = 0;
+    virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, Services::Logging::LogMsgBatch&& msg) = 0;
 
     virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const VSilKit::MetricsUpdate& msg) = 0;
+    virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const VSilKit::WireMetricsUpdate& msg) = 0;
 
     virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from,
                          const Discovery::ParticipantDiscoveryEvent& msg) = 0;
@@ -242,6 +250,10 @@ public:
                          const Services::Rpc::FunctionCall& msg) = 0;
     virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const std::string& targetParticipantName,
                          Services::Rpc::FunctionCall&& msg) = 0;
+    virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const std::string& targetParticipantName,
+                         const Services::Rpc::FunctionCallBatch& msg) = 0;
+    virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const std::string& targetParticipantName,
+                         Services::Rpc::FunctionCallBatch&& msg) = 0;
     virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const std::string& targetParticipantName,
                          const Services::Rpc::FunctionCallResponse& msg) = 0;
     virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const std::string& targetParticipantName,
@@ -249,6 +261,8 @@ public:
 
     virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const std::string& targetParticipantName,
                          const Services::Orchestration::NextSimTask& msg) = 0;
+    virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const std::string& targetParticipantName,
+                         const Services::Orchestration::UserDataMessageCounts& msg) = 0;
     virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const std::string& targetParticipantName,
                          const Services::Orchestration::ParticipantStatus& msg) = 0;
     virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const std::string& targetParticipantName,
@@ -260,9 +274,15 @@ public:
                          const Services::Logging::LogMsg& msg) = 0;
     virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const std::string& targetParticipantName,
                          Services::Logging::LogMsg&& msg) = 0;
+    virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const std::string& targetParticipantName,
+                         const Services::Logging::LogMsgBatch& msg) = 0;
+    virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const std::string& targetParticipantName,
+                         Services::Logging::LogMsgBatch&& msg) = 0;
 
     virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const std::string& targetParticipantName,
                          const VSilKit::MetricsUpdate& msg) = 0;
+    virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const std::string& targetParticipantName,
+                         const VSilKit::WireMetricsUpdate& msg) = 0;
 
     virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const std::string& targetParticipantName,
                          const Discovery::ParticipantDiscoveryEvent& msg) = 0;
@@ -331,6 +351,23 @@ public:
     virtual size_t GetNumberOfRemoteReceivers(const IServiceEndpoint* service, const std::string& msgTypeName) = 0;
     virtual std::vector<std::string> GetParticipantNamesOfRemoteReceivers(const IServiceEndpoint* service,
                                                                           const std::string& msgTypeName) = 0;
+    //! Number of user data messages sent to each participant since it connected, for the participants whose number
+    //! changed since the last call (counted only if the time synchronization is aggregated). The counted messages are
+    //! no longer held back or dropped by the send queue. Must be called on the I/O thread, e.g., in a deferred
+    //! execution.
+    virtual std::map<std::string, uint64_t> TakeSentUserDataMessageCounts() = 0;
+    //! Calls the handler on the I/O thread once the given number of user data messages has been received from each of
+    //! the participants since it connected, or it disconnected. A handler which has not been called yet is replaced.
+    //! Must be called on the I/O thread.
+    virtual void AwaitReceivedUserDataMessages(std::map<std::string, uint64_t> counts,
+                                               std::function<void()> handler) = 0;
+    //! Hold back the user data messages received from the participant from now on, until a simulation step after
+    //! the release time point is executed. Must be called on the I/O thread.
+    virtual void DelayReceivedUserDataMessages(const std::string& participantName,
+                                               std::chrono::nanoseconds releaseTimePoint) = 0;
+    //! Deliver the held back user data messages with a release time point before the time point, ordered by the release
+    //! time point and the name of the sender. Must be called on the I/O thread.
+    virtual void ReleaseReceivedUserDataMessages(std::chrono::nanoseconds timePoint) = 0;
 
     virtual void NotifyShutdown() = 0;
     virtual void EvaluateAggregationInfo(bool isSyncSimStepHandler) = 0;
@@ -57,8 +57,21 @@ struct LogMsg
     std::vector<std::pair<std::string, std::string>> keyValues;
 };
 
+/*! \brief Log entries of a single logger, which are sent together
+ *
+ * The logger name is transmitted only once for all entries of the batch.
+ */
+struct LogMsgBatch
+{
+    std::string loggerName;
+    //! Number of log entries which were dropped by the sender since the previous batch
+    uint64_t droppedCount{0};
+    std::vector<LogMsg> msgs;
+};
+
 inline bool operator==(const SourceLoc& lhs, const SourceLoc& rhs);
 inline bool operator==(const LogMsg& lhs, const LogMsg& rhs);
+inline bool operator==(const LogMsgBatch& lhs, const LogMsgBatch& rhs);
 
 inline std::string to_string(const SourceLoc& sourceLoc);
 inline std::ostream& operator<<(std::ostream& out, const SourceLoc& sourceLoc);
@@ -66,6 +79,9 @@ inline std::ostream& operator<<(std::ostream& out, const SourceLoc& sourceLoc);
 inline std::string to_string(const LogMsg& msg);
 inline std::ostream& operator<<(std::ostream& out, const LogMsg& msg);
 
+inline std::string to_string(const LogMsgBatch& msg);
+inline std::ostream& operator<<(std::ostream& out, const LogMsgBatch& msg);
+
 
 inline std::string to_string(const std::vector<std::pair<std::string, std::string>>& kv);
 inline std::ostream& operator<<(std::ostream& out, const std::vector<std::pair<std::string, std::string>>& kv);
@@ -85,6 +101,11 @@ inline bool operator==(const LogMsg& lhs, const LogMsg& rhs)
            && lhs.source == rhs.source && lhs.payload == rhs.payload && lhs.keyValues == rhs.keyValues;
 }
 
+inline bool operator==(const LogMsgBatch& lhs, const LogMsgBatch& rhs)
+{
+    return lhs.loggerName == rhs.loggerName && lhs.droppedCount == rhs.droppedCount && lhs.msgs == rhs.msgs;
+}
+
 std::string to_string(const SourceLoc& sourceLoc)
 {
     std::stringstream outStream;
@@ -149,6 +170,19 @@ std::ostream& operator<<(std::ostream& out, const LogMsg& msg)
     return out;
 }
 
+std::string to_string(const LogMsgBatch& msg)
+{
+    std::stringstream outStream;
+    outStream << msg;
+    return outStream.str();
+}
+
+std::ostream& operator<<(std::ostream& out, const LogMsgBatch& msg)
+{
+    return out << "LogMsgBatch{logger=" << msg.loggerName << ", msgs=" << msg.msgs.size()
+               << ", dropped=" << msg.droppedCount << "}";
+}
+
 } // namespace Logging
 } // namespace Services
 } // namespace SilKit
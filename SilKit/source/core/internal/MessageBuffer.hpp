@@ -92,12 +92,15 @@ public:
     // peek into raw data, e.g. for retrieving headers without modifying the buffer
     inline auto PeekData() const -> SilKit::Util::Span<const uint8_t>;
     inline auto ReadPos() const -> size_t;
+    inline auto WritePos() const -> size_t;
 
     //! Set the format version to use for ser/des.
     inline void SetProtocolVersion(ProtocolVersion version);
     inline auto GetProtocolVersion() -> ProtocolVersion;
 
     inline void SetReadPos(size_t newReadPos);
+    //! Move the write position, e.g. for overwriting previously serialized header fields in place
+    inline void SetWritePos(size_t newWritePos);
 
 public:
     // ----------------------------------------
@@ -105,6 +108,8 @@ public:
 
     //! \brief Return the underlying data storage by std::move and reset pointers
     inline auto ReleaseStorage() -> std::vector<uint8_t>;
+    //! \brief True if SharedVector payloads handed out by this buffer still refer to its storage
+    inline bool IsStorageShared() const;
     inline auto RemainingBytesLeft() const noexcept -> size_t;
 
 public:
@@ -116,11 +121,12 @@ public:
     template <typename IntegerT, typename std::enable_if_t<std::is_integral<IntegerT>::value, int> = 0>
     inline MessageBuffer& operator<<(IntegerT t)
     {
-        if (_wPos + sizeof(IntegerT) > _storage.size())
+        auto& storage = MutableStorage();
+        if (_wPos + sizeof(IntegerT) > storage.size())
         {
-            _storage.resize(_storage.size() + sizeof(IntegerT));
+            storage.resize(storage.size() + sizeof(IntegerT));
         }
-        std::memcpy(_storage.data() + _wPos, &t, sizeof(IntegerT));
+        std::memcpy(storage.data() + _wPos, &t, sizeof(IntegerT));
 
         _wPos += sizeof(IntegerT);
 
@@ -129,10 +135,11 @@ public:
     template <typename IntegerT, typename std::enable_if_t<std::is_integral<IntegerT>::value, int> = 0>
     inline MessageBuffer& operator>>(IntegerT& t)
     {
-        if (_rPos + sizeof(IntegerT) > _storage.size())
+        const auto& storage = Storage();
+        if (_rPos + sizeof(IntegerT) > storage.size())
             throw end_of_buffer{};
 
-        std::memcpy(&t, _storage.data() + _rPos, sizeof(IntegerT));
+        std::memcpy(&t, storage.data() + _rPos, sizeof(IntegerT));
         _rPos += sizeof(IntegerT);
 
         return *this;
@@ -143,15 +150,16 @@ public:
     template <typename DoubleT, typename std::enable_if_t<std::is_floating_point<DoubleT>::value, int> = 0>
     inline MessageBuffer& operator<<(DoubleT t)
     {
+        auto& storage = MutableStorage();
         static_assert(std::numeric_limits<double>::is_iec559,
                       "This compiler does not support IEEE 754 standard for floating points.");
 
-        if (_wPos + sizeof(DoubleT) > _storage.size())
+        if (_wPos + sizeof(DoubleT) > storage.size())
         {
-            _storage.resize(_storage.size() + sizeof(DoubleT));
+            storage.resize(storage.size() + sizeof(DoubleT));
         }
 
-        std::memcpy(_storage.data() + _wPos, &t, sizeof(DoubleT));
+        std::memcpy(storage.data() + _wPos, &t, sizeof(DoubleT));
         _wPos += sizeof(DoubleT);
 
         return *this;
@@ -159,13 +167,14 @@ public:
     template <typename DoubleT, typename std::enable_if_t<std::is_floating_point<DoubleT>::value, int> = 0>
     inline MessageBuffer& operator>>(DoubleT& t)
     {
+        const auto& storage = Storage();
         static_assert(std::numeric_limits<double>::is_iec559,
                       "This compiler does not support IEEE 754 standard for floating points.");
 
-        if (_rPos + sizeof(DoubleT) > _storage.size())
+        if (_rPos + sizeof(DoubleT) > storage.size())
             throw end_of_buffer{};
 
-        std::memcpy(&t, _storage.data() + _rPos, sizeof(DoubleT));
+        std::memcpy(&t, storage.data() + _rPos, sizeof(DoubleT));
         _rPos += sizeof(DoubleT);
 
         return *this;
@@ -209,6 +218,7 @@ public:
     inline MessageBuffer& operator<<(const Util::SharedVector<ValueT>& sharedData);
     template <typename ValueT>
     inline MessageBuffer& operator>>(Util::SharedVector<ValueT>& sharedData);
+    inline MessageBuffer& operator>>(Util::SharedVector<uint8_t>& sharedData);
     // --------------------------------------------------------------------------------
     // Util::Span<T>
     inline MessageBuffer& operator<<(const Util::Span<const uint8_t>& sharedData);
@@ -265,14 +275,28 @@ public:
 public:
     void IncreaseCapacity(size_t capacity)
     {
-        _storage.reserve(_storage.size() + capacity);
+        auto& storage = MutableStorage();
+        storage.reserve(storage.size() + capacity);
     }
 
+private:
+    // ----------------------------------------
+    // private methods
+
+    //! The serialized data, either owned exclusively or shared with SharedVector payloads
+    inline auto Storage() const -> const std::vector<uint8_t>&;
+    //! The serialized data for modification, detached from any SharedVector payloads handed out before
+    inline auto MutableStorage() -> std::vector<uint8_t>&;
+    //! Move the serialized data into shared ownership. The data itself is not moved or copied.
+    inline auto SharedStorage() -> const std::shared_ptr<std::vector<uint8_t>>&;
+
 private:
     // ----------------------------------------
     // private members
     ProtocolVersion _protocolVersion{CurrentProtocolVersion()};
     std::vector<uint8_t> _storage;
+    // if set, holds the serialized data instead of _storage
+    std::shared_ptr<std::vector<uint8_t>> _sharedStorage;
     std::size_t _wPos{0u};
     std::size_t _rPos{0u};
 };
@@ -291,12 +315,49 @@ auto MessageBuffer::ReleaseStorage() -> std::vector<uint8_t>
 {
     _wPos = 0u;
     _rPos = 0u;
+    if (_sharedStorage)
+    {
+        auto sharedStorage = std::move(_sharedStorage);
+        return (sharedStorage.use_count() == 1) ? std::move(*sharedStorage) : *sharedStorage;
+    }
     return std::move(_storage);
 }
 
+bool MessageBuffer::IsStorageShared() const
+{
+    return _sharedStorage && _sharedStorage.use_count() > 1;
+}
+
+auto MessageBuffer::Storage() const -> const std::vector<uint8_t>&
+{
+    return _sharedStorage ? *_sharedStorage : _storage;
+}
+
+auto MessageBuffer::MutableStorage() -> std::vector<uint8_t>&
+{
+    if (_sharedStorage)
+    {
+        // copy on write, if the data is still referenced elsewhere
+        _storage = (_sharedStorage.use_count() == 1) ? std::move(*_sharedStorage) : *_sharedStorage;
+        _sharedStorage.reset();
+    }
+    return _storage;
+}
+
+auto MessageBuffer::SharedStorage() -> const std::shared_ptr<std::vector<uint8_t>>&
+{
+    if (!_sharedStorage)
+    {
+        _sharedStorage = std::make_shared<std::vector<uint8_t>>(std::move(_storage));
+        _storage.clear();
+    }
+    return _sharedStorage;
+}
+
 inline auto MessageBuffer::RemainingBytesLeft() const noexcept -> size_t
 {
-    return (_rPos > _storage.size()) ? 0 : (_storage.size() - _rPos);
+    const auto& storage = Storage();
+    return (_rPos > storage.size()) ? 0 : (storage.size() - _rPos);
 }
 
 // --------------------------------------------------------------------------------
@@ -310,25 +371,27 @@ MessageBuffer& MessageBuffer::operator<<(const std::string& str)
 
     *this << static_cast<uint32_t>(str.length());
 
-    if (_wPos + str.size() > _storage.size())
+    auto& storage = MutableStorage();
+    if (_wPos + str.size() > storage.size())
     {
-        _storage.resize(_wPos + str.size());
+        storage.resize(_wPos + str.size());
     }
 
-    std::copy(str.begin(), str.end(), _storage.begin() + _wPos);
+    std::copy(str.begin(), str.end(), storage.begin() + _wPos);
     _wPos += str.size();
 
     return *this;
 }
 MessageBuffer& MessageBuffer::operator>>(std::string& str)
 {
+    const auto& storage = Storage();
     uint32_t strLength{0u};
     *this >> strLength;
 
-    if (_rPos + strLength > _storage.size())
+    if (_rPos + strLength > storage.size())
         throw end_of_buffer{};
 
-    str = std::string(_storage.begin() + _rPos, _storage.begin() + _rPos + strLength);
+    str = std::string(storage.begin() + _rPos, storage.begin() + _rPos + strLength);
     _rPos += strLength;
 
     return *this;
@@ -343,13 +406,14 @@ MessageBuffer& MessageBuffer::operator<<(const std::vector<uint8_t>& vector)
 }
 MessageBuffer& MessageBuffer::operator>>(std::vector<uint8_t>& vector)
 {
+    const auto& storage = Storage();
     uint32_t vectorSize{0u};
     *this >> vectorSize;
 
-    if (_rPos + vectorSize > _storage.size())
+    if (_rPos + vectorSize > storage.size())
         throw end_of_buffer{};
 
-    vector = std::vector<uint8_t>(_storage.begin() + _rPos, _storage.begin() + _rPos + vectorSize);
+    vector = std::vector<uint8_t>(storage.begin() + _rPos, storage.begin() + _rPos + vectorSize);
     _rPos += vectorSize;
 
     return *this;
@@ -377,10 +441,11 @@ MessageBuffer& MessageBuffer::operator<<(const std::vector<ValueT>& vector)
 template <typename ValueT>
 MessageBuffer& MessageBuffer::operator>>(std::vector<ValueT>& vector)
 {
+    const auto& storage = Storage();
     uint32_t vectorSize{0u};
     *this >> vectorSize;
 
-    if (_rPos + vectorSize > _storage.size())
+    if (_rPos + vectorSize > storage.size())
         throw end_of_buffer{};
 
     vector.resize(vectorSize);
@@ -410,13 +475,14 @@ inline MessageBuffer& MessageBuffer::operator<<(const Util::Span<const uint8_t>&
 
     *this << static_cast<uint32_t>(span.size());
 
+    auto& storage = MutableStorage();
 
-    if (_wPos + span.size() > _storage.size())
+    if (_wPos + span.size() > storage.size())
     {
-        _storage.resize(_wPos + span.size());
+        storage.resize(_wPos + span.size());
     }
 
-    std::copy(span.begin(), span.end(), _storage.begin() + _wPos);
+    std::copy(span.begin(), span.end(), storage.begin() + _wPos);
     _wPos += span.size();
     return *this;
 }
@@ -459,20 +525,38 @@ inline MessageBuffer& MessageBuffer::operator>>(Util::SharedVector<ValueT>& shar
     return *this;
 }
 
+inline MessageBuffer& MessageBuffer::operator>>(Util::SharedVector<uint8_t>& sharedData)
+{
+    uint32_t vectorSize{0u};
+    *this >> vectorSize;
+
+    if (_rPos + vectorSize > Storage().size())
+        throw end_of_buffer{};
+
+    // byte payloads are not copied, but refer to the (shared) serialized data of this buffer
+    const auto& sharedStorage = SharedStorage();
+    sharedData = Util::SharedVector<uint8_t>{sharedStorage,
+                                             Util::Span<const uint8_t>{sharedStorage->data() + _rPos, vectorSize}};
+    _rPos += vectorSize;
+
+    return *this;
+}
+
 // --------------------------------------------------------------------------------
 // std::array<uint8_t, SIZE>
 template <size_t SIZE>
 MessageBuffer& MessageBuffer::operator<<(const std::array<uint8_t, SIZE>& array)
 {
+    auto& storage = MutableStorage();
     if (array.size() > std::numeric_limits<uint32_t>::max())
         throw end_of_buffer{};
 
-    if (_wPos + array.size() > _storage.size())
+    if (_wPos + array.size() > storage.size())
     {
-        _storage.resize(_wPos + array.size());
+        storage.resize(_wPos + array.size());
     }
 
-    std::copy(array.begin(), array.end(), _storage.begin() + _wPos);
+    std::copy(array.begin(), array.end(), storage.begin() + _wPos);
     _wPos += array.size();
 
     return *this;
@@ -480,10 +564,11 @@ MessageBuffer& MessageBuffer::operator<<(const std::array<uint8_t, SIZE>& array)
 template <size_t SIZE>
 MessageBuffer& MessageBuffer::operator>>(std::array<uint8_t, SIZE>& array)
 {
-    if (_rPos + array.size() > _storage.size())
+    const auto& storage = Storage();
+    if (_rPos + array.size() > storage.size())
         throw end_of_buffer{};
 
-    std::copy(_storage.begin() + _rPos, _storage.begin() + _rPos + array.size(), array.begin());
+    std::copy(storage.begin() + _rPos, storage.begin() + _rPos + array.size(), array.begin());
     _rPos += array.size();
 
     return *this;
@@ -505,7 +590,8 @@ MessageBuffer& MessageBuffer::operator<<(const std::array<ValueT, SIZE>& array)
 template <typename ValueT, size_t SIZE>
 MessageBuffer& MessageBuffer::operator>>(std::array<ValueT, SIZE>& array)
 {
-    if (_rPos + array.size() > _storage.size())
+    const auto& storage = Storage();
+    if (_rPos + array.size() > storage.size())
         throw end_of_buffer{};
 
     for (auto&& value : array)
@@ -683,18 +769,28 @@ inline auto MessageBuffer::GetProtocolVersion() -> ProtocolVersion
 
 inline auto MessageBuffer::PeekData() const -> SilKit::Util::Span<const uint8_t>
 {
-    return _storage;
+    return Storage();
 }
 inline auto MessageBuffer::ReadPos() const -> size_t
 {
     return _rPos;
 }
 
+inline auto MessageBuffer::WritePos() const -> size_t
+{
+    return _wPos;
+}
+
 inline void MessageBuffer::SetReadPos(size_t newReadPos)
 {
     _rPos = newReadPos;
 }
 
+inline void MessageBuffer::SetWritePos(size_t newWritePos)
+{
+    _wPos = newWritePos;
+}
+
 
 MessageBufferPeeker::MessageBufferPeeker(MessageBuffer& messageBuffer)
     : _messageBuffer{messageBuffer}
@@ -707,5 +803,52 @@ MessageBufferPeeker::~MessageBufferPeeker()
     _messageBuffer.SetReadPos(_readPos);
 }
 
+
+// --------------------------------------------------------------------------------
+// Serialized sizes of the elementary types, matching the streaming operators of the MessageBuffer. Used by the
+// SerializedSizeOf overloads of the message types to size the MessageBuffer exactly before serializing a message.
+
+template <typename T, typename std::enable_if_t<std::is_arithmetic<T>::value || std::is_enum<T>::value, int> = 0>
+constexpr auto SerializedSizeOf(T) -> size_t
+{
+    return sizeof(T);
+}
+
+template <class Rep, class Period>
+constexpr auto SerializedSizeOf(std::chrono::duration<Rep, Period>) -> size_t
+{
+    return sizeof(Rep);
+}
+
+constexpr auto SerializedSizeOf(const void*) -> size_t
+{
+    return sizeof(uint64_t);
+}
+
+constexpr auto SerializedSizeOf(const Util::Uuid&) -> size_t
+{
+    return sizeof(Util::Uuid::ab) + sizeof(Util::Uuid::cd);
+}
+
+inline auto SerializedSizeOf(const std::string& str) -> size_t
+{
+    return sizeof(uint32_t) + str.size();
+}
+
+inline auto SerializedSizeOf(const std::vector<uint8_t>& vector) -> size_t
+{
+    return sizeof(uint32_t) + vector.size();
+}
+
+inline auto SerializedSizeOf(const Util::Span<const uint8_t>& span) -> size_t
+{
+    return sizeof(uint32_t) + span.size();
+}
+
+inline auto SerializedSizeOf(const Util::SharedVector<uint8_t>& sharedData) -> size_t
+{
+    return SerializedSizeOf(sharedData.AsSpan());
+}
+
 } // namespace Core
 } // namespace SilKit
@@ -23,6 +23,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include <chrono>
 #include <string>
+#include <vector>
 
 #include "silkit/services/orchestration/OrchestrationDatatypes.hpp"
 
@@ -38,6 +39,21 @@ struct NextSimTask
     std::chrono::nanoseconds duration{0};
 };
 
+//! Number of user data messages sent from one participant to another since they connected
+struct UserDataMessageCount
+{
+    //! The receiver if sent to the time synchronization aggregator, the sender if sent by the aggregator
+    std::string participantName;
+    uint64_t count{0};
+};
+
+//! Sent before a NextSimTask to the time synchronization aggregator, and by the aggregator before its time grant, so
+//! the receivers wait for the user data messages which the grant could overtake otherwise
+struct UserDataMessageCounts
+{
+    std::vector<UserDataMessageCount> counts;
+};
+
 //! System-wide command for the simulation flow.
 struct SystemCommand
 {
@@ -41,12 +41,16 @@ const std::string controllerTypeEthernet = "Ethernet";
 const std::string controllerTypeFlexray = "FlexRay";
 const std::string controllerTypeLin = "LIN";
 
+// CAN supplementalData keys
+const std::string supplKeyCanControllerAcceptanceFilters = "Can::controller::acceptanceFilters";
+
 // PubSub types and supplementalData keys
 const std::string controllerTypeDataPublisher = "DataPublisher";
 const std::string supplKeyDataPublisherTopic = "PubSub::topic";
 const std::string supplKeyDataPublisherPubUUID = "PubSub::pubUUID";
 const std::string supplKeyDataPublisherMediaType = "PubSub::pubMediaType";
 const std::string supplKeyDataPublisherPubLabels = "PubSub::pubLabels";
+const std::string supplKeyDataPublisherAppliesSubscriberFilters = "PubSub::pubAppliesSubFilters";
 
 const std::string controllerTypeDataSubscriber = "DataSubscriber";
 const std::string supplKeyDataSubscriberTopic = "PubSub::topic";
@@ -54,6 +58,7 @@ const std::string supplKeyDataSubscriberMediaType = "PubSub::subMediaType";
 const std::string supplKeyDataSubscriberSubLabels = "PubSub::subLabels";
 const std::string controllerTypeDataSubscriberInternal = "DataSubscriberInternal";
 const std::string supplKeyDataSubscriberInternalParentServiceID = "PubSub::subIntParentServiceId";
+const std::string supplKeyDataSubscriberInternalFilter = "PubSub::subIntFilter";
 
 // RPC types
 const std::string controllerTypeRpcServer = "RpcServer";
@@ -70,6 +75,7 @@ const std::string supplKeyRpcClientUUID = "Rpc::client::UUID";
 const std::string controllerTypeRpcServerInternal = "RpcServerInternal";
 const std::string supplKeyRpcServerInternalClientUUID = "Rpc::serverinternal::clientUUID";
 const std::string supplKeyRpcServerInternalParentServiceID = "Rpc::serverinternal::parentServiceId";
+const std::string supplKeyRpcServerInternalReceivesCallBatches = "Rpc::serverinternal::receivesCallBatches";
 
 // Internal types. These variables are also used for the (internal) controller names.
 const std::string controllerTypeLoggerSender = "LoggerSender";
@@ -89,6 +95,8 @@ const std::string controllerTypeOther = "Other";
 // Lifecycle & TimeSync
 const std::string lifecycleIsCoordinated = "LifecycleIsCoordinated";
 const std::string timeSyncActive = "TimeSyncActive";
+const std::string timeSyncMinimumReactionDelay = "TimeSyncMinimumReactionDelay";
+const std::string timeSyncAggregator = "TimeSyncAggregator";
 
 } // namespace Discovery
 } // namespace Core
@@ -137,6 +137,43 @@ TEST(Test_MessageBuffer, std_vector_uint8_t)
     EXPECT_EQ(in, out);
 }
 
+TEST(Test_MessageBuffer, shared_vector_uint8_t_refers_to_buffer_storage)
+{
+    SilKit::Core::MessageBuffer buffer;
+
+    std::string helperString{"This_is_a_test_string"};
+
+    SilKit::Util::SharedVector<uint8_t> in{std::vector<uint8_t>{helperString.begin(), helperString.end()}};
+    SilKit::Util::SharedVector<uint8_t> out;
+
+    buffer << in;
+    buffer >> out;
+
+    EXPECT_TRUE(ItemsAreEqual(in, out));
+
+    // the payload is not copied out of the buffer
+    const auto storage = buffer.PeekData();
+    EXPECT_GE(out.AsSpan().data(), storage.data());
+    EXPECT_LE(out.AsSpan().data() + out.AsSpan().size(), storage.data() + storage.size());
+}
+
+TEST(Test_MessageBuffer, shared_vector_uint8_t_outlives_modified_buffer)
+{
+    SilKit::Core::MessageBuffer buffer;
+
+    std::vector<uint8_t> in{1, 2, 3, 4, 5};
+    SilKit::Util::SharedVector<uint8_t> out;
+
+    buffer << SilKit::Util::SharedVector<uint8_t>{in};
+    buffer >> out;
+
+    // writing to the buffer must not affect the payload which was read before
+    buffer << std::string(1024, 'X');
+    buffer.ReleaseStorage();
+
+    EXPECT_TRUE(SilKit::Util::ItemsAreEqual(out.AsSpan(), SilKit::Util::ToSpan(in)));
+}
+
 TEST(Test_MessageBuffer, std_vector_string)
 {
     SilKit::Core::MessageBuffer buffer;
@@ -30,10 +30,12 @@ namespace Services {
 namespace Orchestration {
 
 inline std::string to_string(const NextSimTask& nextTask);
+inline std::string to_string(const UserDataMessageCounts& userDataMessageCounts);
 inline std::string to_string(SystemCommand::Kind command);
 inline std::string to_string(const SystemCommand& command);
 
 inline std::ostream& operator<<(std::ostream& out, const NextSimTask& nextTask);
+inline std::ostream& operator<<(std::ostream& out, const UserDataMessageCounts& userDataMessageCounts);
 inline std::ostream& operator<<(std::ostream& out, SystemCommand::Kind command);
 inline std::ostream& operator<<(std::ostream& out, const SystemCommand& command);
 
@@ -56,6 +58,24 @@ std::ostream& operator<<(std::ostream& out, const NextSimTask& nextTask)
     return out;
 }
 
+std::string to_string(const UserDataMessageCounts& userDataMessageCounts)
+{
+    std::stringstream outStream;
+    outStream << userDataMessageCounts;
+    return outStream.str();
+}
+
+std::ostream& operator<<(std::ostream& out, const UserDataMessageCounts& userDataMessageCounts)
+{
+    out << "Orchestration::UserDataMessageCounts{";
+    for (auto it = userDataMessageCounts.counts.begin(); it != userDataMessageCounts.counts.end(); ++it)
+    {
+        out << (it == userDataMessageCounts.counts.begin() ? "" : ", ") << it->participantName << "=" << it->count;
+    }
+    out << "}";
+    return out;
+}
+
 std::string to_string(SystemCommand::Kind command)
 {
     switch (command)
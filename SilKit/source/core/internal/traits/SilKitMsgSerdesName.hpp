@@ -46,13 +46,17 @@ struct SilKitMsgTraitSerdesName
     }
 
 DefineSilKitMsgTrait_SerdesName(SilKit::Services::Logging::LogMsg, "LOGMSG");
+DefineSilKitMsgTrait_SerdesName(SilKit::Services::Logging::LogMsgBatch, "LOGMSGBATCH");
 DefineSilKitMsgTrait_SerdesName(VSilKit::MetricsUpdate, "METRICSUPDATE");
+DefineSilKitMsgTrait_SerdesName(VSilKit::WireMetricsUpdate, "WIREMETRICSUPDATE");
 DefineSilKitMsgTrait_SerdesName(SilKit::Services::Orchestration::SystemCommand, "SYSTEMCOMMAND");
 DefineSilKitMsgTrait_SerdesName(SilKit::Services::Orchestration::ParticipantStatus, "PARTICIPANTSTATUS");
 DefineSilKitMsgTrait_SerdesName(SilKit::Services::Orchestration::WorkflowConfiguration, "WORKFLOWCONFIGURATION");
 DefineSilKitMsgTrait_SerdesName(SilKit::Services::Orchestration::NextSimTask, "NEXTSIMTASK");
+DefineSilKitMsgTrait_SerdesName(SilKit::Services::Orchestration::UserDataMessageCounts, "USERDATAMESSAGECOUNTS");
 DefineSilKitMsgTrait_SerdesName(SilKit::Services::PubSub::WireDataMessageEvent, "DATAMESSAGEEVENT");
 DefineSilKitMsgTrait_SerdesName(SilKit::Services::Rpc::FunctionCall, "FUNCTIONCALL");
+DefineSilKitMsgTrait_SerdesName(SilKit::Services::Rpc::FunctionCallBatch, "FUNCTIONCALLBATCH");
 DefineSilKitMsgTrait_SerdesName(SilKit::Services::Rpc::FunctionCallResponse, "FUNCTIONCALLRESPONSE");
 DefineSilKitMsgTrait_SerdesName(SilKit::Services::Can::WireCanFrameEvent, "CANFRAMEEVENT");
 DefineSilKitMsgTrait_SerdesName(SilKit::Services::Can::CanFrameTransmitEvent, "CANFRAMETRANSMITEVENT");
@@ -129,13 +129,17 @@ struct SilKitMsgTraits
     }
 
 DefineSilKitMsgTrait_TypeName(SilKit::Services::Logging, LogMsg);
+DefineSilKitMsgTrait_TypeName(SilKit::Services::Logging, LogMsgBatch);
 DefineSilKitMsgTrait_TypeName(VSilKit, MetricsUpdate);
+DefineSilKitMsgTrait_TypeName(VSilKit, WireMetricsUpdate);
 DefineSilKitMsgTrait_TypeName(SilKit::Services::Orchestration, SystemCommand);
 DefineSilKitMsgTrait_TypeName(SilKit::Services::Orchestration, ParticipantStatus);
 DefineSilKitMsgTrait_TypeName(SilKit::Services::Orchestration, WorkflowConfiguration);
 DefineSilKitMsgTrait_TypeName(SilKit::Services::Orchestration, NextSimTask);
+DefineSilKitMsgTrait_TypeName(SilKit::Services::Orchestration, UserDataMessageCounts);
 DefineSilKitMsgTrait_TypeName(SilKit::Services::PubSub, WireDataMessageEvent);
 DefineSilKitMsgTrait_TypeName(SilKit::Services::Rpc, FunctionCall);
+DefineSilKitMsgTrait_TypeName(SilKit::Services::Rpc, FunctionCallBatch);
 DefineSilKitMsgTrait_TypeName(SilKit::Services::Rpc, FunctionCallResponse);
 DefineSilKitMsgTrait_TypeName(SilKit::Services::Can, WireCanFrameEvent);
 DefineSilKitMsgTrait_TypeName(SilKit::Services::Can, CanFrameTransmitEvent);
@@ -45,13 +45,17 @@ struct SilKitMsgTraitVersion
     }
 
 DefineSilKitMsgTrait_Version(SilKit::Services::Logging::LogMsg, 1);
+DefineSilKitMsgTrait_Version(SilKit::Services::Logging::LogMsgBatch, 1);
 DefineSilKitMsgTrait_Version(VSilKit::MetricsUpdate, 1);
+DefineSilKitMsgTrait_Version(VSilKit::WireMetricsUpdate, 1);
 DefineSilKitMsgTrait_Version(SilKit::Services::Orchestration::SystemCommand, 1);
 DefineSilKitMsgTrait_Version(SilKit::Services::Orchestration::ParticipantStatus, 1);
 DefineSilKitMsgTrait_Version(SilKit::Services::Orchestration::WorkflowConfiguration, 1);
 DefineSilKitMsgTrait_Version(SilKit::Services::Orchestration::NextSimTask, 1);
+DefineSilKitMsgTrait_Version(SilKit::Services::Orchestration::UserDataMessageCounts, 1);
 DefineSilKitMsgTrait_Version(SilKit::Services::PubSub::WireDataMessageEvent, 1);
 DefineSilKitMsgTrait_Version(SilKit::Services::Rpc::FunctionCall, 1);
+DefineSilKitMsgTrait_Version(SilKit::Services::Rpc::FunctionCallBatch, 1);
 DefineSilKitMsgTrait_Version(SilKit::Services::Rpc::FunctionCallResponse, 1);
 DefineSilKitMsgTrait_Version(SilKit::Services::Can::WireCanFrameEvent, 1);
 DefineSilKitMsgTrait_Version(SilKit::Services::Can::CanFrameTransmitEvent, 1);
@@ -54,6 +54,12 @@ struct NullConnection
     {
     }
 
+    template <typename SilKitMessageT>
+    void SetRemoteReceiverFilter(const std::string& /*networkName*/, const std::string& /*participantName*/,
+                                 std::function<bool(const SilKitMessageT&)> /*filter*/)
+    {
+    }
+
     template <typename SilKitMessageT>
     void SendMsg(const Core::IServiceEndpoint* /*from*/, SilKitMessageT&& /*msg*/)
     {
@@ -67,8 +73,9 @@ struct NullConnection
     void OnAllMessagesDelivered(std::function<void()> /*callback*/) {}
     void FlushSendBuffers() {}
     void ExecuteDeferred(std::function<void()> /*callback*/) {}
+    void UpdateMetrics() {}
     void NotifyShutdown() {}
-    void EnableAggregation() {}
+    void EnableAggregation(VAsioAggregationMode /*mode*/) {}
 
     void RegisterMessageReceiver(std::function<void(IVAsioPeer* /*peer*/, ParticipantAnnouncement)> /*callback*/) {}
     void RegisterPeerShutdownCallback(std::function<void(IVAsioPeer* peer)> /*callback*/) {}
@@ -96,6 +103,22 @@ struct NullConnection
         return {};
     };
 
+    std::map<std::string, uint64_t> TakeSentUserDataMessageCounts()
+    {
+        return {};
+    };
+
+    void AwaitReceivedUserDataMessages(std::map<std::string, uint64_t> /*counts*/, std::function<void()> /*handler*/)
+    {
+    }
+
+    void DelayReceivedUserDataMessages(const std::string& /*participantName*/,
+                                       std::chrono::nanoseconds /*releaseTimePoint*/)
+    {
+    }
+
+    void ReleaseReceivedUserDataMessages(std::chrono::nanoseconds /*timePoint*/) {}
+
     bool ParticipantHasCapability(const std::string& /*participantName*/, const std::string& /*capability*/) const
     {
         return true;
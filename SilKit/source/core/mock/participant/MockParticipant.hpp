@@ -200,6 +200,12 @@ class DummyMetricsManager : public IMetricsManager
         void Add(const std::string&) override {}
     };
 
+    class DummyHistogramMetric : public IHistogramMetric
+    {
+    public:
+        void Take(uint64_t /* value */) override {}
+    };
+
 public:
     auto GetCounter(const std::string& name) -> ICounterMetric* override
     {
@@ -231,12 +237,23 @@ public:
         return &(it->second);
     }
 
+    auto GetHistogram(const std::string& name) -> IHistogramMetric* override
+    {
+        auto it = _histograms.find(name);
+        if (it == _histograms.end())
+        {
+            it = _histograms.emplace().first;
+        }
+        return &(it->second);
+    }
+
     void SubmitUpdates() override {}
 
 private:
     std::unordered_map<std::string, DummyCounterMetric> _counters;
     std::unordered_map<std::string, DummyStatisticMetric> _statistics;
     std::unordered_map<std::string, DummyStringListMetric> _stringLists;
+    std::unordered_map<std::string, DummyHistogramMetric> _histograms;
 };
 
 class DummyParticipant : public IParticipantInternal
@@ -405,10 +422,16 @@ public:
 
     void SendMsg(const IServiceEndpoint* /*from*/, const Services::Rpc::FunctionCall& /*msg*/) override {}
     void SendMsg(const IServiceEndpoint* /*from*/, Services::Rpc::FunctionCall&& /*msg*/) override {}
+    void SendMsg(const IServiceEndpoint* /*from*/, const Services::Rpc::FunctionCallBatch& /*msg*/) override {}
+    void SendMsg(const IServiceEndpoint* /*from*/, Services::Rpc::FunctionCallBatch&& /*msg*/) override {}
     void SendMsg(const IServiceEndpoint* /*from*/, const Services::Rpc::FunctionCallResponse& /*msg*/) override {}
     void SendMsg(const IServiceEndpoint* /*from*/, Services::Rpc::FunctionCallResponse&& /*msg*/) override {}
 
     void SendMsg(const IServiceEndpoint* /*from*/, const Services::Orchestration::NextSimTask& /*msg*/) override {}
+    void SendMsg(const IServiceEndpoint* /*from*/,
+                 const Services::Orchestration::UserDataMessageCounts& /*msg*/) override
+    {
+    }
     void SendMsg(const IServiceEndpoint* /*from*/, const Services::Orchestration::ParticipantStatus& /*msg*/) override
     {
     }
@@ -420,8 +443,11 @@ public:
 
     void SendMsg(const IServiceEndpoint* /*from*/, Services::Logging::LogMsg&& /*msg*/) override {}
     void SendMsg(const IServiceEndpoint* /*from*/, const Services::Logging::LogMsg& /*msg*/) override {}
+    void SendMsg(const IServiceEndpoint* /*from*/, Services::Logging::LogMsgBatch&& /*msg*/) override {}
+    void SendMsg(const IServiceEndpoint* /*from*/, const Services::Logging::LogMsgBatch& /*msg*/) override {}
 
     void SendMsg(const IServiceEndpoint* /*from*/, const VSilKit::MetricsUpdate& /*msg*/) override {}
+    void SendMsg(const IServiceEndpoint* /*from*/, const VSilKit::WireMetricsUpdate& /*msg*/) override {}
 
     void SendMsg(const IServiceEndpoint* /*from*/, const Discovery::ParticipantDiscoveryEvent& /*msg*/) override {}
     void SendMsg(const IServiceEndpoint* /*from*/, const Discovery::ServiceDiscoveryEvent& /*msg*/) override {}
@@ -552,6 +578,14 @@ public:
                  Services::Rpc::FunctionCall&& /*msg*/) override
     {
     }
+    void SendMsg(const IServiceEndpoint* /*from*/, const std::string& /*targetParticipantName*/,
+                 const Services::Rpc::FunctionCallBatch& /*msg*/) override
+    {
+    }
+    void SendMsg(const IServiceEndpoint* /*from*/, const std::string& /*targetParticipantName*/,
+                 Services::Rpc::FunctionCallBatch&& /*msg*/) override
+    {
+    }
     void SendMsg(const IServiceEndpoint* /*from*/, const std::string& /*targetParticipantName*/,
                  const Services::Rpc::FunctionCallResponse& /*msg*/) override
     {
@@ -565,6 +599,10 @@ public:
                  const Services::Orchestration::NextSimTask& /*msg*/) override
     {
     }
+    void SendMsg(const IServiceEndpoint* /*from*/, const std::string& /*targetParticipantName*/,
+                 const Services::Orchestration::UserDataMessageCounts& /*msg*/) override
+    {
+    }
     void SendMsg(const IServiceEndpoint* /*from*/, const std::string& /*targetParticipantName*/,
                  const Services::Orchestration::ParticipantStatus& /*msg*/) override
     {
@@ -586,11 +624,23 @@ public:
                  const Services::Logging::LogMsg& /*msg*/) override
     {
     }
+    void SendMsg(const IServiceEndpoint* /*from*/, const std::string& /*targetParticipantName*/,
+                 Services::Logging::LogMsgBatch&& /*msg*/) override
+    {
+    }
+    void SendMsg(const IServiceEndpoint* /*from*/, const std::string& /*targetParticipantName*/,
+                 const Services::Logging::LogMsgBatch& /*msg*/) override
+    {
+    }
 
     void SendMsg(const IServiceEndpoint* /*from*/, const std::string& /*targetParticipantName*/,
                  const VSilKit::MetricsUpdate& /*msg*/) override
     {
     }
+    void SendMsg(const IServiceEndpoint* /*from*/, const std::string& /*targetParticipantName*/,
+                 const VSilKit::WireMetricsUpdate& /*msg*/) override
+    {
+    }
 
     void SendMsg(const IServiceEndpoint* /*from*/, const std::string& /*targetParticipantName*/,
                  const Discovery::ParticipantDiscoveryEvent& /*msg*/) override
@@ -683,6 +733,23 @@ public:
         return {};
     }
 
+    std::map<std::string, uint64_t> TakeSentUserDataMessageCounts() override
+    {
+        return {};
+    }
+
+    void AwaitReceivedUserDataMessages(std::map<std::string, uint64_t> /*counts*/,
+                                       std::function<void()> /*handler*/) override
+    {
+    }
+
+    void DelayReceivedUserDataMessages(const std::string& /*participantName*/,
+                                       std::chrono::nanoseconds /*releaseTimePoint*/) override
+    {
+    }
+
+    void ReleaseReceivedUserDataMessages(std::chrono::nanoseconds /*timePoint*/) override {}
+
     void NotifyShutdown() override {};
     void EvaluateAggregationInfo(bool /*isSyncSimStepHandler*/) override {};
     void RegisterReplayController(SilKit::Tracing::IReplayDataController*, const std::string&,
@@ -41,9 +41,11 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 // Interfaces relying on I_SilKit_Core_Internal
 #include "IMsgForLogMsgSender.hpp"
 #include "IMsgForLogMsgReceiver.hpp"
+#include "LogMsgBatcher.hpp"
 
 #include "IMsgForCanSimulator.hpp"
 #include "IMsgForCanController.hpp"
+#include "CanAcceptanceFilter.hpp"
 
 #include "IMsgForEthSimulator.hpp"
 #include "IMsgForEthController.hpp"
@@ -57,6 +59,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "IMsgForDataPublisher.hpp"
 #include "IMsgForDataSubscriber.hpp"
 #include "IMsgForDataSubscriberInternal.hpp"
+#include "DataMessageFilter.hpp"
 
 #include "IMsgForRpcServer.hpp"
 #include "IMsgForRpcServerInternal.hpp"
@@ -213,18 +216,24 @@ public:
     void SendMsg(const IServiceEndpoint* from, const Services::Lin::LinFrameResponseUpdate& msg) override;
 
     void SendMsg(const IServiceEndpoint*, const Services::Orchestration::NextSimTask& msg) override;
+    void SendMsg(const IServiceEndpoint*, const Services::Orchestration::UserDataMessageCounts& msg) override;
     void SendMsg(const IServiceEndpoint*, const Services::Orchestration::ParticipantStatus& msg) override;
     void SendMsg(const IServiceEndpoint*, const Services::Orchestration::SystemCommand& msg) override;
     void SendMsg(const IServiceEndpoint*, const Services::Orchestration::WorkflowConfiguration& msg) override;
 
     void SendMsg(const IServiceEndpoint*, const Services::Logging::LogMsg& msg) override;
     void SendMsg(const IServiceEndpoint*, Services::Logging::LogMsg&& msg) override;
+    void SendMsg(const IServiceEndpoint*, const Services::Logging::LogMsgBatch& msg) override;
+    void SendMsg(const IServiceEndpoint*, Services::Logging::LogMsgBatch&& msg) override;
 
     void SendMsg(const SilKit::Core::IServiceEndpoint* from, const VSilKit::MetricsUpdate& msg) override;
+    void SendMsg(const SilKit::Core::IServiceEndpoint* from, const VSilKit::WireMetricsUpdate& msg) override;
 
     void SendMsg(const IServiceEndpoint* from, const Services::PubSub::WireDataMessageEvent& msg) override;
     void SendMsg(const IServiceEndpoint* from, const Services::Rpc::FunctionCall& msg) override;
     void SendMsg(const IServiceEndpoint* from, Services::Rpc::FunctionCall&& msg) override;
+    void SendMsg(const IServiceEndpoint* from, const Services::Rpc::FunctionCallBatch& msg) override;
+    void SendMsg(const IServiceEndpoint* from, Services::Rpc::FunctionCallBatch&& msg) override;
     void SendMsg(const IServiceEndpoint* from, const Services::Rpc::FunctionCallResponse& msg) override;
     void SendMsg(const IServiceEndpoint* from, Services::Rpc::FunctionCallResponse&& msg) override;
 
@@ -293,6 +302,8 @@ public:
 
     void SendMsg(const IServiceEndpoint*, const std::string& targetParticipantName,
                  const Services::Orchestration::NextSimTask& msg) override;
+    void SendMsg(const IServiceEndpoint*, const std::string& targetParticipantName,
+                 const Services::Orchestration::UserDataMessageCounts& msg) override;
     void SendMsg(const IServiceEndpoint*, const std::string& targetParticipantName,
                  const Services::Orchestration::ParticipantStatus& msg) override;
     void SendMsg(const IServiceEndpoint*, const std::string& targetParticipantName,
@@ -304,9 +315,15 @@ public:
                  const Services::Logging::LogMsg& msg) override;
     void SendMsg(const IServiceEndpoint*, const std::string& targetParticipantName,
                  Services::Logging::LogMsg&& msg) override;
+    void SendMsg(const IServiceEndpoint*, const std::string& targetParticipantName,
+                 const Services::Logging::LogMsgBatch& msg) override;
+    void SendMsg(const IServiceEndpoint*, const std::string& targetParticipantName,
+                 Services::Logging::LogMsgBatch&& msg) override;
 
     void SendMsg(const IServiceEndpoint*, const std::string& targetParticipantName,
                  const VSilKit::MetricsUpdate& msg) override;
+    void SendMsg(const IServiceEndpoint*, const std::string& targetParticipantName,
+                 const VSilKit::WireMetricsUpdate& msg) override;
 
     void SendMsg(const IServiceEndpoint* from, const std::string& targetParticipantName,
                  const Services::PubSub::WireDataMessageEvent& msg) override;
@@ -315,6 +332,10 @@ public:
                  const Services::Rpc::FunctionCall& msg) override;
     void SendMsg(const IServiceEndpoint* from, const std::string& targetParticipantName,
                  Services::Rpc::FunctionCall&& msg) override;
+    void SendMsg(const IServiceEndpoint* from, const std::string& targetParticipantName,
+                 const Services::Rpc::FunctionCallBatch& msg) override;
+    void SendMsg(const IServiceEndpoint* from, const std::string& targetParticipantName,
+                 Services::Rpc::FunctionCallBatch&& msg) override;
     void SendMsg(const IServiceEndpoint* from, const std::string& targetParticipantName,
                  const Services::Rpc::FunctionCallResponse& msg) override;
     void SendMsg(const IServiceEndpoint* from, const std::string& targetParticipantName,
@@ -347,6 +368,11 @@ public:
     size_t GetNumberOfRemoteReceivers(const IServiceEndpoint* service, const std::string& msgTypeName) override;
     std::vector<std::string> GetParticipantNamesOfRemoteReceivers(const IServiceEndpoint* service,
                                                                   const std::string& msgTypeName) override;
+    std::map<std::string, uint64_t> TakeSentUserDataMessageCounts() override;
+    void AwaitReceivedUserDataMessages(std::map<std::string, uint64_t> counts, std::function<void()> handler) override;
+    void DelayReceivedUserDataMessages(const std::string& participantName,
+                                       std::chrono::nanoseconds releaseTimePoint) override;
+    void ReleaseReceivedUserDataMessages(std::chrono::nanoseconds timePoint) override;
 
     void NotifyShutdown() override;
     void EvaluateAggregationInfo(bool isSyncSimStepHandler) override;
@@ -415,6 +441,15 @@ private:
     void SetupRemoteLogging();
     void SetupMetrics();
 
+    //!< Filter the CAN frames sent to remote participants by the acceptance filters of their controllers.
+    void TrackRemoteCanAcceptanceFilters();
+
+    //!< Filter the data messages sent to remote participants by the content filters of their subscribers.
+    void TrackRemoteDataSubscriberFilters();
+
+    //!< Forget the content filters of internal subscribers of this participant, once they are removed.
+    void TrackLocalDataSubscriberRemovals();
+
     void SetTimeProvider(Services::Orchestration::ITimeProvider*);
 
     template <class SilKitMessageT>
@@ -468,6 +503,11 @@ private:
     std::unique_ptr<Tracing::ReplayScheduler> _replayScheduler;
     std::unique_ptr<RequestReply::ParticipantReplies> _participantReplies;
 
+    // NB: Used by a service discovery handler, so it must be destroyed after the _controllers
+    Services::Can::RemoteCanAcceptanceFilters _remoteCanAcceptanceFilters;
+    Services::PubSub::RemoteDataSubscriberFilters _remoteDataSubscriberFilters;
+    Services::PubSub::LocalDataSubscriberFilters _localDataSubscriberFilters;
+
     std::tuple<
         ControllerMap<Services::Can::IMsgForCanController>, ControllerMap<Services::Ethernet::IMsgForEthController>,
         ControllerMap<Services::Flexray::IMsgForFlexrayController>, ControllerMap<Services::Lin::IMsgForLinController>,
@@ -501,12 +541,18 @@ private:
     // NB: Must be destroyed before _connection and _metricsManager
     std::unique_ptr<IMetricsTimerThread> _metricsTimerThread;
 
+    // NB: Must be destroyed before _connection, because it sends the last queued log messages
+    std::shared_ptr<Services::Logging::LogMsgBatcher> _logMsgBatcher;
+
     // control variables to prevent multiple create accesses by public API
     std::atomic<bool> _isSystemMonitorCreated{false};
     std::atomic<bool> _isSystemControllerCreated{false};
     std::atomic<bool> _isLoggerCreated{false};
     std::atomic<bool> _isLifecycleServiceCreated{false};
     std::atomic<bool> _isNetworkSimulatorCreated{false};
+    std::atomic<bool> _isCanAcceptanceFilterTrackingStarted{false};
+    std::atomic<bool> _isDataSubscriberFilterTrackingStarted{false};
+    std::atomic<bool> _isLocalDataSubscriberRemovalTrackingStarted{false};
 };
 
 } // namespace Core
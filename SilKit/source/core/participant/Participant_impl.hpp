@@ -83,6 +83,12 @@ namespace tt = Util::tuple_tools;
 // Anonymous namespace for Helper Traits and Functions
 namespace {
 
+// log messages for the remote sink are sent in batches of at most this size, or at least once per interval
+constexpr std::size_t remoteLogMaxBatchSize{256};
+constexpr std::chrono::milliseconds remoteLogFlushInterval{100};
+// number of log messages which may wait for the next batch, before further log messages are dropped
+constexpr std::size_t remoteLogQueueCapacity{4096};
+
 template <class T, class U>
 struct IsControllerMap : std::false_type
 {
@@ -129,6 +135,15 @@ template <class SilKitConnectionT>
 void Participant<SilKitConnectionT>::JoinSilKitSimulation()
 {
     _connection.JoinSimulation(GetRegistryUri());
+
+    // until the time synchronization is known (see EvaluateAggregationInfo), messages are only aggregated while a
+    // write is in progress, which never delays a message
+    if (_participantConfig.experimental.timeSynchronization.enableMessageAggregation
+        != SilKit::Config::v1::Aggregation::Off)
+    {
+        _connection.EnableAggregation(VAsioAggregationMode::WhileWriting);
+    }
+
     OnSilKitSimulationJoined();
 }
 
@@ -206,8 +221,19 @@ void Participant<SilKitConnectionT>::SetupRemoteLogging()
             auto&& logMsgSender =
                 CreateController<Services::Logging::LogMsgSender>(config, std::move(supplementalData), true, true);
 
-            logger->RegisterRemoteLogging([logMsgSender, this](Services::Logging::LogMsg logMsg) {
-                _connection.SendMsg(logMsgSender, std::move(logMsg));
+            _logMsgBatcher = std::make_shared<Services::Logging::LogMsgBatcher>(
+                GetParticipantName(), remoteLogQueueCapacity, remoteLogMaxBatchSize, remoteLogFlushInterval,
+                _participantConfig.logging.flushLevel, [logMsgSender](Services::Logging::LogMsgBatch batch) {
+                    logMsgSender->SendLogMsgBatch(std::move(batch));
+                });
+
+            // the logger outlives the participant members, so the batcher must not be kept alive by it
+            std::weak_ptr<Services::Logging::LogMsgBatcher> weakLogMsgBatcher = _logMsgBatcher;
+            logger->RegisterRemoteLogging([weakLogMsgBatcher](Services::Logging::LogMsg logMsg) {
+                if (auto logMsgBatcher = weakLogMsgBatcher.lock())
+                {
+                    logMsgBatcher->Push(std::move(logMsg));
+                }
             });
         }
     }
@@ -245,8 +271,94 @@ void Participant<SilKitConnectionT>::SetupMetrics()
         SilKit::Config::InternalController config;
         config.name = "MetricsReceiver";
         config.network = "default";
-        CreateController<VSilKit::MetricsReceiver>(config, std::move(supplementalData), true, true, processor);
+        auto* receiver =
+            CreateController<VSilKit::MetricsReceiver>(config, std::move(supplementalData), true, true, processor);
+        receiver->RegisterServiceDiscovery();
+    }
+}
+
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::TrackRemoteCanAcceptanceFilters()
+{
+    if (_isCanAcceptanceFilterTrackingStarted.exchange(true))
+    {
+        return;
+    }
+
+    GetServiceDiscovery()->RegisterServiceDiscoveryHandler(
+        [this](Discovery::ServiceDiscoveryEvent::Type discoveryType, const ServiceDescriptor& serviceDescriptor) {
+        const auto& participantName = serviceDescriptor.GetParticipantName();
+        if (participantName == GetParticipantName())
+        {
+            return;
+        }
+
+        const bool isRelevant = discoveryType == Discovery::ServiceDiscoveryEvent::Type::ServiceCreated
+                                    ? _remoteCanAcceptanceFilters.AddService(serviceDescriptor)
+                                    : _remoteCanAcceptanceFilters.RemoveService(serviceDescriptor);
+        if (!isRelevant)
+        {
+            return;
+        }
+
+        const auto& networkName = serviceDescriptor.GetNetworkName();
+        _connection.template SetRemoteReceiverFilter<Services::Can::WireCanFrameEvent>(
+            networkName, participantName, _remoteCanAcceptanceFilters.GetFrameFilter(networkName, participantName));
+    });
+}
+
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::TrackRemoteDataSubscriberFilters()
+{
+    if (_isDataSubscriberFilterTrackingStarted.exchange(true))
+    {
+        return;
+    }
+
+    GetServiceDiscovery()->RegisterServiceDiscoveryHandler(
+        [this](Discovery::ServiceDiscoveryEvent::Type discoveryType, const ServiceDescriptor& serviceDescriptor) {
+        const auto& participantName = serviceDescriptor.GetParticipantName();
+        if (participantName == GetParticipantName())
+        {
+            return;
+        }
+
+        const bool isRelevant = discoveryType == Discovery::ServiceDiscoveryEvent::Type::ServiceCreated
+                                    ? _remoteDataSubscriberFilters.AddService(serviceDescriptor)
+                                    : _remoteDataSubscriberFilters.RemoveService(serviceDescriptor);
+        if (!isRelevant)
+        {
+            return;
+        }
+
+        const auto& networkName = serviceDescriptor.GetNetworkName();
+        _connection.template SetRemoteReceiverFilter<Services::PubSub::WireDataMessageEvent>(
+            networkName, participantName, _remoteDataSubscriberFilters.GetMessageFilter(networkName, participantName));
+    });
+}
+
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::TrackLocalDataSubscriberRemovals()
+{
+    if (_isLocalDataSubscriberRemovalTrackingStarted.exchange(true))
+    {
+        return;
     }
+
+    GetServiceDiscovery()->RegisterServiceDiscoveryHandler(
+        [this](Discovery::ServiceDiscoveryEvent::Type discoveryType, const ServiceDescriptor& serviceDescriptor) {
+        std::string controllerType;
+        if (discoveryType != Discovery::ServiceDiscoveryEvent::Type::ServiceRemoved
+            || serviceDescriptor.GetParticipantName() != GetParticipantName()
+            || !serviceDescriptor.GetSupplementalDataItem(Discovery::controllerType, controllerType)
+            || controllerType != Discovery::controllerTypeDataSubscriberInternal)
+        {
+            return;
+        }
+
+        _localDataSubscriberFilters.RemoveSubscriber(serviceDescriptor.GetNetworkName(),
+                                                     serviceDescriptor.GetServiceId());
+    });
 }
 
 template <class SilKitConnectionT>
@@ -314,11 +426,17 @@ auto Participant<SilKitConnectionT>::CreateCanController(const std::string& cano
 
     Core::SupplementalData supplementalData;
     supplementalData[SilKit::Core::Discovery::controllerType] = SilKit::Core::Discovery::controllerTypeCan;
+    if (!controllerConfig.acceptanceFilters.empty())
+    {
+        supplementalData[SilKit::Core::Discovery::supplKeyCanControllerAcceptanceFilters] =
+            SilKit::Config::Serialize(controllerConfig.acceptanceFilters);
+    }
 
     auto controller = CreateController<Can::CanController>(controllerConfig, std::move(supplementalData), true, true,
                                                            controllerConfig, &_timeProvider);
 
     controller->RegisterServiceDiscovery();
+    TrackRemoteCanAcceptanceFilters();
 
     Logging::LoggerMessage lm{_logger.get(), Logging::Level::Trace};
     lm.SetMessage("Created controller");
@@ -471,6 +589,11 @@ auto Participant<SilKitConnectionT>::CreateDataSubscriberInternal(
         supplementalData[SilKit::Core::Discovery::supplKeyDataSubscriberInternalParentServiceID] =
             std::to_string(parentDataSubscriber->GetServiceDescriptor().GetServiceId());
     }
+    if (parentDataSubscriber && parentDataSubscriber->GetConfig().filter.has_value())
+    {
+        supplementalData[SilKit::Core::Discovery::supplKeyDataSubscriberInternalFilter] =
+            SilKit::Config::Serialize(parentDataSubscriber->GetConfig().filter.value());
+    }
     SilKit::Config::DataSubscriber controllerConfig;
 
     // Use a unique name to avoid collisions of several subscribers on same topic on one participant
@@ -483,6 +606,13 @@ auto Participant<SilKitConnectionT>::CreateDataSubscriberInternal(
 
     //Restore original DataSubscriber config for replay
     auto&& parentConfig = parentDataSubscriber->GetConfig();
+
+    // The publisher applies the decimation only if all subscribers of this participant have the same filter
+    auto setPublisherAppliesDecimation = [controller](bool publisherAppliesDecimation) {
+        controller->SetPublisherAppliesDecimation(publisherAppliesDecimation);
+    };
+    _localDataSubscriberFilters.AddSubscriber(network, controller->GetServiceDescriptor().GetServiceId(),
+                                              parentConfig.filter, std::move(setPublisherAppliesDecimation));
     if (_replayScheduler)
     {
         _replayScheduler->ConfigureController(parentConfig.name, controller, parentConfig.replay,
@@ -528,6 +658,11 @@ auto Participant<SilKitConnectionT>::CreateDataPublisher(const std::string& cano
     supplementalData[SilKit::Core::Discovery::supplKeyDataPublisherMediaType] = configuredDataNodeSpec.MediaType();
     supplementalData[SilKit::Core::Discovery::supplKeyDataPublisherPubLabels] =
         SilKit::Config::Serialize(configuredDataNodeSpec.Labels());
+    supplementalData[SilKit::Core::Discovery::supplKeyDataPublisherAppliesSubscriberFilters] = "1";
+
+    // The subscribers of the publisher are only discovered after its creation, so the network must be known first
+    _remoteDataSubscriberFilters.AddPublisherNetwork(network);
+    TrackRemoteDataSubscriberFilters();
 
     auto controller = CreateController<Services::PubSub::DataPublisher>(
         controllerConfig, network, std::move(supplementalData), true, true, &_timeProvider, configuredDataNodeSpec,
@@ -603,6 +738,8 @@ auto Participant<SilKitConnectionT>::CreateDataSubscriber(
         controllerConfig, network, std::move(supplementalData), true, true, controllerConfig, &_timeProvider,
         configuredDataNodeSpec, defaultDataHandler);
 
+    // registered before the subscriber creates internal subscribers in its discovery handler
+    TrackLocalDataSubscriberRemovals();
     controller->RegisterServiceDiscovery();
 
     if (GetLogger()->GetLogLevel() <= Logging::Level::Trace)
@@ -647,6 +784,7 @@ auto Participant<SilKitConnectionT>::CreateRpcServerInternal(
     supplementalData[SilKit::Core::Discovery::controllerType] =
         SilKit::Core::Discovery::controllerTypeRpcServerInternal;
     supplementalData[SilKit::Core::Discovery::supplKeyRpcServerInternalClientUUID] = clientUUID;
+    supplementalData[SilKit::Core::Discovery::supplKeyRpcServerInternalReceivesCallBatches] = "1";
     auto parentRpcServer = dynamic_cast<Services::Rpc::RpcServer*>(parent);
     if (parentRpcServer)
     {
@@ -788,12 +926,31 @@ auto Participant<SilKitConnectionT>::CreateTimeSyncService(Orchestration::Lifecy
     timeSyncSupplementalData[SilKit::Core::Discovery::controllerType] =
         SilKit::Core::Discovery::controllerTypeTimeSyncService;
 
+    // Advertise the smallest delay of all networks, since other participants do not know which networks they share
+    const auto& minimumReactionDelays = _participantConfig.experimental.timeSynchronization.minimumReactionDelays;
+    if (!minimumReactionDelays.empty())
+    {
+        auto minimumReactionDelay = std::chrono::nanoseconds::max();
+        for (const auto& networkDelay : minimumReactionDelays)
+        {
+            minimumReactionDelay = (std::min)(minimumReactionDelay, networkDelay.delay);
+        }
+        timeSyncSupplementalData[SilKit::Core::Discovery::timeSyncMinimumReactionDelay] =
+            std::to_string(minimumReactionDelay.count());
+    }
+
+    const auto& timeSyncAggregator = _participantConfig.experimental.timeSynchronization.aggregator;
+    if (!timeSyncAggregator.empty())
+    {
+        timeSyncSupplementalData[SilKit::Core::Discovery::timeSyncAggregator] = timeSyncAggregator;
+    }
+
     Config::InternalController config;
     config.name = Discovery::controllerTypeTimeSyncService;
     config.network = "default";
     timeSyncService = CreateController<Orchestration::TimeSyncService>(
         config, std::move(timeSyncSupplementalData), false, false, &_timeProvider, _participantConfig.healthCheck,
-        lifecycleService, _participantConfig.experimental.timeSynchronization.animationFactor);
+        lifecycleService, _participantConfig.experimental.timeSynchronization.animationFactor, timeSyncAggregator);
 
     return timeSyncService;
 }
@@ -1247,6 +1404,18 @@ void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from, Servi
     SendMsgImpl(from, std::move(msg));
 }
 
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from, const Services::Rpc::FunctionCallBatch& msg)
+{
+    SendMsgImpl(from, msg);
+}
+
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from, Services::Rpc::FunctionCallBatch&& msg)
+{
+    SendMsgImpl(from, std::move(msg));
+}
+
 template <class SilKitConnectionT>
 void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from,
                                              const Services::Rpc::FunctionCallResponse& msg)
@@ -1267,6 +1436,13 @@ void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from,
     SendMsgImpl(from, msg);
 }
 
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from,
+                                             const Services::Orchestration::UserDataMessageCounts& msg)
+{
+    SendMsgImpl(from, msg);
+}
+
 template <class SilKitConnectionT>
 void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from,
                                              const Services::Orchestration::ParticipantStatus& msg)
@@ -1301,12 +1477,30 @@ void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from, Servi
     SendMsgImpl(from, std::move(msg));
 }
 
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from, const Services::Logging::LogMsgBatch& msg)
+{
+    SendMsgImpl(from, msg);
+}
+
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from, Services::Logging::LogMsgBatch&& msg)
+{
+    SendMsgImpl(from, std::move(msg));
+}
+
 template <class SilKitConnectionT>
 void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from, const VSilKit::MetricsUpdate& msg)
 {
     SendMsgImpl(from, msg);
 }
 
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from, const VSilKit::WireMetricsUpdate& msg)
+{
+    SendMsgImpl(from, msg);
+}
+
 template <class SilKitConnectionT>
 void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from,
                                              const Discovery::ParticipantDiscoveryEvent& msg)
@@ -1545,6 +1739,20 @@ void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from, const
     SendMsgImpl(from, targetParticipantName, std::move(msg));
 }
 
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from, const std::string& targetParticipantName,
+                                             const Services::Rpc::FunctionCallBatch& msg)
+{
+    SendMsgImpl(from, targetParticipantName, msg);
+}
+
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from, const std::string& targetParticipantName,
+                                             Services::Rpc::FunctionCallBatch&& msg)
+{
+    SendMsgImpl(from, targetParticipantName, std::move(msg));
+}
+
 template <class SilKitConnectionT>
 void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from, const std::string& targetParticipantName,
                                              const Services::Rpc::FunctionCallResponse& msg)
@@ -1566,6 +1774,13 @@ void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from, const
     SendMsgImpl(from, targetParticipantName, msg);
 }
 
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from, const std::string& targetParticipantName,
+                                             const Services::Orchestration::UserDataMessageCounts& msg)
+{
+    SendMsgImpl(from, targetParticipantName, msg);
+}
+
 template <class SilKitConnectionT>
 void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from, const std::string& targetParticipantName,
                                              const Services::Orchestration::ParticipantStatus& msg)
@@ -1601,6 +1816,20 @@ void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from, const
     SendMsgImpl(from, targetParticipantName, std::move(msg));
 }
 
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from, const std::string& targetParticipantName,
+                                             const Services::Logging::LogMsgBatch& msg)
+{
+    SendMsgImpl(from, targetParticipantName, msg);
+}
+
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from, const std::string& targetParticipantName,
+                                             Services::Logging::LogMsgBatch&& msg)
+{
+    SendMsgImpl(from, targetParticipantName, std::move(msg));
+}
+
 template <class SilKitConnectionT>
 void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from, const std::string& targetParticipantName,
                                              const VSilKit::MetricsUpdate& msg)
@@ -1608,6 +1837,13 @@ void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from, const
     SendMsgImpl(from, targetParticipantName, msg);
 }
 
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from, const std::string& targetParticipantName,
+                                             const VSilKit::WireMetricsUpdate& msg)
+{
+    SendMsgImpl(from, targetParticipantName, msg);
+}
+
 template <class SilKitConnectionT>
 void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from, const std::string& targetParticipantName,
                                              const Discovery::ParticipantDiscoveryEvent& msg)
@@ -1879,6 +2115,32 @@ std::vector<std::string> Participant<SilKitConnectionT>::GetParticipantNamesOfRe
     return _connection.GetParticipantNamesOfRemoteReceivers(service, msgTypeName);
 }
 
+template <class SilKitConnectionT>
+std::map<std::string, uint64_t> Participant<SilKitConnectionT>::TakeSentUserDataMessageCounts()
+{
+    return _connection.TakeSentUserDataMessageCounts();
+}
+
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::AwaitReceivedUserDataMessages(std::map<std::string, uint64_t> counts,
+                                                                   std::function<void()> handler)
+{
+    _connection.AwaitReceivedUserDataMessages(std::move(counts), std::move(handler));
+}
+
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::DelayReceivedUserDataMessages(const std::string& participantName,
+                                                                   std::chrono::nanoseconds releaseTimePoint)
+{
+    _connection.DelayReceivedUserDataMessages(participantName, releaseTimePoint);
+}
+
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::ReleaseReceivedUserDataMessages(std::chrono::nanoseconds timePoint)
+{
+    _connection.ReleaseReceivedUserDataMessages(timePoint);
+}
+
 template <class SilKitConnectionT>
 void Participant<SilKitConnectionT>::NotifyShutdown()
 {
@@ -1898,12 +2160,12 @@ void Participant<SilKitConnectionT>::EvaluateAggregationInfo(bool isSyncSimStepH
         break;
     case SilKit::Config::v1::Aggregation::On:
         // aggregate in both blocking and non-blocking case
-        _connection.EnableAggregation();
+        _connection.EnableAggregation(VAsioAggregationMode::SimulationStep);
         break;
     case SilKit::Config::v1::Aggregation::Auto:
-        // aggregate in blocking case only
+        // aggregate until the end of the simulation step in blocking case only, otherwise while writing
         if (isSyncSimStepHandler)
-            _connection.EnableAggregation();
+            _connection.EnableAggregation(VAsioAggregationMode::SimulationStep);
         break;
     default:
         throw SilKitError{"Unknown aggregation type."};
@@ -1985,7 +2247,10 @@ auto Participant<SilKitConnectionT>::GetOrCreateMetricsSender() -> VSilKit::IMet
                 config.name = SilKit::Core::Discovery::controllerTypeMetricsSender;
                 config.network = "default";
 
-                sender = CreateController<VSilKit::MetricsSender>(config, std::move(supplementalData), true, true);
+                auto* metricsSender =
+                    CreateController<VSilKit::MetricsSender>(config, std::move(supplementalData), true, true);
+                metricsSender->RegisterServiceDiscovery();
+                sender = metricsSender;
             }
 
             _metricsSender = static_cast<IMetricsSender*>(static_cast<VSilKit::MetricsSender*>(sender));
@@ -2024,8 +2289,12 @@ auto Participant<SilKitConnectionT>::MakeTimerThread() -> std::unique_ptr<IMetri
         return nullptr;
     }
 
-    return std::make_unique<VSilKit::MetricsTimerThread>(
-        [this] { ExecuteDeferred([this] { GetMetricsManager()->SubmitUpdates(); }); });
+    return std::make_unique<VSilKit::MetricsTimerThread>([this] {
+        ExecuteDeferred([this] {
+            _connection.UpdateMetrics();
+            GetMetricsManager()->SubmitUpdates();
+        });
+    });
 }
 
 
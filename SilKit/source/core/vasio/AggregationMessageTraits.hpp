@@ -49,6 +49,11 @@ inline constexpr auto aggregationKind<SilKit::Services::Rpc::FunctionCall>() ->
     return MessageAggregationKind::UserDataMessage;
 }
 template <>
+inline constexpr auto aggregationKind<SilKit::Services::Rpc::FunctionCallBatch>() -> MessageAggregationKind
+{
+    return MessageAggregationKind::UserDataMessage;
+}
+template <>
 inline constexpr auto aggregationKind<SilKit::Services::Rpc::FunctionCallResponse>() -> MessageAggregationKind
 {
     return MessageAggregationKind::UserDataMessage;
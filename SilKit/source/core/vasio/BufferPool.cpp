@@ -0,0 +1,118 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "BufferPool.hpp"
+
+#include <algorithm>
+#include <iterator>
+
+namespace SilKit {
+namespace Core {
+
+constexpr std::array<std::size_t, 5> BufferPool::SizeClasses;
+constexpr std::size_t BufferPool::MaxBuffersPerSizeClass;
+
+auto BufferPool::Acquire(std::size_t minimumCapacity) -> std::vector<uint8_t>
+{
+    // the smallest size class which is large enough
+    const auto it = std::lower_bound(SizeClasses.begin(), SizeClasses.end(), minimumCapacity);
+    if (it == SizeClasses.end())
+    {
+        ++_statistics.misses;
+
+        std::vector<uint8_t> buffer;
+        buffer.reserve(minimumCapacity);
+        return buffer;
+    }
+
+    auto& freeBuffers = _freeBuffers[static_cast<std::size_t>(std::distance(SizeClasses.begin(), it))];
+    if (freeBuffers.empty() && _numReturnedBuffers.load(std::memory_order_relaxed) > 0)
+    {
+        TakeOverReturnedBuffers();
+    }
+    if (freeBuffers.empty())
+    {
+        ++_statistics.misses;
+
+        std::vector<uint8_t> buffer;
+        buffer.reserve(*it);
+        return buffer;
+    }
+
+    ++_statistics.hits;
+
+    auto buffer = std::move(freeBuffers.back());
+    freeBuffers.pop_back();
+    return buffer;
+}
+
+void BufferPool::Release(std::vector<uint8_t> buffer)
+{
+    if (buffer.capacity() < SizeClasses.front() || buffer.capacity() > SizeClasses.back())
+    {
+        return;
+    }
+
+    // the largest size class which the buffer can serve
+    const auto it = std::upper_bound(SizeClasses.begin(), SizeClasses.end(), buffer.capacity());
+    auto& freeBuffers = _freeBuffers[static_cast<std::size_t>(std::distance(SizeClasses.begin(), it)) - 1];
+    if (freeBuffers.size() >= MaxBuffersPerSizeClass)
+    {
+        return;
+    }
+
+    buffer.clear();
+    freeBuffers.emplace_back(std::move(buffer));
+}
+
+void BufferPool::ReleaseFromAnyThread(std::vector<uint8_t> buffer)
+{
+    if (buffer.capacity() < SizeClasses.front() || buffer.capacity() > SizeClasses.back())
+    {
+        return;
+    }
+
+    std::unique_lock<decltype(_returnedBuffersMutex)> lock{_returnedBuffersMutex};
+    // the owning thread does not keep more than the limit of each size class anyway
+    if (_returnedBuffers.size() >= SizeClasses.size() * MaxBuffersPerSizeClass)
+    {
+        return;
+    }
+    _returnedBuffers.emplace_back(std::move(buffer));
+    _numReturnedBuffers.store(_returnedBuffers.size(), std::memory_order_relaxed);
+}
+
+void BufferPool::TakeOverReturnedBuffers()
+{
+    std::vector<std::vector<uint8_t>> returnedBuffers;
+    {
+        std::unique_lock<decltype(_returnedBuffersMutex)> lock{_returnedBuffersMutex};
+        returnedBuffers.swap(_returnedBuffers);
+        _numReturnedBuffers.store(0, std::memory_order_relaxed);
+    }
+
+    for (auto& buffer : returnedBuffers)
+    {
+        Release(std::move(buffer));
+    }
+}
+
+auto BufferPool::GetStatistics() const -> BufferPoolStatistics
+{
+    return _statistics;
+}
+
+auto BufferPool::ThreadLocal() -> BufferPool&
+{
+    return *ThreadLocalShared();
+}
+
+auto BufferPool::ThreadLocalShared() -> const std::shared_ptr<BufferPool>&
+{
+    static thread_local const std::shared_ptr<BufferPool> pool{std::make_shared<BufferPool>()};
+    return pool;
+}
+
+} // namespace Core
+} // namespace SilKit
@@ -0,0 +1,75 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <stdint.h>
+
+namespace SilKit {
+namespace Core {
+
+struct BufferPoolStatistics
+{
+    //! Number of acquired buffers which were taken from the pool
+    uint64_t hits{0};
+    //! Number of acquired buffers which had to be allocated
+    uint64_t misses{0};
+};
+
+//! Recycles the storage of serialized messages, after they have been written to the socket or dispatched.
+//! A pool is not thread-safe, use the pool of the current thread (see ThreadLocal). Only ReleaseFromAnyThread may be
+//! called by other threads.
+class BufferPool
+{
+public:
+    // size classes, chosen to fit typical CAN/LIN, FlexRay, Ethernet, and small to large PubSub messages
+    static constexpr std::array<std::size_t, 5> SizeClasses{{64, 256, 2048, 16 * 1024, 64 * 1024}};
+    static constexpr std::size_t MaxBuffersPerSizeClass{64};
+
+public:
+    // constructors and destructors
+    BufferPool() = default;
+    BufferPool(const BufferPool&) = delete;
+    BufferPool& operator=(const BufferPool&) = delete;
+
+public:
+    // public methods
+
+    //! Returns an empty buffer with a capacity of at least minimumCapacity bytes
+    auto Acquire(std::size_t minimumCapacity) -> std::vector<uint8_t>;
+    //! Returns the buffer to the pool. Buffers which do not fit any size class, or which exceed the pool limits, are
+    //! freed.
+    void Release(std::vector<uint8_t> buffer);
+    //! Returns the buffer from another thread. The owning thread takes it over when its pool runs out of buffers.
+    void ReleaseFromAnyThread(std::vector<uint8_t> buffer);
+
+    auto GetStatistics() const -> BufferPoolStatistics;
+
+    //! The pool of the calling thread
+    static auto ThreadLocal() -> BufferPool&;
+    //! The pool of the calling thread, kept alive by buffers which are returned to it from other threads
+    static auto ThreadLocalShared() -> const std::shared_ptr<BufferPool>&;
+
+private:
+    // private methods
+    void TakeOverReturnedBuffers();
+
+private:
+    // member variables
+    std::array<std::vector<std::vector<uint8_t>>, SizeClasses.size()> _freeBuffers;
+    BufferPoolStatistics _statistics;
+
+    // buffers released by other threads
+    std::mutex _returnedBuffersMutex;
+    std::vector<std::vector<uint8_t>> _returnedBuffers;
+    std::atomic<std::size_t> _numReturnedBuffers{0};
+};
+
+} // namespace Core
+} // namespace SilKit
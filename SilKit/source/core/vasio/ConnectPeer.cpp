@@ -30,11 +30,13 @@ namespace VSilKit {
 
 
 ConnectPeer::ConnectPeer(IIoContext* ioContext, SilKit::Services::Logging::ILogger* logger,
-                         const SilKit::Core::VAsioPeerInfo& peerInfo, bool enableDomainSockets)
+                         const SilKit::Core::VAsioPeerInfo& peerInfo, bool enableDomainSockets,
+                         bool enableSharedMemory)
     : _ioContext{ioContext}
     , _logger{logger}
     , _peerInfo{peerInfo}
     , _enableDomainSockets{enableDomainSockets}
+    , _enableSharedMemory{enableSharedMemory}
 {
     SILKIT_ASSERT(_ioContext != nullptr);
     SILKIT_ASSERT(!_peerInfo.participantName.empty());
@@ -88,10 +90,26 @@ static auto IsIp6(const std::string& address) -> bool
 }
 
 
+static auto HasSharedMemoryCapability(const std::string& capabilities) -> bool
+{
+    try
+    {
+        return SilKit::Core::VAsioCapabilities{capabilities}.HasCapability(SilKit::Core::Capabilities::SharedMemory);
+    }
+    catch (const SilKit::SilKitError&)
+    {
+        return false;
+    }
+}
+
+
 void ConnectPeer::UpdateUris()
 {
     std::vector<Uri> acceptorUris;
 
+    // shared memory is only used if both sides have it enabled, otherwise the local-domain and tcp URIs are used
+    const bool useSharedMemory{_enableSharedMemory && HasSharedMemoryCapability(_peerInfo.capabilities)};
+
     for (const auto& str : _peerInfo.acceptorUris)
     {
         try
@@ -120,6 +138,13 @@ void ConnectPeer::UpdateUris()
                     acceptorUris.emplace_back(std::move(tcpUri));
                 }
             }
+            else if (uri.Type() == Uri::UriType::SharedMemory)
+            {
+                if (useSharedMemory)
+                {
+                    acceptorUris.emplace_back(std::move(uri));
+                }
+            }
             else
             {
                 acceptorUris.emplace_back(std::move(uri));
@@ -135,11 +160,13 @@ void ConnectPeer::UpdateUris()
         }
     }
 
-    // ensure local-domain URIs are tried first
+    // ensure shared memory and local-domain URIs are tried first
     std::stable_sort(acceptorUris.begin(), acceptorUris.end(), [](const Uri& lhs, const Uri& rhs) {
         const auto ComputePenalty{[](const Uri& uri) -> int {
             switch (uri.Type())
             {
+            case Uri::UriType::SharedMemory:
+                return 50;
             case Uri::UriType::Local:
                 return 100;
             case Uri::UriType::Tcp:
@@ -213,6 +240,10 @@ void ConnectPeer::TryNextUri()
             }
             break;
 
+        case Uri::UriType::SharedMemory:
+            _connector = _ioContext->MakeSharedMemoryConnector(uri.Path());
+            break;
+
         default:
             Log::Warn(_logger, "Invalid uri type {}", static_cast<std::underlying_type_t<Uri::UriType>>(uri.Type()));
             break;
@@ -58,6 +58,7 @@ class ConnectPeer
     SilKit::Services::Logging::ILogger* _logger{nullptr};
     SilKit::Core::VAsioPeerInfo _peerInfo;
     bool _enableDomainSockets{false};
+    bool _enableSharedMemory{false};
 
     IConnectPeerListener* _listener{nullptr};
 
@@ -71,7 +72,7 @@ class ConnectPeer
 
 public:
     ConnectPeer(IIoContext* ioContext, SilKit::Services::Logging::ILogger* logger,
-                const SilKit::Core::VAsioPeerInfo& peerInfo, bool enableDomainSockets);
+                const SilKit::Core::VAsioPeerInfo& peerInfo, bool enableDomainSockets, bool enableSharedMemory = false);
     ~ConnectPeer() override;
 
 public: // IConnectPeer
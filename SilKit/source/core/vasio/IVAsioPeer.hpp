@@ -31,10 +31,41 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "SerializedMessage.hpp"
 
+namespace VSilKit {
+struct ICounterMetric;
+struct IStatisticMetric;
+struct IHistogramMetric;
+} // namespace VSilKit
+
 namespace SilKit {
 namespace Core {
 
 
+//! Metrics of the queue of outgoing messages of a peer, any of them may be nullptr
+struct VAsioPeerSendQueueMetrics
+{
+    //! Number of queued messages, sampled whenever a write is started
+    VSilKit::IStatisticMetric* size{nullptr};
+    //! Number of queued bytes, sampled whenever a write is started
+    VSilKit::IStatisticMetric* bytes{nullptr};
+    //! Number of user data messages dropped due to the send queue limits
+    VSilKit::ICounterMetric* droppedMessages{nullptr};
+    //! Nanoseconds from queueing a message until it has been written completely
+    VSilKit::IHistogramMetric* latency{nullptr};
+};
+
+
+//! How long a peer holds back user data messages, such that they are sent by fewer writes. The messages to a peer keep
+//! the order in which they were sent, other messages sent while user data messages are held back are held back too.
+enum class VAsioAggregationMode
+{
+    //! Until the end of the simulation step, i.e., until a FlushAggregationMessage is sent
+    SimulationStep,
+    //! While a write to the peer is in progress (like Nagle's algorithm), which never delays a message on an idle peer
+    WhileWriting,
+};
+
+
 class IVAsioPeer : public IServiceEndpoint
 {
 public:
@@ -62,7 +93,13 @@ public:
     virtual void SetProtocolVersion(ProtocolVersion v) = 0;
     virtual auto GetProtocolVersion() const -> ProtocolVersion = 0;
 
-    virtual void EnableAggregation() = 0;
+    virtual void EnableAggregation(VAsioAggregationMode mode) = 0;
+
+    virtual void SetSendQueueMetrics(VAsioPeerSendQueueMetrics metrics) = 0;
+
+    //! Number of user data messages sent to the peer since it connected. The held back ones are sent first, and the
+    //! counted ones are no longer dropped by the limits of the send queue. Must be called on the io context.
+    virtual auto ReportSentUserDataMessages() -> uint64_t = 0;
 };
 
 
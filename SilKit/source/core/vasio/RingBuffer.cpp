@@ -34,6 +34,11 @@ void RingBuffer::AdvanceRPos(size_t numBytes)
 }
 
 bool RingBuffer::Peek(std::vector<uint8_t>& elem) const
+{
+    return Peek(Util::Span<uint8_t>{elem});
+}
+
+bool RingBuffer::Peek(Util::Span<uint8_t> elem) const
 {
     // make sure, we only copy as many bytes as are contained in the buffer
     if (elem.size() > _size)
@@ -67,6 +72,24 @@ bool RingBuffer::Read(std::vector<uint8_t>& elem)
     return true;
 }
 
+bool RingBuffer::Read(std::vector<uint8_t>& elem, size_t numBytes)
+{
+    if (numBytes > _size)
+    {
+        return false;
+    }
+
+    // copy data from first and second contiguous array (of occupied memory)
+    size_t numBytesArrayOne = std::min((Capacity() - _rPos), numBytes);
+    elem.reserve(numBytes);
+    elem.assign(std::next(_buffer.begin(), _rPos), std::next(_buffer.begin(), _rPos + numBytesArrayOne));
+    elem.insert(elem.end(), _buffer.begin(), std::next(_buffer.begin(), numBytes - numBytesArrayOne));
+
+    AdvanceRPos(numBytes);
+
+    return true;
+}
+
 void RingBuffer::GetWritingBuffers(std::vector<MutableBuffer>& buffers)
 {
     auto arrayOne = GetFreeMemoryArrayOne();
@@ -8,6 +8,7 @@
 #include <stdint.h>
 
 #include "util/Buffer.hpp"
+#include "silkit/util/Span.hpp"
 
 namespace SilKit {
 namespace Core {
@@ -24,7 +25,10 @@ public:
     std::size_t Size() const;
 
     bool Peek(std::vector<uint8_t>& elem) const;
+    bool Peek(Util::Span<uint8_t> elem) const;
     bool Read(std::vector<uint8_t>& elem);
+    // replaces the contents of elem with the next numBytes bytes, without initializing elem beforehand
+    bool Read(std::vector<uint8_t>& elem, std::size_t numBytes);
 
     void GetWritingBuffers(std::vector<MutableBuffer>& buffers);
 
@@ -0,0 +1,147 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "SendQueueBackpressure.hpp"
+
+namespace SilKit {
+namespace Core {
+
+SendQueueBackpressure::SendQueueBackpressure(size_t maxPendingMessages)
+    : _maxPendingMessages{maxPendingMessages}
+{
+}
+
+auto SendQueueBackpressure::Acquire(const std::string& networkName) -> bool
+{
+    // senders only take the lock if a send queue is full or too many messages are pending
+    if (_fullSendQueues != 0 || IsPendingLimitReached())
+    {
+        std::unique_lock<std::mutex> lock{_mutex};
+        if (IsBlocking(networkName))
+        {
+            ++_blockedSenders;
+            _condition.wait(lock, [this, &networkName] { return !IsBlocking(networkName); });
+            --_blockedSenders;
+        }
+    }
+
+    if (_isShutDown)
+    {
+        return false;
+    }
+
+    ++_pendingMessages;
+    return true;
+}
+
+void SendQueueBackpressure::Release()
+{
+    --_pendingMessages;
+    NotifyBlockedSenders();
+}
+
+void SendQueueBackpressure::SetSendQueueFull(const IVAsioPeer* peer, bool isFull)
+{
+    {
+        std::unique_lock<std::mutex> lock{_mutex};
+        UpdateFullReceivers(peer, isFull);
+    }
+
+    if (!isFull)
+    {
+        NotifyBlockedSenders();
+    }
+}
+
+void SendQueueBackpressure::AddReceiver(const IVAsioPeer* peer, const std::string& networkName)
+{
+    std::unique_lock<std::mutex> lock{_mutex};
+
+    const auto isNewNetwork = _networksOfPeer[peer].insert(networkName).second;
+    if (isNewNetwork && _fullPeers.count(peer) != 0)
+    {
+        ++_fullReceiversOfNetwork[networkName];
+    }
+}
+
+void SendQueueBackpressure::RemovePeer(const IVAsioPeer* peer)
+{
+    {
+        std::unique_lock<std::mutex> lock{_mutex};
+        UpdateFullReceivers(peer, false);
+        _networksOfPeer.erase(peer);
+    }
+
+    NotifyBlockedSenders();
+}
+
+void SendQueueBackpressure::Shutdown()
+{
+    _isShutDown = true;
+
+    std::unique_lock<std::mutex> lock{_mutex};
+    _condition.notify_all();
+}
+
+bool SendQueueBackpressure::IsBlocking(const std::string& networkName) const
+{
+    if (_isShutDown)
+    {
+        return false;
+    }
+
+    const auto it = _fullReceiversOfNetwork.find(networkName);
+    return IsPendingLimitReached() || (it != _fullReceiversOfNetwork.end() && it->second != 0);
+}
+
+bool SendQueueBackpressure::IsPendingLimitReached() const
+{
+    return _maxPendingMessages != 0 && _pendingMessages >= _maxPendingMessages;
+}
+
+void SendQueueBackpressure::UpdateFullReceivers(const IVAsioPeer* peer, bool isFull)
+{
+    const auto wasFull = _fullPeers.count(peer) != 0;
+    if (wasFull == isFull)
+    {
+        return;
+    }
+
+    if (isFull)
+    {
+        _fullPeers.insert(peer);
+        ++_fullSendQueues;
+    }
+    else
+    {
+        _fullPeers.erase(peer);
+        --_fullSendQueues;
+    }
+
+    const auto networksIt = _networksOfPeer.find(peer);
+    if (networksIt == _networksOfPeer.end())
+    {
+        return;
+    }
+
+    for (const auto& networkName : networksIt->second)
+    {
+        auto& fullReceivers = _fullReceiversOfNetwork[networkName];
+        fullReceivers = isFull ? fullReceivers + 1 : fullReceivers - 1;
+    }
+}
+
+void SendQueueBackpressure::NotifyBlockedSenders()
+{
+    // a sender increments the counter before it checks the condition under the lock, taking the lock here ensures it
+    // is either waiting already, or sees the changed condition
+    if (_blockedSenders != 0)
+    {
+        std::unique_lock<std::mutex> lock{_mutex};
+        _condition.notify_all();
+    }
+}
+
+} // namespace Core
+} // namespace SilKit
@@ -0,0 +1,81 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <stddef.h>
+
+namespace SilKit {
+namespace Core {
+
+class IVAsioPeer;
+
+//! Holds back the threads sending user data messages on a network, while the send queue of a peer receiving on that
+//! network exceeds its limits (the Block overflow policy). The peers report the state of their send queues from the io
+//! context. The senders wait before they hand a message over to the io context, so neither the io context nor its
+//! handler queue grow without limit.
+class SendQueueBackpressure
+{
+public:
+    // constructors and destructors
+
+    //! At most maxPendingMessages messages are handed over to the io context, but not yet queued by the peers. 0 is
+    //! unlimited.
+    explicit SendQueueBackpressure(size_t maxPendingMessages);
+    SendQueueBackpressure(const SendQueueBackpressure&) = delete;
+    SendQueueBackpressure& operator=(const SendQueueBackpressure&) = delete;
+
+public:
+    // public methods
+
+    //! Blocks the calling thread while the send queue of a peer receiving on the network is full, or too many messages
+    //! are pending. Returns false if the message is not counted as pending, because the backpressure was shut down
+    //! meanwhile.
+    auto Acquire(const std::string& networkName) -> bool;
+    //! Called on the io context after an acquired message has been queued by the peers
+    void Release();
+
+    //! Called on the io context whenever the send queue of a peer starts or stops exceeding its limits
+    void SetSendQueueFull(const IVAsioPeer* peer, bool isFull);
+    //! Called on the io context when messages on the network are sent to the peer
+    void AddReceiver(const IVAsioPeer* peer, const std::string& networkName);
+    //! Called on the io context when the peer is gone, the senders no longer wait for its send queue
+    void RemovePeer(const IVAsioPeer* peer);
+
+    //! Releases all blocked senders, and lets all following ones pass
+    void Shutdown();
+
+private:
+    // private methods
+    //! Requires the lock
+    bool IsBlocking(const std::string& networkName) const;
+    bool IsPendingLimitReached() const;
+    void UpdateFullReceivers(const IVAsioPeer* peer, bool isFull);
+    void NotifyBlockedSenders();
+
+private:
+    // private members
+    const size_t _maxPendingMessages;
+    std::atomic<size_t> _pendingMessages{0};
+    std::atomic<size_t> _fullSendQueues{0};
+    std::atomic_bool _isShutDown{false};
+
+    std::mutex _mutex;
+    std::condition_variable _condition;
+    std::atomic<size_t> _blockedSenders{0};
+
+    // guarded by _mutex
+    std::unordered_set<const IVAsioPeer*> _fullPeers;
+    std::unordered_map<const IVAsioPeer*, std::unordered_set<std::string>> _networksOfPeer;
+    std::unordered_map<std::string, size_t> _fullReceiversOfNetwork;
+};
+
+} // namespace Core
+} // namespace SilKit
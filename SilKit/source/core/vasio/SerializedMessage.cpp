@@ -32,13 +32,27 @@ SerializedMessage::SerializedMessage(std::vector<uint8_t>&& blob)
 }
 
 auto SerializedMessage::ReleaseStorage() -> std::vector<uint8_t>
+{
+    Util::SharedVector<uint8_t> sharedPayload;
+    auto buffer = ReleaseStorage(sharedPayload);
+
+    const auto payload = sharedPayload.AsSpan();
+    buffer.insert(buffer.end(), payload.begin(), payload.end());
+    return buffer;
+}
+
+auto SerializedMessage::ReleaseStorage(Util::SharedVector<uint8_t>& sharedPayload) -> std::vector<uint8_t>
 {
     auto buffer = _buffer.ReleaseStorage();
-    if (buffer.size() > std::numeric_limits<uint32_t>::max())
+    sharedPayload = std::move(_sharedPayload);
+    _sharedPayload = {};
+
+    const auto messageSize = buffer.size() + sharedPayload.AsSpan().size();
+    if (messageSize > std::numeric_limits<uint32_t>::max())
         throw SilKitError{"SerializedMessage::Serialize: message buffer is too large"};
 
-    // emplace the buffer size as the first element in the byte stream
-    const auto bufferSize = static_cast<uint32_t>(buffer.size());
+    // emplace the message size as the first element in the byte stream
+    const auto bufferSize = static_cast<uint32_t>(messageSize);
     memcpy(buffer.data(), &bufferSize, sizeof(uint32_t));
     return buffer;
 }
@@ -93,6 +107,21 @@ auto SerializedMessage::GetProxyMessageHeader() const -> ProxyMessageHeader
     return _proxyMessageHeader;
 }
 
+auto SerializedMessage::NetworkHeadersSize() const -> size_t
+{
+    // see WriteNetworkHeaders()
+    size_t size = sizeof(_messageSize) + sizeof(_messageKind);
+    if (_messageKind == VAsioMsgKind::SilKitRegistryMessage)
+    {
+        size += sizeof(_registryKind);
+    }
+    if (IsMwOrSim(_messageKind))
+    {
+        size += sizeof(_remoteIndex) + sizeof(_endpointAddress.participant) + sizeof(_endpointAddress.endpoint);
+    }
+    return size;
+}
+
 void SerializedMessage::WriteNetworkHeaders()
 {
     _buffer << _messageSize; // placeholder for finalization via ReleaseStorage()
@@ -168,5 +197,82 @@ void SerializedMessage::SetAggregationKind(MessageAggregationKind msgAggregation
     _aggregationKind = msgAggregationKind;
 }
 
+void SerializedMessage::SetRemoteIndex(EndpointId remoteIndex)
+{
+    if (!IsMwOrSim(_messageKind))
+    {
+        throw SilKitError("SerializedMessage::SetRemoteIndex called on wrong message kind: "
+                          + std::to_string((int)_messageKind));
+    }
+
+    _remoteIndex = remoteIndex;
+
+    // the remote index directly follows the message size and message kind, see WriteNetworkHeaders()
+    const auto writePos = _buffer.WritePos();
+    _buffer.SetWritePos(sizeof(_messageSize) + sizeof(_messageKind));
+    _buffer << _remoteIndex;
+    _buffer.SetWritePos(writePos);
+}
+
+void SerializedMessage::SharePayload()
+{
+    if (!IsMwOrSim(_messageKind))
+    {
+        throw SilKitError("SerializedMessage::SharePayload called on wrong message kind: "
+                          + std::to_string((int)_messageKind));
+    }
+    if (!_sharedPayload.AsSpan().empty())
+    {
+        return;
+    }
+
+    const auto headersSize = NetworkHeadersSize();
+    const auto readPos = _buffer.ReadPos();
+    const auto version = _buffer.GetProtocolVersion();
+
+    // the storage is returned to the pool of this thread, even if another thread releases the last copy of the message
+    auto storage = std::shared_ptr<std::vector<uint8_t>>{
+        new std::vector<uint8_t>{_buffer.ReleaseStorage()},
+        [owningPool = BufferPool::ThreadLocalShared()](std::vector<uint8_t>* sharedStorage) {
+        owningPool->ReleaseFromAnyThread(std::move(*sharedStorage));
+        delete sharedStorage;
+    }};
+
+    auto headers = BufferPool::ThreadLocal().Acquire(headersSize);
+    headers.assign(storage->begin(), storage->begin() + headersSize);
+
+    _sharedPayload = Util::SharedVector<uint8_t>{
+        storage, Util::Span<const uint8_t>{storage->data() + headersSize, storage->size() - headersSize}};
+    _buffer = MessageBuffer{std::move(headers)};
+    _buffer.SetProtocolVersion(version);
+    _buffer.SetReadPos(readPos);
+}
+
+void SerializedMessage::RecycleStorage()
+{
+    if (_buffer.IsStorageShared())
+    {
+        return;
+    }
+
+    BufferPool::ThreadLocal().Release(_buffer.ReleaseStorage());
+}
+
+auto SerializedMessage::UnsharedBuffer() const -> MessageBuffer
+{
+    auto bufferCopy = _buffer;
+    const auto readPos = bufferCopy.ReadPos();
+    const auto version = bufferCopy.GetProtocolVersion();
+
+    auto storage = bufferCopy.ReleaseStorage();
+    const auto payload = _sharedPayload.AsSpan();
+    storage.insert(storage.end(), payload.begin(), payload.end());
+
+    MessageBuffer buffer{std::move(storage)};
+    buffer.SetProtocolVersion(version);
+    buffer.SetReadPos(readPos);
+    return buffer;
+}
+
 } // namespace Core
 } // namespace SilKit
@@ -24,6 +24,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "SerializedMessageTraits.hpp"
 #include "AggregationMessageTraits.hpp"
 #include "MessageBuffer.hpp"
+#include "BufferPool.hpp"
 
 // Component specific Serialize/Deserialize functions
 #include "VAsioSerdes.hpp"
@@ -66,6 +67,31 @@ struct SerializedSize
     }
 };
 
+template <typename T, typename = void>
+struct HasSerializedSizeOf : std::false_type
+{
+};
+
+template <typename T>
+struct HasSerializedSizeOf<T, decltype(void(SerializedSizeOf(std::declval<const T&>())))> : std::true_type
+{
+};
+
+// The exact serialized size for message types with a SerializedSizeOf overload, e.g., messages with a variable sized
+// payload. For all other message types, the serialized size of the first message is used.
+template <typename T>
+auto SerializedSizeHint(const T& message) -> std::enable_if_t<HasSerializedSizeOf<T>::value, size_t>
+{
+    return SerializedSizeOf(message);
+}
+
+template <typename T>
+auto SerializedSizeHint(const T& message) -> std::enable_if_t<!HasSerializedSizeOf<T>::value, size_t>
+{
+    static SerializedSize<T> messageSize{message};
+    return messageSize.Size();
+}
+
 // A serialized message used as binary wire format for the VAsio transport.
 class SerializedMessage
 {
@@ -85,6 +111,9 @@ public: // Sending a SerializedMessage: from T to binary blob
     explicit SerializedMessage(ProtocolVersion version, const MessageT& message);
 
     auto ReleaseStorage() -> std::vector<uint8_t>;
+    //! Release the network headers and the shared payload separately, they have to be sent back to back. The shared
+    //! payload is empty, unless SharePayload was called.
+    auto ReleaseStorage(Util::SharedVector<uint8_t>& sharedPayload) -> std::vector<uint8_t>;
 
 public: // Receiving a SerializedMessage: from binary blob to SilKitMessage<T>
     explicit SerializedMessage(std::vector<uint8_t>&& blob);
@@ -104,10 +133,23 @@ public: // Receiving a SerializedMessage: from binary blob to SilKitMessage<T>
     auto GetRegistryMessageHeader() const -> RegistryMsgHeader;
 
     void SetAggregationKind(MessageAggregationKind msgAggregationKind);
+    //! Overwrite the remote index of an already serialized sim message in place, without serializing it again.
+    void SetRemoteIndex(EndpointId remoteIndex);
+
+    //! Share the payload of a sim message with all copies of this message. The copies only get their own network
+    //! headers, e.g., to patch in the remote index of each receiver, instead of a copy of the whole message.
+    void SharePayload();
+
+    //! Return the storage of a received message to the buffer pool of the calling thread, unless the deserialized
+    //! message still refers to it.
+    void RecycleStorage();
 
 private:
+    auto NetworkHeadersSize() const -> size_t;
     void WriteNetworkHeaders();
     void ReadNetworkHeaders();
+    // the network headers and the shared payload in a single buffer, positioned like _buffer
+    auto UnsharedBuffer() const -> MessageBuffer;
     // network headers, some members are optional depending on messageKind
     uint32_t _messageSize{0};
     VAsioMsgKind _messageKind{VAsioMsgKind::Invalid};
@@ -122,6 +164,8 @@ private:
     ProxyMessageHeader _proxyMessageHeader;
 
     MessageBuffer _buffer;
+    // the payload following the network headers in _buffer, if it is shared, see SharePayload()
+    Util::SharedVector<uint8_t> _sharedPayload;
 };
 
 //////////////////////////////////////////////////////////////////////
@@ -130,12 +174,10 @@ private:
 template <typename MessageT>
 SerializedMessage::SerializedMessage(const MessageT& message)
 {
-    static SerializedSize<MessageT> messageSize{message};
-    _buffer.IncreaseCapacity(messageSize.Size());
-
     _messageKind = messageKind<MessageT>();
     _registryKind = registryMessageKind<MessageT>();
     _aggregationKind = aggregationKind<MessageT>();
+    _buffer = MessageBuffer{BufferPool::ThreadLocal().Acquire(NetworkHeadersSize() + SerializedSizeHint(message))};
     WriteNetworkHeaders();
     Serialize(_buffer, message);
     //Ensure we can directly Deserialize in unit tests by reading the header in again
@@ -145,12 +187,10 @@ SerializedMessage::SerializedMessage(const MessageT& message)
 template <typename MessageT>
 SerializedMessage::SerializedMessage(ProtocolVersion version, const MessageT& message)
 {
-    static SerializedSize<MessageT> messageSize{message};
-    _buffer.IncreaseCapacity(messageSize.Size());
-
     _messageKind = messageKind<MessageT>();
     _registryKind = registryMessageKind<MessageT>();
     _aggregationKind = aggregationKind<MessageT>();
+    _buffer = MessageBuffer{BufferPool::ThreadLocal().Acquire(NetworkHeadersSize() + SerializedSizeHint(message))};
     _buffer.SetProtocolVersion(version);
     WriteNetworkHeaders();
     Serialize(_buffer, message);
@@ -161,14 +201,12 @@ SerializedMessage::SerializedMessage(ProtocolVersion version, const MessageT& me
 template <typename MessageT>
 SerializedMessage::SerializedMessage(const MessageT& message, EndpointAddress endpointAddress, EndpointId remoteIndex)
 {
-    static SerializedSize<MessageT> messageSize{message};
-    _buffer.IncreaseCapacity(messageSize.Size());
-
     _remoteIndex = remoteIndex;
     _endpointAddress = endpointAddress;
     _messageKind = messageKind<MessageT>();
     _registryKind = registryMessageKind<MessageT>();
     _aggregationKind = aggregationKind<MessageT>();
+    _buffer = MessageBuffer{BufferPool::ThreadLocal().Acquire(NetworkHeadersSize() + SerializedSizeHint(message))};
     WriteNetworkHeaders();
     Serialize(_buffer, message);
     //Ensure we can directly Deserialize in unit tests by reading the header in again
@@ -178,6 +216,12 @@ SerializedMessage::SerializedMessage(const MessageT& message, EndpointAddress en
 template <typename ApiMessageT>
 auto SerializedMessage::Deserialize() -> ApiMessageT
 {
+    if (!_sharedPayload.AsSpan().empty())
+    {
+        _buffer = UnsharedBuffer();
+        _sharedPayload = {};
+    }
+
     ApiMessageT value{};
     AdlDeserialize(_buffer, value);
     return value;
@@ -186,7 +230,7 @@ auto SerializedMessage::Deserialize() -> ApiMessageT
 template <typename ApiMessageT>
 auto SerializedMessage::Deserialize() const -> ApiMessageT
 {
-    auto bufferCopy = _buffer;
+    auto bufferCopy = _sharedPayload.AsSpan().empty() ? _buffer : UnsharedBuffer();
     ApiMessageT value{};
     AdlDeserialize(bufferCopy, value);
     return value;
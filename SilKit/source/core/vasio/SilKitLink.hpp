@@ -21,6 +21,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #pragma once
 
+#include "Assert.hpp"
 #include "LoggerMessage.hpp"
 
 #include "VAsioTransmitter.hpp"
@@ -73,12 +74,43 @@ public:
 
     void SetHistoryLength(size_t history);
 
+    void SetRemoteReceiverFilter(const std::string& participantName, std::function<bool(const MsgT&)> filter);
+
     void DispatchSilKitMessageToTarget(const IServiceEndpoint* from, const std::string& targetParticipantName,
                                        const MsgT& msg);
 
+private:
+    // ----------------------------------------
+    // private types
+
+    //! Identity of an endpoint on this link. All endpoints on a link have the same network name, so comparing the
+    //! remaining fields of ServiceDescriptor::operator== is sufficient.
+    struct EndpointKey
+    {
+        ParticipantId participantId;
+        EndpointId serviceId;
+        ServiceType serviceType;
+
+        bool operator==(const EndpointKey& other) const
+        {
+            return serviceId == other.serviceId && participantId == other.participantId
+                   && serviceType == other.serviceType;
+        }
+    };
+
+    //! A local receiver, with its endpoint and identity resolved when it is added to the link
+    struct LocalReceiver
+    {
+        ReceiverT* receiver;
+        const IServiceEndpoint* endpoint;
+        EndpointKey key;
+    };
+
 private:
     // ----------------------------------------
     // private methods
+    static auto MakeEndpointKey(const ServiceDescriptor& serviceDescriptor) -> EndpointKey;
+
     void DispatchSilKitMessage(ReceiverT* to, const IServiceEndpoint* from, const MsgT& msg);
     void DistributeToSelf(const IServiceEndpoint* from, const MsgT& msg);
 
@@ -89,7 +121,7 @@ private:
     Services::Logging::ILoggerInternal* _logger;
     Services::Orchestration::ITimeProvider* _timeProvider;
 
-    std::vector<ReceiverT*> _localReceivers;
+    std::vector<LocalReceiver> _localReceivers;
     VAsioTransmitter<MsgT> _vasioTransmitter;
 };
 
@@ -106,12 +138,26 @@ SilKitLink<MsgT>::SilKitLink(std::string name, Services::Logging::ILoggerInterna
 {
 }
 
+template <class MsgT>
+auto SilKitLink<MsgT>::MakeEndpointKey(const ServiceDescriptor& serviceDescriptor) -> EndpointKey
+{
+    return EndpointKey{serviceDescriptor.GetParticipantId(), serviceDescriptor.GetServiceId(),
+                       serviceDescriptor.GetServiceType()};
+}
+
 template <class MsgT>
 void SilKitLink<MsgT>::AddLocalReceiver(ReceiverT* receiver)
 {
-    if (std::find(_localReceivers.begin(), _localReceivers.end(), receiver) != _localReceivers.end())
+    if (std::find_if(_localReceivers.begin(), _localReceivers.end(),
+                     [receiver](const LocalReceiver& localReceiver) { return localReceiver.receiver == receiver; })
+        != _localReceivers.end())
         return;
-    _localReceivers.push_back(receiver);
+
+    // The service descriptor of a receiver is set before it is registered, and does not change afterwards
+    const auto* endpoint = dynamic_cast<const IServiceEndpoint*>(receiver);
+    SILKIT_ASSERT(endpoint != nullptr);
+
+    _localReceivers.push_back(LocalReceiver{receiver, endpoint, MakeEndpointKey(endpoint->GetServiceDescriptor())});
 }
 
 template <class MsgT>
@@ -164,9 +210,9 @@ void SilKitLink<MsgT>::DistributeRemoteSilKitMessage(const IServiceEndpoint* fro
         SetTimestamp(msg, _timeProvider->Now());
     }
 
-    for (auto&& receiver : _localReceivers)
+    for (auto&& localReceiver : _localReceivers)
     {
-        DispatchSilKitMessage(receiver, from, msg);
+        DispatchSilKitMessage(localReceiver.receiver, from, msg);
     }
 }
 
@@ -184,25 +230,27 @@ void SilKitLink<MsgT>::DistributeLocalSilKitMessage(const IServiceEndpoint* from
 template <class MsgT>
 void SilKitLink<MsgT>::DistributeToSelf(const IServiceEndpoint* from, const MsgT& msg)
 {
-    for (auto&& receiver : _localReceivers)
+    // C++ 17 -> if constexpr
+    if (SilKitMsgTraits<MsgT>::IsSelfDeliveryForbidden())
     {
-        auto* receiverId = dynamic_cast<const IServiceEndpoint*>(receiver);
+        return;
+    }
 
-        // C++ 17 -> if constexpr
-        if (SilKitMsgTraits<MsgT>::IsSelfDeliveryForbidden())
-        {
-            continue;
-        }
+    const auto& fromDescriptor = from->GetServiceDescriptor();
+    const auto fromKey = MakeEndpointKey(fromDescriptor);
+
+    for (auto&& localReceiver : _localReceivers)
+    {
         // C++ 17 -> if constexpr
         if (!SilKitMsgTraits<MsgT>::IsSelfDeliveryEnforced())
         {
-            if (receiverId->GetServiceDescriptor() == from->GetServiceDescriptor())
+            if (localReceiver.key == fromKey)
                 continue;
         }
         // Trace reception of self delivery
-        Services::TraceRx(_logger, receiverId, msg, from->GetServiceDescriptor());
+        Services::TraceRx(_logger, localReceiver.endpoint, msg, fromDescriptor);
 
-        DispatchSilKitMessage(receiver, from, msg);
+        DispatchSilKitMessage(localReceiver.receiver, from, msg);
     }
 }
 
@@ -245,5 +293,12 @@ void SilKitLink<MsgT>::SetHistoryLength(size_t history)
     _vasioTransmitter.SetHistoryLength(history);
 }
 
+template <class MsgT>
+void SilKitLink<MsgT>::SetRemoteReceiverFilter(const std::string& participantName,
+                                               std::function<bool(const MsgT&)> filter)
+{
+    _vasioTransmitter.SetRemoteReceiverFilter(participantName, std::move(filter));
+}
+
 } // namespace Core
 } // namespace SilKit
@@ -0,0 +1,108 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "BufferPool.hpp"
+
+#include <thread>
+
+#include "gtest/gtest.h"
+
+namespace {
+
+using namespace SilKit::Core;
+
+TEST(Test_BufferPool, acquire_uses_smallest_sufficient_size_class)
+{
+    BufferPool pool;
+
+    auto buffer = pool.Acquire(100);
+    EXPECT_TRUE(buffer.empty());
+    EXPECT_GE(buffer.capacity(), 256u);
+    EXPECT_LT(buffer.capacity(), 2048u);
+
+    EXPECT_EQ(pool.GetStatistics().hits, 0u);
+    EXPECT_EQ(pool.GetStatistics().misses, 1u);
+}
+
+TEST(Test_BufferPool, released_buffers_are_reused)
+{
+    BufferPool pool;
+
+    auto buffer = pool.Acquire(100);
+    buffer.resize(200, 0xAB);
+    const auto* data = buffer.data();
+    pool.Release(std::move(buffer));
+
+    auto reused = pool.Acquire(150);
+    EXPECT_TRUE(reused.empty());
+    EXPECT_EQ(reused.data(), data);
+
+    EXPECT_EQ(pool.GetStatistics().hits, 1u);
+    EXPECT_EQ(pool.GetStatistics().misses, 1u);
+}
+
+TEST(Test_BufferPool, released_buffers_serve_only_smaller_or_equal_size_classes)
+{
+    BufferPool pool;
+
+    pool.Release(pool.Acquire(64));
+
+    auto buffer = pool.Acquire(100);
+    EXPECT_GE(buffer.capacity(), 100u);
+
+    EXPECT_EQ(pool.GetStatistics().hits, 0u);
+    EXPECT_EQ(pool.GetStatistics().misses, 2u);
+}
+
+TEST(Test_BufferPool, oversized_buffers_are_not_retained)
+{
+    BufferPool pool;
+
+    const auto oversized = BufferPool::SizeClasses.back() + 1;
+    pool.Release(pool.Acquire(oversized));
+    pool.Acquire(oversized);
+
+    EXPECT_EQ(pool.GetStatistics().hits, 0u);
+    EXPECT_EQ(pool.GetStatistics().misses, 2u);
+}
+
+TEST(Test_BufferPool, number_of_retained_buffers_is_limited)
+{
+    BufferPool pool;
+
+    std::vector<std::vector<uint8_t>> buffers;
+    for (size_t i = 0; i < BufferPool::MaxBuffersPerSizeClass + 1; ++i)
+    {
+        buffers.emplace_back(pool.Acquire(64));
+    }
+    for (auto& buffer : buffers)
+    {
+        pool.Release(std::move(buffer));
+    }
+    for (size_t i = 0; i < BufferPool::MaxBuffersPerSizeClass + 1; ++i)
+    {
+        pool.Acquire(64);
+    }
+
+    EXPECT_EQ(pool.GetStatistics().hits, BufferPool::MaxBuffersPerSizeClass);
+    EXPECT_EQ(pool.GetStatistics().misses, BufferPool::MaxBuffersPerSizeClass + 2);
+}
+
+TEST(Test_BufferPool, buffers_released_by_other_threads_return_to_the_owning_pool)
+{
+    BufferPool pool;
+
+    auto buffer = pool.Acquire(100);
+    const auto* data = buffer.data();
+    std::thread{[&pool, &buffer] { pool.ReleaseFromAnyThread(std::move(buffer)); }}.join();
+
+    // the pool of the other thread is not involved
+    auto reused = pool.Acquire(150);
+    EXPECT_EQ(reused.data(), data);
+
+    EXPECT_EQ(pool.GetStatistics().hits, 1u);
+    EXPECT_EQ(pool.GetStatistics().misses, 1u);
+}
+
+} // namespace
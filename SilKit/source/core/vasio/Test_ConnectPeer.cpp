@@ -165,6 +165,78 @@ TEST_F(Test_ConnectPeer, local_is_tried_before_tcp_but_order_is_stable)
 }
 
 
+TEST_F(Test_ConnectPeer, shared_memory_is_tried_before_local_if_both_sides_enable_it)
+{
+    static constexpr bool DOMAIN_SOCKETS_ENABLED{true};
+    static constexpr bool SHARED_MEMORY_ENABLED{true};
+    static constexpr auto TIMEOUT{4321ms};
+
+    auto MakeConnector{[this] { return MakeConnectorThatFails(TIMEOUT); }};
+
+    // Arrange
+
+    Sequence s1;
+
+    EXPECT_CALL(ioContext, MakeSharedMemoryConnector("/some/path.shm")).InSequence(s1).WillOnce(MakeConnector);
+    EXPECT_CALL(ioContext, MakeLocalConnector("/some/path")).InSequence(s1).WillOnce(MakeConnector);
+
+    MockConnectPeerListener connectPeerListener;
+    EXPECT_CALL(connectPeerListener, OnConnectPeerSuccess).Times(0);
+    EXPECT_CALL(connectPeerListener, OnConnectPeerFailure).Times(1).InSequence(s1);
+
+    // Act
+
+    VAsioPeerInfo peerInfo;
+    peerInfo.participantName = "A";
+    peerInfo.participantId = SilKit::Util::Hash::Hash(peerInfo.participantName);
+    peerInfo.acceptorUris.emplace_back("local:///some/path");
+    peerInfo.acceptorUris.emplace_back("shm:///some/path.shm");
+    peerInfo.capabilities = R"([{"name":"shared-memory"}])";
+
+    ConnectPeer connectPeer{&ioContext, &logger, peerInfo, DOMAIN_SOCKETS_ENABLED, SHARED_MEMORY_ENABLED};
+    connectPeer.SetListener(connectPeerListener);
+    connectPeer.AsyncConnect(1, TIMEOUT);
+
+    ioContext.Run();
+}
+
+
+TEST_F(Test_ConnectPeer, shared_memory_is_skipped_if_the_peer_does_not_have_the_capability)
+{
+    static constexpr bool DOMAIN_SOCKETS_ENABLED{true};
+    static constexpr bool SHARED_MEMORY_ENABLED{true};
+    static constexpr auto TIMEOUT{4321ms};
+
+    auto MakeConnector{[this] { return MakeConnectorThatFails(TIMEOUT); }};
+
+    // Arrange
+
+    Sequence s1;
+
+    EXPECT_CALL(ioContext, MakeSharedMemoryConnector(_)).Times(0);
+    EXPECT_CALL(ioContext, MakeLocalConnector("/some/path")).InSequence(s1).WillOnce(MakeConnector);
+
+    MockConnectPeerListener connectPeerListener;
+    EXPECT_CALL(connectPeerListener, OnConnectPeerSuccess).Times(0);
+    EXPECT_CALL(connectPeerListener, OnConnectPeerFailure).Times(1).InSequence(s1);
+
+    // Act
+
+    VAsioPeerInfo peerInfo;
+    peerInfo.participantName = "A";
+    peerInfo.participantId = SilKit::Util::Hash::Hash(peerInfo.participantName);
+    peerInfo.acceptorUris.emplace_back("local:///some/path");
+    peerInfo.acceptorUris.emplace_back("shm:///some/path.shm");
+    peerInfo.capabilities = "";
+
+    ConnectPeer connectPeer{&ioContext, &logger, peerInfo, DOMAIN_SOCKETS_ENABLED, SHARED_MEMORY_ENABLED};
+    connectPeer.SetListener(connectPeerListener);
+    connectPeer.AsyncConnect(1, TIMEOUT);
+
+    ioContext.Run();
+}
+
+
 TEST_F(Test_ConnectPeer, retry_count_is_honored)
 {
     static constexpr bool DOMAIN_SOCKETS_ENABLED{true};
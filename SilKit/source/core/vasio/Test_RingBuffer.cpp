@@ -82,6 +82,31 @@ TEST(Test_RingBuffer, writeSingle)
     }
 }
 
+// reading into an empty vector, and peeking into a span, across the wrap-around of the ring buffer
+TEST(Test_RingBuffer, readNumBytes_peekSpan)
+{
+    const size_t capacity{10};
+    RingBuffer ringBuffer(capacity);
+
+    Write(ringBuffer, {0, 0, 0, 0, 0, 0, 0});
+    std::vector<uint8_t> discard;
+    ASSERT_TRUE(ringBuffer.Read(discard, 7));
+    ASSERT_EQ(discard.size(), 7u);
+
+    const std::vector<uint8_t> elem{1, 2, 3, 4, 5, 6};
+    Write(ringBuffer, elem);
+
+    uint8_t peeked[4]{};
+    ASSERT_TRUE(ringBuffer.Peek(SilKit::Util::Span<uint8_t>{peeked, sizeof(peeked)}));
+    ASSERT_EQ(std::vector<uint8_t>(std::begin(peeked), std::end(peeked)), (std::vector<uint8_t>{1, 2, 3, 4}));
+
+    std::vector<uint8_t> readData{9, 9};
+    ASSERT_FALSE(ringBuffer.Read(readData, elem.size() + 1));
+    ASSERT_TRUE(ringBuffer.Read(readData, elem.size()));
+    ASSERT_EQ(elem, readData);
+    ASSERT_EQ(ringBuffer.Size(), 0u);
+}
+
 // resizing of ring buffer (via Reserve)
 TEST(Test_RingBuffer, resizeRingBuffer)
 {
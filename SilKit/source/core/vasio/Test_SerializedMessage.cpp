@@ -24,6 +24,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include <cstdint>
 #include <array>
 #include <string>
+#include <thread>
 
 #include "gtest/gtest.h"
 
@@ -99,3 +100,208 @@ TEST(Test_SerializedMessage, packed_handshake_message)
     ASSERT_EQ(ptr->simulationNameSize, announcement.simulationName.size());
     ASSERT_EQ(to_string(ptr->simulationName, ptr->simulationNameSize), announcement.simulationName);
 }
+
+TEST(Test_SerializedMessage, set_remote_index_patches_serialized_sim_message)
+{
+    using namespace SilKit::Services::PubSub;
+
+    const std::vector<uint8_t> payload{1, 2, 3, 4, 5, 6, 7, 8};
+    const EndpointAddress endpointAddress{1234, 5678};
+
+    WireDataMessageEvent event{std::chrono::nanoseconds{42}, payload};
+
+    SerializedMessage original{event, endpointAddress, 1};
+    auto patched = original;
+    patched.SetRemoteIndex(7);
+    ASSERT_EQ(patched.GetRemoteIndex(), 7u);
+
+    auto originalBlob = original.ReleaseStorage();
+    auto patchedBlob = patched.ReleaseStorage();
+    ASSERT_EQ(originalBlob.size(), patchedBlob.size());
+
+    // reading the patched blob yields the new remote index and the unmodified remaining message
+    SerializedMessage received{std::move(patchedBlob)};
+    ASSERT_EQ(received.GetMessageKind(), VAsioMsgKind::SilKitMwMsg);
+    ASSERT_EQ(received.GetRemoteIndex(), 7u);
+    ASSERT_EQ(received.GetEndpointAddress(), endpointAddress);
+
+    auto receivedEvent = received.Deserialize<WireDataMessageEvent>();
+    ASSERT_EQ(receivedEvent.timestamp, event.timestamp);
+    ASSERT_TRUE(ItemsAreEqual(receivedEvent.data, event.data));
+}
+
+TEST(Test_SerializedMessage, copies_of_a_message_with_shared_payload_only_differ_in_their_network_headers)
+{
+    using namespace SilKit::Services::PubSub;
+
+    const EndpointAddress endpointAddress{1234, 5678};
+    WireDataMessageEvent event{std::chrono::nanoseconds{42}, std::vector<uint8_t>(1024, 0xAB)};
+
+    SerializedMessage original{event, endpointAddress, 1};
+    const auto contiguousBlob = SerializedMessage{event, endpointAddress, 7}.ReleaseStorage();
+
+    original.SharePayload();
+    auto patched = original;
+    patched.SetRemoteIndex(7);
+
+    SilKit::Util::SharedVector<uint8_t> originalPayload;
+    SilKit::Util::SharedVector<uint8_t> patchedPayload;
+    const auto originalHeaders = original.ReleaseStorage(originalPayload);
+    auto patchedHeaders = patched.ReleaseStorage(patchedPayload);
+
+    // the payload is not copied, only the network headers
+    ASSERT_EQ(originalPayload.AsSpan().data(), patchedPayload.AsSpan().data());
+    ASSERT_EQ(originalHeaders.size(), patchedHeaders.size());
+    ASSERT_LT(patchedHeaders.size(), 32u);
+
+    // the headers followed by the shared payload are the same message as the contiguous one
+    const auto payload = patchedPayload.AsSpan();
+    patchedHeaders.insert(patchedHeaders.end(), payload.begin(), payload.end());
+    ASSERT_EQ(patchedHeaders, contiguousBlob);
+
+    SerializedMessage received{std::move(patchedHeaders)};
+    ASSERT_EQ(received.GetRemoteIndex(), 7u);
+    auto receivedEvent = received.Deserialize<WireDataMessageEvent>();
+    ASSERT_TRUE(ItemsAreEqual(receivedEvent.data, event.data));
+}
+
+TEST(Test_SerializedMessage, shared_payload_released_by_another_thread_returns_to_the_pool_of_the_serializing_thread)
+{
+    using namespace SilKit::Services::PubSub;
+
+    const uint8_t* payloadData{nullptr};
+    std::vector<uint8_t> reacquired;
+
+    // a fresh thread, so its pool is empty
+    std::thread{[&payloadData, &reacquired] {
+        WireDataMessageEvent event{std::chrono::nanoseconds{42}, std::vector<uint8_t>(1024, 0xAB)};
+
+        SilKit::Util::SharedVector<uint8_t> payload;
+        {
+            SerializedMessage message{event, EndpointAddress{1234, 5678}, 1};
+            message.SharePayload();
+            message.ReleaseStorage(payload);
+        }
+        payloadData = payload.AsSpan().data();
+
+        // the io thread drops the last reference to the payload
+        std::thread{[payload = std::move(payload)]() mutable { payload = {}; }}.join();
+
+        reacquired = BufferPool::ThreadLocal().Acquire(1100);
+    }}.join();
+
+    EXPECT_LT(reacquired.data(), payloadData);
+    EXPECT_GT(reacquired.data() + reacquired.capacity(), payloadData);
+}
+
+TEST(Test_SerializedMessage, recycled_storage_of_received_message_is_reused_unless_a_payload_refers_to_it)
+{
+    using namespace SilKit::Services::PubSub;
+
+    const WireDataMessageEvent event{std::chrono::nanoseconds{42}, std::vector<uint8_t>(1024, 0xAB)};
+
+    const uint8_t* firstStorage{nullptr};
+    const uint8_t* secondStorage{nullptr};
+    std::vector<uint8_t> reacquired;
+    WireDataMessageEvent keptEvent;
+
+    // a fresh thread, so its pool is empty
+    std::thread{[&] {
+
+        // the deserialized event refers to the storage of the received message
+        auto firstBlob{SerializedMessage{event, EndpointAddress{1234, 5678}, 1}.ReleaseStorage()};
+        firstStorage = firstBlob.data();
+        SerializedMessage first{std::move(firstBlob)};
+        keptEvent = first.Deserialize<WireDataMessageEvent>();
+        first.RecycleStorage();
+
+        auto secondBlob{SerializedMessage{event, EndpointAddress{1234, 5678}, 1}.ReleaseStorage()};
+        secondStorage = secondBlob.data();
+        SerializedMessage second{std::move(secondBlob)};
+        second.Deserialize<WireDataMessageEvent>();
+        second.RecycleStorage();
+
+        reacquired = BufferPool::ThreadLocal().Acquire(1100);
+    }}.join();
+
+    EXPECT_EQ(reacquired.data(), secondStorage);
+    EXPECT_NE(reacquired.data(), firstStorage);
+    ASSERT_TRUE(ItemsAreEqual(keptEvent.data, event.data));
+}
+
+TEST(Test_SerializedMessage, message_with_shared_payload_can_be_deserialized)
+{
+    using namespace SilKit::Services::PubSub;
+
+    WireDataMessageEvent event{std::chrono::nanoseconds{42}, std::vector<uint8_t>(1024, 0xAB)};
+
+    SerializedMessage message{event, EndpointAddress{1234, 5678}, 1};
+    message.SharePayload();
+
+    const auto& constMessage = message;
+    ASSERT_TRUE(ItemsAreEqual(constMessage.Deserialize<WireDataMessageEvent>().data, event.data));
+    ASSERT_TRUE(ItemsAreEqual(message.Deserialize<WireDataMessageEvent>().data, event.data));
+}
+
+template <typename MessageT>
+auto SerializedSizeOfBySerializing(const MessageT& message) -> size_t
+{
+    MessageBuffer buffer;
+    Serialize(buffer, message);
+    return buffer.ReleaseStorage().size();
+}
+
+TEST(Test_SerializedMessage, serialized_size_of_matches_serialized_size)
+{
+    using namespace SilKit::Services;
+
+    const std::vector<uint8_t> payload(300, 0xAB);
+
+    PubSub::WireDataMessageEvent dataMessageEvent{std::chrono::nanoseconds{1}, payload};
+    EXPECT_EQ(SerializedSizeOf(dataMessageEvent), SerializedSizeOfBySerializing(dataMessageEvent));
+
+    Rpc::FunctionCall functionCall{std::chrono::nanoseconds{1}, {1, 2}, payload};
+    EXPECT_EQ(SerializedSizeOf(functionCall), SerializedSizeOfBySerializing(functionCall));
+
+    Rpc::FunctionCallResponse functionCallResponse{
+        std::chrono::nanoseconds{1}, {1, 2}, payload, Rpc::FunctionCallResponse::Status::Success};
+    EXPECT_EQ(SerializedSizeOf(functionCallResponse), SerializedSizeOfBySerializing(functionCallResponse));
+
+    Can::WireCanFrameEvent canFrameEvent{};
+    canFrameEvent.frame.dataField = SilKit::Util::SharedVector<uint8_t>{std::vector<uint8_t>(64, 0xCD)};
+    EXPECT_EQ(SerializedSizeOf(canFrameEvent), SerializedSizeOfBySerializing(canFrameEvent));
+
+    Ethernet::WireEthernetFrameEvent ethernetFrameEvent{};
+    ethernetFrameEvent.frame.raw = SilKit::Util::SharedVector<uint8_t>{std::vector<uint8_t>(1500, 0xEF)};
+    EXPECT_EQ(SerializedSizeOf(ethernetFrameEvent), SerializedSizeOfBySerializing(ethernetFrameEvent));
+
+    Flexray::WireFlexrayFrameEvent flexrayFrameEvent{};
+    flexrayFrameEvent.frame.payload = SilKit::Util::SharedVector<uint8_t>{std::vector<uint8_t>(254, 0x12)};
+    EXPECT_EQ(SerializedSizeOf(flexrayFrameEvent), SerializedSizeOfBySerializing(flexrayFrameEvent));
+
+    Flexray::WireFlexrayFrameTransmitEvent flexrayFrameTransmitEvent{};
+    flexrayFrameTransmitEvent.frame = flexrayFrameEvent.frame;
+    EXPECT_EQ(SerializedSizeOf(flexrayFrameTransmitEvent), SerializedSizeOfBySerializing(flexrayFrameTransmitEvent));
+
+    Flexray::WireFlexrayTxBufferUpdate flexrayTxBufferUpdate{};
+    flexrayTxBufferUpdate.payload = flexrayFrameEvent.frame.payload;
+    EXPECT_EQ(SerializedSizeOf(flexrayTxBufferUpdate), SerializedSizeOfBySerializing(flexrayTxBufferUpdate));
+}
+
+TEST(Test_SerializedMessage, large_message_after_small_message_is_serialized_without_reallocation)
+{
+    using namespace SilKit::Services::PubSub;
+
+    const EndpointAddress endpointAddress{1234, 5678};
+
+    // a small first message must not determine the buffer size of all following messages
+    SerializedMessage{WireDataMessageEvent{std::chrono::nanoseconds{1}, std::vector<uint8_t>(1)}, endpointAddress, 1};
+
+    WireDataMessageEvent largeEvent{std::chrono::nanoseconds{2}, std::vector<uint8_t>(1024 * 1024, 0xAB)};
+    SerializedMessage largeMessage{largeEvent, endpointAddress, 1};
+
+    const auto blob = largeMessage.ReleaseStorage();
+    ASSERT_GT(blob.size(), SerializedSizeOf(largeEvent));
+    // the buffer was allocated once with the exact size, and never grown
+    ASSERT_EQ(blob.capacity(), blob.size());
+}
@@ -158,7 +158,17 @@ struct DummyVAsioPeerBase : IVAsioPeer
         throw MethodNotImplementedError{};
     }
 
-    void EnableAggregation() final
+    void EnableAggregation(VAsioAggregationMode) final
+    {
+        throw MethodNotImplementedError{};
+    }
+
+    void SetSendQueueMetrics(VAsioPeerSendQueueMetrics) final
+    {
+        throw MethodNotImplementedError{};
+    }
+
+    auto ReportSentUserDataMessages() -> uint64_t final
     {
         throw MethodNotImplementedError{};
     }
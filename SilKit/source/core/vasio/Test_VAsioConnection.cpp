@@ -74,6 +74,7 @@ struct MockSilKitMessageReceiver
     : public IMessageReceiver<Tests::Version1::TestMessage>
     , public IMessageReceiver<Tests::Version2::TestMessage>
     , public IMessageReceiver<Tests::TestFrameEvent>
+    , public IMessageReceiver<SilKit::Services::PubSub::WireDataMessageEvent>
     , public IServiceEndpoint
 {
     ServiceDescriptor _serviceDescriptor;
@@ -91,6 +92,9 @@ struct MockSilKitMessageReceiver
     MOCK_METHOD(void, ReceiveMsg, (const SilKit::Core::IServiceEndpoint*, const Tests::Version2::TestMessage&),
                 (override));
     MOCK_METHOD(void, ReceiveMsg, (const SilKit::Core::IServiceEndpoint*, const Tests::TestFrameEvent&), (override));
+    MOCK_METHOD(void, ReceiveMsg,
+                (const SilKit::Core::IServiceEndpoint*, const SilKit::Services::PubSub::WireDataMessageEvent&),
+                (override));
 
     // IServiceEndpoint
     MOCK_METHOD(void, SetServiceDescriptor, (const ServiceDescriptor& serviceDescriptor), (override));
@@ -137,7 +141,9 @@ struct MockVAsioPeer : public IVAsioPeer
     MOCK_METHOD(void, SetProtocolVersion, (ProtocolVersion), (override));
     MOCK_METHOD(ProtocolVersion, GetProtocolVersion, (), (const, override));
     MOCK_METHOD(void, Shutdown, (), (override));
-    MOCK_METHOD(void, EnableAggregation, (), (override));
+    MOCK_METHOD(void, EnableAggregation, (VAsioAggregationMode), (override));
+    MOCK_METHOD(void, SetSendQueueMetrics, (VAsioPeerSendQueueMetrics), (override));
+    MOCK_METHOD(uint64_t, ReportSentUserDataMessages, (), (override));
 
     // IServiceEndpoint (via IVAsioPeer)
     MOCK_METHOD(void, SetServiceDescriptor, (const ServiceDescriptor& serviceDescriptor), (override));
@@ -194,6 +200,27 @@ protected:
     {
         _connection.RegisterSilKitMsgReceiver<MessageT, ServiceT>(receiver);
     }
+
+    // records the timestamps of the delivered user data messages
+    void RegisterUserDataMessageReceiver(MockSilKitMessageReceiver* receiver)
+    {
+        using SilKit::Services::PubSub::WireDataMessageEvent;
+
+        ON_CALL(*receiver, ReceiveMsg(_, testing::An<const WireDataMessageEvent&>()))
+            .WillByDefault([this](auto, const WireDataMessageEvent& message) {
+                _deliveredUserDataMessages.push_back(message.timestamp);
+            });
+        RegisterSilKitMsgReceiver<WireDataMessageEvent, MockSilKitMessageReceiver>(receiver);
+    }
+
+    void ReceiveUserDataMessage(std::chrono::nanoseconds timestamp)
+    {
+        SilKit::Services::PubSub::WireDataMessageEvent message{timestamp, {}};
+        const auto endpointAddress = _from.GetServiceDescriptor().to_endpointAddress();
+        _connection.OnSocketData(&_from, SerializedMessage{message, endpointAddress, 0});
+    }
+
+    std::vector<std::chrono::nanoseconds> _deliveredUserDataMessages;
 };
 
 } // namespace Core
@@ -295,3 +322,87 @@ TEST_F(Test_VAsioConnection, DISABLED_versioned_send_testmessage)
 
     _connection.OnSocketData(&_from, std::move(buffer));
 }
+
+//////////////////////////////////////////////////////////////////////
+// Subscriptions rejected by participants of older versions
+//////////////////////////////////////////////////////////////////////
+
+TEST_F(Test_VAsioConnection, rejected_subscription_to_message_type_unknown_to_older_participants_is_not_an_error)
+{
+    SubscriptionAcknowledge ack;
+    ack.subscriber.msgTypeName = SilKitMsgTraits<SilKit::Services::Rpc::FunctionCallBatch>::SerdesName();
+    ack.subscriber.networkName = "rpc";
+    ack.status = SubscriptionAcknowledge::Status::Failed;
+
+    EXPECT_CALL(_dummyLogger, Log(_, _)).Times(testing::AnyNumber());
+    EXPECT_CALL(_dummyLogger, Log(SilKit::Services::Logging::Level::Error, _)).Times(0);
+    EXPECT_CALL(_dummyLogger, Log(SilKit::Services::Logging::Level::Debug, testing::HasSubstr("Failed to subscribe")))
+        .Times(1);
+
+    _connection.OnSocketData(&_from, SerializedMessage{ack});
+}
+
+TEST_F(Test_VAsioConnection, rejected_subscription_is_an_error)
+{
+    SubscriptionAcknowledge ack;
+    ack.subscriber.msgTypeName = SilKitMsgTraits<SilKit::Services::PubSub::WireDataMessageEvent>::SerdesName();
+    ack.subscriber.networkName = "pubsub";
+    ack.status = SubscriptionAcknowledge::Status::Failed;
+
+    EXPECT_CALL(_dummyLogger, Log(_, _)).Times(testing::AnyNumber());
+    EXPECT_CALL(_dummyLogger, Log(SilKit::Services::Logging::Level::Error, testing::HasSubstr("Failed to subscribe")))
+        .Times(1);
+
+    _connection.OnSocketData(&_from, SerializedMessage{ack});
+}
+
+//////////////////////////////////////////////////////////////////////
+// User data messages held back for the minimum reaction delay of the sender
+//////////////////////////////////////////////////////////////////////
+
+TEST_F(Test_VAsioConnection, held_back_user_data_messages_are_delivered_after_their_release_time_point)
+{
+    testing::NiceMock<MockSilKitMessageReceiver> mockReceiver;
+    RegisterUserDataMessageReceiver(&mockReceiver);
+
+    _connection.DelayReceivedUserDataMessages(_from.GetInfo().participantName, 3ms);
+    ReceiveUserDataMessage(1ms);
+    ReceiveUserDataMessage(2ms);
+    EXPECT_TRUE(_deliveredUserDataMessages.empty());
+
+    // the step at the release time point is not affected by the messages yet
+    _connection.ReleaseReceivedUserDataMessages(3ms);
+    EXPECT_TRUE(_deliveredUserDataMessages.empty());
+
+    _connection.ReleaseReceivedUserDataMessages(4ms);
+    EXPECT_EQ(_deliveredUserDataMessages, (std::vector<std::chrono::nanoseconds>{1ms, 2ms}));
+}
+
+TEST_F(Test_VAsioConnection, user_data_messages_are_no_longer_held_back_after_the_simulation_time_stopped)
+{
+    testing::NiceMock<MockSilKitMessageReceiver> mockReceiver;
+    RegisterUserDataMessageReceiver(&mockReceiver);
+
+    _connection.DelayReceivedUserDataMessages(_from.GetInfo().participantName, 3ms);
+    ReceiveUserDataMessage(1ms);
+
+    _connection.ReleaseReceivedUserDataMessages(std::chrono::nanoseconds::max());
+    EXPECT_EQ(_deliveredUserDataMessages, (std::vector<std::chrono::nanoseconds>{1ms}));
+
+    ReceiveUserDataMessage(2ms);
+    EXPECT_EQ(_deliveredUserDataMessages, (std::vector<std::chrono::nanoseconds>{1ms, 2ms}));
+}
+
+TEST_F(Test_VAsioConnection, held_back_user_data_messages_are_delivered_when_the_sender_shuts_down)
+{
+    testing::NiceMock<MockSilKitMessageReceiver> mockReceiver;
+    RegisterUserDataMessageReceiver(&mockReceiver);
+
+    _connection.DelayReceivedUserDataMessages(_from.GetInfo().participantName, 3ms);
+    ReceiveUserDataMessage(1ms);
+    EXPECT_TRUE(_deliveredUserDataMessages.empty());
+
+    // no NextSimTask of the sender follows, which would release the message
+    _connection.OnPeerShutdown(&_from);
+    EXPECT_EQ(_deliveredUserDataMessages, (std::vector<std::chrono::nanoseconds>{1ms}));
+}
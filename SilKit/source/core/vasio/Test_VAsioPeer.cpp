@@ -0,0 +1,715 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "VAsioPeer.hpp"
+#include "BufferPool.hpp"
+
+#include "MockLogger.hpp"
+
+#include "MockIoContext.hpp"
+#include "MockRawByteStream.hpp"
+#include "MockTimer.hpp"
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <future>
+#include <thread>
+
+
+namespace {
+
+
+using namespace SilKit::Core;
+
+
+using ::testing::ElementsAre;
+using ::testing::NiceMock;
+
+using SilKit::Services::Logging::MockLogger;
+using VSilKit::MockIoContextWithExecutionQueue;
+using VSilKit::MockRawByteStream;
+using VSilKit::MockTimer;
+
+
+struct MockVAsioPeerListener : IVAsioPeerListener
+{
+    MOCK_METHOD(void, OnSocketData, (IVAsioPeer*, SerializedMessage&&), (override));
+    MOCK_METHOD(void, OnPeerShutdown, (IVAsioPeer*), (override));
+};
+
+
+struct Test_VAsioPeer : ::testing::Test
+{
+    MockIoContextWithExecutionQueue ioContext;
+    NiceMock<MockLogger> logger;
+    NiceMock<MockVAsioPeerListener> peerListener;
+
+    MockRawByteStream* stream{nullptr};
+    IRawByteStreamListener* streamListener{nullptr};
+
+    // sizes of the buffers of every AsyncWriteSome call, in call order
+    std::vector<std::vector<size_t>> writes;
+
+    auto MakePeer(VAsioPeerOptions options) -> std::unique_ptr<VAsioPeer>
+    {
+        EXPECT_CALL(ioContext, MakeTimer).WillOnce([] { return std::make_unique<NiceMock<MockTimer>>(); });
+
+        auto rawByteStream{std::make_unique<MockRawByteStream>()};
+        stream = rawByteStream.get();
+
+        EXPECT_CALL(*stream, SetListener).WillOnce([this](IRawByteStreamListener& listener) {
+            streamListener = &listener;
+        });
+        ON_CALL(*stream, AsyncWriteSome).WillByDefault([this](ConstBufferSequence bufferSequence) {
+            std::vector<size_t> sizes;
+            for (const auto& buffer : bufferSequence)
+            {
+                sizes.push_back(buffer.GetSize());
+            }
+            writes.emplace_back(std::move(sizes));
+        });
+
+        return std::make_unique<VAsioPeer>(&peerListener, &ioContext, std::move(rawByteStream), &logger, options);
+    }
+
+    static auto MakeMessage(size_t networkNameLength) -> SerializedMessage
+    {
+        VAsioMsgSubscriber subscriber;
+        subscriber.networkName = std::string(networkNameLength, 'N');
+        subscriber.msgTypeName = "T";
+        return SerializedMessage{subscriber};
+    }
+
+    static auto MakeUserDataMessage(size_t networkNameLength) -> SerializedMessage
+    {
+        auto message{MakeMessage(networkNameLength)};
+        message.SetAggregationKind(MessageAggregationKind::UserDataMessage);
+        return message;
+    }
+
+    static auto MakeFlushMessage(size_t networkNameLength) -> SerializedMessage
+    {
+        auto message{MakeMessage(networkNameLength)};
+        message.SetAggregationKind(MessageAggregationKind::FlushAggregationMessage);
+        return message;
+    }
+
+    static auto SizeOf(SerializedMessage message) -> size_t
+    {
+        return message.ReleaseStorage().size();
+    }
+};
+
+
+TEST_F(Test_VAsioPeer, queued_messages_are_gathered_into_a_single_write)
+{
+    auto peer{MakePeer({})};
+
+    EXPECT_CALL(*stream, AsyncWriteSome).Times(1);
+
+    peer->SendSilKitMsg(MakeMessage(1));
+    peer->SendSilKitMsg(MakeMessage(2));
+    peer->SendSilKitMsg(MakeMessage(3));
+
+    ioContext.Run();
+
+    ASSERT_THAT(writes, ElementsAre(ElementsAre(SizeOf(MakeMessage(1)), SizeOf(MakeMessage(2)),
+                                                SizeOf(MakeMessage(3)))));
+}
+
+
+TEST_F(Test_VAsioPeer, gathered_writes_respect_buffer_limit)
+{
+    VAsioPeerOptions options;
+    options.maxBuffersPerWrite = 2;
+
+    auto peer{MakePeer(options)};
+
+    EXPECT_CALL(*stream, AsyncWriteSome).Times(2);
+
+    peer->SendSilKitMsg(MakeMessage(1));
+    peer->SendSilKitMsg(MakeMessage(2));
+    peer->SendSilKitMsg(MakeMessage(3));
+
+    ioContext.Run();
+
+    ASSERT_EQ(writes.size(), 1u);
+    streamListener->OnAsyncWriteSomeDone(*stream, SizeOf(MakeMessage(1)) + SizeOf(MakeMessage(2)));
+
+    ASSERT_THAT(writes, ElementsAre(ElementsAre(SizeOf(MakeMessage(1)), SizeOf(MakeMessage(2))),
+                                    ElementsAre(SizeOf(MakeMessage(3)))));
+}
+
+
+TEST_F(Test_VAsioPeer, gathered_writes_respect_byte_limit_but_send_oversized_messages)
+{
+    VAsioPeerOptions options;
+    options.maxBytesPerWrite = SizeOf(MakeMessage(1)) + SizeOf(MakeMessage(2));
+
+    auto peer{MakePeer(options)};
+
+    EXPECT_CALL(*stream, AsyncWriteSome).Times(3);
+
+    peer->SendSilKitMsg(MakeMessage(1));
+    peer->SendSilKitMsg(MakeMessage(2));
+    peer->SendSilKitMsg(MakeMessage(100));
+    peer->SendSilKitMsg(MakeMessage(1));
+
+    ioContext.Run();
+
+    streamListener->OnAsyncWriteSomeDone(*stream, SizeOf(MakeMessage(1)) + SizeOf(MakeMessage(2)));
+    streamListener->OnAsyncWriteSomeDone(*stream, SizeOf(MakeMessage(100)));
+
+    ASSERT_THAT(writes, ElementsAre(ElementsAre(SizeOf(MakeMessage(1)), SizeOf(MakeMessage(2))),
+                                    ElementsAre(SizeOf(MakeMessage(100))), ElementsAre(SizeOf(MakeMessage(1)))));
+}
+
+
+TEST_F(Test_VAsioPeer, partially_completed_gathered_write_continues_with_remaining_bytes)
+{
+    auto peer{MakePeer({})};
+
+    EXPECT_CALL(*stream, AsyncWriteSome).Times(2);
+
+    peer->SendSilKitMsg(MakeMessage(1));
+    peer->SendSilKitMsg(MakeMessage(2));
+    peer->SendSilKitMsg(MakeMessage(3));
+
+    ioContext.Run();
+
+    // complete the first buffer and three bytes of the second one
+    streamListener->OnAsyncWriteSomeDone(*stream, SizeOf(MakeMessage(1)) + 3);
+
+    ASSERT_THAT(writes, ElementsAre(ElementsAre(SizeOf(MakeMessage(1)), SizeOf(MakeMessage(2)),
+                                                SizeOf(MakeMessage(3))),
+                                    ElementsAre(SizeOf(MakeMessage(2)) - 3, SizeOf(MakeMessage(3)))));
+}
+
+
+TEST_F(Test_VAsioPeer, shared_payload_is_written_after_the_network_headers_of_each_message)
+{
+    auto peer{MakePeer({})};
+
+    std::vector<const void*> writtenData;
+    EXPECT_CALL(*stream, AsyncWriteSome).WillOnce([&writtenData](ConstBufferSequence bufferSequence) {
+        for (const auto& buffer : bufferSequence)
+        {
+            writtenData.push_back(buffer.GetData());
+        }
+    });
+
+    SilKit::Services::PubSub::WireDataMessageEvent event{std::chrono::nanoseconds{1}, std::vector<uint8_t>(1024)};
+    SerializedMessage message{event, EndpointAddress{1, 2}, 3};
+    const auto messageSize = SizeOf(message);
+    message.SharePayload();
+
+    auto otherMessage = message;
+    otherMessage.SetRemoteIndex(4);
+
+    peer->SendSilKitMsg(std::move(message));
+    peer->SendSilKitMsg(std::move(otherMessage));
+
+    ioContext.Run();
+
+    // headers and payload of both messages, the payload is written twice from the same memory
+    ASSERT_EQ(writtenData.size(), 4u);
+    ASSERT_NE(writtenData[0], writtenData[2]);
+    ASSERT_EQ(writtenData[1], writtenData[3]);
+
+    streamListener->OnAsyncWriteSomeDone(*stream, 2 * messageSize);
+}
+
+
+TEST_F(Test_VAsioPeer, queued_messages_wake_up_the_io_context_once)
+{
+    auto peer{MakePeer({})};
+
+    peer->SendSilKitMsg(MakeMessage(1));
+    peer->SendSilKitMsg(MakeMessage(2));
+    peer->SendSilKitMsg(MakeMessage(3));
+
+    ASSERT_EQ(ioContext.handlerQueue.size(), 1u);
+}
+
+
+TEST_F(Test_VAsioPeer, messages_exceeding_the_send_queue_capacity_are_sent_in_order)
+{
+    VAsioPeerOptions options;
+    options.sendQueueCapacity = 2;
+    options.maxBuffersPerWrite = 1;
+
+    auto peer{MakePeer(options)};
+
+    EXPECT_CALL(*stream, AsyncWriteSome).Times(5);
+
+    for (size_t networkNameLength = 1; networkNameLength <= 3; ++networkNameLength)
+    {
+        peer->SendSilKitMsg(MakeMessage(networkNameLength));
+    }
+
+    ioContext.Run();
+
+    // messages queued while the overflowed ones are still pending must not overtake them
+    peer->SendSilKitMsg(MakeMessage(4));
+    peer->SendSilKitMsg(MakeMessage(5));
+
+    for (size_t networkNameLength = 1; networkNameLength <= 5; ++networkNameLength)
+    {
+        streamListener->OnAsyncWriteSomeDone(*stream, SizeOf(MakeMessage(networkNameLength)));
+        ioContext.Run();
+    }
+
+    ASSERT_THAT(writes, ElementsAre(ElementsAre(SizeOf(MakeMessage(1))), ElementsAre(SizeOf(MakeMessage(2))),
+                                    ElementsAre(SizeOf(MakeMessage(3))), ElementsAre(SizeOf(MakeMessage(4))),
+                                    ElementsAre(SizeOf(MakeMessage(5)))));
+}
+
+
+TEST_F(Test_VAsioPeer, written_messages_are_returned_to_the_buffer_pool)
+{
+    auto peer{MakePeer({})};
+
+    const uint8_t* writtenData{nullptr};
+    EXPECT_CALL(*stream, AsyncWriteSome).WillOnce([&writtenData](ConstBufferSequence bufferSequence) {
+        writtenData = static_cast<const uint8_t*>(bufferSequence[0].GetData());
+    });
+
+    auto message{MakeMessage(1)};
+    const auto messageSize{SizeOf(message)};
+    peer->SendSilKitMsg(std::move(message));
+
+    ioContext.Run();
+    streamListener->OnAsyncWriteSomeDone(*stream, messageSize);
+
+    // the most recently released buffer is handed out first
+    auto buffer = BufferPool::ThreadLocal().Acquire(messageSize);
+    ASSERT_EQ(buffer.data(), writtenData);
+}
+
+
+TEST_F(Test_VAsioPeer, received_messages_are_handed_over_to_the_io_context)
+{
+    VAsioPeerOptions options;
+    options.completionsOnIoWorkerThread = true;
+
+    auto peer{MakePeer(options)};
+
+    std::vector<MutableBuffer> readBuffers;
+    EXPECT_CALL(*stream, AsyncReadSome).WillRepeatedly([&readBuffers](MutableBufferSequence bufferSequence) {
+        readBuffers.assign(bufferSequence.begin(), bufferSequence.end());
+    });
+
+    peer->StartAsyncRead();
+    ASSERT_FALSE(readBuffers.empty());
+
+    // two complete messages are received by a single read
+    auto received{MakeMessage(1).ReleaseStorage()};
+    const auto second{MakeMessage(2).ReleaseStorage()};
+    received.insert(received.end(), second.begin(), second.end());
+    ASSERT_GE(readBuffers[0].GetSize(), received.size());
+    std::copy(received.begin(), received.end(), static_cast<uint8_t*>(readBuffers[0].GetData()));
+
+    std::vector<size_t> receivedSizes;
+    EXPECT_CALL(peerListener, OnSocketData).WillRepeatedly([&receivedSizes](IVAsioPeer*, SerializedMessage&& message) {
+        receivedSizes.push_back(message.ReleaseStorage().size());
+    });
+
+    streamListener->OnAsyncReadSomeDone(*stream, received.size());
+    ASSERT_TRUE(receivedSizes.empty());
+
+    ioContext.Run();
+    ASSERT_THAT(receivedSizes, ElementsAre(SizeOf(MakeMessage(1)), SizeOf(MakeMessage(2))));
+}
+
+
+TEST_F(Test_VAsioPeer, messages_exceeding_the_ring_buffer_are_read_directly_into_their_buffer)
+{
+    auto peer{MakePeer({})};
+
+    std::vector<MutableBuffer> readBuffers;
+    EXPECT_CALL(*stream, AsyncReadSome).WillRepeatedly([&readBuffers](MutableBufferSequence bufferSequence) {
+        readBuffers.assign(bufferSequence.begin(), bufferSequence.end());
+    });
+
+    const auto large{MakeMessage(3 * 4096).ReleaseStorage()};
+    const auto feed = [this, &readBuffers](const uint8_t* data, size_t size) {
+        ASSERT_FALSE(readBuffers.empty());
+        ASSERT_GE(readBuffers[0].GetSize(), size);
+        std::copy(data, data + size, static_cast<uint8_t*>(readBuffers[0].GetData()));
+        streamListener->OnAsyncReadSomeDone(*stream, size);
+    };
+
+    std::vector<std::vector<uint8_t>> received;
+    EXPECT_CALL(peerListener, OnSocketData).WillRepeatedly([&received](IVAsioPeer*, SerializedMessage&& message) {
+        received.push_back(message.ReleaseStorage());
+    });
+
+    peer->StartAsyncRead();
+
+    // the first read only contains the beginning of the message
+    feed(large.data(), 100);
+    ASSERT_TRUE(received.empty());
+
+    // the remainder of the message is read in one piece into the buffer of the message
+    ASSERT_EQ(readBuffers.size(), 1u);
+    ASSERT_EQ(readBuffers[0].GetSize(), large.size() - 100);
+    const auto* const directBuffer = readBuffers[0].GetData();
+
+    feed(large.data() + 100, large.size() - 100);
+    ASSERT_EQ(received.size(), 1u);
+    ASSERT_EQ(received[0], large);
+    ASSERT_EQ(static_cast<const void*>(received[0].data() + 100), directBuffer);
+
+    // the following messages are received through the ring buffer again
+    const auto small{MakeMessage(1).ReleaseStorage()};
+    feed(small.data(), small.size());
+    ASSERT_EQ(received.size(), 2u);
+    ASSERT_EQ(received[1], small);
+}
+
+
+TEST_F(Test_VAsioPeer, write_completions_are_handed_over_to_the_io_context)
+{
+    VAsioPeerOptions options;
+    options.maxBuffersPerWrite = 1;
+    options.completionsOnIoWorkerThread = true;
+
+    auto peer{MakePeer(options)};
+
+    EXPECT_CALL(*stream, AsyncWriteSome).Times(2);
+
+    peer->SendSilKitMsg(MakeMessage(1));
+    peer->SendSilKitMsg(MakeMessage(2));
+
+    ioContext.Run();
+    ASSERT_EQ(writes.size(), 1u);
+
+    streamListener->OnAsyncWriteSomeDone(*stream, SizeOf(MakeMessage(1)));
+    ASSERT_EQ(writes.size(), 1u);
+
+    ioContext.Run();
+    ASSERT_THAT(writes, ElementsAre(ElementsAre(SizeOf(MakeMessage(1))), ElementsAre(SizeOf(MakeMessage(2)))));
+}
+
+
+TEST_F(Test_VAsioPeer, drop_newest_policy_drops_user_data_messages_exceeding_the_send_queue_limit)
+{
+    VAsioPeerOptions options;
+    options.sendQueueMaxMessages = 2;
+    options.sendQueueOverflowPolicy = SendQueueOverflowPolicy::DropNewest;
+
+    auto peer{MakePeer(options)};
+
+    EXPECT_CALL(*stream, AsyncWriteSome).Times(1);
+
+    peer->SendSilKitMsg(MakeUserDataMessage(1));
+    peer->SendSilKitMsg(MakeUserDataMessage(2));
+    peer->SendSilKitMsg(MakeUserDataMessage(3));
+    // other messages are never dropped
+    peer->SendSilKitMsg(MakeMessage(4));
+
+    ioContext.Run();
+
+    ASSERT_THAT(writes, ElementsAre(ElementsAre(SizeOf(MakeMessage(1)), SizeOf(MakeMessage(2)),
+                                                SizeOf(MakeMessage(4)))));
+}
+
+
+TEST_F(Test_VAsioPeer, drop_oldest_policy_drops_the_oldest_queued_user_data_messages)
+{
+    VAsioPeerOptions options;
+    options.sendQueueMaxMessages = 2;
+    options.sendQueueOverflowPolicy = SendQueueOverflowPolicy::DropOldest;
+
+    auto peer{MakePeer(options)};
+
+    EXPECT_CALL(*stream, AsyncWriteSome).Times(2);
+
+    // keep the stream busy, such that the following messages stay in the send queue
+    peer->SendSilKitMsg(MakeMessage(1));
+    ioContext.Run();
+
+    peer->SendSilKitMsg(MakeUserDataMessage(2));
+    peer->SendSilKitMsg(MakeMessage(3));
+    peer->SendSilKitMsg(MakeUserDataMessage(4));
+    ioContext.Run();
+
+    streamListener->OnAsyncWriteSomeDone(*stream, SizeOf(MakeMessage(1)));
+    ioContext.Run();
+
+    ASSERT_THAT(writes, ElementsAre(ElementsAre(SizeOf(MakeMessage(1))),
+                                    ElementsAre(SizeOf(MakeMessage(3)), SizeOf(MakeMessage(4)))));
+}
+
+
+TEST_F(Test_VAsioPeer, drop_oldest_policy_keeps_the_reported_user_data_messages)
+{
+    VAsioPeerOptions options;
+    options.sendQueueMaxMessages = 2;
+    options.sendQueueOverflowPolicy = SendQueueOverflowPolicy::DropOldest;
+
+    auto peer{MakePeer(options)};
+
+    EXPECT_CALL(*stream, AsyncWriteSome).Times(2);
+
+    // keep the stream busy, such that the following messages stay in the send queue
+    peer->SendSilKitMsg(MakeMessage(1));
+    ioContext.Run();
+
+    peer->SendSilKitMsg(MakeUserDataMessage(2));
+    ioContext.Run();
+    // the receiver waits for the reported message, it must not be dropped anymore
+    ASSERT_EQ(peer->ReportSentUserDataMessages(), 1u);
+
+    peer->SendSilKitMsg(MakeUserDataMessage(3));
+    peer->SendSilKitMsg(MakeUserDataMessage(4));
+    ioContext.Run();
+
+    // the dropped message is not counted
+    ASSERT_EQ(peer->ReportSentUserDataMessages(), 2u);
+
+    streamListener->OnAsyncWriteSomeDone(*stream, SizeOf(MakeMessage(1)));
+    ioContext.Run();
+
+    ASSERT_THAT(writes, ElementsAre(ElementsAre(SizeOf(MakeMessage(1))),
+                                    ElementsAre(SizeOf(MakeMessage(2)), SizeOf(MakeMessage(4)))));
+}
+
+
+TEST_F(Test_VAsioPeer, error_policy_notifies_once_per_overflow)
+{
+    int overflows{0};
+
+    VAsioPeerOptions options;
+    options.sendQueueMaxMessages = 1;
+    options.sendQueueOverflowPolicy = SendQueueOverflowPolicy::Error;
+    options.onSendQueueOverflow = [&overflows](IVAsioPeer&) { ++overflows; };
+
+    auto peer{MakePeer(options)};
+
+    EXPECT_CALL(*stream, AsyncWriteSome).Times(2);
+
+    peer->SendSilKitMsg(MakeMessage(1));
+    ioContext.Run();
+
+    peer->SendSilKitMsg(MakeUserDataMessage(2));
+    peer->SendSilKitMsg(MakeUserDataMessage(3));
+    peer->SendSilKitMsg(MakeUserDataMessage(4));
+    ioContext.Run();
+
+    ASSERT_EQ(overflows, 1);
+
+    streamListener->OnAsyncWriteSomeDone(*stream, SizeOf(MakeMessage(1)));
+    ioContext.Run();
+
+    ASSERT_THAT(writes, ElementsAre(ElementsAre(SizeOf(MakeMessage(1))), ElementsAre(SizeOf(MakeMessage(2)))));
+}
+
+
+TEST_F(Test_VAsioPeer, block_policy_does_not_block_the_io_context)
+{
+    VAsioPeerOptions options;
+    options.sendQueueMaxMessages = 1;
+    options.maxBuffersPerWrite = 1;
+
+    auto peer{MakePeer(options)};
+
+    EXPECT_CALL(*stream, AsyncWriteSome).Times(3);
+
+    ioContext.Post([&peer] {
+        peer->SendSilKitMsg(MakeUserDataMessage(1));
+        peer->SendSilKitMsg(MakeUserDataMessage(2));
+        peer->SendSilKitMsg(MakeUserDataMessage(3));
+    });
+    ioContext.Run();
+
+    for (size_t networkNameLength = 1; networkNameLength <= 3; ++networkNameLength)
+    {
+        streamListener->OnAsyncWriteSomeDone(*stream, SizeOf(MakeMessage(networkNameLength)));
+        ioContext.Run();
+    }
+
+    ASSERT_THAT(writes, ElementsAre(ElementsAre(SizeOf(MakeMessage(1))), ElementsAre(SizeOf(MakeMessage(2))),
+                                    ElementsAre(SizeOf(MakeMessage(3)))));
+}
+
+
+TEST_F(Test_VAsioPeer, block_policy_blocks_the_sending_thread_until_the_send_queue_drains)
+{
+    SendQueueBackpressure backpressure{0};
+
+    VAsioPeerOptions options;
+    options.sendQueueMaxMessages = 1;
+    options.maxBuffersPerWrite = 1;
+    options.sendQueueBackpressure = &backpressure;
+
+    auto peer{MakePeer(options)};
+    backpressure.AddReceiver(peer.get(), "N");
+
+    EXPECT_CALL(*stream, AsyncWriteSome).Times(2);
+
+    // the first message is being written, the next two exceed the limit of the send queue
+    peer->SendSilKitMsg(MakeUserDataMessage(1));
+    ioContext.Run();
+    peer->SendSilKitMsg(MakeUserDataMessage(2));
+    peer->SendSilKitMsg(MakeUserDataMessage(3));
+
+    // senders on networks which the peer does not receive are not held back
+    ASSERT_TRUE(backpressure.Acquire("Other"));
+    backpressure.Release();
+
+    // the sender is held back like VAsioConnection::SendMsg does, before it hands the message over to the io context
+    std::promise<void> senderResumed;
+    auto senderResumedFuture = senderResumed.get_future();
+    std::thread sender{[&backpressure, &senderResumed] {
+        backpressure.Acquire("N");
+        senderResumed.set_value();
+    }};
+
+    ASSERT_EQ(senderResumedFuture.wait_for(std::chrono::milliseconds{100}), std::future_status::timeout);
+
+    // writing the first message takes the second one out of the queue, which is then within its limits again
+    streamListener->OnAsyncWriteSomeDone(*stream, SizeOf(MakeMessage(1)));
+    ioContext.Run();
+
+    ASSERT_EQ(senderResumedFuture.wait_for(std::chrono::seconds{10}), std::future_status::ready);
+    sender.join();
+    backpressure.Release();
+}
+
+
+TEST_F(Test_VAsioPeer, block_policy_releases_the_sending_thread_when_the_peer_disconnects)
+{
+    SendQueueBackpressure backpressure{0};
+
+    VAsioPeerOptions options;
+    options.sendQueueMaxMessages = 1;
+    options.maxBuffersPerWrite = 1;
+    options.sendQueueBackpressure = &backpressure;
+
+    auto peer{MakePeer(options)};
+    backpressure.AddReceiver(peer.get(), "N");
+
+    EXPECT_CALL(*stream, AsyncWriteSome).Times(1);
+    EXPECT_CALL(peerListener, OnPeerShutdown(peer.get())).Times(1);
+
+    peer->SendSilKitMsg(MakeUserDataMessage(1));
+    ioContext.Run();
+    peer->SendSilKitMsg(MakeUserDataMessage(2));
+    peer->SendSilKitMsg(MakeUserDataMessage(3));
+
+    std::promise<void> senderResumed;
+    auto senderResumedFuture = senderResumed.get_future();
+    std::thread sender{[&backpressure, &senderResumed] {
+        backpressure.Acquire("N");
+        senderResumed.set_value();
+    }};
+
+    ASSERT_EQ(senderResumedFuture.wait_for(std::chrono::milliseconds{100}), std::future_status::timeout);
+
+    // the remote participant disconnects while its send queue is full, without ever draining it
+    streamListener->OnShutdown(*stream);
+
+    ASSERT_EQ(senderResumedFuture.wait_for(std::chrono::seconds{10}), std::future_status::ready);
+    sender.join();
+    backpressure.Release();
+
+    // following senders are not held back either
+    ASSERT_TRUE(backpressure.Acquire("N"));
+    backpressure.Release();
+}
+
+
+TEST_F(Test_VAsioPeer, aggregated_messages_are_gathered_into_a_single_write_at_the_end_of_the_simulation_step)
+{
+    auto peer{MakePeer({})};
+    peer->EnableAggregation(VAsioAggregationMode::SimulationStep);
+
+    EXPECT_CALL(*stream, AsyncWriteSome).Times(1);
+
+    peer->SendSilKitMsg(MakeUserDataMessage(1));
+    peer->SendSilKitMsg(MakeUserDataMessage(2));
+    ioContext.Run();
+    ASSERT_TRUE(writes.empty());
+
+    peer->SendSilKitMsg(MakeFlushMessage(3));
+    ioContext.Run();
+
+    // the aggregated messages are not copied into a single buffer
+    ASSERT_THAT(writes, ElementsAre(ElementsAre(SizeOf(MakeMessage(1)), SizeOf(MakeMessage(2)),
+                                                SizeOf(MakeMessage(3)))));
+}
+
+
+TEST_F(Test_VAsioPeer, other_messages_do_not_overtake_held_back_user_data_messages)
+{
+    auto peer{MakePeer({})};
+    peer->EnableAggregation(VAsioAggregationMode::SimulationStep);
+
+    EXPECT_CALL(*stream, AsyncWriteSome).Times(2);
+
+    // without held back messages, other messages are sent right away
+    peer->SendSilKitMsg(MakeMessage(1));
+    ioContext.Run();
+    streamListener->OnAsyncWriteSomeDone(*stream, SizeOf(MakeMessage(1)));
+
+    peer->SendSilKitMsg(MakeUserDataMessage(2));
+    peer->SendSilKitMsg(MakeMessage(3));
+    ioContext.Run();
+    ASSERT_EQ(writes.size(), 1u);
+
+    peer->SendSilKitMsg(MakeFlushMessage(4));
+    ioContext.Run();
+    ASSERT_THAT(writes, ElementsAre(ElementsAre(SizeOf(MakeMessage(1))),
+                                    ElementsAre(SizeOf(MakeMessage(2)), SizeOf(MakeMessage(3)),
+                                                SizeOf(MakeMessage(4)))));
+}
+
+
+TEST_F(Test_VAsioPeer, aggregated_messages_are_flushed_when_exceeding_the_byte_limit)
+{
+    VAsioPeerOptions options;
+    options.aggregationMaxBytes = SizeOf(MakeMessage(3));
+
+    auto peer{MakePeer(options)};
+    peer->EnableAggregation(VAsioAggregationMode::SimulationStep);
+
+    EXPECT_CALL(*stream, AsyncWriteSome).Times(1);
+
+    peer->SendSilKitMsg(MakeUserDataMessage(1));
+    peer->SendSilKitMsg(MakeUserDataMessage(2));
+    peer->SendSilKitMsg(MakeUserDataMessage(3));
+    ioContext.Run();
+
+    ASSERT_THAT(writes, ElementsAre(ElementsAre(SizeOf(MakeMessage(1)), SizeOf(MakeMessage(2)))));
+}
+
+
+TEST_F(Test_VAsioPeer, messages_are_held_back_only_while_writing)
+{
+    auto peer{MakePeer({})};
+    peer->EnableAggregation(VAsioAggregationMode::WhileWriting);
+
+    EXPECT_CALL(*stream, AsyncWriteSome).Times(2);
+
+    // nothing is written, the message is sent right away
+    peer->SendSilKitMsg(MakeUserDataMessage(1));
+    ioContext.Run();
+    ASSERT_EQ(writes.size(), 1u);
+
+    peer->SendSilKitMsg(MakeUserDataMessage(2));
+    peer->SendSilKitMsg(MakeUserDataMessage(3));
+    ioContext.Run();
+    ASSERT_EQ(writes.size(), 1u);
+
+    streamListener->OnAsyncWriteSomeDone(*stream, SizeOf(MakeMessage(1)));
+    ioContext.Run();
+
+    ASSERT_THAT(writes, ElementsAre(ElementsAre(SizeOf(MakeMessage(1))),
+                                    ElementsAre(SizeOf(MakeMessage(2)), SizeOf(MakeMessage(3)))));
+}
+
+
+} // namespace
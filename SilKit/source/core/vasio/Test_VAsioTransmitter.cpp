@@ -0,0 +1,136 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "VAsioTransmitter.hpp"
+
+#include "MockVAsioPeer.hpp"
+
+#include "CanSerdes.hpp"
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+namespace {
+
+using namespace SilKit::Core;
+using namespace SilKit::Services::Can;
+
+using ::testing::_;
+using ::testing::NiceMock;
+using ::testing::Return;
+using ::testing::ReturnRef;
+
+struct NamedPeer : NiceMock<MockVAsioPeer>
+{
+    explicit NamedPeer(const std::string& participantName)
+    {
+        info.participantName = participantName;
+        ON_CALL(*this, GetInfo()).WillByDefault(ReturnRef(info));
+        ON_CALL(*this, SendSilKitMsg(_)).WillByDefault([this](SerializedMessage message) {
+            receivedRemoteIndices.push_back(message.GetRemoteIndex());
+        });
+    }
+
+    VAsioPeerInfo info;
+    std::vector<EndpointId> receivedRemoteIndices;
+};
+
+struct Sender : IServiceEndpoint
+{
+    void SetServiceDescriptor(const ServiceDescriptor& serviceDescriptor) override
+    {
+        _serviceDescriptor = serviceDescriptor;
+    }
+    auto GetServiceDescriptor() const -> const ServiceDescriptor& override
+    {
+        return _serviceDescriptor;
+    }
+
+    ServiceDescriptor _serviceDescriptor{"Sender", "CAN1", "CanController1", 1};
+};
+
+auto MakeFrame(uint32_t canId) -> WireCanFrameEvent
+{
+    WireCanFrameEvent frameEvent{};
+    frameEvent.frame.canId = canId;
+    return frameEvent;
+}
+
+class Test_VAsioTransmitter : public testing::Test
+{
+protected:
+    Test_VAsioTransmitter()
+    {
+        transmitter.AddRemoteReceiver(&peer1, 11);
+        transmitter.AddRemoteReceiver(&peer2, 12);
+        transmitter.AddRemoteReceiver(&peer3, 13);
+    }
+
+    NamedPeer peer1{"P1"};
+    NamedPeer peer2{"P2"};
+    NamedPeer peer3{"P3"};
+    Sender sender;
+    VAsioTransmitter<WireCanFrameEvent> transmitter;
+};
+
+TEST_F(Test_VAsioTransmitter, messages_are_sent_to_all_remote_receivers)
+{
+    transmitter.ReceiveMsg(&sender, MakeFrame(0x100));
+
+    EXPECT_EQ(peer1.receivedRemoteIndices, std::vector<EndpointId>{11});
+    EXPECT_EQ(peer2.receivedRemoteIndices, std::vector<EndpointId>{12});
+    EXPECT_EQ(peer3.receivedRemoteIndices, std::vector<EndpointId>{13});
+}
+
+TEST_F(Test_VAsioTransmitter, messages_rejected_by_the_filter_of_a_participant_are_not_sent_to_it)
+{
+    transmitter.SetRemoteReceiverFilter("P2", [](const WireCanFrameEvent& msg) { return msg.frame.canId == 0x100; });
+
+    transmitter.ReceiveMsg(&sender, MakeFrame(0x100));
+    transmitter.ReceiveMsg(&sender, MakeFrame(0x200));
+
+    EXPECT_EQ(peer1.receivedRemoteIndices, (std::vector<EndpointId>{11, 11}));
+    EXPECT_EQ(peer2.receivedRemoteIndices, (std::vector<EndpointId>{12}));
+    EXPECT_EQ(peer3.receivedRemoteIndices, (std::vector<EndpointId>{13, 13}));
+
+    // an empty filter accepts all messages again
+    transmitter.SetRemoteReceiverFilter("P2", nullptr);
+    transmitter.ReceiveMsg(&sender, MakeFrame(0x200));
+
+    EXPECT_EQ(peer2.receivedRemoteIndices, (std::vector<EndpointId>{12, 12}));
+}
+
+TEST_F(Test_VAsioTransmitter, messages_rejected_by_all_filters_are_not_sent)
+{
+    auto rejectAll = [](const WireCanFrameEvent&) { return false; };
+    transmitter.SetRemoteReceiverFilter("P1", rejectAll);
+    transmitter.SetRemoteReceiverFilter("P2", rejectAll);
+    transmitter.SetRemoteReceiverFilter("P3", rejectAll);
+
+    EXPECT_CALL(peer1, SendSilKitMsg(_)).Times(0);
+    EXPECT_CALL(peer2, SendSilKitMsg(_)).Times(0);
+    EXPECT_CALL(peer3, SendSilKitMsg(_)).Times(0);
+
+    transmitter.ReceiveMsg(&sender, MakeFrame(0x100));
+}
+
+TEST(Test_VAsioTransmitterFilter, filter_set_before_the_remote_receiver_is_added_applies_to_it)
+{
+    NamedPeer peer1{"P1"};
+    NamedPeer peer2{"P2"};
+    Sender sender;
+    VAsioTransmitter<WireCanFrameEvent> transmitter;
+
+    transmitter.SetRemoteReceiverFilter("P2", [](const WireCanFrameEvent& msg) { return msg.frame.canId == 0x100; });
+    transmitter.AddRemoteReceiver(&peer1, 11);
+    transmitter.AddRemoteReceiver(&peer2, 12);
+
+    transmitter.ReceiveMsg(&sender, MakeFrame(0x100));
+    transmitter.ReceiveMsg(&sender, MakeFrame(0x200));
+
+    EXPECT_EQ(peer1.receivedRemoteIndices, (std::vector<EndpointId>{11, 11}));
+    EXPECT_EQ(peer2.receivedRemoteIndices, (std::vector<EndpointId>{12}));
+}
+
+} // namespace
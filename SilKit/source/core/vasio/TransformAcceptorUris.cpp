@@ -56,7 +56,7 @@ inline auto GetUriInfo(const Uri& uri) -> UriInfo
         return host;
     }(uri.Host());
 
-    if (uri.Type() == Uri::UriType::Local)
+    if (uri.Type() == Uri::UriType::Local || uri.Type() == Uri::UriType::SharedMemory)
     {
         UriInfo hostInfo;
         hostInfo.local = true;
@@ -191,8 +191,8 @@ auto TransformAcceptorUris(SilKit::Services::Logging::ILogger* logger, IVAsioPee
         acceptUri(uri);
     }
 
-    // Order the acceptor URIs before sending them to the audience participant. Local-domain acceptors always have the
-    // highest priority.
+    // Order the acceptor URIs before sending them to the audience participant. Shared memory and local-domain acceptors
+    // always have the highest priority.
 
     std::multimap<int, std::string> orderedAcceptorUris;
 
@@ -214,7 +214,7 @@ auto TransformAcceptorUris(SilKit::Services::Logging::ILogger* logger, IVAsioPee
 
     for (const auto& uri : acceptorUris)
     {
-        if (uri.Type() == Uri::UriType::Local)
+        if (uri.Type() == Uri::UriType::Local || uri.Type() == Uri::UriType::SharedMemory)
         {
             orderedAcceptorUris.emplace(localDomainPenalty, uri.EncodedString());
             continue;
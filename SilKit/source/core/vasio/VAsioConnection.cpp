@@ -23,6 +23,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "VAsioProtocolVersion.hpp"
 
 #include "SerializedMessage.hpp"
+#include "BufferPool.hpp"
 
 #include <algorithm>
 #include <chrono>
@@ -170,6 +171,11 @@ auto MakeCapabilitiesFromConfiguration(const SilKit::Config::ParticipantConfigur
         capabilities.AddCapability(SilKit::Core::Capabilities::RequestParticipantConnection);
     }
 
+    if (participantConfiguration.middleware.enableSharedMemory)
+    {
+        capabilities.AddCapability(SilKit::Core::Capabilities::SharedMemory);
+    }
+
     return capabilities;
 }
 
@@ -194,6 +200,102 @@ auto MakeAsioSocketOptionsFromConfiguration(const SilKit::Config::ParticipantCon
 }
 
 
+auto MakeAsioIoContextOptionsFromConfiguration(const SilKit::Config::ParticipantConfiguration& participantConfiguration)
+    -> SilKit::Core::AsioIoContextOptions
+{
+    SilKit::Core::AsioIoContextOptions ioContextOptions{};
+    ioContextOptions.ioWorkerThreads =
+        static_cast<size_t>((std::max)(participantConfiguration.middleware.ioWorkerThreads, 1));
+    ioContextOptions.sharedMemoryRingCapacity =
+        static_cast<size_t>((std::max)(participantConfiguration.middleware.sharedMemoryRingCapacity, 0));
+    ioContextOptions.sharedMemoryHandshakeTimeout = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::duration<double>{participantConfiguration.middleware.connectTimeoutSeconds});
+
+    return ioContextOptions;
+}
+
+
+auto MakeSendQueueOverflowPolicy(SilKit::Config::SendQueueOverflowPolicy policy)
+    -> SilKit::Core::SendQueueOverflowPolicy
+{
+    switch (policy)
+    {
+    case SilKit::Config::SendQueueOverflowPolicy::Block:
+        return SilKit::Core::SendQueueOverflowPolicy::Block;
+    case SilKit::Config::SendQueueOverflowPolicy::DropOldest:
+        return SilKit::Core::SendQueueOverflowPolicy::DropOldest;
+    case SilKit::Config::SendQueueOverflowPolicy::DropNewest:
+        return SilKit::Core::SendQueueOverflowPolicy::DropNewest;
+    case SilKit::Config::SendQueueOverflowPolicy::Error:
+        return SilKit::Core::SendQueueOverflowPolicy::Error;
+    }
+
+    throw SilKit::ConfigurationError{"Invalid SendQueueOverflowPolicy"};
+}
+
+
+// Message types which participants of older versions do not know, and therefore reject subscriptions to. The services
+// subscribing to them fall back to other message types for these participants, e.g., an RPC client only sends call
+// batches to servers announcing that they receive them.
+bool IsUnknownToOlderParticipants(const std::string& msgTypeName)
+{
+    using SilKit::Core::SilKitMsgTraits;
+
+    return msgTypeName == SilKitMsgTraits<SilKit::Services::Rpc::FunctionCallBatch>::SerdesName()
+           || msgTypeName == SilKitMsgTraits<SilKit::Services::Logging::LogMsgBatch>::SerdesName()
+           || msgTypeName == SilKitMsgTraits<VSilKit::WireMetricsUpdate>::SerdesName();
+}
+
+
+bool HoldsBackUserDataMessages(const SilKit::Config::ParticipantConfiguration& participantConfiguration)
+{
+    const auto& middleware = participantConfiguration.middleware;
+    const auto policy = MakeSendQueueOverflowPolicy(middleware.sendQueueOverflowPolicy);
+    return policy == SilKit::Core::SendQueueOverflowPolicy::Block
+           && (middleware.sendQueueMaxMessages > 0 || middleware.sendQueueMaxBytes > 0);
+}
+
+
+bool CountsUserDataMessages(const SilKit::Config::ParticipantConfiguration& participantConfiguration,
+                            const std::string& participantName)
+{
+    const auto& timeSyncAggregator = participantConfiguration.experimental.timeSynchronization.aggregator;
+    return !timeSyncAggregator.empty() && timeSyncAggregator != participantName;
+}
+
+
+auto MakeVAsioPeerOptionsFromConfiguration(const SilKit::Config::ParticipantConfiguration& participantConfiguration)
+    -> SilKit::Core::VAsioPeerOptions
+{
+    SilKit::Core::VAsioPeerOptions peerOptions{};
+    peerOptions.maxBytesPerWrite =
+        static_cast<size_t>((std::max)(participantConfiguration.middleware.maxBytesPerWrite, 1));
+    peerOptions.maxBuffersPerWrite =
+        static_cast<size_t>((std::max)(participantConfiguration.middleware.maxBuffersPerWrite, 1));
+    peerOptions.sendQueueMaxMessages =
+        static_cast<size_t>((std::max)(participantConfiguration.middleware.sendQueueMaxMessages, 0));
+    peerOptions.sendQueueMaxBytes =
+        static_cast<size_t>((std::max)(participantConfiguration.middleware.sendQueueMaxBytes, 0));
+    peerOptions.sendQueueOverflowPolicy =
+        MakeSendQueueOverflowPolicy(participantConfiguration.middleware.sendQueueOverflowPolicy);
+
+    const auto& timeSynchronization = participantConfiguration.experimental.timeSynchronization;
+    peerOptions.aggregationMaxBytes =
+        static_cast<size_t>((std::max)(timeSynchronization.messageAggregationMaxBytes, 0));
+    peerOptions.aggregationMaxDelay =
+        std::chrono::milliseconds{(std::max)(timeSynchronization.messageAggregationMaxDelayMs, 1)};
+
+    return peerOptions;
+}
+
+
+//! The clock is only read for the duration histograms, if the metrics are submitted to any sink.
+bool MeasuresDurations(const SilKit::Config::ParticipantConfiguration& config)
+{
+    return !config.experimental.metrics.sinks.empty();
+}
+
+
 auto GetConnectTimeoutSeconds(const SilKit::Config::ParticipantConfiguration& config) -> std::chrono::milliseconds
 {
     std::chrono::duration<double> seconds{config.middleware.connectTimeoutSeconds};
@@ -252,18 +354,27 @@ VAsioConnection::VAsioConnection(IParticipantInternal* participant, IMetricsMana
     , _participantId{participantId}
     , _timeProvider{timeProvider}
     , _capabilities{MakeCapabilitiesFromConfiguration(_config)}
-    , _ioContext{MakeAsioIoContext(MakeAsioSocketOptionsFromConfiguration(_config))}
+    , _ioContext{MakeAsioIoContext(MakeAsioSocketOptionsFromConfiguration(_config),
+                                   MakeAsioIoContextOptionsFromConfiguration(_config))}
     , _connectKnownParticipants{*_ioContext, *this, *this, MakeConnectKnownParticipantsSettings(_config)}
     , _remoteConnectionManager{*this, MakeRemoteConnectionManagerSettings(_config)}
     , _version{version}
     , _metricsManager{metricsManager}
+    , _bufferPoolHitsMetric{_metricsManager->GetCounter("BufferPoolHits")}
+    , _bufferPoolMissesMetric{_metricsManager->GetCounter("BufferPoolMisses")}
+    , _dispatchDurationMetric{
+          MeasuresDurations(_config) ? _metricsManager->GetHistogram("MessageDispatchDurationNs") : nullptr}
     , _participant{participant}
+    , _holdBackUserDataMessages{HoldsBackUserDataMessages(_config)}
+    , _sendQueueBackpressure{static_cast<size_t>((std::max)(_config.middleware.sendQueueMaxPendingMessages, 0))}
+    , _countUserDataMessages{CountsUserDataMessages(_config, _participantName)}
 {
 }
 
 VAsioConnection::~VAsioConnection()
 {
     _isShuttingDown = true;
+    _sendQueueBackpressure.Shutdown();
 
     _ioContext->Post([this] {
         {
@@ -328,6 +439,12 @@ auto VAsioConnection::PrepareAcceptorEndpointUris(const std::string& connectUri)
         // Create the default local-domain socket path.
         auto localEndpoint = makeLocalEndpoint(_participantName, _participantId, connectUri);
         acceptorEndpointUris.emplace_back("local://" + localEndpoint.path());
+
+        // The shared memory acceptor needs a local-domain socket of its own.
+        if (_config.middleware.enableSharedMemory)
+        {
+            acceptorEndpointUris.emplace_back("shm://" + localEndpoint.path() + ".shm");
+        }
     }
 
     return acceptorEndpointUris;
@@ -371,7 +488,8 @@ void VAsioConnection::OpenTcpAcceptors(const std::vector<std::string>& acceptorE
                 metric->Add(fmt::format("{}:{}", host, uri.Port()));
             }
         }
-        else if (uri.Type() == Uri::UriType::Local && uri.Scheme() == "local")
+        else if ((uri.Type() == Uri::UriType::Local && uri.Scheme() == "local")
+                 || (uri.Type() == Uri::UriType::SharedMemory && uri.Scheme() == "shm"))
         {
             // do nothing, handled elsewhere
         }
@@ -418,7 +536,8 @@ void VAsioConnection::OpenLocalAcceptors(const std::vector<std::string>& accepto
 
             metric->Add(fmt::format("{}", uri.Path()));
         }
-        else if (uri.Type() == Uri::UriType::Tcp && uri.Scheme() == "tcp")
+        else if ((uri.Type() == Uri::UriType::Tcp && uri.Scheme() == "tcp")
+                 || (uri.Type() == Uri::UriType::SharedMemory && uri.Scheme() == "shm"))
         {
             // do nothing, handled elsewhere
         }
@@ -429,6 +548,48 @@ void VAsioConnection::OpenLocalAcceptors(const std::vector<std::string>& accepto
     }
 }
 
+void VAsioConnection::OpenSharedMemoryAcceptors(const std::vector<std::string>& acceptorEndpointUris)
+{
+    auto metric = _metricsManager->GetStringList("SharedMemoryAcceptors");
+    metric->Clear();
+
+    for (const auto& uriString : acceptorEndpointUris)
+    {
+        const auto uri = Uri::Parse(uriString);
+
+        if (uri.Type() != Uri::UriType::SharedMemory || uri.Scheme() != "shm")
+        {
+            // other URIs are handled (or warned about) by the TCP and local domain acceptors
+            continue;
+        }
+
+        SilKit::Services::Logging::Debug(_logger, "Found shared memory acceptor endpoint URI {} with path {}",
+                                         uriString, uri.Path());
+
+        // file must not exist before we bind/listen on it
+        (void)fs::remove(uri.Path());
+
+        try
+        {
+            auto acceptor{_ioContext->MakeSharedMemoryAcceptor(uri.Path())};
+            acceptor->SetListener(*this);
+            acceptor->AsyncAccept({});
+
+            {
+                std::unique_lock<decltype(_acceptorsMutex)> lock{_acceptorsMutex};
+                _acceptors.emplace_back(std::move(acceptor));
+            }
+        }
+        catch (const std::exception& exception)
+        {
+            Services::Logging::Error(_logger, "Unable to accept shared memory connections on '{}': {}", uri.Path(),
+                                     exception.what());
+        }
+
+        metric->Add(fmt::format("{}", uri.Path()));
+    }
+}
+
 void VAsioConnection::JoinSimulation(std::string connectUri)
 {
     SILKIT_ASSERT(_logger);
@@ -458,6 +619,11 @@ void VAsioConnection::OpenParticipantAcceptors(const std::string& connectUri)
 {
     const auto acceptorEndpointUris = PrepareAcceptorEndpointUris(connectUri);
 
+    if (_config.middleware.enableSharedMemory)
+    {
+        OpenSharedMemoryAcceptors(acceptorEndpointUris);
+    }
+
     if (_config.middleware.enableDomainSockets)
     {
         OpenLocalAcceptors(acceptorEndpointUris);
@@ -1069,11 +1235,6 @@ void VAsioConnection::HandleConnectedPeer(IVAsioPeer* peer)
 void VAsioConnection::AssociateParticipantNameAndPeer(const std::string& simulationName,
                                                       const std::string& participantName, IVAsioPeer* peer)
 {
-    {
-        std::lock_guard<decltype(_mutex)> lock{_mutex};
-        _participantNameToPeer[simulationName].insert({participantName, peer});
-    }
-
     IStringListMetric* metric;
     auto metricNameBase = "Peer/" + simulationName + "/" + participantName;
 
@@ -1082,6 +1243,22 @@ void VAsioConnection::AssociateParticipantNameAndPeer(const std::string& simulat
 
     metric = _metricsManager->GetStringList(metricNameBase + "/RemoteEndpoint");
     metric->Add(peer->GetRemoteAddress());
+
+    // the metrics are assigned before the peer is published, other threads may send via the peer right after that
+    VAsioPeerSendQueueMetrics sendQueueMetrics;
+    sendQueueMetrics.size = _metricsManager->GetStatistic(metricNameBase + "/SendQueueSize");
+    sendQueueMetrics.bytes = _metricsManager->GetStatistic(metricNameBase + "/SendQueueBytes");
+    sendQueueMetrics.droppedMessages = _metricsManager->GetCounter(metricNameBase + "/SendQueueDroppedMessages");
+    if (MeasuresDurations(_config))
+    {
+        sendQueueMetrics.latency = _metricsManager->GetHistogram(metricNameBase + "/SendLatencyNs");
+    }
+    peer->SetSendQueueMetrics(sendQueueMetrics);
+
+    {
+        std::lock_guard<decltype(_mutex)> lock{_mutex};
+        _participantNameToPeer[simulationName].insert({participantName, peer});
+    }
 }
 
 auto VAsioConnection::FindPeerByName(const std::string& simulationName,
@@ -1219,7 +1396,7 @@ void VAsioConnection::AddPeer(std::unique_ptr<IVAsioPeer> newPeer)
 
     if (_useAggregation)
     {
-        newPeer->EnableAggregation();
+        newPeer->EnableAggregation(_aggregationMode);
     }
 
     std::unique_lock<std::mutex> lock{_peersLock};
@@ -1261,6 +1438,9 @@ void VAsioConnection::OnPeerShutdown(IVAsioPeer* peer)
             OnPeerShutdown(proxyPeer);
         }
 
+        ReleaseReceivedUserDataMessagesOf(peer);
+        ForgetUserDataMessageCountsOf(peer);
+
         {
             std::unique_lock<std::mutex> lock{_peersLock};
 
@@ -1273,10 +1453,18 @@ void VAsioConnection::OnPeerShutdown(IVAsioPeer* peer)
 
             RemovePeerFromLinks(peer);
             RemovePeerFromConnection(peer);
+            _sendQueueBackpressure.RemovePeer(peer);
         }
     }
 }
 
+void VAsioConnection::UpdateBufferPoolMetrics()
+{
+    const auto statistics = BufferPool::ThreadLocal().GetStatistics();
+    _bufferPoolHitsMetric->Set(statistics.hits);
+    _bufferPoolMissesMetric->Set(statistics.misses);
+}
+
 void VAsioConnection::SendProxyPeerShutdownNotification(IVAsioPeer* peer)
 {
     const auto& sourceSimulationName = peer->GetSimulationName();
@@ -1346,18 +1534,23 @@ void VAsioConnection::RemovePeerFromConnection(IVAsioPeer* peer)
 void VAsioConnection::NotifyShutdown()
 {
     _isShuttingDown = true;
+    _sendQueueBackpressure.Shutdown();
+
+    // without further simulation steps, the held back user data messages are delivered right away
+    ExecuteOnIoThread([this] { ReleaseReceivedUserDataMessages(std::chrono::nanoseconds::max()); });
 }
 
-void VAsioConnection::EnableAggregation()
+void VAsioConnection::EnableAggregation(VAsioAggregationMode mode)
 {
     // pass information to all existing peers
     for (auto& peer : _peers)
     {
-        peer->EnableAggregation();
+        peer->EnableAggregation(mode);
     }
 
     // keep information for peers joining in the future
     _useAggregation = true;
+    _aggregationMode = mode;
 }
 
 void VAsioConnection::OnSocketData(IVAsioPeer* from, SerializedMessage&& buffer)
@@ -1517,8 +1710,18 @@ void VAsioConnection::ReceiveSubscriptionAcknowledge(IVAsioPeer* from, Serialize
 
     if (ack.status != SubscriptionAcknowledge::Status::Success)
     {
-        Services::Logging::Error(_logger, "Failed to subscribe [{}] {} from {}", ack.subscriber.networkName,
-                                 ack.subscriber.msgTypeName, from->GetInfo().participantName);
+        if (IsUnknownToOlderParticipants(ack.subscriber.msgTypeName))
+        {
+            Services::Logging::Debug(_logger,
+                                     "Failed to subscribe [{}] {} from {}, which probably runs an older version",
+                                     ack.subscriber.networkName, ack.subscriber.msgTypeName,
+                                     from->GetInfo().participantName);
+        }
+        else
+        {
+            Services::Logging::Error(_logger, "Failed to subscribe [{}] {} from {}", ack.subscriber.networkName,
+                                     ack.subscriber.msgTypeName, from->GetInfo().participantName);
+        }
     }
 
     // We remove the pending subscription in any case as there will not follow a new, successful acknowledge from that peer
@@ -1573,6 +1776,10 @@ bool VAsioConnection::TryAddRemoteSubscriber(IVAsioPeer* from, const VAsioMsgSub
         // add the remote receiver without taking the lock
         link->AddRemoteReceiver(from, subscriber.receiverIdx);
 
+        // messages to a proxied participant are queued by the peer of the proxy
+        auto* const proxyPeer = dynamic_cast<VAsioProxyPeer*>(from);
+        _sendQueueBackpressure.AddReceiver(proxyPeer ? proxyPeer->GetPeer() : from, subscriber.networkName);
+
         wasAdded = true;
     });
 
@@ -1606,7 +1813,43 @@ void VAsioConnection::ReceiveRawSilKitMessage(IVAsioPeer* from, SerializedMessag
     ServiceDescriptor tmpService(fromService->GetServiceDescriptor());
     tmpService.SetServiceId(endpoint.endpoint);
 
-    _vasioReceivers[receiverIdx]->ReceiveRawMsg(from, tmpService, std::move(buffer));
+    auto* receiver = _vasioReceivers[receiverIdx].get();
+    const auto isUserDataMessage = receiver->ReceivesUserDataMessages();
+    const auto delayIt = isUserDataMessage ? _receivedUserDataDelays.find(from->GetInfo().participantName)
+                                           : _receivedUserDataDelays.end();
+    if (delayIt != _receivedUserDataDelays.end())
+    {
+        _heldBackMessages[delayIt->first].push_back(
+            HeldBackMessage{delayIt->second, from, receiver, std::move(tmpService), std::move(buffer)});
+    }
+    else
+    {
+        DispatchRawSilKitMessage(from, receiver, tmpService, std::move(buffer));
+    }
+
+    // a held back message counts as received, it is released in the simulation step it belongs to
+    if (isUserDataMessage && _countUserDataMessages)
+    {
+        CountReceivedUserDataMessage(from->GetInfo().participantName);
+    }
+}
+
+void VAsioConnection::DispatchRawSilKitMessage(IVAsioPeer* from, IVAsioReceiver* receiver,
+                                               const ServiceDescriptor& descriptor, SerializedMessage&& buffer)
+{
+    if (_dispatchDurationMetric == nullptr)
+    {
+        receiver->ReceiveRawMsg(from, descriptor, std::move(buffer));
+        return;
+    }
+
+    // includes the deserialization and all handlers of local receivers
+    const auto dispatchStart = std::chrono::steady_clock::now();
+    receiver->ReceiveRawMsg(from, descriptor, std::move(buffer));
+    const auto dispatchDuration = std::chrono::steady_clock::now() - dispatchStart;
+
+    _dispatchDurationMetric->Take(
+        static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(dispatchDuration).count()));
 }
 
 void VAsioConnection::RegisterMessageReceiver(std::function<void(IVAsioPeer* peer, ParticipantAnnouncement)> callback)
@@ -1752,6 +1995,163 @@ auto VAsioConnection::GetParticipantNamesOfRemoteReceivers(const IServiceEndpoin
     return result;
 }
 
+auto VAsioConnection::TakeSentUserDataMessageCounts() -> std::map<std::string, uint64_t>
+{
+    std::map<std::string, uint64_t> result;
+    if (!_countUserDataMessages)
+    {
+        return result;
+    }
+
+    std::unique_lock<std::mutex> lock{_peersLock};
+    for (auto&& peer : _peers)
+    {
+        const auto count = peer->ReportSentUserDataMessages();
+        auto& reportedCount = _reportedSentUserDataMessageCounts[peer->GetInfo().participantName];
+        if (count != reportedCount)
+        {
+            reportedCount = count;
+            result[peer->GetInfo().participantName] = count;
+        }
+    }
+
+    return result;
+}
+
+void VAsioConnection::AwaitReceivedUserDataMessages(std::map<std::string, uint64_t> counts,
+                                                    std::function<void()> handler)
+{
+    for (auto&& participantNameAndCount : counts)
+    {
+        // the messages of a participant which is not connected (anymore) will never arrive
+        if (FindPeerByName(_simulationName, participantNameAndCount.first) == nullptr)
+        {
+            continue;
+        }
+
+        auto& awaitedCount = _awaitedUserDataMessageCounts[participantNameAndCount.first];
+        awaitedCount = (std::max)(awaitedCount, participantNameAndCount.second);
+    }
+    _awaitedUserDataMessagesHandler = std::move(handler);
+
+    // erases the counts which are reached already
+    for (auto it = _awaitedUserDataMessageCounts.begin(); it != _awaitedUserDataMessageCounts.end();)
+    {
+        if (_receivedUserDataMessageCounts[it->first] >= it->second)
+        {
+            it = _awaitedUserDataMessageCounts.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    NotifyIfUserDataMessagesReceived();
+}
+
+void VAsioConnection::CountReceivedUserDataMessage(const std::string& participantName)
+{
+    const auto receivedCount = ++_receivedUserDataMessageCounts[participantName];
+
+    const auto it = _awaitedUserDataMessageCounts.find(participantName);
+    if (it != _awaitedUserDataMessageCounts.end() && receivedCount >= it->second)
+    {
+        _awaitedUserDataMessageCounts.erase(it);
+        NotifyIfUserDataMessagesReceived();
+    }
+}
+
+void VAsioConnection::ForgetUserDataMessageCountsOf(IVAsioPeer* peer)
+{
+    // a reconnecting participant counts its messages from zero again
+    const auto& participantName = peer->GetInfo().participantName;
+    _reportedSentUserDataMessageCounts.erase(participantName);
+    _receivedUserDataMessageCounts.erase(participantName);
+
+    if (_awaitedUserDataMessageCounts.erase(participantName) != 0)
+    {
+        NotifyIfUserDataMessagesReceived();
+    }
+}
+
+void VAsioConnection::NotifyIfUserDataMessagesReceived()
+{
+    if (!_awaitedUserDataMessageCounts.empty() || !_awaitedUserDataMessagesHandler)
+    {
+        return;
+    }
+
+    // the handler may advance the simulation time, which must not happen while a message is being received
+    ExecuteOnIoThread(std::move(_awaitedUserDataMessagesHandler));
+    _awaitedUserDataMessagesHandler = nullptr;
+}
+
+void VAsioConnection::DelayReceivedUserDataMessages(const std::string& participantName,
+                                                    std::chrono::nanoseconds releaseTimePoint)
+{
+    _receivedUserDataDelays[participantName] = releaseTimePoint;
+}
+
+void VAsioConnection::ReleaseReceivedUserDataMessages(std::chrono::nanoseconds timePoint)
+{
+    if (timePoint == std::chrono::nanoseconds::max())
+    {
+        // the simulation time stopped, nothing is held back anymore
+        _receivedUserDataDelays.clear();
+    }
+
+    // merge the messages of all senders, their release time points are ascending per sender and equal ones are
+    // delivered in the order of the sender names
+    while (true)
+    {
+        auto next = _heldBackMessages.end();
+        for (auto it = _heldBackMessages.begin(); it != _heldBackMessages.end(); ++it)
+        {
+            const auto releaseTimePoint = it->second.front().releaseTimePoint;
+            if (releaseTimePoint < timePoint
+                && (next == _heldBackMessages.end() || releaseTimePoint < next->second.front().releaseTimePoint))
+            {
+                next = it;
+            }
+        }
+        if (next == _heldBackMessages.end())
+        {
+            return;
+        }
+
+        // the handlers may receive further messages, so the message is removed before it is dispatched
+        auto message = std::move(next->second.front());
+        next->second.pop_front();
+        if (next->second.empty())
+        {
+            _heldBackMessages.erase(next);
+        }
+
+        DispatchRawSilKitMessage(message.from, message.receiver, message.descriptor, std::move(message.buffer));
+    }
+}
+
+void VAsioConnection::ReleaseReceivedUserDataMessagesOf(IVAsioPeer* peer)
+{
+    const auto& participantName = peer->GetInfo().participantName;
+    _receivedUserDataDelays.erase(participantName);
+
+    const auto it = _heldBackMessages.find(participantName);
+    if (it == _heldBackMessages.end())
+    {
+        return;
+    }
+
+    // the messages refer to the peer, they are delivered before it is removed
+    auto messages = std::move(it->second);
+    _heldBackMessages.erase(it);
+    for (auto&& message : messages)
+    {
+        DispatchRawSilKitMessage(message.from, message.receiver, message.descriptor, std::move(message.buffer));
+    }
+}
+
 void VAsioConnection::SyncSubscriptionsCompleted()
 {
     _receivedAllSubscriptionAcknowledges.set_value();
@@ -1794,7 +2194,19 @@ auto VAsioConnection::MakePeerInfo() -> VAsioPeerInfo
     {
         std::lock_guard<decltype(_acceptorsMutex)> lock{_acceptorsMutex};
 
-        // Ensure that the local acceptors are the first entries in the acceptorUris
+        // Ensure that the shared memory and local acceptors are the first entries in the acceptorUris
+        for (const auto& acceptor : _acceptors)
+        {
+            Uri uri{acceptor->GetLocalEndpoint()};
+
+            if (uri.Type() != Uri::UriType::SharedMemory)
+            {
+                continue;
+            }
+
+            peerInfo.acceptorUris.emplace_back(uri.EncodedString());
+        }
+
         for (const auto& acceptor : _acceptors)
         {
             Uri uri{acceptor->GetLocalEndpoint()};
@@ -1829,14 +2241,27 @@ auto VAsioConnection::MakePeerInfo() -> VAsioPeerInfo
 auto VAsioConnection::MakeConnectPeer(const VAsioPeerInfo& peerInfo) -> std::unique_ptr<IConnectPeer>
 {
     auto connectPeer{
-        std::make_unique<ConnectPeer>(_ioContext.get(), _logger, peerInfo, _config.middleware.enableDomainSockets)};
+        std::make_unique<ConnectPeer>(_ioContext.get(), _logger, peerInfo, _config.middleware.enableDomainSockets,
+                                      _config.middleware.enableSharedMemory)};
     return connectPeer;
 }
 
 
 auto VAsioConnection::MakeVAsioPeer(std::unique_ptr<IRawByteStream> stream) -> std::unique_ptr<IVAsioPeer>
 {
-    auto vAsioPeer{std::make_unique<VAsioPeer>(this, _ioContext.get(), std::move(stream), _logger)};
+    auto peerOptions{MakeVAsioPeerOptionsFromConfiguration(_config)};
+    // only TCP and local domain sockets are moved onto the I/O worker threads, see IoWorkerThreads
+    peerOptions.completionsOnIoWorkerThread = stream->CompletesOnIoWorkerThread();
+    peerOptions.sendQueueBackpressure = &_sendQueueBackpressure;
+    peerOptions.onSendQueueOverflow = [this](IVAsioPeer& peer) {
+        Services::Logging::Error(_logger,
+                                 "Messages to participant '{}' are dropped, because its send queue is full. The "
+                                 "participant does not receive messages as fast as they are sent.",
+                                 peer.GetInfo().participantName);
+    };
+
+    auto vAsioPeer{std::make_unique<VAsioPeer>(this, _ioContext.get(), std::move(stream), _logger,
+                                               std::move(peerOptions))};
     return vAsioPeer;
 }
 
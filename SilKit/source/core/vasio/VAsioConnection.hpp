@@ -31,8 +31,12 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include <mutex>
 #include <atomic>
 #include <list>
+#include <map>
+#include <deque>
+#include <chrono>
 #include <set>
 #include <condition_variable>
+#include <functional>
 
 #include "ParticipantConfiguration.hpp"
 
@@ -69,6 +73,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "MakeAsioIoContext.hpp"
 #include "ConnectKnownParticipants.hpp"
 #include "RemoteConnectionManager.hpp"
+#include "SendQueueBackpressure.hpp"
 
 
 namespace SilKit {
@@ -159,17 +164,46 @@ public:
         });
     }
 
+    //! Only the messages accepted by the filter are sent to the participant on the network. An empty filter accepts
+    //! all messages.
+    template <typename SilKitMessageT>
+    void SetRemoteReceiverFilter(const std::string& networkName, const std::string& participantName,
+                                 std::function<bool(const SilKitMessageT&)> filter)
+    {
+        ExecuteOnIoThread([this, networkName, participantName, filter = std::move(filter)]() mutable {
+            this->GetLinkByName<SilKitMessageT>(networkName)->SetRemoteReceiverFilter(participantName,
+                                                                                       std::move(filter));
+        });
+    }
+
     template <typename SilKitMessageT>
     void SendMsg(const IServiceEndpoint* from, SilKitMessageT&& msg)
     {
-        ExecuteOnIoThread(&VAsioConnection::SendMsgImpl<SilKitMessageT>, from, std::forward<SilKitMessageT>(msg));
+        using MessageT = std::decay_t<SilKitMessageT>;
+        const auto isHeldBack = HoldBackUserDataMessage<MessageT>(from);
+        // an rvalue message is moved into the posted function, instead of being copied
+        ExecuteOnIoThread([this, from, isHeldBack, msg = MessageT{std::forward<SilKitMessageT>(msg)}] {
+            this->SendMsgImpl<MessageT>(from, msg);
+            if (isHeldBack)
+            {
+                _sendQueueBackpressure.Release();
+            }
+        });
     }
 
     template <typename SilKitMessageT>
     void SendMsg(const IServiceEndpoint* from, const std::string& targetParticipantName, SilKitMessageT&& msg)
     {
-        ExecuteOnIoThread(&VAsioConnection::SendMsgToTargetImpl<SilKitMessageT>, from, targetParticipantName,
-                          std::forward<SilKitMessageT>(msg));
+        using MessageT = std::decay_t<SilKitMessageT>;
+        const auto isHeldBack = HoldBackUserDataMessage<MessageT>(from);
+        ExecuteOnIoThread(
+            [this, from, targetParticipantName, isHeldBack, msg = MessageT{std::forward<SilKitMessageT>(msg)}] {
+                this->SendMsgToTargetImpl<MessageT>(from, targetParticipantName, msg);
+                if (isHeldBack)
+                {
+                    _sendQueueBackpressure.Release();
+                }
+            });
     }
 
     inline void OnAllMessagesDelivered(const std::function<void()>& callback)
@@ -183,6 +217,12 @@ public:
         _ioContext->Post(std::move(function));
     }
 
+    //! Updates the metrics which are sampled instead of being updated continuously, must be called on the I/O thread
+    void UpdateMetrics()
+    {
+        UpdateBufferPoolMetrics();
+    }
+
     inline auto Config() const -> const SilKit::Config::ParticipantConfiguration&
     {
         return _config;
@@ -195,6 +235,7 @@ public:
     auto PrepareAcceptorEndpointUris(const std::string& connectUri) -> std::vector<std::string>;
     void OpenTcpAcceptors(const std::vector<std::string>& acceptorEndpointUris);
     void OpenLocalAcceptors(const std::vector<std::string>& acceptorEndpointUris);
+    void OpenSharedMemoryAcceptors(const std::vector<std::string>& acceptorEndpointUris);
 
     // Listening Sockets (acceptors)
     void AcceptLocalConnections(const std::string& uniqueId);
@@ -206,7 +247,7 @@ public:
 
     void NotifyShutdown();
 
-    void EnableAggregation();
+    void EnableAggregation(VAsioAggregationMode mode);
 
     // Register handlers for completion of async service creation
     void AddAsyncSubscriptionsCompletionHandler(std::function<void()> handler);
@@ -221,6 +262,10 @@ public:
     auto GetNumberOfRemoteReceivers(const IServiceEndpoint* service, const std::string& msgTypeName) -> size_t;
     auto GetParticipantNamesOfRemoteReceivers(const IServiceEndpoint* service,
                                               const std::string& msgTypeName) -> std::vector<std::string>;
+    auto TakeSentUserDataMessageCounts() -> std::map<std::string, uint64_t>;
+    void AwaitReceivedUserDataMessages(std::map<std::string, uint64_t> counts, std::function<void()> handler);
+    void DelayReceivedUserDataMessages(const std::string& participantName, std::chrono::nanoseconds releaseTimePoint);
+    void ReleaseReceivedUserDataMessages(std::chrono::nanoseconds timePoint);
 
     bool ParticipantHasCapability(const std::string& participantName, const std::string& capability) const;
 
@@ -235,14 +280,19 @@ private: // data types
     template <class MsgT>
     using SilKitServiceToLinkMap = std::map<std::string, std::shared_ptr<SilKitLink<MsgT>>>;
 
+    //! The links owned by _links never go away, so the raw pointers stay valid
+    template <class MsgT>
+    using SilKitSenderToLinkMap = std::unordered_map<const IServiceEndpoint*, SilKitLink<MsgT>*>;
+
     using ParticipantAnnouncementReceiver = std::function<void(IVAsioPeer* peer, ParticipantAnnouncement)>;
 
     using SilKitMessageTypes = std::tuple<
-        Services::Logging::LogMsg, Services::Orchestration::NextSimTask, Services::Orchestration::SystemCommand,
+        Services::Logging::LogMsg, Services::Logging::LogMsgBatch, Services::Orchestration::NextSimTask,
+        Services::Orchestration::UserDataMessageCounts, Services::Orchestration::SystemCommand,
         Services::Orchestration::ParticipantStatus, Services::Orchestration::WorkflowConfiguration,
         Services::PubSub::WireDataMessageEvent, Services::Rpc::FunctionCall, Services::Rpc::FunctionCallResponse,
-        Services::Can::WireCanFrameEvent, Services::Can::CanFrameTransmitEvent, Services::Can::CanControllerStatus,
-        Services::Can::CanConfigureBaudrate, Services::Can::CanSetControllerMode,
+        Services::Rpc::FunctionCallBatch, Services::Can::WireCanFrameEvent, Services::Can::CanFrameTransmitEvent,
+        Services::Can::CanControllerStatus, Services::Can::CanConfigureBaudrate, Services::Can::CanSetControllerMode,
         Services::Ethernet::WireEthernetFrameEvent, Services::Ethernet::EthernetFrameTransmitEvent,
         Services::Ethernet::EthernetStatus, Services::Ethernet::EthernetSetMode, Services::Lin::LinSendFrameRequest,
         Services::Lin::LinSendFrameHeaderRequest, Services::Lin::LinTransmission, Services::Lin::LinWakeupPulse,
@@ -254,7 +304,7 @@ private: // data types
         Services::Flexray::FlexrayTxBufferConfigUpdate, Services::Flexray::WireFlexrayTxBufferUpdate,
         Services::Flexray::FlexrayPocStatusEvent, Core::Discovery::ParticipantDiscoveryEvent,
         Core::Discovery::ServiceDiscoveryEvent, Core::RequestReply::RequestReplyCall,
-        Core::RequestReply::RequestReplyCallReturn, VSilKit::MetricsUpdate,
+        Core::RequestReply::RequestReplyCallReturn, VSilKit::MetricsUpdate, VSilKit::WireMetricsUpdate,
 
         // Private testing data types
         Core::Tests::Version1::TestMessage, Core::Tests::Version2::TestMessage, Core::Tests::TestFrameEvent>;
@@ -263,6 +313,12 @@ private:
     // ----------------------------------------
     // private methods
     void ReceiveRawSilKitMessage(IVAsioPeer* from, SerializedMessage&& buffer);
+    void DispatchRawSilKitMessage(IVAsioPeer* from, IVAsioReceiver* receiver, const ServiceDescriptor& descriptor,
+                                  SerializedMessage&& buffer);
+    void ReleaseReceivedUserDataMessagesOf(IVAsioPeer* peer);
+    void CountReceivedUserDataMessage(const std::string& participantName);
+    void ForgetUserDataMessageCountsOf(IVAsioPeer* peer);
+    void NotifyIfUserDataMessagesReceived();
     void ReceiveSubscriptionAnnouncement(IVAsioPeer* from, SerializedMessage&& buffer);
     void ReceiveSubscriptionAcknowledge(IVAsioPeer* from, SerializedMessage&& buffer);
     void ReceiveRegistryMessage(IVAsioPeer* from, SerializedMessage&& buffer);
@@ -298,6 +354,9 @@ private:
     void RemovePendingSubscription(const PendingAcksIdentifier& ackId);
 
     void SendProxyPeerShutdownNotification(IVAsioPeer* peer);
+
+    // Publish the statistics of the buffer pool of the I/O thread
+    void UpdateBufferPoolMetrics();
     void RemovePeerFromLinks(IVAsioPeer* peer);
     void RemovePeerFromConnection(IVAsioPeer* peer);
 
@@ -368,11 +427,39 @@ private:
     }
 
     template <class SilKitMessageT>
-    void RegisterSilKitMsgSender(const std::string& networkName)
+    void RegisterSilKitMsgSender(const IServiceEndpoint* sender)
     {
+        auto&& networkName = sender->GetServiceDescriptor().GetNetworkName();
+
         auto link = GetLinkByName<SilKitMessageT>(networkName);
         auto&& serviceLinkMap = std::get<SilKitServiceToLinkMap<SilKitMessageT>>(_serviceToLinkMap);
         serviceLinkMap[networkName] = link;
+
+        // resolve the link once, such that sending does not have to look up the network name of each message
+        auto&& senderLinkMap = std::get<SilKitSenderToLinkMap<SilKitMessageT>>(_senderToLinkMap);
+        senderLinkMap[sender] = link.get();
+    }
+
+    template <class SilKitMessageT>
+    auto GetLinkOfSender(const IServiceEndpoint* from) -> SilKitLink<SilKitMessageT>*
+    {
+        auto&& senderLinkMap = std::get<SilKitSenderToLinkMap<SilKitMessageT>>(_senderToLinkMap);
+        const auto senderIt = senderLinkMap.find(from);
+        if (senderIt != senderLinkMap.end())
+        {
+            return senderIt->second;
+        }
+
+        // endpoints which are not registered as a service send on the link of their network
+        const auto& key = from->GetServiceDescriptor().GetNetworkName();
+
+        auto&& linkMap = std::get<SilKitServiceToLinkMap<SilKitMessageT>>(_serviceToLinkMap);
+        const auto linkIt = linkMap.find(key);
+        if (linkIt == linkMap.end())
+        {
+            throw SilKitError{"VAsioConnection: sending on empty link for " + key};
+        }
+        return linkIt->second.get();
     }
 
     template <class SilKitServiceT>
@@ -388,7 +475,7 @@ private:
 
         Util::tuple_tools::for_each(sendMessageTypes, [this, service](auto&& message) {
             using SilKitMessageT = std::decay_t<decltype(message)>;
-            this->RegisterSilKitMsgSender<SilKitMessageT>(GetServiceDescriptor(service).GetNetworkName());
+            this->RegisterSilKitMsgSender<SilKitMessageT>(&dynamic_cast<const IServiceEndpoint&>(*service));
         });
 
         // We could have registered a receiver that only uses already acknowledged senders, thus no new handshake is
@@ -410,44 +497,38 @@ private:
     }
 
     template <class SilKitMessageT>
-    void SendMsgImpl(const IServiceEndpoint* from, SilKitMessageT&& msg)
+    void SendMsgImpl(const IServiceEndpoint* from, const SilKitMessageT& msg)
     {
-        const auto& key = from->GetServiceDescriptor().GetNetworkName();
-
-        auto& linkMap = std::get<SilKitServiceToLinkMap<std::decay_t<SilKitMessageT>>>(_serviceToLinkMap);
-        if (linkMap.count(key) < 1)
-        {
-            throw SilKitError{"SendMsgImpl: sending on empty link for " + key};
-        }
-        auto&& link = linkMap[key];
-        link->DistributeLocalSilKitMessage(from, std::forward<SilKitMessageT>(msg));
+        GetLinkOfSender<SilKitMessageT>(from)->DistributeLocalSilKitMessage(from, msg);
     }
 
     template <class SilKitMessageT>
     void SendMsgToTargetImpl(const IServiceEndpoint* from, const std::string& targetParticipantName,
-                             SilKitMessageT&& msg)
+                             const SilKitMessageT& msg)
     {
-        const auto& key = from->GetServiceDescriptor().GetNetworkName();
-
-        auto& linkMap = std::get<SilKitServiceToLinkMap<std::decay_t<SilKitMessageT>>>(_serviceToLinkMap);
-        if (linkMap.count(key) < 1)
-        {
-            throw SilKitError{"SendMsgToTargetImpl: sending on empty link for " + key};
-        }
-        auto&& link = linkMap[key];
-        link->DispatchSilKitMessageToTarget(from, targetParticipantName, std::forward<SilKitMessageT>(msg));
+        GetLinkOfSender<SilKitMessageT>(from)->DispatchSilKitMessageToTarget(from, targetParticipantName, msg);
     }
 
-    template <typename... MethodArgs, typename... Args>
-    inline void ExecuteOnIoThread(void (VAsioConnection::*method)(MethodArgs...), Args&&... args)
-    {
-        _ioContext->Post([=]() mutable { (this->*method)(std::move(args)...); });
-    }
     inline void ExecuteOnIoThread(std::function<void()> function)
     {
         _ioContext->Post(std::move(function));
     }
 
+    //! Blocks the calling thread while the send queue of a peer receiving on the network of the sender is full (Block
+    //! overflow policy), returns true if the message has to be released after it was handed over to the peers
+    template <class SilKitMessageT>
+    bool HoldBackUserDataMessage(const IServiceEndpoint* from)
+    {
+        // the io context drains the send queues, waiting for them would never return
+        if (!_holdBackUserDataMessages || aggregationKind<SilKitMessageT>() != MessageAggregationKind::UserDataMessage
+            || _ioContext->IsRunningInThisThread())
+        {
+            return false;
+        }
+
+        return _sendQueueBackpressure.Acquire(from->GetServiceDescriptor().GetNetworkName());
+    }
+
     template <class SilKitServiceT>
     const ServiceDescriptor& GetServiceDescriptor(SilKitServiceT* service)
     {
@@ -501,6 +582,8 @@ private:
     Util::tuple_tools::wrapped_tuple<SilKitLinkMap, SilKitMessageTypes> _links;
     //! \brief Lookup for links by name.
     Util::tuple_tools::wrapped_tuple<SilKitServiceToLinkMap, SilKitMessageTypes> _serviceToLinkMap;
+    //! \brief Links of the registered senders, resolved on registration.
+    Util::tuple_tools::wrapped_tuple<SilKitSenderToLinkMap, SilKitMessageTypes> _senderToLinkMap;
 
     std::vector<std::unique_ptr<IVAsioReceiver>> _vasioReceivers;
     std::unordered_set<std::string> _vasioUniqueReceiverIds;
@@ -570,6 +653,9 @@ private:
 
     // metrics
     IMetricsManager* _metricsManager;
+    ICounterMetric* _bufferPoolHitsMetric;
+    ICounterMetric* _bufferPoolMissesMetric;
+    IHistogramMetric* _dispatchDurationMetric;
 
     // for debugging purposes:
     IParticipantInternal* _participant{nullptr};
@@ -577,6 +663,33 @@ private:
     friend class ::SilKit::Core::RemoteConnectionManager;
 
     bool _useAggregation{false};
+    VAsioAggregationMode _aggregationMode{VAsioAggregationMode::SimulationStep};
+
+    // the senders of user data messages are held back while the send queue of a peer is full (Block overflow policy)
+    const bool _holdBackUserDataMessages;
+    SendQueueBackpressure _sendQueueBackpressure;
+
+    // the grants of the time synchronization aggregator could overtake the user data messages between the other
+    // participants, so these count the user data messages, and the receivers wait for the number sent before the
+    // grant (only accessed on the I/O thread)
+    const bool _countUserDataMessages;
+    std::unordered_map<std::string, uint64_t> _reportedSentUserDataMessageCounts;
+    std::unordered_map<std::string, uint64_t> _receivedUserDataMessageCounts;
+    std::map<std::string, uint64_t> _awaitedUserDataMessageCounts;
+    std::function<void()> _awaitedUserDataMessagesHandler;
+
+    // the user data messages of a participant with a minimum reaction delay are held back until the simulation step
+    // they are relevant for, so they are delivered in the same step in every run (only accessed on the I/O thread)
+    struct HeldBackMessage
+    {
+        std::chrono::nanoseconds releaseTimePoint;
+        IVAsioPeer* from;
+        IVAsioReceiver* receiver;
+        ServiceDescriptor descriptor;
+        SerializedMessage buffer;
+    };
+    std::unordered_map<std::string, std::chrono::nanoseconds> _receivedUserDataDelays;
+    std::map<std::string, std::deque<HeldBackMessage>> _heldBackMessages;
 };
 
 
@@ -21,15 +21,19 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "VAsioPeer.hpp"
 
+#include <algorithm>
 #include <iomanip>
+#include <iterator>
 #include <sstream>
 #include <thread>
 
 #include "LoggerMessage.hpp"
 #include "VAsioMsgKind.hpp"
+#include "BufferPool.hpp"
 #include "VAsioConnection.hpp"
 #include "Uri.hpp"
 #include "Assert.hpp"
+#include "Metrics.hpp"
 
 #include "util/TracingMacros.hpp"
 
@@ -48,12 +52,14 @@ namespace SilKit {
 namespace Core {
 
 VAsioPeer::VAsioPeer(IVAsioPeerListener* listener, IIoContext* ioContext, std::unique_ptr<IRawByteStream> stream,
-                     Services::Logging::ILogger* logger)
+                     Services::Logging::ILogger* logger, VAsioPeerOptions options)
     : _listener{listener}
     , _ioContext{ioContext}
     , _socket{std::move(stream)}
+    , _options{options}
     , _logger{logger}
     , _msgBuffer{4096}
+    , _sendingQueue{_options.sendQueueCapacity}
 {
     _socket->SetListener(*this);
 
@@ -65,6 +71,10 @@ VAsioPeer::VAsioPeer(IVAsioPeerListener* listener, IIoContext* ioContext, std::u
 VAsioPeer::~VAsioPeer()
 {
     SILKIT_TRACE_METHOD_(_logger, "()");
+
+    // a full send queue must not hold back the senders after the peer is gone
+    _isShuttingDown = true;
+    UpdateSendQueueBackpressure();
 }
 
 
@@ -72,10 +82,8 @@ void VAsioPeer::Shutdown()
 {
     _isShuttingDown = true;
 
-    {
-        std::unique_lock<decltype(_sendingQueueMutex)> lock{_sendingQueueMutex};
-        _sendingQueue.clear();
-    }
+    // the queued messages are discarded by the next StartAsyncWrite, only the io context may drain the send queue
+    UpdateSendQueueBackpressure();
 
     _socket->Shutdown();
     _flushTimer->Shutdown();
@@ -116,69 +124,432 @@ auto VAsioPeer::GetSimulationName() const -> const std::string&
 
 void VAsioPeer::SendSilKitMsg(SerializedMessage buffer)
 {
-    auto blob = buffer.ReleaseStorage();
-
-    if (_useAggregation && buffer.GetAggregationKind() == MessageAggregationKind::UserDataMessage)
+    const auto aggregationKind = buffer.GetAggregationKind();
+    // the clock is only read if the send latency is measured at all
+    const auto enqueueTime = _sendingQueueMetrics.latency != nullptr ? std::chrono::steady_clock::now()
+                                                                      : std::chrono::steady_clock::time_point{};
+    Util::SharedVector<uint8_t> sharedPayload;
+    auto blob = buffer.ReleaseStorage(sharedPayload);
+
+    if (_useAggregation && aggregationKind == MessageAggregationKind::UserDataMessage)
     {
-        Aggregate(blob);
+        Aggregate(QueuedMessage{std::move(blob), std::move(sharedPayload), true, enqueueTime});
     }
-    else if (_useAggregation && buffer.GetAggregationKind() == MessageAggregationKind::FlushAggregationMessage)
+    else if (_useAggregation && aggregationKind == MessageAggregationKind::FlushAggregationMessage)
     {
-        Aggregate(blob); // don't forget to send (current) time sync message
-        Flush();
+        // don't forget to send (current) time sync message
+        Aggregate(QueuedMessage{std::move(blob), std::move(sharedPayload), false, enqueueTime});
+        UpdateStepDuration();
+        FlushAggregatedMessages(false);
+    }
+    else if (_useAggregation)
+    {
+        SendOrHoldBack(QueuedMessage{std::move(blob), std::move(sharedPayload), false, enqueueTime});
     }
     else
     {
-        SendSilKitMsgInternal(std::move(blob));
+        SendSilKitMsgInternal(QueuedMessage{std::move(blob), std::move(sharedPayload),
+                                            aggregationKind == MessageAggregationKind::UserDataMessage, enqueueTime});
     }
 }
 
-void VAsioPeer::SendSilKitMsgInternal(std::vector<uint8_t> blob)
+void VAsioPeer::SendOrHoldBack(QueuedMessage message)
+{
+    // a flush which already took the held back messages has to send them first
+    std::unique_lock<std::mutex> flushLock{_aggregationFlushMutex};
+    {
+        std::unique_lock<std::mutex> lock{_aggregationMutex};
+        if (!_aggregatedMessages.empty())
+        {
+            // the message must not overtake the user data messages held back before, it is flushed with them
+            _aggregatedBytes += message.Size();
+            _aggregatedMessages.emplace_back(std::move(message));
+            return;
+        }
+    }
+
+    SendSilKitMsgInternal(std::move(message));
+}
+
+void VAsioPeer::SendSilKitMsgInternal(QueuedMessage message)
 {
     // Prevent sending when shutting down
     if (!_isShuttingDown && _socket != nullptr)
     {
-        std::unique_lock<std::mutex> lock{_sendingQueueMutex};
+        const auto isUserData = message.isUserData;
+        const auto messageSize = message.Size();
+        if (isUserData && !AdmitToSendQueue(messageSize))
+        {
+            return;
+        }
+
+        // count the message before it is visible to the io context, which uncounts it when taking it out of the queue
+        _queuedMessages += 1;
+        _queuedBytes += messageSize;
+        if (isUserData)
+        {
+            _sentUserDataMessages += 1;
+        }
+
+        // once a message went to the overflow queue, all following ones have to, until it is taken over completely
+        if (_sendingQueueOverflowing.load(std::memory_order_acquire) || !_sendingQueue.TryPush(message))
+        {
+            std::unique_lock<std::mutex> lock{_sendingQueueOverflowMutex};
+            _sendingQueueOverflow.emplace_back(std::move(message));
+            _sendingQueueOverflowing.store(true, std::memory_order_release);
+        }
+
+        // only the first message after the last StartAsyncWrite has to wake up the io context
+        if (!_writePending.exchange(true))
+        {
+            _ioContext->Dispatch([this] { StartAsyncWrite(); });
+        }
+
+        if (isUserData && _options.sendQueueOverflowPolicy == SendQueueOverflowPolicy::DropOldest
+            && ExceedsSendQueueLimits(_queuedMessages, _queuedBytes))
+        {
+            NotifySendQueueOverflow();
+        }
+
+        UpdateSendQueueBackpressure();
+    }
+}
+
+auto VAsioPeer::ExceedsSendQueueLimits(size_t messages, size_t bytes) const -> bool
+{
+    return (_options.sendQueueMaxMessages != 0 && messages > _options.sendQueueMaxMessages)
+           || (_options.sendQueueMaxBytes != 0 && bytes > _options.sendQueueMaxBytes);
+}
+
+auto VAsioPeer::AdmitToSendQueue(size_t messageSize) -> bool
+{
+    // a message is always admitted to an empty queue, even if it exceeds the byte limit on its own
+    if (_queuedMessages == 0 || !ExceedsSendQueueLimits(_queuedMessages + 1, _queuedBytes + messageSize))
+    {
+        return true;
+    }
+
+    switch (_options.sendQueueOverflowPolicy)
+    {
+    case SendQueueOverflowPolicy::Block:
+        // the senders are held back before they hand their messages over to the io context, which drains the queue
+        // and therefore never blocks itself
+        return true;
+    case SendQueueOverflowPolicy::DropOldest:
+        // the io context drops the oldest messages after this one has been queued
+        return true;
+    case SendQueueOverflowPolicy::DropNewest:
+    case SendQueueOverflowPolicy::Error:
+        _droppedMessages += 1;
+        NotifySendQueueOverflow();
+        return false;
+    }
+
+    return true;
+}
+
+void VAsioPeer::NotifySendQueueOverflow()
+{
+    if (!_overflowHandlingPending.exchange(true))
+    {
+        _ioContext->Dispatch([this] { HandleSendQueueOverflow(); });
+    }
+}
+
+void VAsioPeer::HandleSendQueueOverflow()
+{
+    _overflowHandlingPending = false;
+
+    if (_isShuttingDown)
+    {
+        return;
+    }
+
+    if (_options.sendQueueOverflowPolicy == SendQueueOverflowPolicy::DropOldest)
+    {
+        DropOldestUserDataMessages();
+    }
+
+    if (_options.sendQueueOverflowPolicy == SendQueueOverflowPolicy::Error && !_overflowReported)
+    {
+        _overflowReported = true;
+        if (_options.onSendQueueOverflow)
+        {
+            _options.onSendQueueOverflow(*this);
+        }
+    }
+
+    UpdateSendQueueMetrics();
+}
+
+void VAsioPeer::DropOldestUserDataMessages()
+{
+    // user data messages are dropped from anywhere in the queue, all queued messages have to be taken over for that
+    TakeOverSendQueue();
+
+    // the queued messages are in the order they were counted, the first ones were reported and are awaited already
+    auto reportedUserDataMessages = _reportedUserDataMessages > _writtenUserDataMessages
+                                        ? _reportedUserDataMessages - _writtenUserDataMessages
+                                        : 0;
+
+    auto it = _takenOverMessages.begin();
+    while (it != _takenOverMessages.end() && ExceedsSendQueueLimits(_queuedMessages, _queuedBytes))
+    {
+        if (!it->isUserData)
+        {
+            ++it;
+            continue;
+        }
+
+        if (reportedUserDataMessages > 0)
+        {
+            reportedUserDataMessages -= 1;
+            ++it;
+            continue;
+        }
+
+        _queuedMessages -= 1;
+        _queuedBytes -= it->Size();
+        _droppedMessages += 1;
+        _sentUserDataMessages -= 1;
+        it = _takenOverMessages.erase(it);
+    }
+}
+
+void VAsioPeer::UpdateSendQueueBackpressure()
+{
+    if (_options.sendQueueOverflowPolicy != SendQueueOverflowPolicy::Block || _options.sendQueueBackpressure == nullptr)
+    {
+        return;
+    }
+
+    // a peer which is shutting down discards its queue, it must not hold back the senders anymore
+    const auto isFull = !_isShuttingDown && ExceedsSendQueueLimits(_queuedMessages, _queuedBytes);
+    if (isFull != _sendQueueReportedFull)
+    {
+        _sendQueueReportedFull = isFull;
+        _options.sendQueueBackpressure->SetSendQueueFull(this, isFull);
+    }
+}
+
+void VAsioPeer::UpdateSendQueueMetrics()
+{
+    if (_sendingQueueMetrics.size != nullptr)
+    {
+        _sendingQueueMetrics.size->Take(static_cast<double>(_queuedMessages));
+    }
+    if (_sendingQueueMetrics.bytes != nullptr)
+    {
+        _sendingQueueMetrics.bytes->Take(static_cast<double>(_queuedBytes));
+    }
+    if (_sendingQueueMetrics.droppedMessages != nullptr)
+    {
+        _sendingQueueMetrics.droppedMessages->Set(_droppedMessages);
+    }
+}
 
-        _sendingQueue.emplace_back(std::move(blob));
+auto VAsioPeer::FrontOfSendQueue() -> const QueuedMessage*
+{
+    if (!_takenOverMessages.empty())
+    {
+        return &_takenOverMessages.front();
+    }
 
-        lock.unlock();
+    if (auto* message = _sendingQueue.Front())
+    {
+        return message;
+    }
 
-        _ioContext->Dispatch([this] { StartAsyncWrite(); });
+    // the overflow queue is only taken over if the sending queue is empty, i.e., all messages which were queued before
+    // the first overflowed message have been sent
+    if (_sendingQueueOverflowing.load(std::memory_order_acquire))
+    {
+        std::unique_lock<std::mutex> lock{_sendingQueueOverflowMutex};
+        _takenOverMessages.swap(_sendingQueueOverflow);
+        _sendingQueueOverflowing.store(false, std::memory_order_release);
     }
+
+    return _takenOverMessages.empty() ? nullptr : &_takenOverMessages.front();
 }
 
-void VAsioPeer::Aggregate(const std::vector<uint8_t>& blob)
+void VAsioPeer::PopSendQueue(QueuedMessage& message)
 {
-    // start initial timer
-    // NB: resetting timer in every Aggregate() is costly
-    if (!_initialTimerStarted)
+    if (!_takenOverMessages.empty())
     {
-        _flushTimer->AsyncWaitFor(_flushTimeout);
-        _initialTimerStarted = true;
+        message = std::move(_takenOverMessages.front());
+        _takenOverMessages.pop_front();
+    }
+    else
+    {
+        const auto popped = _sendingQueue.TryPop(message);
+        SILKIT_ASSERT(popped);
+        SILKIT_UNUSED_ARG(popped);
     }
 
-    _aggregatedMessages.insert(_aggregatedMessages.end(), blob.begin(), blob.end());
+    _queuedMessages -= 1;
+    _queuedBytes -= message.Size();
+    if (message.isUserData)
+    {
+        _writtenUserDataMessages += 1;
+    }
+}
 
-    // ensure that the aggregation buffer does not exceed a certain size
-    if (_aggregatedMessages.size() > _aggregationBufferThreshold)
+void VAsioPeer::TakeOverSendQueue()
+{
+    // keeps the order of FrontOfSendQueue: the sending queue first, then the overflow queue
+    QueuedMessage message;
+    while (_sendingQueue.TryPop(message))
+    {
+        _takenOverMessages.emplace_back(std::move(message));
+    }
+
+    if (_sendingQueueOverflowing.load(std::memory_order_acquire))
+    {
+        std::unique_lock<std::mutex> lock{_sendingQueueOverflowMutex};
+        std::move(_sendingQueueOverflow.begin(), _sendingQueueOverflow.end(), std::back_inserter(_takenOverMessages));
+        _sendingQueueOverflow.clear();
+        _sendingQueueOverflowing.store(false, std::memory_order_release);
+    }
+}
+
+void VAsioPeer::ClearSendQueue()
+{
+    QueuedMessage message;
+    while (FrontOfSendQueue() != nullptr)
+    {
+        PopSendQueue(message);
+    }
+}
+
+void VAsioPeer::Aggregate(QueuedMessage message)
+{
+    bool exceedsMaxBytes{false};
+    {
+        std::unique_lock<std::mutex> lock{_aggregationMutex};
+
+        // start the timer with the first held back message
+        // NB: resetting timer in every Aggregate() is costly
+        if (!_flushTimerArmed)
+        {
+            ArmFlushTimer();
+        }
+
+        _aggregatedBytes += message.Size();
+        _aggregatedMessages.emplace_back(std::move(message));
+
+        exceedsMaxBytes = _aggregatedBytes > _options.aggregationMaxBytes;
+    }
+
+    // ensure that the aggregated messages do not exceed a certain size
+    if (exceedsMaxBytes)
     {
         Services::Logging::Debug(_logger,
                                  "VAsioPeer: Automated flush of aggregation buffer has been triggered, since the "
                                  "maximum buffer size of {}Byte has been exceeded.",
-                                 _aggregationBufferThreshold);
-        Flush();
+                                 _options.aggregationMaxBytes);
+        FlushAggregatedMessages(false);
+    }
+    else if (_aggregationMode == VAsioAggregationMode::WhileWriting && !_sending)
+    {
+        // nothing is being written, holding the message back would only delay it
+        FlushAggregatedMessages(false);
+    }
+}
+
+void VAsioPeer::FlushAggregatedMessages(bool skipIfBusy)
+{
+    // the io context must not wait for a sender, which may be blocked by the overflow policy of the send queue
+    std::unique_lock<std::mutex> flushLock{_aggregationFlushMutex, std::defer_lock};
+    if (skipIfBusy)
+    {
+        if (!flushLock.try_lock())
+        {
+            // another thread is flushing, messages it does not pick up are flushed by the timer
+            std::unique_lock<std::mutex> lock{_aggregationMutex};
+            if (!_flushTimerArmed && !_aggregatedMessages.empty())
+            {
+                ArmFlushTimer();
+            }
+            return;
+        }
+    }
+    else
+    {
+        flushLock.lock();
+    }
+
+    do
+    {
+        {
+            std::unique_lock<std::mutex> lock{_aggregationMutex};
+            _flushedMessages.swap(_aggregatedMessages);
+            _aggregatedBytes = 0;
+
+            // reset timer when flush is triggered (in the WhileWriting mode most flushes happen right away, which would
+            // reset the timer for almost every message)
+            if (_aggregationMode == VAsioAggregationMode::SimulationStep)
+            {
+                ArmFlushTimer();
+            }
+        }
+
+        for (auto& message : _flushedMessages)
+        {
+            SendSilKitMsgInternal(std::move(message));
+        }
+        _flushedMessages.clear();
+
+        // messages held back meanwhile are not flushed by the io context while this thread holds the flush lock
+    } while (_aggregationMode == VAsioAggregationMode::WhileWriting && !_sending && HasAggregatedMessages());
+}
+
+auto VAsioPeer::HasAggregatedMessages() -> bool
+{
+    std::unique_lock<std::mutex> lock{_aggregationMutex};
+    return !_aggregatedMessages.empty();
+}
+
+void VAsioPeer::ArmFlushTimer()
+{
+    // in the SimulationStep mode, a flush message usually arrives after about one simulation step; the timer expires
+    // a few deviations later (like the retransmission timeout of TCP, see RFC 6298)
+    _flushDelay = _options.aggregationMaxDelay;
+    if (_aggregationMode == VAsioAggregationMode::SimulationStep && _smoothedStepDuration.count() > 0)
+    {
+        const auto adaptiveDelay = _smoothedStepDuration + 4 * _stepDurationVariation;
+        _flushDelay = (std::min)((std::max)(adaptiveDelay, std::chrono::nanoseconds{1ms}), _flushDelay);
     }
+
+    _flushTimer->AsyncWaitFor(_flushDelay);
+    _flushTimerArmed = true;
 }
 
-void VAsioPeer::Flush()
+void VAsioPeer::UpdateStepDuration()
 {
-    decltype(_aggregatedMessages) blob;
-    blob.swap(_aggregatedMessages);
-    SendSilKitMsgInternal(std::move(blob));
+    if (_aggregationMode != VAsioAggregationMode::SimulationStep)
+    {
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock{_aggregationMutex};
 
-    // reset timer when flush is triggered
-    _flushTimer->AsyncWaitFor(_flushTimeout);
+    const auto now = std::chrono::steady_clock::now();
+    if (_lastStepEnd != std::chrono::steady_clock::time_point{})
+    {
+        const auto stepDuration = std::chrono::duration_cast<std::chrono::nanoseconds>(now - _lastStepEnd);
+        if (_smoothedStepDuration.count() == 0)
+        {
+            _smoothedStepDuration = stepDuration;
+            _stepDurationVariation = stepDuration / 2;
+        }
+        else
+        {
+            const auto deviation = stepDuration - _smoothedStepDuration;
+            _stepDurationVariation += ((deviation.count() < 0 ? -deviation : deviation) - _stepDurationVariation) / 4;
+            _smoothedStepDuration += deviation / 8;
+        }
+    }
+    _lastStepEnd = now;
 }
 
 void VAsioPeer::StartAsyncWrite()
@@ -186,25 +557,72 @@ void VAsioPeer::StartAsyncWrite()
     if (_sending)
         return;
 
-    std::unique_lock<std::mutex> lock{_sendingQueueMutex};
-    if (_sendingQueue.empty())
+    // messages queued from now on are not necessarily picked up below, their producer has to schedule another call
+    _writePending.store(false);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    if (_isShuttingDown)
     {
+        ClearSendQueue();
         return;
     }
 
+    UpdateSendQueueMetrics();
+
+    // gather as many queued messages into a single write as the configured limits allow, but at least one
+    // (a message with a shared payload takes up two buffers, its network headers and the payload)
+    _currentSendingMessages.clear();
+    size_t gatheredBuffers{0};
+    size_t gatheredBytes{0};
+    while (auto* message = FrontOfSendQueue())
+    {
+        const auto buffersOfMessage = message->sharedPayload.AsSpan().empty() ? size_t{1} : size_t{2};
+        if (!_currentSendingMessages.empty()
+            && (gatheredBuffers + buffersOfMessage > _options.maxBuffersPerWrite
+                || gatheredBytes + message->Size() > _options.maxBytesPerWrite))
+        {
+            break;
+        }
+
+        gatheredBuffers += buffersOfMessage;
+        gatheredBytes += message->Size();
+        _currentSendingMessages.emplace_back();
+        PopSendQueue(_currentSendingMessages.back());
+    }
+
+    if (_currentSendingMessages.empty())
+    {
+        return;
+    }
+
+    if (!ExceedsSendQueueLimits(_queuedMessages, _queuedBytes))
+    {
+        _overflowReported = false;
+    }
+    UpdateSendQueueBackpressure();
+
     _sending = true;
 
-    _currentSendingBufferData = std::move(_sendingQueue.front());
-    _sendingQueue.pop_front();
-    lock.unlock();
+    _currentSendingBuffers.clear();
+    for (const auto& message : _currentSendingMessages)
+    {
+        _currentSendingBuffers.emplace_back(message.blob.data(), message.blob.size());
+
+        const auto sharedPayload = message.sharedPayload.AsSpan();
+        if (!sharedPayload.empty())
+        {
+            _currentSendingBuffers.emplace_back(sharedPayload.data(), sharedPayload.size());
+        }
+    }
+    _currentSendingBufferIndex = 0;
 
-    _currentSendingBuffer = ConstBuffer(_currentSendingBufferData.data(), _currentSendingBufferData.size());
     WriteSomeAsync();
 }
 
 void VAsioPeer::WriteSomeAsync()
 {
-    _socket->AsyncWriteSome(ConstBufferSequence{&_currentSendingBuffer, 1});
+    _socket->AsyncWriteSome(ConstBufferSequence{_currentSendingBuffers.data() + _currentSendingBufferIndex,
+                                                _currentSendingBuffers.size() - _currentSendingBufferIndex});
 }
 
 void VAsioPeer::Subscribe(VAsioMsgSubscriber subscriber)
@@ -242,12 +660,12 @@ void VAsioPeer::DispatchBuffer()
         }
         if (_msgBuffer.Size() >= sizeof(uint32_t))
         {
-            std::vector<uint8_t> msgSizeInBytes(sizeof(uint32_t));
-            if (!_msgBuffer.Peek(msgSizeInBytes))
+            uint32_t msgSize{0};
+            if (!_msgBuffer.Peek(Util::Span<uint8_t>{reinterpret_cast<uint8_t*>(&msgSize), sizeof(msgSize)}))
             {
                 throw SilKitError("Reading message size from ring buffer failed.");
             }
-            _currentMsgSize = *reinterpret_cast<uint32_t*>(msgSizeInBytes.data());
+            _currentMsgSize = msgSize;
         }
         else
         {
@@ -262,32 +680,53 @@ void VAsioPeer::DispatchBuffer()
     if (_currentMsgSize == 0 || _currentMsgSize > 1024 * 1024 * 1024)
     {
         SilKit::Services::Logging::Error(_logger, "Received invalid Message Size: {}", _currentMsgSize);
-        Shutdown();
+
+        if (_options.completionsOnIoWorkerThread)
+        {
+            // stop dispatching immediately, the remaining shutdown must happen on the io context (timer, send queue)
+            _isShuttingDown = true;
+            _ioContext->Post([this] { Shutdown(); });
+        }
+        else
+        {
+            Shutdown();
+        }
+        return;
     }
 
 
     if (_msgBuffer.Size() < _currentMsgSize)
     {
-        // Make the buffer large enough and wait until we have more data.
         if (_msgBuffer.Capacity() < _currentMsgSize)
         {
-            _msgBuffer.Reserve(_currentMsgSize);
+            // only the part of the message which is already received is copied, the rest is read into its buffer
+            _largeMsg = AcquireReceiveBuffer(_currentMsgSize);
+            if (!_msgBuffer.Read(_largeMsg, _msgBuffer.Size()))
+            {
+                throw SilKitError("Reading data from ring buffer failed.");
+            }
+            _largeMsgReceived = _largeMsg.size();
+            _largeMsg.resize(_currentMsgSize);
+
+            ReadLargeMessageAsync();
+            return;
         }
 
+        // wait until we have more data
         ReadSomeAsync();
         return;
     }
     else
     {
-        std::vector<uint8_t> currentMsg(_currentMsgSize);
-        if (!_msgBuffer.Read(currentMsg))
+        // a message fitting into the ring buffer is copied out of it exactly once, its payloads are not copied again
+        // during deserialization (see MessageBuffer and SharedVector)
+        auto currentMsg = AcquireReceiveBuffer(_currentMsgSize);
+        if (!_msgBuffer.Read(currentMsg, _currentMsgSize))
         {
             throw SilKitError("Reading data from ring buffer failed.");
         }
 
-        SerializedMessage message{std::move(currentMsg)};
-        message.SetProtocolVersion(GetProtocolVersion());
-        _listener->OnSocketData(this, std::move(message));
+        HandleReceivedMessage(SerializedMessage{std::move(currentMsg)});
 
         _currentMsgSize = 0u;
 
@@ -296,6 +735,47 @@ void VAsioPeer::DispatchBuffer()
 }
 
 
+void VAsioPeer::ReadLargeMessageAsync()
+{
+    _currentReceivingBuffers.clear();
+    _currentReceivingBuffers.emplace_back(_largeMsg.data() + _largeMsgReceived, _largeMsg.size() - _largeMsgReceived);
+
+    _socket->AsyncReadSome(MutableBufferSequence{_currentReceivingBuffers.data(), _currentReceivingBuffers.size()});
+}
+
+auto VAsioPeer::AcquireReceiveBuffer(size_t size) -> std::vector<uint8_t>
+{
+    // the storage is recycled on the io context after dispatching the message (see VAsioReceiver), so the pool of an
+    // I/O worker thread would only drain
+    if (_options.completionsOnIoWorkerThread)
+    {
+        std::vector<uint8_t> buffer;
+        buffer.reserve(size);
+        return buffer;
+    }
+
+    return BufferPool::ThreadLocal().Acquire(size);
+}
+
+void VAsioPeer::HandleReceivedMessage(SerializedMessage message)
+{
+    if (_options.completionsOnIoWorkerThread)
+    {
+        _receivedMessages.emplace_back(std::move(message));
+        return;
+    }
+
+    DeliverReceivedMessage(std::move(message));
+}
+
+void VAsioPeer::DeliverReceivedMessage(SerializedMessage message)
+{
+    // the protocol version is negotiated by the handshake, i.e., by handling previously received messages
+    message.SetProtocolVersion(GetProtocolVersion());
+    _listener->OnSocketData(this, std::move(message));
+}
+
+
 // IRawByteStreamListener
 
 
@@ -304,8 +784,38 @@ void VAsioPeer::OnAsyncReadSomeDone(IRawByteStream& stream, size_t bytesTransfer
     SILKIT_UNUSED_ARG(stream);
     SILKIT_TRACE_METHOD_(_logger, "({}, {})", static_cast<const void*>(&stream), bytesTransferred);
 
-    _msgBuffer.AdvanceWPos(bytesTransferred);
+    if (!_largeMsg.empty())
+    {
+        _largeMsgReceived += bytesTransferred;
+        if (_largeMsgReceived < _largeMsg.size())
+        {
+            ReadLargeMessageAsync();
+            return;
+        }
+
+        HandleReceivedMessage(SerializedMessage{std::move(_largeMsg)});
+        _largeMsg.clear();
+        _currentMsgSize = 0u;
+    }
+    else
+    {
+        _msgBuffer.AdvanceWPos(bytesTransferred);
+    }
     DispatchBuffer();
+
+    if (!_receivedMessages.empty())
+    {
+        // hand all messages of this read over at once, posting preserves the order in which they were received
+        auto messages{std::make_shared<std::vector<SerializedMessage>>()};
+        messages->swap(_receivedMessages);
+
+        _ioContext->Post([this, messages] {
+            for (auto& message : *messages)
+            {
+                DeliverReceivedMessage(std::move(message));
+            }
+        });
+    }
 }
 
 
@@ -314,14 +824,73 @@ void VAsioPeer::OnAsyncWriteSomeDone(IRawByteStream& stream, size_t bytesTransfe
     SILKIT_UNUSED_ARG(stream);
     SILKIT_TRACE_METHOD_(_logger, "({}, {})", static_cast<const void*>(&stream), bytesTransferred);
 
-    if (bytesTransferred < _currentSendingBuffer.GetSize())
+    if (_options.completionsOnIoWorkerThread)
+    {
+        // the send state and the buffer pool of the serializing thread belong to the io context
+        _ioContext->Post([this, bytesTransferred] { ContinueAsyncWrite(bytesTransferred); });
+        return;
+    }
+
+    ContinueAsyncWrite(bytesTransferred);
+}
+
+void VAsioPeer::ContinueAsyncWrite(size_t bytesTransferred)
+{
+    // skip all completely written buffers and slice off the written prefix of a partially written one
+    while (bytesTransferred > 0 && _currentSendingBufferIndex < _currentSendingBuffers.size())
+    {
+        auto& buffer = _currentSendingBuffers[_currentSendingBufferIndex];
+        const auto bytesOfBuffer = (std::min)(bytesTransferred, buffer.GetSize());
+        buffer.SliceOff(bytesOfBuffer);
+        bytesTransferred -= bytesOfBuffer;
+
+        if (buffer.GetSize() == 0)
+        {
+            ++_currentSendingBufferIndex;
+        }
+    }
+
+    if (_currentSendingBufferIndex < _currentSendingBuffers.size())
     {
-        _currentSendingBuffer.SliceOff(bytesTransferred);
         WriteSomeAsync();
         return;
     }
 
+    if (_sendingQueueMetrics.latency != nullptr)
+    {
+        const auto now = std::chrono::steady_clock::now();
+        for (const auto& message : _currentSendingMessages)
+        {
+            const auto enqueueTime = message.enqueueTime;
+
+            // messages queued before the metric was set carry no enqueue time
+            if (enqueueTime == std::chrono::steady_clock::time_point{})
+            {
+                continue;
+            }
+
+            const auto latency = std::chrono::duration_cast<std::chrono::nanoseconds>(now - enqueueTime);
+            _sendingQueueMetrics.latency->Take(static_cast<uint64_t>(latency.count()));
+        }
+    }
+
+    // all gathered messages are written, recycle their storage for serializing the next messages (shared payloads are
+    // recycled along with the last message referring to them)
+    auto& bufferPool = BufferPool::ThreadLocal();
+    for (auto& message : _currentSendingMessages)
+    {
+        bufferPool.Release(std::move(message.blob));
+    }
+    _currentSendingMessages.clear();
+
     _sending = false;
+
+    // messages held back while writing are gathered into the next write
+    if (_useAggregation && _aggregationMode == VAsioAggregationMode::WhileWriting)
+    {
+        FlushAggregatedMessages(true);
+    }
+
     StartAsyncWrite();
 }
 
@@ -331,6 +900,10 @@ void VAsioPeer::OnShutdown(IRawByteStream& stream)
     SILKIT_UNUSED_ARG(stream);
     SILKIT_TRACE_METHOD_(_logger, "({})", static_cast<const void*>(&stream));
 
+    // the remote side disconnected, nothing is sent anymore and the senders must not wait for the send queue
+    _isShuttingDown = true;
+    UpdateSendQueueBackpressure();
+
     _listener->OnPeerShutdown(this);
 }
 
@@ -339,23 +912,61 @@ void VAsioPeer::OnTimerExpired(ITimer& timer)
     SILKIT_UNUSED_ARG(timer);
     SILKIT_TRACE_METHOD_(_logger, "({})", static_cast<const void*>(&timer));
 
-    if (!_aggregatedMessages.empty())
+    std::chrono::nanoseconds flushDelay;
+    {
+        std::unique_lock<std::mutex> lock{_aggregationMutex};
+        _flushTimerArmed = false;
+        if (_aggregatedMessages.empty())
+        {
+            return;
+        }
+        flushDelay = _flushDelay;
+    }
+
+    if (_aggregationMode == VAsioAggregationMode::SimulationStep && flushDelay >= _options.aggregationMaxDelay)
     {
         Services::Logging::Warn(
             _logger,
             "VAsioPeer: Automated flush of aggregation buffer has been triggered, since the "
             "maximum allowed time step duration of {}milliseconds has been exceeded. Consider switching off the "
             "message aggregation via the config option 'EnableMessageAggregation'.",
-            _flushTimeout.count());
+            _options.aggregationMaxDelay.count());
+    }
+    else
+    {
+        Services::Logging::Debug(_logger,
+                                 "VAsioPeer: Automated flush of aggregation buffer has been triggered, since the "
+                                 "messages have been held back for {}ns.",
+                                 flushDelay.count());
+    }
+
+    FlushAggregatedMessages(true);
+}
 
-        Flush();
+void VAsioPeer::SetSendQueueMetrics(VAsioPeerSendQueueMetrics metrics)
+{
+    _sendingQueueMetrics = metrics;
+}
+
+auto VAsioPeer::ReportSentUserDataMessages() -> uint64_t
+{
+    // the held back messages are counted once they are in the send queue
+    if (_useAggregation && HasAggregatedMessages())
+    {
+        FlushAggregatedMessages(false);
     }
+
+    _reportedUserDataMessages = _sentUserDataMessages;
+    return _reportedUserDataMessages;
 }
 
-void VAsioPeer::EnableAggregation()
+void VAsioPeer::EnableAggregation(VAsioAggregationMode mode)
 {
+    _aggregationMode = mode;
     _useAggregation = true;
-    SilKit::Services::Logging::Debug(_logger, "VAsioPeer: Enable aggregation for peer {}", _info.participantName);
+    SilKit::Services::Logging::Debug(_logger, "VAsioPeer: Enable aggregation for peer {} ({})", _info.participantName,
+                                     mode == VAsioAggregationMode::SimulationStep ? "until end of simulation step"
+                                                                                  : "while writing");
 }
 
 } // namespace Core
@@ -22,8 +22,11 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #pragma once
 
 
+#include <atomic>
+#include <chrono>
+#include <functional>
 #include <vector>
-#include <queue>
+#include <deque>
 #include <mutex>
 #include <sstream>
 
@@ -33,8 +36,10 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "EndpointAddress.hpp"
 #include "MessageBuffer.hpp"
 #include "RingBuffer.hpp"
+#include "MpscQueue.hpp"
 #include "VAsioPeerInfo.hpp"
 #include "ProtocolVersion.hpp"
+#include "SendQueueBackpressure.hpp"
 
 #include "IIoContext.hpp"
 #include "IRawByteStream.hpp"
@@ -45,6 +50,50 @@ namespace SilKit {
 namespace Core {
 
 
+//! What a peer does with a user data message, if queueing it would exceed the limits of its send queue
+enum class SendQueueOverflowPolicy
+{
+    //! Block the sending thread until the queue is below the limits, see SendQueueBackpressure. The io context itself
+    //! is never blocked, messages it sends are always queued.
+    Block,
+    //! Queue the message and drop the oldest queued user data messages
+    DropOldest,
+    //! Drop the message
+    DropNewest,
+    //! Drop the message and notify the onSendQueueOverflow callback
+    Error,
+};
+
+struct VAsioPeerOptions
+{
+    //! Upper bound of bytes gathered into a single write. A single message larger than this is still sent as a whole.
+    size_t maxBytesPerWrite{1024 * 1024};
+    //! Upper bound of queued messages gathered into a single write.
+    size_t maxBuffersPerWrite{64};
+    //! Number of messages the lock-free send queue holds. Further messages are queued in a (locked) overflow queue.
+    size_t sendQueueCapacity{4096};
+    //! Upper bound of queued messages, 0 is unlimited. Only user data messages (PubSub, RPC, CAN, and Ethernet) are
+    //! held back by the overflow policy, all other messages are always queued.
+    size_t sendQueueMaxMessages{0};
+    //! Upper bound of queued bytes, 0 is unlimited. A single message is queued even if it exceeds the limit on its own.
+    size_t sendQueueMaxBytes{0};
+    SendQueueOverflowPolicy sendQueueOverflowPolicy{SendQueueOverflowPolicy::Block};
+    //! Called on the io context if a message was dropped by the Error policy, once until the queue is below the limits
+    std::function<void(IVAsioPeer&)> onSendQueueOverflow;
+    //! Notified by the Block policy whenever the send queue starts or stops exceeding the limits
+    SendQueueBackpressure* sendQueueBackpressure{nullptr};
+    //! Aggregated messages are sent as soon as they exceed this number of bytes.
+    size_t aggregationMaxBytes{100 * 1000};
+    //! Upper bound of the time messages are held back by the aggregation. In the SimulationStep mode, the actual delay
+    //! adapts to the observed wall-clock duration of the simulation steps.
+    std::chrono::milliseconds aggregationMaxDelay{50};
+    //! The stream completes reads and writes on an I/O worker thread, instead of the thread running the io context.
+    //! Received messages and write completions are then handed over to the io context, such that the listener and the
+    //! send queue are only accessed from the thread running the io context.
+    bool completionsOnIoWorkerThread{false};
+};
+
+
 class VAsioPeer
     : public IVAsioPeer
     , private IRawByteStreamListener
@@ -65,7 +114,7 @@ public:
     VAsioPeer& operator=(VAsioPeer&& other) = delete; //implicitly deleted because of mutex
 
     VAsioPeer(IVAsioPeerListener* listener, IIoContext* ioContext, std::unique_ptr<IRawByteStream> stream,
-              Services::Logging::ILogger* logger);
+              Services::Logging::ILogger* logger, VAsioPeerOptions options = {});
 
     ~VAsioPeer() override;
 
@@ -95,18 +144,43 @@ public:
 
     void Shutdown() override;
 
-    void EnableAggregation() override;
+    void EnableAggregation(VAsioAggregationMode mode) override;
+
+    void SetSendQueueMetrics(VAsioPeerSendQueueMetrics metrics) override;
+
+    auto ReportSentUserDataMessages() -> uint64_t override;
 
 private:
     // ----------------------------------------
     // Private Methods
     void StartAsyncWrite();
     void WriteSomeAsync();
+    void ContinueAsyncWrite(size_t bytesTransferred);
     void ReadSomeAsync();
     void DispatchBuffer();
-    void SendSilKitMsgInternal(std::vector<uint8_t> blob);
-    void Aggregate(const std::vector<uint8_t>& blob);
-    void Flush();
+    void ReadLargeMessageAsync();
+    auto AcquireReceiveBuffer(size_t size) -> std::vector<uint8_t>;
+    void HandleReceivedMessage(SerializedMessage message);
+    void DeliverReceivedMessage(SerializedMessage message);
+    struct QueuedMessage;
+    void SendSilKitMsgInternal(QueuedMessage message);
+    auto FrontOfSendQueue() -> const QueuedMessage*;
+    void PopSendQueue(QueuedMessage& message);
+    void ClearSendQueue();
+    void TakeOverSendQueue();
+    auto ExceedsSendQueueLimits(size_t messages, size_t bytes) const -> bool;
+    auto AdmitToSendQueue(size_t messageSize) -> bool;
+    void NotifySendQueueOverflow();
+    void HandleSendQueueOverflow();
+    void DropOldestUserDataMessages();
+    void UpdateSendQueueBackpressure();
+    void UpdateSendQueueMetrics();
+    void Aggregate(QueuedMessage message);
+    void SendOrHoldBack(QueuedMessage message);
+    void FlushAggregatedMessages(bool skipIfBusy);
+    auto HasAggregatedMessages() -> bool;
+    void ArmFlushTimer();
+    void UpdateStepDuration();
 
 private: // IRawByteStreamListener
     void OnAsyncReadSomeDone(IRawByteStream& stream, size_t bytesTransferred) override;
@@ -123,6 +197,7 @@ private:
     IVAsioPeerListener* _listener{nullptr};
     IIoContext* _ioContext{nullptr};
     std::unique_ptr<IRawByteStream> _socket;
+    VAsioPeerOptions _options;
     VAsioPeerInfo _info;
     std::string _simulationName;
 
@@ -134,24 +209,79 @@ private:
     std::atomic<uint32_t> _currentMsgSize{0u};
     RingBuffer _msgBuffer;
     std::vector<MutableBuffer> _currentReceivingBuffers;
+    // a message exceeding the ring buffer is read directly into its own buffer, instead of growing the ring buffer and
+    // copying the message out of it
+    std::vector<uint8_t> _largeMsg;
+    size_t _largeMsgReceived{0};
+    // messages received by a single read on the I/O worker thread, which are not yet handed over to the io context
+    std::vector<SerializedMessage> _receivedMessages;
 
     // sending
-    mutable std::mutex _sendingQueueMutex;
-    std::deque<std::vector<uint8_t>> _sendingQueue;
-    ConstBuffer _currentSendingBuffer;
-    std::vector<uint8_t> _currentSendingBufferData;
-    std::vector<uint8_t> _aggregatedMessages;
+    struct QueuedMessage
+    {
+        std::vector<uint8_t> blob;
+        // the payload following blob, if it is shared with the same message to other receivers
+        Util::SharedVector<uint8_t> sharedPayload;
+        // user data messages are subject to the overflow policy
+        bool isUserData{false};
+        std::chrono::steady_clock::time_point enqueueTime{};
+
+        auto Size() const -> size_t
+        {
+            return blob.size() + sharedPayload.AsSpan().size();
+        }
+    };
+    Util::MpscQueue<QueuedMessage> _sendingQueue;
+    // messages which did not fit into the sending queue, producers use it as long as it is not empty to keep the order
+    std::mutex _sendingQueueOverflowMutex;
+    std::deque<QueuedMessage> _sendingQueueOverflow;
+    std::atomic_bool _sendingQueueOverflowing{false};
+    // messages taken over by the io context, they precede all messages in the sending queue
+    std::deque<QueuedMessage> _takenOverMessages;
+    // a StartAsyncWrite is scheduled or a write is in progress, producers only schedule another one if it is not set
+    std::atomic_bool _writePending{false};
+    // queued messages which are not yet part of a write, compared against the limits of the send queue
+    std::atomic<size_t> _queuedMessages{0};
+    std::atomic<size_t> _queuedBytes{0};
+    std::atomic<uint64_t> _droppedMessages{0};
+    std::atomic_bool _overflowHandlingPending{false};
+    bool _overflowReported{false};
+    // the send queue exceeds its limits, as last reported to the backpressure of the Block overflow policy
+    bool _sendQueueReportedFull{false};
+    VAsioPeerSendQueueMetrics _sendingQueueMetrics;
+    // user data messages which were admitted to the send queue and not dropped, the number of them which was reported,
+    // and the number of them which were taken out of the send queue to be written (the latter ones only accessed on
+    // the io context); the reported ones which are still queued are never dropped
+    std::atomic<uint64_t> _sentUserDataMessages{0};
+    uint64_t _reportedUserDataMessages{0};
+    uint64_t _writtenUserDataMessages{0};
+    // all messages of the currently pending (gathered) write and the remaining parts of them that are still unsent
+    std::vector<QueuedMessage> _currentSendingMessages;
+    std::vector<ConstBuffer> _currentSendingBuffers;
+    size_t _currentSendingBufferIndex{0};
 
     std::atomic_bool _sending{false};
     Core::ServiceDescriptor _serviceDescriptor;
 
-    bool _useAggregation{false};
-    const size_t _aggregationBufferThreshold{100 * 1000};
+    // aggregation: held back messages are moved into the send queue as a whole, without copying them, such that they
+    // are gathered into as few writes as possible
+    std::atomic_bool _useAggregation{false};
+    std::atomic<VAsioAggregationMode> _aggregationMode{VAsioAggregationMode::SimulationStep};
+    std::mutex _aggregationMutex;
+    std::vector<QueuedMessage> _aggregatedMessages;
+    size_t _aggregatedBytes{0};
+    // only a single thread moves held back messages into the send queue at a time, which keeps their order
+    std::mutex _aggregationFlushMutex;
+    std::vector<QueuedMessage> _flushedMessages;
+    // smoothed wall-clock duration of a simulation step (the time between two flush messages) and its variation
+    std::chrono::steady_clock::time_point _lastStepEnd{};
+    std::chrono::nanoseconds _smoothedStepDuration{0};
+    std::chrono::nanoseconds _stepDurationVariation{0};
 
     // we trigger a flush of aggregated messages, if too much time has passed since the last flush
     std::unique_ptr<ITimer> _flushTimer;
-    const std::chrono::milliseconds _flushTimeout{50};
-    bool _initialTimerStarted{false};
+    std::chrono::nanoseconds _flushDelay{0};
+    bool _flushTimerArmed{false};
 };
 
 // ================================================================================
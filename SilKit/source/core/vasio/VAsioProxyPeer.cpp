@@ -61,6 +61,10 @@ void VAsioProxyPeer::SendSilKitMsg(SerializedMessage buffer)
     // keep track of aggregation kind
     auto bufferProxy = SerializedMessage{msg};
     bufferProxy.SetAggregationKind(buffer.GetAggregationKind());
+    if (buffer.GetAggregationKind() == MessageAggregationKind::UserDataMessage)
+    {
+        _sentUserDataMessages += 1;
+    }
 
     _peer->SendSilKitMsg(std::move(bufferProxy));
 }
@@ -103,11 +107,23 @@ void VAsioProxyPeer::Shutdown()
     Log::Debug(_logger, "VAsioProxyPeer ({}): Shutdown: Ignored", _peerInfo.participantName);
 }
 
-void VAsioProxyPeer::EnableAggregation()
+void VAsioProxyPeer::EnableAggregation(VAsioAggregationMode /*mode*/)
 {
     Log::Debug(_logger, "VAsioProxyPeer ({}): EnableAggregation: Ignored", _peerInfo.participantName);
 }
 
+void VAsioProxyPeer::SetSendQueueMetrics(VAsioPeerSendQueueMetrics /*metrics*/)
+{
+    Log::Debug(_logger, "VAsioProxyPeer ({}): SetSendQueueMetrics: Ignored", _peerInfo.participantName);
+}
+
+auto VAsioProxyPeer::ReportSentUserDataMessages() -> uint64_t
+{
+    // the messages are sent (and reported) by the peer of the proxy
+    _peer->ReportSentUserDataMessages();
+    return _sentUserDataMessages;
+}
+
 void VAsioProxyPeer::SetProtocolVersion(ProtocolVersion v)
 {
     Log::Debug(_logger, "VAsioProxyPeer ({}): SetProtocolVersion: {}.{}", _peerInfo.participantName, v.major, v.minor);
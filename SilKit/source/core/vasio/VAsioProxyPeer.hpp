@@ -21,6 +21,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #pragma once
 
+#include <atomic>
 
 #include "IVAsioPeer.hpp"
 
@@ -55,7 +56,9 @@ public: // IVAsioPeer
     auto GetLocalAddress() const -> std::string override;
     void StartAsyncRead() override;
     void Shutdown() override;
-    void EnableAggregation() override;
+    void EnableAggregation(VAsioAggregationMode mode) override;
+    void SetSendQueueMetrics(VAsioPeerSendQueueMetrics metrics) override;
+    auto ReportSentUserDataMessages() -> uint64_t override;
     void SetProtocolVersion(ProtocolVersion v) override;
     auto GetProtocolVersion() const -> ProtocolVersion override;
     void SetSimulationName(const std::string& simulationName) override;
@@ -81,6 +84,8 @@ private:
     ServiceDescriptor _serviceDescriptor;
     SilKit::Services::Logging::ILogger* _logger;
     ProtocolVersion _protocolVersion;
+    // NB: the user data messages dropped by the limits of the send queue of _peer are still counted
+    std::atomic<uint64_t> _sentUserDataMessages{0};
 };
 
 
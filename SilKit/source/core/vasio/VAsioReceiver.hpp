@@ -64,6 +64,7 @@ public:
     virtual ~IVAsioReceiver() = default;
     virtual auto GetDescriptor() const -> const VAsioMsgSubscriber& = 0;
     virtual void ReceiveRawMsg(IVAsioPeer* from, const ServiceDescriptor& descriptor, SerializedMessage&& buffer) = 0;
+    virtual bool ReceivesUserDataMessages() const = 0;
 };
 
 template <class MsgT>
@@ -83,6 +84,10 @@ public:
     // Public interface methods
     auto GetDescriptor() const -> const VAsioMsgSubscriber& override;
     void ReceiveRawMsg(IVAsioPeer* from, const ServiceDescriptor& descriptor, SerializedMessage&& buffer) override;
+    bool ReceivesUserDataMessages() const override
+    {
+        return aggregationKind<MsgT>() == MessageAggregationKind::UserDataMessage;
+    }
     void SetServiceDescriptor(const ServiceDescriptor& serviceDescriptor) override
     {
         _serviceDescriptor = serviceDescriptor;
@@ -124,12 +129,17 @@ template <class MsgT>
 void VAsioReceiver<MsgT>::ReceiveRawMsg(IVAsioPeer* /*from*/, const ServiceDescriptor& descriptor,
                                         SerializedMessage&& buffer)
 {
-    MsgT msg = buffer.Deserialize<MsgT>();
+    {
+        MsgT msg = buffer.Deserialize<MsgT>();
 
-    Services::TraceRx(_logger, this, msg, descriptor);
+        Services::TraceRx(_logger, this, msg, descriptor);
+
+        auto remoteId = RemoteServiceEndpoint(descriptor);
+        _link->DistributeRemoteSilKitMessage(&remoteId, std::move(msg));
+    }
 
-    auto remoteId = RemoteServiceEndpoint(descriptor);
-    _link->DistributeRemoteSilKitMessage(&remoteId, std::move(msg));
+    // the storage is reused for receiving the following messages, unless a handler kept a payload referring to it
+    buffer.RecycleStorage();
 }
 
 } // namespace Core
@@ -423,8 +423,8 @@ void VAsioRegistry::OnMetricsUpdate(const std::string& participantName, const VS
     Log::Info(GetLogger(), "Participant {} updates {} metrics", participantName, metricsUpdate.metrics.size());
     for (const auto& data : metricsUpdate.metrics)
     {
-        Log::Info(GetLogger(), "Metric Update: {} {} {} {} ({})", data.name, data.kind, data.value, data.timestamp,
-                  participantName);
+        Log::Info(GetLogger(), "Metric Update: {} {} {} {} ({})", data.name, data.kind,
+                  VSilKit::FormatMetricValue(data), data.timestamp, participantName);
     }
 }
 
@@ -21,7 +21,11 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #pragma once
 
+#include <algorithm>
+#include <functional>
+#include <iterator>
 #include <sstream>
+#include <unordered_map>
 
 #include "IVAsioPeer.hpp"
 #include <type_traits>
@@ -97,6 +101,15 @@ class VAsioTransmitter
     using History = MessageHistory<MsgT, SilKitMsgTraits<MsgT>::HistSize()>;
     History _hist;
 
+    using Filter = std::function<bool(const MsgT&)>;
+
+    // The filter of the remote participant is resolved once when the receiver is added or the filter is set, so the
+    // send path does not need to look it up by participant name.
+    struct FilteredRemoteReceiver : RemoteReceiver
+    {
+        Filter filter;
+    };
+
 public:
     // ----------------------------------------
     // Public methods
@@ -110,8 +123,18 @@ public:
             return;
 
 
+        FilteredRemoteReceiver filteredRemoteReceiver;
+        filteredRemoteReceiver.peer = peer;
+        filteredRemoteReceiver.remoteIdx = remoteIdx;
+
+        const auto filter = _remoteReceiverFilters.find(peer->GetInfo().participantName);
+        if (filter != _remoteReceiverFilters.end())
+        {
+            filteredRemoteReceiver.filter = filter->second;
+        }
+
         _serviceDescriptor.SetParticipantNameAndComputeId(peer->GetInfo().participantName);
-        _remoteReceivers.push_back(remoteReceiver);
+        _remoteReceivers.push_back(std::move(filteredRemoteReceiver));
         _hist.NotifyPeer(peer, remoteIdx);
     }
 
@@ -166,17 +189,61 @@ public:
         _hist.SetHistoryLength(historyLength);
     }
 
+    //! Only the messages accepted by the filter are sent to the participant. An empty filter accepts all messages.
+    void SetRemoteReceiverFilter(const std::string& participantName, Filter filter)
+    {
+        for (auto&& remoteReceiver : _remoteReceivers)
+        {
+            if (remoteReceiver.peer->GetInfo().participantName == participantName)
+            {
+                remoteReceiver.filter = filter;
+            }
+        }
+
+        if (filter)
+        {
+            _remoteReceiverFilters[participantName] = std::move(filter);
+        }
+        else
+        {
+            _remoteReceiverFilters.erase(participantName);
+        }
+    }
+
 public:
     // ----------------------------------------
     // Public interface methods
     void ReceiveMsg(const IServiceEndpoint* from, const MsgT& msg) override
     {
         _hist.Save(from, msg);
-        for (auto& receiver : _remoteReceivers)
+        if (_remoteReceivers.empty())
         {
-            auto buffer = SerializedMessage(msg, to_endpointAddress(from->GetServiceDescriptor()), receiver.remoteIdx);
-            receiver.peer->SendSilKitMsg(std::move(buffer));
+            return;
         }
+
+        if (!_remoteReceiverFilters.empty())
+        {
+            SendFilteredMessage(from, msg);
+            return;
+        }
+
+        // Serialize the message only once. Every remote receiver gets its own network headers with the remote index
+        // patched in, the payload is shared by all of them. The last receiver takes over the original buffer.
+        auto buffer = SerializedMessage(msg, to_endpointAddress(from->GetServiceDescriptor()),
+                                        _remoteReceivers.front().remoteIdx);
+        if (_remoteReceivers.size() > 1)
+        {
+            buffer.SharePayload();
+        }
+        const auto lastReceiver = std::prev(_remoteReceivers.end());
+        for (auto it = _remoteReceivers.begin(); it != lastReceiver; ++it)
+        {
+            auto bufferCopy = buffer;
+            bufferCopy.SetRemoteIndex(it->remoteIdx);
+            it->peer->SendSilKitMsg(std::move(bufferCopy));
+        }
+        buffer.SetRemoteIndex(lastReceiver->remoteIdx);
+        lastReceiver->peer->SendSilKitMsg(std::move(buffer));
     }
 
     // IServiceEndpoint
@@ -189,10 +256,45 @@ public:
         return _serviceDescriptor;
     }
 
+private:
+    // ----------------------------------------
+    // private methods
+    void SendFilteredMessage(const IServiceEndpoint* from, const MsgT& msg)
+    {
+        auto isAccepted = [&msg](const FilteredRemoteReceiver& remoteReceiver) {
+            return !remoteReceiver.filter || remoteReceiver.filter(msg);
+        };
+
+        // Serialize the message only if a remote receiver accepts it, and only once
+        auto receiver = std::find_if(_remoteReceivers.begin(), _remoteReceivers.end(), isAccepted);
+        if (receiver == _remoteReceivers.end())
+        {
+            return;
+        }
+
+        auto buffer = SerializedMessage(msg, to_endpointAddress(from->GetServiceDescriptor()), receiver->remoteIdx);
+        auto next = std::find_if(std::next(receiver), _remoteReceivers.end(), isAccepted);
+        if (next != _remoteReceivers.end())
+        {
+            buffer.SharePayload();
+        }
+        for (; next != _remoteReceivers.end(); next = std::find_if(std::next(next), _remoteReceivers.end(), isAccepted))
+        {
+            auto bufferCopy = buffer;
+            bufferCopy.SetRemoteIndex(receiver->remoteIdx);
+            receiver->peer->SendSilKitMsg(std::move(bufferCopy));
+            receiver = next;
+        }
+        buffer.SetRemoteIndex(receiver->remoteIdx);
+        receiver->peer->SendSilKitMsg(std::move(buffer));
+    }
+
 private:
     // ----------------------------------------
     // private members
-    std::vector<RemoteReceiver> _remoteReceivers;
+    std::vector<FilteredRemoteReceiver> _remoteReceivers;
+    //! Filters by participant name, including those of participants which are not remote receivers (yet)
+    std::unordered_map<std::string, Filter> _remoteReceiverFilters;
     ServiceDescriptor _serviceDescriptor;
 };
 
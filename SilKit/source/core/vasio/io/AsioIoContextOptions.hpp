@@ -0,0 +1,34 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <chrono>
+
+#include <cstddef>
+
+
+namespace VSilKit {
+
+
+struct AsioIoContextOptions
+{
+    //! Number of threads performing the socket I/O of the streams, including the thread calling Run. Handlers posted
+    //! to the io context, timers, acceptors, and connectors are always executed by the thread calling Run.
+    std::size_t ioWorkerThreads{1};
+    //! Capacity of the ring buffer of each direction of a shared memory connection.
+    std::size_t sharedMemoryRingCapacity{1024 * 1024};
+    //! Maximum duration of the handshake, which exchanges the names of the rings, of a shared memory connection.
+    std::chrono::milliseconds sharedMemoryHandshakeTimeout{5000};
+};
+
+
+} // namespace VSilKit
+
+
+namespace SilKit {
+namespace Core {
+using VSilKit::AsioIoContextOptions;
+} // namespace Core
+} // namespace SilKit
@@ -30,6 +30,9 @@ struct IIoContext
 
     virtual void Dispatch(std::function<void()> function) = 0;
 
+    //! True if the calling thread is currently running handlers of this io context
+    virtual auto IsRunningInThisThread() const -> bool = 0;
+
     virtual auto MakeTcpAcceptor(const std::string& address, uint16_t port) -> std::unique_ptr<IAcceptor> = 0;
 
     virtual auto MakeLocalAcceptor(const std::string& path) -> std::unique_ptr<IAcceptor> = 0;
@@ -38,6 +41,12 @@ struct IIoContext
 
     virtual auto MakeLocalConnector(const std::string& path) -> std::unique_ptr<IConnector> = 0;
 
+    //! Accepts connections on the local-domain socket at path, the data is transferred via shared memory.
+    virtual auto MakeSharedMemoryAcceptor(const std::string& path) -> std::unique_ptr<IAcceptor> = 0;
+
+    //! Connects to a shared memory acceptor with its local-domain socket at path.
+    virtual auto MakeSharedMemoryConnector(const std::string& path) -> std::unique_ptr<IConnector> = 0;
+
     virtual auto MakeTimer() -> std::unique_ptr<ITimer> = 0;
 
     virtual auto Resolve(const std::string& name) -> std::vector<std::string> = 0;
@@ -30,6 +30,13 @@ struct IRawByteStream
     virtual void AsyncWriteSome(ConstBufferSequence bufferSequence) = 0;
 
     virtual void Shutdown() = 0;
+
+    //! True if the read and write completions are executed by an I/O worker thread instead of the thread running the
+    //! io context which created the stream.
+    virtual auto CompletesOnIoWorkerThread() const -> bool
+    {
+        return false;
+    }
 };
 
 
@@ -10,9 +10,10 @@
 namespace VSilKit {
 
 
-auto MakeAsioIoContext(const AsioSocketOptions& socketOptions) -> std::unique_ptr<IIoContext>
+auto MakeAsioIoContext(const AsioSocketOptions& socketOptions, const AsioIoContextOptions& ioContextOptions)
+    -> std::unique_ptr<IIoContext>
 {
-    return std::make_unique<AsioIoContext>(socketOptions);
+    return std::make_unique<AsioIoContext>(socketOptions, ioContextOptions);
 }
 
 
@@ -6,6 +6,7 @@
 
 
 #include "IIoContext.hpp"
+#include "AsioIoContextOptions.hpp"
 #include "AsioSocketOptions.hpp"
 
 #include "LoggerMessage.hpp"
@@ -16,7 +17,8 @@
 namespace VSilKit {
 
 
-auto MakeAsioIoContext(const AsioSocketOptions& socketOptions) -> std::unique_ptr<IIoContext>;
+auto MakeAsioIoContext(const AsioSocketOptions& socketOptions, const AsioIoContextOptions& ioContextOptions = {})
+    -> std::unique_ptr<IIoContext>;
 
 
 } // namespace VSilKit
@@ -370,6 +370,9 @@ TEST_F(Test_IoContext_AcceptorConnector_PingPong, tcp)
     connector->AsyncConnect(0ms);
 
     ioContext->Run();
+
+    ASSERT_FALSE(accepted.stream->CompletesOnIoWorkerThread());
+    ASSERT_FALSE(connected.stream->CompletesOnIoWorkerThread());
 }
 
 TEST_F(Test_IoContext_AcceptorConnector_PingPong, tcp_connect_send_buffer_size)
@@ -398,6 +401,36 @@ TEST_F(Test_IoContext_AcceptorConnector_PingPong, tcp_connect_send_buffer_size)
     ioContext->Run();
 }
 
+TEST_F(Test_IoContext_AcceptorConnector_PingPong, tcp_io_worker_threads)
+{
+    SetupExpectations();
+
+    AsioIoContextOptions asioIoContextOptions{};
+    asioIoContextOptions.ioWorkerThreads = 3;
+
+    auto ioContext = VSilKit::MakeAsioIoContext({}, asioIoContextOptions);
+    ioContext->SetLogger(logger);
+
+    auto acceptor = ioContext->MakeTcpAcceptor("127.0.0.1", 0);
+    acceptor->SetListener(acceptorListener);
+    acceptor->AsyncAccept(5000ms);
+
+    auto endpoint = acceptor->GetLocalEndpoint();
+    auto uri = Uri::Parse(endpoint);
+
+    ASSERT_EQ(uri.Type(), Uri::UriType::Tcp);
+
+    auto connector = ioContext->MakeTcpConnector(uri.Host(), uri.Port());
+    connector->SetListener(connectorListener);
+    connector->AsyncConnect(0ms);
+
+    // returns only after the socket I/O performed by the worker threads is complete
+    ioContext->Run();
+
+    ASSERT_TRUE(accepted.stream->CompletesOnIoWorkerThread());
+    ASSERT_TRUE(connected.stream->CompletesOnIoWorkerThread());
+}
+
 TEST_F(Test_IoContext_AcceptorConnector_PingPong, local_domain)
 {
     SetupExpectations();
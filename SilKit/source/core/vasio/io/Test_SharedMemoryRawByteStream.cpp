@@ -0,0 +1,330 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "impl/SharedMemoryRawByteStream.hpp"
+
+#include "MockIoContext.hpp"
+#include "MockRawByteStream.hpp"
+#include "MockTimer.hpp"
+#include "MockLogger.hpp"
+
+#include <deque>
+#include <numeric>
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+namespace {
+
+using namespace SilKit::Core;
+
+using ::testing::_;
+using ::testing::InSequence;
+using ::testing::NiceMock;
+
+using SilKit::Services::Logging::MockLogger;
+using VSilKit::MockIoContextWithExecutionQueue;
+using VSilKit::MockRawByteStreamListener;
+using VSilKit::MockTimer;
+
+// One end of an in-memory stream pair, which completes all operations via the io context (like a local-domain socket)
+struct FakeLocalStream : IRawByteStream
+{
+    IIoContext* ioContext{nullptr};
+    FakeLocalStream* peer{nullptr};
+    IRawByteStreamListener* listener{nullptr};
+
+    std::deque<uint8_t> incoming;
+    bool reading{false};
+    std::vector<MutableBuffer> readBuffers;
+    bool shutdown{false};
+
+    void SetListener(IRawByteStreamListener& newListener) override
+    {
+        listener = &newListener;
+    }
+
+    auto GetLocalEndpoint() const -> std::string override
+    {
+        return "local:///tmp/test.silkit";
+    }
+
+    auto GetRemoteEndpoint() const -> std::string override
+    {
+        return "local://";
+    }
+
+    void AsyncReadSome(MutableBufferSequence bufferSequence) override
+    {
+        ASSERT_FALSE(reading);
+        reading = true;
+        readBuffers.assign(bufferSequence.begin(), bufferSequence.end());
+        ioContext->Post([this] { Deliver(); });
+    }
+
+    void AsyncWriteSome(ConstBufferSequence bufferSequence) override
+    {
+        size_t total{0};
+        for (const auto& buffer : bufferSequence)
+        {
+            const auto data{static_cast<const uint8_t*>(buffer.GetData())};
+            peer->incoming.insert(peer->incoming.end(), data, data + buffer.GetSize());
+            total += buffer.GetSize();
+        }
+
+        ioContext->Post([this, total] { listener->OnAsyncWriteSomeDone(*this, total); });
+        ioContext->Post([this] { peer->Deliver(); });
+    }
+
+    void Shutdown() override
+    {
+        if (shutdown)
+        {
+            return;
+        }
+
+        // both ends are closed, like a socket whose peer sees the end of the stream
+        shutdown = true;
+        reading = false;
+        ioContext->Post([this] { listener->OnShutdown(*this); });
+        peer->Shutdown();
+    }
+
+    void Deliver()
+    {
+        if (!reading || incoming.empty())
+        {
+            return;
+        }
+
+        size_t total{0};
+        for (auto& buffer : readBuffers)
+        {
+            while (buffer.GetSize() != 0 && !incoming.empty())
+            {
+                *static_cast<uint8_t*>(buffer.SliceOff(1).GetData()) = incoming.front();
+                incoming.pop_front();
+                ++total;
+            }
+        }
+
+        reading = false;
+        listener->OnAsyncReadSomeDone(*this, total);
+    }
+};
+
+auto MakeData(size_t size) -> std::vector<uint8_t>
+{
+    std::vector<uint8_t> data(size);
+    std::iota(data.begin(), data.end(), uint8_t{0});
+    return data;
+}
+
+class Test_SharedMemoryRawByteStream : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        if (!SharedMemoryRing::IsSupported())
+        {
+            GTEST_SKIP() << "shared memory is not supported on this platform";
+        }
+
+        ON_CALL(ioContext, MakeTimer()).WillByDefault([this] {
+            auto timer{std::make_unique<NiceMock<MockTimer>>()};
+            ON_CALL(*timer, SetListener(_)).WillByDefault([this](ITimerListener& listener) {
+                timerListeners.push_back(&listener);
+            });
+            return timer;
+        });
+
+        auto makeLocalStream = [this] {
+            auto stream{std::make_unique<FakeLocalStream>()};
+            stream->ioContext = &ioContext;
+            return stream;
+        };
+
+        auto localA{makeLocalStream()};
+        auto localB{makeLocalStream()};
+        localA->peer = localB.get();
+        localB->peer = localA.get();
+        localStreamA = localA.get();
+        localStreamB = localB.get();
+
+        SharedMemoryRawByteStreamOptions options;
+        options.ringCapacity = 4096;
+
+        streamA = std::make_unique<SharedMemoryRawByteStream>(options, ioContext, std::move(localA), logger);
+        streamB = std::make_unique<SharedMemoryRawByteStream>(options, ioContext, std::move(localB), logger);
+        streamA->SetListener(listenerA);
+        streamB->SetListener(listenerB);
+    }
+
+    void Handshake()
+    {
+        bool successA{false};
+        bool successB{false};
+        streamA->AsyncHandshake([&successA](bool success) { successA = success; });
+        streamB->AsyncHandshake([&successB](bool success) { successB = success; });
+        ioContext.Run();
+
+        ASSERT_TRUE(successA);
+        ASSERT_TRUE(successB);
+    }
+
+    NiceMock<MockLogger> logger;
+    NiceMock<MockIoContextWithExecutionQueue> ioContext;
+    std::vector<ITimerListener*> timerListeners;
+
+    FakeLocalStream* localStreamA{nullptr};
+    FakeLocalStream* localStreamB{nullptr};
+    std::unique_ptr<SharedMemoryRawByteStream> streamA;
+    std::unique_ptr<SharedMemoryRawByteStream> streamB;
+    MockRawByteStreamListener listenerA;
+    MockRawByteStreamListener listenerB;
+};
+
+TEST_F(Test_SharedMemoryRawByteStream, waiting_reader_receives_the_data_written_by_the_other_side)
+{
+    Handshake();
+
+    EXPECT_EQ(streamA->GetLocalEndpoint(), "shm:///tmp/test.silkit");
+
+    const auto data{MakeData(100)};
+    std::vector<uint8_t> received(1000);
+
+    EXPECT_CALL(listenerA, OnAsyncWriteSomeDone(_, data.size())).Times(1);
+    EXPECT_CALL(listenerB, OnAsyncReadSomeDone(_, data.size())).Times(1);
+
+    // the read waits for data, the write wakes it up via the local stream
+    MutableBuffer readBuffer{received.data(), received.size()};
+    streamB->AsyncReadSome(MutableBufferSequence{&readBuffer, 1});
+    ioContext.Run();
+
+    ConstBuffer writeBuffer{data.data(), data.size()};
+    streamA->AsyncWriteSome(ConstBufferSequence{&writeBuffer, 1});
+    ioContext.Run();
+
+    received.resize(data.size());
+    EXPECT_EQ(received, data);
+}
+
+TEST_F(Test_SharedMemoryRawByteStream, waiting_writer_continues_once_the_other_side_reads)
+{
+    Handshake();
+
+    const auto data{MakeData(5000)};
+    std::vector<uint8_t> received(5000);
+
+    {
+        InSequence sequence;
+        EXPECT_CALL(listenerA, OnAsyncWriteSomeDone(_, 4096)).WillOnce([&data, this] {
+            // the ring is full, the remaining bytes have to wait for the reader
+            ConstBuffer writeBuffer{data.data() + 4096, data.size() - 4096};
+            streamA->AsyncWriteSome(ConstBufferSequence{&writeBuffer, 1});
+        });
+        EXPECT_CALL(listenerA, OnAsyncWriteSomeDone(_, 5000 - 4096)).Times(1);
+    }
+
+    ConstBuffer writeBuffer{data.data(), data.size()};
+    streamA->AsyncWriteSome(ConstBufferSequence{&writeBuffer, 1});
+    ioContext.Run();
+
+    size_t receivedBytes{0};
+    EXPECT_CALL(listenerB, OnAsyncReadSomeDone(_, _)).WillRepeatedly([&](auto&, size_t bytesTransferred) {
+        receivedBytes += bytesTransferred;
+        if (receivedBytes < received.size())
+        {
+            MutableBuffer readBuffer{received.data() + receivedBytes, received.size() - receivedBytes};
+            streamB->AsyncReadSome(MutableBufferSequence{&readBuffer, 1});
+        }
+    });
+
+    MutableBuffer readBuffer{received.data(), received.size()};
+    streamB->AsyncReadSome(MutableBufferSequence{&readBuffer, 1});
+    ioContext.Run();
+
+    EXPECT_EQ(received, data);
+}
+
+TEST_F(Test_SharedMemoryRawByteStream, data_written_before_a_shutdown_is_received_before_the_shutdown)
+{
+    Handshake();
+
+    const auto data{MakeData(100)};
+    std::vector<uint8_t> received(60);
+
+    EXPECT_CALL(listenerA, OnAsyncWriteSomeDone(_, data.size())).Times(1);
+    EXPECT_CALL(listenerA, OnShutdown(_)).Times(1);
+
+    {
+        InSequence sequence;
+        EXPECT_CALL(listenerB, OnAsyncReadSomeDone(_, 60)).WillOnce([&received, this] {
+            MutableBuffer readBuffer{received.data(), received.size()};
+            streamB->AsyncReadSome(MutableBufferSequence{&readBuffer, 1});
+        });
+        EXPECT_CALL(listenerB, OnAsyncReadSomeDone(_, 40)).WillOnce([&received, this] {
+            MutableBuffer readBuffer{received.data(), received.size()};
+            streamB->AsyncReadSome(MutableBufferSequence{&readBuffer, 1});
+        });
+        EXPECT_CALL(listenerB, OnShutdown(_)).Times(1);
+    }
+
+    ConstBuffer writeBuffer{data.data(), data.size()};
+    streamA->AsyncWriteSome(ConstBufferSequence{&writeBuffer, 1});
+    streamA->Shutdown();
+    ioContext.Run();
+
+    MutableBuffer readBuffer{received.data(), received.size()};
+    streamB->AsyncReadSome(MutableBufferSequence{&readBuffer, 1});
+    ioContext.Run();
+}
+
+TEST_F(Test_SharedMemoryRawByteStream, handshake_fails_if_the_other_side_does_not_use_shared_memory)
+{
+    bool called{false};
+    bool successA{true};
+    streamA->AsyncHandshake([&](bool success) {
+        called = true;
+        successA = success;
+    });
+
+    // the other side starts a regular connection instead
+    const auto data{MakeData(64)};
+    ConstBuffer writeBuffer{data.data(), data.size()};
+    NiceMock<MockRawByteStreamListener> plainListener;
+    localStreamB->SetListener(plainListener);
+    localStreamB->AsyncWriteSome(ConstBufferSequence{&writeBuffer, 1});
+
+    ioContext.Run();
+
+    EXPECT_TRUE(called);
+    EXPECT_FALSE(successA);
+}
+
+TEST_F(Test_SharedMemoryRawByteStream, handshake_fails_if_it_does_not_complete_in_time)
+{
+    bool called{false};
+    bool successA{true};
+    streamA->AsyncHandshake([&](bool success) {
+        called = true;
+        successA = success;
+    });
+
+    // the other side never answers
+    NiceMock<MockRawByteStreamListener> plainListener;
+    localStreamB->SetListener(plainListener);
+    ioContext.Run();
+    ASSERT_FALSE(called);
+
+    ASSERT_EQ(timerListeners.size(), 1u);
+    MockTimer timer;
+    timerListeners.front()->OnTimerExpired(timer);
+    ioContext.Run();
+
+    EXPECT_TRUE(called);
+    EXPECT_FALSE(successA);
+}
+
+} // namespace
@@ -0,0 +1,190 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "impl/SharedMemoryRing.hpp"
+
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+
+using namespace SilKit::Core;
+
+auto WriteAll(SharedMemoryRing& ring, const std::vector<uint8_t>& data) -> size_t
+{
+    ConstBuffer buffer{data.data(), data.size()};
+    return ring.Write(ConstBufferSequence{&buffer, 1});
+}
+
+auto ReadSome(SharedMemoryRing& ring, size_t size) -> std::vector<uint8_t>
+{
+    std::vector<uint8_t> data(size);
+    MutableBuffer buffer{data.data(), data.size()};
+    data.resize(ring.Read(MutableBufferSequence{&buffer, 1}));
+    return data;
+}
+
+auto MakeData(size_t size, uint8_t first) -> std::vector<uint8_t>
+{
+    std::vector<uint8_t> data(size);
+    std::iota(data.begin(), data.end(), first);
+    return data;
+}
+
+class Test_SharedMemoryRing : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        if (!SharedMemoryRing::IsSupported())
+        {
+            GTEST_SKIP() << "shared memory is not supported on this platform";
+        }
+    }
+};
+
+TEST_F(Test_SharedMemoryRing, opened_ring_shares_the_data_of_the_created_ring)
+{
+    auto writer{SharedMemoryRing::Create(1)};
+    auto reader{SharedMemoryRing::Open(writer->GetName())};
+
+    // the capacity is rounded up to the minimum of one page
+    EXPECT_EQ(writer->Capacity(), 4096u);
+    EXPECT_EQ(reader->Capacity(), 4096u);
+
+    const auto data{MakeData(100, 0)};
+    ASSERT_EQ(WriteAll(*writer, data), data.size());
+    EXPECT_EQ(reader->Size(), data.size());
+    EXPECT_EQ(ReadSome(*reader, 1000), data);
+    EXPECT_EQ(reader->Size(), 0u);
+}
+
+TEST_F(Test_SharedMemoryRing, name_is_only_removed_by_the_creator)
+{
+    auto writer{SharedMemoryRing::Create(4096)};
+    const auto name{writer->GetName()};
+
+    // opening the ring (or an opened ring removing its name) must not affect the name
+    auto reader{SharedMemoryRing::Open(name)};
+    reader->Unlink();
+    reader.reset();
+    reader = SharedMemoryRing::Open(name);
+
+    writer->Unlink();
+    EXPECT_THROW(SharedMemoryRing::Open(name), SilKit::SilKitError);
+
+    // the memory stays shared after the name was removed
+    const auto data{MakeData(10, 0)};
+    ASSERT_EQ(WriteAll(*writer, data), data.size());
+    EXPECT_EQ(ReadSome(*reader, 100), data);
+}
+
+TEST_F(Test_SharedMemoryRing, created_rings_have_distinct_names)
+{
+    auto first{SharedMemoryRing::Create(4096)};
+    auto second{SharedMemoryRing::Create(4096)};
+
+    EXPECT_NE(first->GetName(), second->GetName());
+    // macOS limits the names of shared memory objects to 31 characters
+    EXPECT_LE(first->GetName().size(), 31u);
+}
+
+TEST_F(Test_SharedMemoryRing, write_is_truncated_at_capacity_and_wraps_around)
+{
+    auto writer{SharedMemoryRing::Create(4096)};
+    auto reader{SharedMemoryRing::Open(writer->GetName())};
+
+    ASSERT_EQ(WriteAll(*writer, MakeData(3000, 0)), 3000u);
+    ASSERT_EQ(ReadSome(*reader, 3000).size(), 3000u);
+
+    // the data wraps around the end of the ring, and only the free space is filled
+    const auto data{MakeData(5000, 7)};
+    ASSERT_EQ(WriteAll(*writer, data), 4096u);
+    EXPECT_EQ(WriteAll(*writer, data), 0u);
+
+    EXPECT_EQ(ReadSome(*reader, 5000), std::vector<uint8_t>(data.begin(), data.begin() + 4096));
+}
+
+TEST_F(Test_SharedMemoryRing, waiting_reader_is_taken_by_the_next_write)
+{
+    auto writer{SharedMemoryRing::Create(4096)};
+    auto reader{SharedMemoryRing::Open(writer->GetName())};
+
+    EXPECT_FALSE(writer->TakeWaitingReader());
+    ASSERT_TRUE(reader->PrepareReaderWait());
+
+    ASSERT_EQ(WriteAll(*writer, MakeData(1, 0)), 1u);
+    EXPECT_TRUE(writer->TakeWaitingReader());
+    EXPECT_FALSE(writer->TakeWaitingReader());
+
+    // data is available, so the reader does not wait
+    EXPECT_FALSE(reader->PrepareReaderWait());
+}
+
+TEST_F(Test_SharedMemoryRing, waiting_writer_is_taken_by_the_next_read)
+{
+    auto writer{SharedMemoryRing::Create(4096)};
+    auto reader{SharedMemoryRing::Open(writer->GetName())};
+
+    // space is available, so the writer does not wait
+    EXPECT_FALSE(writer->PrepareWriterWait());
+
+    ASSERT_EQ(WriteAll(*writer, MakeData(4096, 0)), 4096u);
+    ASSERT_TRUE(writer->PrepareWriterWait());
+
+    ASSERT_EQ(ReadSome(*reader, 1).size(), 1u);
+    EXPECT_TRUE(reader->TakeWaitingWriter());
+    EXPECT_FALSE(reader->TakeWaitingWriter());
+}
+
+TEST_F(Test_SharedMemoryRing, concurrent_writer_and_reader_keep_the_byte_order)
+{
+    constexpr size_t totalBytes{1024 * 1024};
+
+    auto writer{SharedMemoryRing::Create(4096)};
+    auto reader{SharedMemoryRing::Open(writer->GetName())};
+
+    std::thread writerThread{[&writer] {
+        std::vector<uint8_t> chunk(777);
+        for (size_t written = 0; written < totalBytes;)
+        {
+            for (size_t index = 0; index < chunk.size(); ++index)
+            {
+                chunk[index] = static_cast<uint8_t>((written + index) % 251);
+            }
+
+            ConstBuffer buffer{chunk.data(), (std::min)(chunk.size(), totalBytes - written)};
+            const auto count{writer->Write(ConstBufferSequence{&buffer, 1})};
+            if (count == 0)
+            {
+                std::this_thread::yield();
+            }
+            written += count;
+        }
+    }};
+
+    std::vector<uint8_t> chunk(1000);
+    for (size_t read = 0; read < totalBytes;)
+    {
+        MutableBuffer buffer{chunk.data(), chunk.size()};
+        const auto count{reader->Read(MutableBufferSequence{&buffer, 1})};
+        if (count == 0)
+        {
+            std::this_thread::yield();
+        }
+
+        for (size_t index = 0; index < count; ++index)
+        {
+            ASSERT_EQ(chunk[index], static_cast<uint8_t>((read + index) % 251));
+        }
+        read += count;
+    }
+
+    writerThread.join();
+}
+
+} // namespace
@@ -10,6 +10,7 @@
 #include "AsioCleanupEndpoint.hpp"
 #include "AsioGenericRawByteStream.hpp"
 #include "AsioFormatEndpoint.hpp"
+#include "AsioIoWorkerPool.hpp"
 #include "SetAsioSocketOptions.hpp"
 
 #include "AsioSocketOptions.hpp"
@@ -54,6 +55,7 @@ class AsioAcceptor final : public IAcceptor
     AsioSocketOptions _socketOptions;
 
     std::shared_ptr<asio::io_context> _asioIoContext;
+    std::shared_ptr<AsioIoWorkerPool> _ioWorkerPool;
 
     AsioAcceptorType _acceptor;
     asio::cancellation_signal _acceptCancelSignal;
@@ -67,7 +69,8 @@ class AsioAcceptor final : public IAcceptor
 
 public:
     AsioAcceptor(const AsioSocketOptions& socketOptions, std::shared_ptr<asio::io_context> asioIoContext,
-                 AsioAcceptorType acceptor, SilKit::Services::Logging::ILogger& logger);
+                 std::shared_ptr<AsioIoWorkerPool> ioWorkerPool, AsioAcceptorType acceptor,
+                 SilKit::Services::Logging::ILogger& logger);
     ~AsioAcceptor() override;
 
 public: // IAcceptor
@@ -84,9 +87,11 @@ private:
 
 template <typename T>
 AsioAcceptor<T>::AsioAcceptor(const AsioSocketOptions& socketOptions, std::shared_ptr<asio::io_context> asioIoContext,
-                              AsioAcceptorType acceptor, SilKit::Services::Logging::ILogger& logger)
+                              std::shared_ptr<AsioIoWorkerPool> ioWorkerPool, AsioAcceptorType acceptor,
+                              SilKit::Services::Logging::ILogger& logger)
     : _socketOptions{socketOptions}
     , _asioIoContext{std::move(asioIoContext)}
+    , _ioWorkerPool{std::move(ioWorkerPool)}
     , _acceptor{std::move(acceptor)}
     , _timeoutTimer{_acceptor.get_executor()}
     , _localEndpoint{_acceptor.local_endpoint()}
@@ -186,7 +191,10 @@ void AsioAcceptor<T>::OnAsioAsyncAcceptComplete(const asio::error_code& asioErro
     AsioGenericRawByteStreamOptions options{};
     options.tcp.quickAck = isTcp && _socketOptions.tcp.quickAck;
 
-    auto stream{std::make_unique<AsioGenericRawByteStream>(options, _asioIoContext, std::move(socket), *_logger)};
+    auto socketIoContext{_ioWorkerPool ? _ioWorkerPool->NextIoContext() : nullptr};
+
+    auto stream{std::make_unique<AsioGenericRawByteStream>(options, _asioIoContext, std::move(socketIoContext),
+                                                           std::move(socket), *_logger)};
 
     _timeoutCancelSignal.emit(asio::cancellation_type::total);
     _listener->OnAsyncAcceptSuccess(*this, std::move(stream));
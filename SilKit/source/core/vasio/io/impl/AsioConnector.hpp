@@ -10,6 +10,7 @@
 #include "AsioCleanupEndpoint.hpp"
 #include "AsioGenericRawByteStream.hpp"
 #include "AsioFormatEndpoint.hpp"
+#include "AsioIoWorkerPool.hpp"
 #include "SetAsioSocketOptions.hpp"
 
 #include "AsioSocketOptions.hpp"
@@ -55,6 +56,7 @@ class AsioConnector final : public IConnector
         std::atomic<AsioConnector*> _parent;
 
         std::weak_ptr<asio::io_context> _asioIoContext;
+        std::shared_ptr<AsioIoWorkerPool> _ioWorkerPool;
         AsioSocketOptions _asioSocketOptions;
         AsioEndpointType _remoteEndpoint;
 
@@ -86,6 +88,7 @@ class AsioConnector final : public IConnector
     };
 
     std::shared_ptr<asio::io_context> _asioIoContext;
+    std::shared_ptr<AsioIoWorkerPool> _ioWorkerPool;
     SilKit::Services::Logging::ILogger* _logger{nullptr};
 
     IConnectorListener* _listener{nullptr};
@@ -93,8 +96,9 @@ class AsioConnector final : public IConnector
     std::shared_ptr<Op> _op;
 
 public:
-    AsioConnector(std::shared_ptr<asio::io_context> asioIoContext, const AsioSocketOptions& socketOptions,
-                  const AsioEndpointType& remoteEndpoint, SilKit::Services::Logging::ILogger& logger);
+    AsioConnector(std::shared_ptr<asio::io_context> asioIoContext, std::shared_ptr<AsioIoWorkerPool> ioWorkerPool,
+                  const AsioSocketOptions& socketOptions, const AsioEndpointType& remoteEndpoint,
+                  SilKit::Services::Logging::ILogger& logger);
     ~AsioConnector() override;
 
 public: // IAcceptor
@@ -105,9 +109,11 @@ public: // IAcceptor
 
 
 template <typename T>
-AsioConnector<T>::AsioConnector(std::shared_ptr<asio::io_context> asioIoContext, const AsioSocketOptions& socketOptions,
+AsioConnector<T>::AsioConnector(std::shared_ptr<asio::io_context> asioIoContext,
+                                std::shared_ptr<AsioIoWorkerPool> ioWorkerPool, const AsioSocketOptions& socketOptions,
                                 const AsioEndpointType& remoteEndpoint, SilKit::Services::Logging::ILogger& logger)
     : _asioIoContext{std::move(asioIoContext)}
+    , _ioWorkerPool{std::move(ioWorkerPool)}
     , _logger{&logger}
     , _op{std::make_shared<Op>(*this, socketOptions, remoteEndpoint)}
 {
@@ -157,6 +163,7 @@ AsioConnector<T>::Op::Op(AsioConnector& connector, const AsioSocketOptions& asio
                          const AsioEndpointType& remoteEndpoint)
     : _parent{&connector}
     , _asioIoContext{connector._asioIoContext}
+    , _ioWorkerPool{connector._ioWorkerPool}
     , _asioSocketOptions{asioSocketOptions}
     , _remoteEndpoint{remoteEndpoint}
     , _socket{*connector._asioIoContext, _remoteEndpoint.protocol()}
@@ -287,8 +294,10 @@ void AsioConnector<T>::Op::OnAsioAsyncConnectComplete(const asio::error_code& as
     AsioGenericRawByteStreamOptions options{};
     options.tcp.quickAck = isTcp && _asioSocketOptions.tcp.quickAck;
 
-    auto stream{
-        std::make_unique<AsioGenericRawByteStream>(options, std::move(asioIoContext), std::move(socket), *_logger)};
+    auto socketIoContext{_ioWorkerPool ? _ioWorkerPool->NextIoContext() : nullptr};
+
+    auto stream{std::make_unique<AsioGenericRawByteStream>(options, std::move(asioIoContext),
+                                                           std::move(socketIoContext), std::move(socket), *_logger)};
 
     _timeoutCancelSignal.emit(asio::cancellation_type::total);
     HandleSuccess(std::move(stream));
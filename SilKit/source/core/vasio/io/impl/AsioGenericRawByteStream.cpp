@@ -48,6 +48,32 @@ auto IsErrorToTryAgain(const asio::error_code& ec) -> bool
            || ec == asio::error::try_again;
 }
 
+using AsioSocket = asio::generic::stream_protocol::socket;
+
+auto MoveSocketToIoContext(AsioSocket socket, asio::io_context* asioIoContext, Log::ILogger* logger) -> AsioSocket
+{
+    if (asioIoContext == nullptr || &socket.get_executor().context() == asioIoContext)
+    {
+        return socket;
+    }
+
+    asio::error_code errorCode;
+
+    const auto protocol{socket.local_endpoint(errorCode).protocol()};
+    if (!errorCode)
+    {
+        // releasing the native handle is not supported on all platforms (e.g., before Windows 8.1)
+        const auto nativeHandle{socket.release(errorCode)};
+        if (!errorCode)
+        {
+            return AsioSocket{*asioIoContext, protocol, nativeHandle};
+        }
+    }
+
+    Log::Debug(logger, "AsioGenericRawByteStream: keeping socket I/O on the calling thread: {}", errorCode.message());
+    return socket;
+}
+
 
 } // namespace
 
@@ -56,15 +82,19 @@ namespace VSilKit {
 
 
 AsioGenericRawByteStream::AsioGenericRawByteStream(const AsioGenericRawByteStreamOptions& options,
-                                                   std::shared_ptr<asio::io_context> asioIoContext, AsioSocket socket,
+                                                   std::shared_ptr<asio::io_context> asioIoContext,
+                                                   std::shared_ptr<asio::io_context> socketIoContext, AsioSocket socket,
                                                    SilKit::Services::Logging::ILogger& logger)
     : _options{options}
     , _asioIoContext{std::move(asioIoContext)}
-    , _socket{std::move(socket)}
+    , _socketIoContext{std::move(socketIoContext)}
+    , _socket{MoveSocketToIoContext(std::move(socket), _socketIoContext.get(), &logger)}
     , _logger{&logger}
 {
     SILKIT_TRACE_METHOD_(_logger, "(...)");
 
+    _socketOnIoWorker = &_socket.get_executor().context() != _asioIoContext.get();
+
     EnableQuickAck();
 }
 
@@ -97,6 +127,12 @@ auto AsioGenericRawByteStream::GetRemoteEndpoint() const -> std::string
 }
 
 
+auto AsioGenericRawByteStream::CompletesOnIoWorkerThread() const -> bool
+{
+    return _socketOnIoWorker;
+}
+
+
 void AsioGenericRawByteStream::AsyncReadSome(MutableBufferSequence bufferSequence)
 {
     SILKIT_TRACE_METHOD_(_logger, "(...)");
@@ -125,8 +161,9 @@ void AsioGenericRawByteStream::AsyncReadSome(MutableBufferSequence bufferSequenc
             return asio::mutable_buffer{buffer.GetData(), buffer.GetSize()};
         });
 
-        _socket.async_read_some(_readBufferSequence,
-                                [this](const auto& e, auto s) { OnAsioAsyncReadSomeComplete(e, s); });
+        _socket.async_read_some(_readBufferSequence, [this, workGuard = MakeWorkGuard()](const auto& e, auto s) {
+            OnAsioAsyncReadSomeComplete(e, s);
+        });
     }
 }
 
@@ -159,8 +196,9 @@ void AsioGenericRawByteStream::AsyncWriteSome(ConstBufferSequence bufferSequence
             return asio::const_buffer{buffer.GetData(), buffer.GetSize()};
         });
 
-        _socket.async_write_some(_writeBufferSequence,
-                                 [this](const auto& e, auto s) { OnAsioAsyncWriteSomeComplete(e, s); });
+        _socket.async_write_some(_writeBufferSequence, [this, workGuard = MakeWorkGuard()](const auto& e, auto s) {
+            OnAsioAsyncWriteSomeComplete(e, s);
+        });
     }
 }
 
@@ -205,14 +243,19 @@ void AsioGenericRawByteStream::OnAsioAsyncReadSomeComplete(asio::error_code cons
             // only re-trigger the read if no bytes were transferred, otherwise treat it as a 'normal' completion
 
             _reading = true;
-            _socket.async_read_some(_readBufferSequence,
-                                    [this](const auto& e, auto s) { OnAsioAsyncReadSomeComplete(e, s); });
+            _socket.async_read_some(_readBufferSequence, [this, workGuard = MakeWorkGuard()](const auto& e, auto s) {
+                OnAsioAsyncReadSomeComplete(e, s);
+            });
 
             return;
         }
+
+        ++_callingListener;
     }
 
     _listener->OnAsyncReadSomeDone(*this, bytesTransferred);
+
+    OnListenerCallbackDone();
 }
 
 
@@ -243,14 +286,33 @@ void AsioGenericRawByteStream::OnAsioAsyncWriteSomeComplete(asio::error_code con
             // only re-trigger the write if no bytes were transferred, otherwise treat it as a 'normal' completion
 
             _writing = true;
-            _socket.async_write_some(_writeBufferSequence,
-                                     [this](const auto& e, auto s) { OnAsioAsyncWriteSomeComplete(e, s); });
+            _socket.async_write_some(_writeBufferSequence, [this, workGuard = MakeWorkGuard()](const auto& e, auto s) {
+                OnAsioAsyncWriteSomeComplete(e, s);
+            });
 
             return;
         }
+
+        ++_callingListener;
     }
 
     _listener->OnAsyncWriteSomeDone(*this, bytesTransferred);
+
+    OnListenerCallbackDone();
+}
+
+
+void AsioGenericRawByteStream::OnListenerCallbackDone()
+{
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+
+    --_callingListener;
+
+    // a shutdown during the callback could not notify the listener yet
+    if (_shutdownPending)
+    {
+        HandleShutdownOrError();
+    }
 }
 
 
@@ -275,7 +337,8 @@ void AsioGenericRawByteStream::HandleShutdownOrError()
         }
     }
 
-    if (!_reading && !_writing)
+    // the listener must not be notified about the shutdown while a callback may still be executing
+    if (!_reading && !_writing && _callingListener == 0)
     {
         if (!_shutdownPosted)
         {
@@ -289,6 +352,14 @@ void AsioGenericRawByteStream::HandleShutdownOrError()
 }
 
 
+auto AsioGenericRawByteStream::MakeWorkGuard() -> AsioWorkGuard
+{
+    // keeps the io context executing the listener notifications running while the socket I/O is performed by another
+    // io context
+    return asio::make_work_guard(*_asioIoContext);
+}
+
+
 #if defined(__linux__)
 
 void AsioGenericRawByteStream::EnableQuickAck()
@@ -33,6 +33,7 @@ struct AsioGenericRawByteStreamOptions
 class AsioGenericRawByteStream final : public IRawByteStream
 {
     using AsioSocket = asio::generic::stream_protocol::socket;
+    using AsioWorkGuard = asio::executor_work_guard<asio::io_context::executor_type>;
 
     IRawByteStreamListener* _listener{nullptr};
 
@@ -41,20 +42,30 @@ class AsioGenericRawByteStream final : public IRawByteStream
     bool _shutdownPosted{false};
     bool _reading{false};
     bool _writing{false};
+    // number of listener callbacks (read / write completion) currently executing
+    int _callingListener{0};
 
     std::vector<asio::mutable_buffer> _readBufferSequence;
     std::vector<asio::const_buffer> _writeBufferSequence;
 
     AsioGenericRawByteStreamOptions _options;
 
+    // the io context which executes the shutdown notification of the listener
     std::shared_ptr<asio::io_context> _asioIoContext;
+    // the io context performing the socket I/O, if it differs from the one above
+    std::shared_ptr<asio::io_context> _socketIoContext;
     AsioSocket _socket;
+    // false if the socket stays on asioIoContext, e.g., because it could not be moved onto socketIoContext
+    bool _socketOnIoWorker{false};
 
     SilKit::Services::Logging::ILogger* _logger{nullptr};
 
 public:
+    //! If socketIoContext is not null, the socket is moved onto it, and the read and write completions are executed by
+    //! the thread running socketIoContext. The shutdown notification is always executed by asioIoContext.
     AsioGenericRawByteStream(const AsioGenericRawByteStreamOptions& options,
-                             std::shared_ptr<asio::io_context> asioIoContext, AsioSocket socket,
+                             std::shared_ptr<asio::io_context> asioIoContext,
+                             std::shared_ptr<asio::io_context> socketIoContext, AsioSocket socket,
                              SilKit::Services::Logging::ILogger& logger);
     ~AsioGenericRawByteStream() override;
 
@@ -65,13 +76,17 @@ public: // IRawByteStream
     void AsyncReadSome(MutableBufferSequence bufferSequence) override;
     void AsyncWriteSome(ConstBufferSequence bufferSequence) override;
     void Shutdown() override;
+    auto CompletesOnIoWorkerThread() const -> bool override;
 
 private:
     void OnAsioAsyncReadSomeComplete(const asio::error_code& errorCode, size_t bytesTransferred);
     void OnAsioAsyncWriteSomeComplete(const asio::error_code& errorCode, size_t bytesTransferred);
 
+    void OnListenerCallbackDone();
     void HandleShutdownOrError();
 
+    auto MakeWorkGuard() -> AsioWorkGuard;
+
 private:
     void EnableQuickAck();
 };
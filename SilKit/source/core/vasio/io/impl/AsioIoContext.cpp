@@ -8,6 +8,9 @@
 #include "AsioConnector.hpp"
 #include "AsioTimer.hpp"
 #include "SetAsioSocketOptions.hpp"
+#include "SharedMemoryAcceptor.hpp"
+#include "SharedMemoryConnector.hpp"
+#include "SharedMemoryRing.hpp"
 
 #include "util/Exceptions.hpp"
 #include "util/TracingMacros.hpp"
@@ -132,10 +135,17 @@ void SetListenOptions(SilKit::Services::Logging::ILogger*, asio::ip::tcp::accept
 } // namespace
 
 
-AsioIoContext::AsioIoContext(const AsioSocketOptions& socketOptions)
+AsioIoContext::AsioIoContext(const AsioSocketOptions& socketOptions, const AsioIoContextOptions& ioContextOptions)
     : _socketOptions{socketOptions}
     , _asioIoContext{std::make_shared<asio::io_context>()}
 {
+    _sharedMemoryOptions.ringCapacity = ioContextOptions.sharedMemoryRingCapacity;
+    _sharedMemoryOptions.handshakeTimeout = ioContextOptions.sharedMemoryHandshakeTimeout;
+
+    if (ioContextOptions.ioWorkerThreads > 1)
+    {
+        _ioWorkerPool = std::make_shared<AsioIoWorkerPool>(ioContextOptions.ioWorkerThreads - 1);
+    }
 }
 
 
@@ -157,7 +167,14 @@ void AsioIoContext::Run()
         _asioIoContext->restart();
     }
 
-    _asioIoContext->run();
+    if (_ioWorkerPool)
+    {
+        _ioWorkerPool->RunWhile([this] { _asioIoContext->run(); });
+    }
+    else
+    {
+        _asioIoContext->run();
+    }
 }
 
 
@@ -175,6 +192,12 @@ void AsioIoContext::Dispatch(std::function<void()> function)
 }
 
 
+auto AsioIoContext::IsRunningInThisThread() const -> bool
+{
+    return _asioIoContext->get_executor().running_in_this_thread();
+}
+
+
 static auto IsIpV4(const std::string& string) -> bool
 {
     static std::regex regex{R"(^[0-9]+[.][0-9]+[.][0-9]+[.][0-9]+$)", std::regex::optimize};
@@ -223,8 +246,8 @@ auto AsioIoContext::MakeTcpAcceptor(const std::string& ipAddress, uint16_t port)
 
     OpenAcceptor(acceptor, endpoint, *_logger);
 
-    return std::make_unique<AsioAcceptor<decltype(acceptor)>>(_socketOptions, _asioIoContext, std::move(acceptor),
-                                                              *_logger);
+    return std::make_unique<AsioAcceptor<decltype(acceptor)>>(_socketOptions, _asioIoContext, _ioWorkerPool,
+                                                              std::move(acceptor), *_logger);
 }
 
 
@@ -232,13 +255,7 @@ auto AsioIoContext::MakeLocalAcceptor(const std::string& path) -> std::unique_pt
 {
     SILKIT_TRACE_METHOD_(_logger, "({})", path);
 
-    asio::local::stream_protocol::endpoint endpoint{path};
-    asio::local::stream_protocol::acceptor acceptor{_asioIoContext->get_executor()};
-
-    OpenAcceptor(acceptor, endpoint, *_logger);
-
-    return std::make_unique<AsioAcceptor<decltype(acceptor)>>(_socketOptions, _asioIoContext, std::move(acceptor),
-                                                              *_logger);
+    return MakeLocalAcceptor(path, _ioWorkerPool);
 }
 
 
@@ -252,7 +269,7 @@ auto AsioIoContext::MakeTcpConnector(const std::string& ipAddress, uint16_t port
     auto address = CleanIpAddress(ipAddress);
     AsioProtocolType::endpoint endpoint{asio::ip::make_address(address), port};
 
-    return std::make_unique<ConnectorType>(_asioIoContext, _socketOptions, endpoint, *_logger);
+    return std::make_unique<ConnectorType>(_asioIoContext, _ioWorkerPool, _socketOptions, endpoint, *_logger);
 }
 
 
@@ -260,12 +277,62 @@ auto AsioIoContext::MakeLocalConnector(const std::string& path) -> std::unique_p
 {
     SILKIT_TRACE_METHOD_(_logger, "({})", path);
 
+    return MakeLocalConnector(path, _ioWorkerPool);
+}
+
+
+auto AsioIoContext::MakeSharedMemoryAcceptor(const std::string& path) -> std::unique_ptr<IAcceptor>
+{
+    SILKIT_TRACE_METHOD_(_logger, "({})", path);
+
+    if (!SharedMemoryRing::IsSupported())
+    {
+        throw SilKit::SilKitError{"Shared memory connections are not supported on this platform"};
+    }
+
+    // the local domain socket only carries the handshake and the notifications, its I/O stays on this io context
+    return std::make_unique<SharedMemoryAcceptor>(_sharedMemoryOptions, *this, MakeLocalAcceptor(path, nullptr),
+                                                  *_logger);
+}
+
+
+auto AsioIoContext::MakeSharedMemoryConnector(const std::string& path) -> std::unique_ptr<IConnector>
+{
+    SILKIT_TRACE_METHOD_(_logger, "({})", path);
+
+    if (!SharedMemoryRing::IsSupported())
+    {
+        throw SilKit::SilKitError{"Shared memory connections are not supported on this platform"};
+    }
+
+    // the local domain socket only carries the handshake and the notifications, its I/O stays on this io context
+    return std::make_unique<SharedMemoryConnector>(_sharedMemoryOptions, *this, MakeLocalConnector(path, nullptr),
+                                                   *_logger);
+}
+
+
+auto AsioIoContext::MakeLocalAcceptor(const std::string& path, std::shared_ptr<AsioIoWorkerPool> ioWorkerPool)
+    -> std::unique_ptr<IAcceptor>
+{
+    asio::local::stream_protocol::endpoint endpoint{path};
+    asio::local::stream_protocol::acceptor acceptor{_asioIoContext->get_executor()};
+
+    OpenAcceptor(acceptor, endpoint, *_logger);
+
+    return std::make_unique<AsioAcceptor<decltype(acceptor)>>(_socketOptions, _asioIoContext, std::move(ioWorkerPool),
+                                                              std::move(acceptor), *_logger);
+}
+
+
+auto AsioIoContext::MakeLocalConnector(const std::string& path, std::shared_ptr<AsioIoWorkerPool> ioWorkerPool)
+    -> std::unique_ptr<IConnector>
+{
     using AsioProtocolType = asio::local::stream_protocol;
     using ConnectorType = AsioConnector<AsioProtocolType>;
 
     AsioProtocolType::endpoint endpoint{path};
 
-    return std::make_unique<ConnectorType>(_asioIoContext, _socketOptions, endpoint, *_logger);
+    return std::make_unique<ConnectorType>(_asioIoContext, std::move(ioWorkerPool), _socketOptions, endpoint, *_logger);
 }
 
 
@@ -303,6 +370,11 @@ void AsioIoContext::SetLogger(SilKit::Services::Logging::ILogger& logger)
 {
     SILKIT_TRACE_METHOD_(&logger, "({})", static_cast<const void*>(&logger));
     _logger = &logger;
+
+    if (_ioWorkerPool)
+    {
+        _ioWorkerPool->SetLogger(logger);
+    }
 }
 
 
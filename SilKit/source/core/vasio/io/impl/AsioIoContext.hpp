@@ -7,7 +7,9 @@
 
 #include "IIoContext.hpp"
 
+#include "AsioIoWorkerPool.hpp"
 #include "MakeAsioIoContext.hpp"
+#include "SharedMemoryRawByteStream.hpp"
 
 #include "LoggerMessage.hpp"
 
@@ -27,24 +29,37 @@ namespace VSilKit {
 class AsioIoContext final : public IIoContext
 {
     AsioSocketOptions _socketOptions;
+    SharedMemoryRawByteStreamOptions _sharedMemoryOptions;
     std::shared_ptr<asio::io_context> _asioIoContext;
+    // only present if additional I/O worker threads are configured
+    std::shared_ptr<AsioIoWorkerPool> _ioWorkerPool;
     SilKit::Services::Logging::ILogger* _logger{nullptr};
 
 public:
-    explicit AsioIoContext(const AsioSocketOptions& socketOptions);
+    explicit AsioIoContext(const AsioSocketOptions& socketOptions, const AsioIoContextOptions& ioContextOptions = {});
     ~AsioIoContext() override;
 
 public: // IIoContext
     void Run() override;
     void Post(std::function<void()> function) override;
     void Dispatch(std::function<void()> function) override;
+    auto IsRunningInThisThread() const -> bool override;
     auto MakeTcpAcceptor(const std::string& address, uint16_t port) -> std::unique_ptr<IAcceptor> override;
     auto MakeLocalAcceptor(const std::string& path) -> std::unique_ptr<IAcceptor> override;
     auto MakeTcpConnector(const std::string& address, uint16_t port) -> std::unique_ptr<IConnector> override;
     auto MakeLocalConnector(const std::string& path) -> std::unique_ptr<IConnector> override;
+    auto MakeSharedMemoryAcceptor(const std::string& path) -> std::unique_ptr<IAcceptor> override;
+    auto MakeSharedMemoryConnector(const std::string& path) -> std::unique_ptr<IConnector> override;
     auto MakeTimer() -> std::unique_ptr<ITimer> override;
     auto Resolve(const std::string& name) -> std::vector<std::string> override;
     void SetLogger(SilKit::Services::Logging::ILogger& logger) override;
+
+private:
+    // the sockets of the streams are moved onto the I/O worker pool, if it is not null
+    auto MakeLocalAcceptor(const std::string& path, std::shared_ptr<AsioIoWorkerPool> ioWorkerPool)
+        -> std::unique_ptr<IAcceptor>;
+    auto MakeLocalConnector(const std::string& path, std::shared_ptr<AsioIoWorkerPool> ioWorkerPool)
+        -> std::unique_ptr<IConnector>;
 };
 
 
@@ -0,0 +1,107 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "AsioIoWorkerPool.hpp"
+
+#include "SetThreadName.hpp"
+
+#include <string>
+#include <thread>
+
+
+namespace VSilKit {
+
+
+AsioIoWorkerPool::AsioIoWorkerPool(std::size_t numberOfWorkers)
+{
+    for (std::size_t index = 0; index != numberOfWorkers; ++index)
+    {
+        _asioIoContexts.emplace_back(std::make_shared<asio::io_context>());
+    }
+}
+
+
+void AsioIoWorkerPool::RunWhile(const std::function<void()>& function)
+{
+    using WorkGuard = asio::executor_work_guard<asio::io_context::executor_type>;
+
+    std::vector<WorkGuard> workGuards;
+    std::vector<std::thread> threads;
+
+    for (const auto& asioIoContext : _asioIoContexts)
+    {
+        if (asioIoContext->stopped())
+        {
+            asioIoContext->restart();
+        }
+
+        // keep the worker running, even if none of its streams has a pending operation at the moment
+        workGuards.emplace_back(asioIoContext->get_executor());
+        threads.emplace_back([this, asioIoContext] { RunWorker(*asioIoContext); });
+    }
+
+    const auto stopWorkers = [this, &workGuards, &threads] {
+        for (auto& workGuard : workGuards)
+        {
+            workGuard.reset();
+        }
+
+        for (const auto& asioIoContext : _asioIoContexts)
+        {
+            asioIoContext->stop();
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+    };
+
+    try
+    {
+        function();
+    }
+    catch (...)
+    {
+        stopWorkers();
+        throw;
+    }
+
+    stopWorkers();
+}
+
+
+auto AsioIoWorkerPool::NextIoContext() -> std::shared_ptr<asio::io_context>
+{
+    const auto index{_nextIndex++ % _asioIoContexts.size()};
+    return _asioIoContexts[index];
+}
+
+
+void AsioIoWorkerPool::SetLogger(SilKit::Services::Logging::ILogger& logger)
+{
+    _logger = &logger;
+}
+
+
+void AsioIoWorkerPool::RunWorker(asio::io_context& asioIoContext)
+{
+    SilKit::Util::SetThreadName("SilKit-IOWorker");
+
+    while (true)
+    {
+        try
+        {
+            asioIoContext.run();
+            return;
+        }
+        catch (const std::exception& error)
+        {
+            SilKit::Services::Logging::Error(_logger, "AsioIoWorkerPool: Something went wrong: {}", error.what());
+        }
+    }
+}
+
+
+} // namespace VSilKit
@@ -0,0 +1,46 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "LoggerMessage.hpp"
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "asio.hpp"
+
+
+namespace VSilKit {
+
+
+//! Additional asio::io_context instances, each executed by a dedicated thread, which perform the socket I/O of streams
+//! on behalf of an AsioIoContext. The threads only exist while the AsioIoContext is running.
+class AsioIoWorkerPool
+{
+    std::vector<std::shared_ptr<asio::io_context>> _asioIoContexts;
+    std::atomic<std::size_t> _nextIndex{0};
+
+    SilKit::Services::Logging::ILogger* _logger{nullptr};
+
+public:
+    explicit AsioIoWorkerPool(std::size_t numberOfWorkers);
+
+    //! Executes the workers until the function returns (or throws). Handlers which have not been executed by then, are
+    //! kept until the next call.
+    void RunWhile(const std::function<void()>& function);
+
+    //! Returns the io context of the next worker (round robin).
+    auto NextIoContext() -> std::shared_ptr<asio::io_context>;
+
+    void SetLogger(SilKit::Services::Logging::ILogger& logger);
+
+private:
+    void RunWorker(asio::io_context& asioIoContext);
+};
+
+
+} // namespace VSilKit
@@ -0,0 +1,141 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "SharedMemoryAcceptor.hpp"
+
+#include <algorithm>
+
+
+namespace VSilKit {
+
+
+SharedMemoryAcceptor::SharedMemoryAcceptor(const SharedMemoryRawByteStreamOptions& options, IIoContext& ioContext,
+                                           std::unique_ptr<IAcceptor> acceptor,
+                                           SilKit::Services::Logging::ILogger& logger)
+    : _options{options}
+    , _ioContext{&ioContext}
+    , _acceptor{std::move(acceptor)}
+    , _logger{&logger}
+{
+    _acceptor->SetListener(*this);
+}
+
+
+SharedMemoryAcceptor::~SharedMemoryAcceptor() = default;
+
+
+void SharedMemoryAcceptor::SetListener(IAcceptorListener& listener)
+{
+    _listener = &listener;
+}
+
+
+auto SharedMemoryAcceptor::GetLocalEndpoint() const -> std::string
+{
+    return MakeSharedMemoryEndpoint(_acceptor->GetLocalEndpoint());
+}
+
+
+void SharedMemoryAcceptor::AsyncAccept(std::chrono::milliseconds timeout)
+{
+    _timeout = timeout;
+    _acceptRequested = true;
+
+    if (!_establishedStreams.empty())
+    {
+        auto stream{std::move(_establishedStreams.front())};
+        _establishedStreams.pop_front();
+
+        _acceptRequested = false;
+        _listener->OnAsyncAcceptSuccess(*this, std::move(stream));
+        return;
+    }
+
+    StartAccept();
+}
+
+
+void SharedMemoryAcceptor::Shutdown()
+{
+    _shutdown = true;
+
+    _acceptor->Shutdown();
+
+    // the handshake handlers are called with false and remove the streams
+    for (const auto& stream : _handshakingStreams)
+    {
+        stream->Shutdown();
+    }
+
+    _establishedStreams.clear();
+}
+
+
+void SharedMemoryAcceptor::OnAsyncAcceptSuccess(IAcceptor&, std::unique_ptr<IRawByteStream> stream)
+{
+    _accepting = false;
+
+    auto handshakingStream{
+        std::make_unique<SharedMemoryRawByteStream>(_options, *_ioContext, std::move(stream), *_logger)};
+    auto* handshakingStreamPtr{handshakingStream.get()};
+    _handshakingStreams.emplace_back(std::move(handshakingStream));
+
+    handshakingStreamPtr->AsyncHandshake(
+        [this, handshakingStreamPtr](bool success) { OnHandshakeDone(handshakingStreamPtr, success); });
+
+    StartAccept();
+}
+
+
+void SharedMemoryAcceptor::OnAsyncAcceptFailure(IAcceptor&)
+{
+    _accepting = false;
+    _acceptRequested = false;
+
+    _listener->OnAsyncAcceptFailure(*this);
+}
+
+
+void SharedMemoryAcceptor::StartAccept()
+{
+    if (_accepting || !_acceptRequested || _shutdown)
+    {
+        return;
+    }
+
+    _accepting = true;
+    _acceptor->AsyncAccept(_timeout);
+}
+
+
+void SharedMemoryAcceptor::OnHandshakeDone(SharedMemoryRawByteStream* streamPtr, bool success)
+{
+    auto it{std::find_if(_handshakingStreams.begin(), _handshakingStreams.end(),
+                         [streamPtr](const auto& handshakingStream) { return handshakingStream.get() == streamPtr; })};
+    if (it == _handshakingStreams.end())
+    {
+        return;
+    }
+
+    auto stream{std::move(*it)};
+    _handshakingStreams.erase(it);
+
+    if (!success || _shutdown)
+    {
+        SilKit::Services::Logging::Debug(_logger, "SharedMemoryAcceptor: dropping connection after failed handshake");
+        return;
+    }
+
+    if (!_acceptRequested)
+    {
+        _establishedStreams.emplace_back(std::move(stream));
+        return;
+    }
+
+    _acceptRequested = false;
+    _listener->OnAsyncAcceptSuccess(*this, std::move(stream));
+}
+
+
+} // namespace VSilKit
@@ -0,0 +1,75 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+
+#include "IAcceptor.hpp"
+#include "IIoContext.hpp"
+
+#include "SharedMemoryRawByteStream.hpp"
+
+#include "LoggerMessage.hpp"
+
+#include <chrono>
+#include <deque>
+#include <memory>
+#include <vector>
+
+
+namespace VSilKit {
+
+
+//! Accepts connections on a local-domain acceptor and hands them out as shared memory streams, once their handshake
+//! completed. The handshakes run concurrently, the acceptor continues accepting while a requested connection is still
+//! handshaking, such that a stalled connection does not hold up the others. Connections whose handshake fails are
+//! dropped.
+class SharedMemoryAcceptor final
+    : public IAcceptor
+    , private IAcceptorListener
+{
+    SharedMemoryRawByteStreamOptions _options;
+    IIoContext* _ioContext{nullptr};
+    std::unique_ptr<IAcceptor> _acceptor;
+    SilKit::Services::Logging::ILogger* _logger{nullptr};
+
+    IAcceptorListener* _listener{nullptr};
+
+    std::chrono::milliseconds _timeout{};
+    bool _acceptRequested{false};
+    bool _accepting{false};
+    std::vector<std::unique_ptr<SharedMemoryRawByteStream>> _handshakingStreams;
+    // streams whose handshake completed while no connection was requested by the listener
+    std::deque<std::unique_ptr<SharedMemoryRawByteStream>> _establishedStreams;
+    bool _shutdown{false};
+
+public:
+    SharedMemoryAcceptor(const SharedMemoryRawByteStreamOptions& options, IIoContext& ioContext,
+                         std::unique_ptr<IAcceptor> acceptor, SilKit::Services::Logging::ILogger& logger);
+    ~SharedMemoryAcceptor() override;
+
+public: // IAcceptor
+    void SetListener(IAcceptorListener& listener) override;
+    auto GetLocalEndpoint() const -> std::string override;
+    void AsyncAccept(std::chrono::milliseconds timeout) override;
+    void Shutdown() override;
+
+private: // IAcceptorListener (of the local-domain acceptor)
+    void OnAsyncAcceptSuccess(IAcceptor& acceptor, std::unique_ptr<IRawByteStream> stream) override;
+    void OnAsyncAcceptFailure(IAcceptor& acceptor) override;
+
+private:
+    void StartAccept();
+    void OnHandshakeDone(SharedMemoryRawByteStream* stream, bool success);
+};
+
+
+} // namespace VSilKit
+
+
+namespace SilKit {
+namespace Core {
+using VSilKit::SharedMemoryAcceptor;
+} // namespace Core
+} // namespace SilKit
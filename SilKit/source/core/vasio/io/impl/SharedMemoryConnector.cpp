@@ -0,0 +1,81 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "SharedMemoryConnector.hpp"
+
+
+namespace VSilKit {
+
+
+SharedMemoryConnector::SharedMemoryConnector(const SharedMemoryRawByteStreamOptions& options, IIoContext& ioContext,
+                                             std::unique_ptr<IConnector> connector,
+                                             SilKit::Services::Logging::ILogger& logger)
+    : _options{options}
+    , _ioContext{&ioContext}
+    , _connector{std::move(connector)}
+    , _logger{&logger}
+{
+    _connector->SetListener(*this);
+}
+
+
+SharedMemoryConnector::~SharedMemoryConnector() = default;
+
+
+void SharedMemoryConnector::SetListener(IConnectorListener& listener)
+{
+    _listener = &listener;
+}
+
+
+void SharedMemoryConnector::AsyncConnect(std::chrono::milliseconds timeout)
+{
+    _connector->AsyncConnect(timeout);
+}
+
+
+void SharedMemoryConnector::Shutdown()
+{
+    _connector->Shutdown();
+
+    if (_handshakingStream)
+    {
+        _handshakingStream->Shutdown();
+    }
+}
+
+
+void SharedMemoryConnector::OnAsyncConnectSuccess(IConnector&, std::unique_ptr<IRawByteStream> stream)
+{
+    _handshakingStream =
+        std::make_unique<SharedMemoryRawByteStream>(_options, *_ioContext, std::move(stream), *_logger);
+    _handshakingStream->AsyncHandshake([this](bool success) { OnHandshakeDone(success); });
+}
+
+
+void SharedMemoryConnector::OnAsyncConnectFailure(IConnector&)
+{
+    _listener->OnAsyncConnectFailure(*this);
+}
+
+
+void SharedMemoryConnector::OnHandshakeDone(bool success)
+{
+    auto stream{std::move(_handshakingStream)};
+
+    if (success)
+    {
+        _listener->OnAsyncConnectSuccess(*this, std::move(stream));
+        return;
+    }
+
+    SilKit::Services::Logging::Debug(_logger, "SharedMemoryConnector: shared memory handshake failed");
+    stream.reset();
+
+    // the listener may destroy this connector
+    _listener->OnAsyncConnectFailure(*this);
+}
+
+
+} // namespace VSilKit
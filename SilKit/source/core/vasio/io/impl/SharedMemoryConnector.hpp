@@ -0,0 +1,63 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+
+#include "IConnector.hpp"
+#include "IIoContext.hpp"
+
+#include "SharedMemoryRawByteStream.hpp"
+
+#include "LoggerMessage.hpp"
+
+#include <chrono>
+#include <memory>
+
+
+namespace VSilKit {
+
+
+//! Connects via a local-domain connector and hands out the connection as a shared memory stream, once its handshake
+//! completed. A failed handshake is reported as a failed connection attempt.
+class SharedMemoryConnector final
+    : public IConnector
+    , private IConnectorListener
+{
+    SharedMemoryRawByteStreamOptions _options;
+    IIoContext* _ioContext{nullptr};
+    std::unique_ptr<IConnector> _connector;
+    SilKit::Services::Logging::ILogger* _logger{nullptr};
+
+    IConnectorListener* _listener{nullptr};
+
+    std::unique_ptr<SharedMemoryRawByteStream> _handshakingStream;
+
+public:
+    SharedMemoryConnector(const SharedMemoryRawByteStreamOptions& options, IIoContext& ioContext,
+                          std::unique_ptr<IConnector> connector, SilKit::Services::Logging::ILogger& logger);
+    ~SharedMemoryConnector() override;
+
+public: // IConnector
+    void SetListener(IConnectorListener& listener) override;
+    void AsyncConnect(std::chrono::milliseconds timeout) override;
+    void Shutdown() override;
+
+private: // IConnectorListener (of the local-domain connector)
+    void OnAsyncConnectSuccess(IConnector& connector, std::unique_ptr<IRawByteStream> stream) override;
+    void OnAsyncConnectFailure(IConnector& connector) override;
+
+private:
+    void OnHandshakeDone(bool success);
+};
+
+
+} // namespace VSilKit
+
+
+namespace SilKit {
+namespace Core {
+using VSilKit::SharedMemoryConnector;
+} // namespace Core
+} // namespace SilKit
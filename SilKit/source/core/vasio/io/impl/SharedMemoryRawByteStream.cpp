@@ -0,0 +1,568 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "SharedMemoryRawByteStream.hpp"
+
+#include "util/Exceptions.hpp"
+#include "util/TracingMacros.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+
+#if SILKIT_ENABLE_TRACING_INSTRUMENTATION_SharedMemoryRawByteStream
+#define SILKIT_TRACE_METHOD_(logger, ...) SILKIT_TRACE_METHOD(logger, __VA_ARGS__)
+#else
+#define SILKIT_TRACE_METHOD_(...)
+#endif
+
+
+namespace {
+
+
+namespace Log = SilKit::Services::Logging;
+
+constexpr char HELLO_MAGIC[8] = {'S', 'I', 'L', 'K', 'S', 'H', 'M', '1'};
+
+// the value is irrelevant, every byte tells the receiver to look at the rings again
+const std::uint8_t NOTIFICATION{0x01};
+// sent once during the handshake, after the ring of the other side was opened
+const std::uint8_t OPENED{0x4f};
+
+
+} // namespace
+
+
+namespace VSilKit {
+
+
+auto MakeSharedMemoryEndpoint(const std::string& localEndpoint) -> std::string
+{
+    static const std::string localScheme{"local://"};
+
+    if (localEndpoint.compare(0, localScheme.size(), localScheme) == 0)
+    {
+        return "shm://" + localEndpoint.substr(localScheme.size());
+    }
+
+    return localEndpoint;
+}
+
+
+SharedMemoryRawByteStream::SharedMemoryRawByteStream(const SharedMemoryRawByteStreamOptions& options,
+                                                     IIoContext& ioContext, std::unique_ptr<IRawByteStream> stream,
+                                                     SilKit::Services::Logging::ILogger& logger)
+    : _options{options}
+    , _ioContext{&ioContext}
+    , _stream{std::move(stream)}
+    , _logger{&logger}
+{
+    SILKIT_TRACE_METHOD_(_logger, "(...)");
+
+    _stream->SetListener(*this);
+}
+
+
+SharedMemoryRawByteStream::~SharedMemoryRawByteStream()
+{
+    SILKIT_TRACE_METHOD_(_logger, "()");
+}
+
+
+void SharedMemoryRawByteStream::AsyncHandshake(std::function<void(bool)> handler)
+{
+    SILKIT_TRACE_METHOD_(_logger, "(...)");
+
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+
+    _handshakeHandler = std::move(handler);
+
+    try
+    {
+        _sendRing = SharedMemoryRing::Create(_options.ringCapacity);
+    }
+    catch (const std::exception& exception)
+    {
+        Log::Warn(_logger, "SharedMemoryRawByteStream: unable to create the shared memory: {}", exception.what());
+        _stream->Shutdown();
+        return;
+    }
+
+    _handshakeTimer = _ioContext->MakeTimer();
+    _handshakeTimer->SetListener(*this);
+    _handshakeTimer->AsyncWaitFor(_options.handshakeTimeout);
+
+    const auto& name{_sendRing->GetName()};
+    std::memcpy(_helloOut.data(), HELLO_MAGIC, sizeof(HELLO_MAGIC));
+    std::memcpy(_helloOut.data() + sizeof(HELLO_MAGIC), name.data(),
+                (std::min)(name.size(), HELLO_SIZE - sizeof(HELLO_MAGIC) - 1));
+
+    _streamWriting = true;
+    ConstBuffer writeBuffer{_helloOut.data(), _helloOut.size()};
+    _stream->AsyncWriteSome(ConstBufferSequence{&writeBuffer, 1});
+
+    _streamReading = true;
+    MutableBuffer readBuffer{_helloIn.data(), _helloIn.size()};
+    _stream->AsyncReadSome(MutableBufferSequence{&readBuffer, 1});
+}
+
+
+void SharedMemoryRawByteStream::SetListener(IRawByteStreamListener& listener)
+{
+    SILKIT_TRACE_METHOD_(_logger, "({})", static_cast<const void*>(&listener));
+
+    _listener = &listener;
+}
+
+
+auto SharedMemoryRawByteStream::GetLocalEndpoint() const -> std::string
+{
+    return MakeSharedMemoryEndpoint(_stream->GetLocalEndpoint());
+}
+
+
+auto SharedMemoryRawByteStream::GetRemoteEndpoint() const -> std::string
+{
+    return MakeSharedMemoryEndpoint(_stream->GetRemoteEndpoint());
+}
+
+
+void SharedMemoryRawByteStream::AsyncReadSome(MutableBufferSequence bufferSequence)
+{
+    SILKIT_TRACE_METHOD_(_logger, "(...)");
+
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+
+    if (_shutdownRequested || _shutdownPosted)
+    {
+        SILKIT_TRACE_METHOD_(_logger, "ignored, already shutting down");
+        return;
+    }
+
+    if (!_established || _reading)
+    {
+        throw InvalidStateError{};
+    }
+
+    _reading = true;
+    _readBufferSequence.assign(bufferSequence.begin(), bufferSequence.end());
+
+    TryCompleteRead();
+    UpdateStreamRead();
+
+    // the read found no more data after the other side shut down
+    PostShutdownIfDone();
+}
+
+
+void SharedMemoryRawByteStream::AsyncWriteSome(ConstBufferSequence bufferSequence)
+{
+    SILKIT_TRACE_METHOD_(_logger, "(...)");
+
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+
+    if (_shutdownRequested || _streamShutdown)
+    {
+        SILKIT_TRACE_METHOD_(_logger, "ignored, already shutting down");
+        return;
+    }
+
+    if (!_established || _writing)
+    {
+        throw InvalidStateError{};
+    }
+
+    _writing = true;
+    _writeBufferSequence.assign(bufferSequence.begin(), bufferSequence.end());
+
+    TryCompleteWrite();
+    UpdateStreamRead();
+}
+
+
+void SharedMemoryRawByteStream::Shutdown()
+{
+    SILKIT_TRACE_METHOD_(_logger, "()");
+
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+
+    if (_shutdownRequested)
+    {
+        return;
+    }
+
+    _shutdownRequested = true;
+
+    // pending operations are never completed, the listener is notified about the shutdown instead
+    _reading = false;
+    _writing = false;
+
+    _stream->Shutdown();
+
+    PostShutdownIfDone();
+}
+
+
+// IRawByteStreamListener (of the underlying stream)
+
+
+void SharedMemoryRawByteStream::OnAsyncReadSomeDone(IRawByteStream&, size_t bytesTransferred)
+{
+    SILKIT_TRACE_METHOD_(_logger, "({})", bytesTransferred);
+
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+
+    _streamReading = false;
+
+    if (!_established)
+    {
+        if (_helloInRead < _helloIn.size())
+        {
+            _helloInRead += bytesTransferred;
+        }
+        else
+        {
+            _openedInRead = bytesTransferred != 0;
+        }
+        ContinueHandshake();
+        return;
+    }
+
+    // the content of the notifications is irrelevant, look for data and space in the rings
+    TryCompleteRead();
+    TryCompleteWrite();
+    UpdateStreamRead();
+}
+
+
+void SharedMemoryRawByteStream::OnAsyncWriteSomeDone(IRawByteStream&, size_t bytesTransferred)
+{
+    SILKIT_TRACE_METHOD_(_logger, "({})", bytesTransferred);
+
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+
+    _streamWriting = false;
+
+    if (!_established)
+    {
+        if (_helloOutWritten < _helloOut.size())
+        {
+            _helloOutWritten += bytesTransferred;
+        }
+        else
+        {
+            _openedOutWritten = bytesTransferred != 0;
+        }
+        ContinueHandshake();
+        return;
+    }
+
+    if (_notificationPending || bytesTransferred == 0)
+    {
+        _notificationPending = false;
+        Notify();
+    }
+}
+
+
+void SharedMemoryRawByteStream::OnShutdown(IRawByteStream&)
+{
+    SILKIT_TRACE_METHOD_(_logger, "()");
+
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+
+    _streamShutdown = true;
+
+    if (!_established)
+    {
+        CompleteHandshake(false);
+        return;
+    }
+
+    // the other side is gone, but the data it wrote before is still delivered
+    _writing = false;
+
+    TryCompleteRead();
+    PostShutdownIfDone();
+}
+
+
+// ITimerListener (of the handshake timer)
+
+
+void SharedMemoryRawByteStream::OnTimerExpired(ITimer&)
+{
+    SILKIT_TRACE_METHOD_(_logger, "()");
+
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+
+    if (_established || !_handshakeHandler)
+    {
+        return;
+    }
+
+    Log::Warn(_logger, "SharedMemoryRawByteStream: the handshake did not complete within {}ms",
+              _options.handshakeTimeout.count());
+
+    // the handler is called with false once the underlying stream was shut down
+    _stream->Shutdown();
+}
+
+
+// Handshake
+
+
+void SharedMemoryRawByteStream::ContinueHandshake()
+{
+    if (_streamShutdown || _shutdownRequested || !_handshakeHandler)
+    {
+        return;
+    }
+
+    if (_helloOutWritten < _helloOut.size() && !_streamWriting)
+    {
+        _streamWriting = true;
+        ConstBuffer writeBuffer{_helloOut.data() + _helloOutWritten, _helloOut.size() - _helloOutWritten};
+        _stream->AsyncWriteSome(ConstBufferSequence{&writeBuffer, 1});
+    }
+
+    if (_helloInRead < _helloIn.size() && !_streamReading)
+    {
+        _streamReading = true;
+        MutableBuffer readBuffer{_helloIn.data() + _helloInRead, _helloIn.size() - _helloInRead};
+        _stream->AsyncReadSome(MutableBufferSequence{&readBuffer, 1});
+    }
+
+    if (_helloOutWritten < _helloOut.size() || _helloInRead < _helloIn.size())
+    {
+        return;
+    }
+
+    if (!_receiveRing)
+    {
+        if (std::memcmp(_helloIn.data(), HELLO_MAGIC, sizeof(HELLO_MAGIC)) != 0)
+        {
+            Log::Warn(_logger, "SharedMemoryRawByteStream: the other side did not start a shared memory handshake");
+            _stream->Shutdown();
+            return;
+        }
+
+        const auto nameBegin{reinterpret_cast<const char*>(_helloIn.data()) + sizeof(HELLO_MAGIC)};
+        const std::string name{nameBegin, strnlen(nameBegin, HELLO_SIZE - sizeof(HELLO_MAGIC))};
+
+        try
+        {
+            _receiveRing = SharedMemoryRing::Open(name);
+        }
+        catch (const std::exception& exception)
+        {
+            Log::Warn(_logger, "SharedMemoryRawByteStream: unable to open the shared memory: {}", exception.what());
+            _stream->Shutdown();
+            return;
+        }
+    }
+
+    if (!_openedOutWritten && !_streamWriting)
+    {
+        _streamWriting = true;
+        ConstBuffer writeBuffer{&OPENED, 1};
+        _stream->AsyncWriteSome(ConstBufferSequence{&writeBuffer, 1});
+    }
+
+    if (!_openedInRead && !_streamReading)
+    {
+        _streamReading = true;
+        MutableBuffer readBuffer{&_openedIn, 1};
+        _stream->AsyncReadSome(MutableBufferSequence{&readBuffer, 1});
+    }
+
+    if (!_openedOutWritten || !_openedInRead)
+    {
+        return;
+    }
+
+    // the other side opened the ring, nobody else may open it after that
+    _sendRing->Unlink();
+
+    Log::Debug(_logger, "SharedMemoryRawByteStream: sending via '{}', receiving via '{}'", _sendRing->GetName(),
+               _receiveRing->GetName());
+
+    _established = true;
+    CompleteHandshake(true);
+}
+
+
+void SharedMemoryRawByteStream::CompleteHandshake(bool success)
+{
+    if (!_handshakeHandler)
+    {
+        return;
+    }
+
+    auto handler{std::move(_handshakeHandler)};
+    _handshakeHandler = nullptr;
+
+    if (_handshakeTimer)
+    {
+        _handshakeTimer->Shutdown();
+    }
+
+    _ioContext->Post([handler = std::move(handler), success] { handler(success); });
+}
+
+
+// Data Transfer (the mutex is held by the callers)
+
+
+void SharedMemoryRawByteStream::TryCompleteRead()
+{
+    if (!_reading)
+    {
+        return;
+    }
+
+    auto bytesTransferred{_receiveRing->Read(_readBufferSequence)};
+
+    if (bytesTransferred == 0)
+    {
+        if (_streamShutdown)
+        {
+            // all data of the other side was delivered
+            _reading = false;
+            return;
+        }
+
+        if (_receiveRing->PrepareReaderWait())
+        {
+            return;
+        }
+
+        // the other side wrote data after the first attempt
+        bytesTransferred = _receiveRing->Read(_readBufferSequence);
+    }
+
+    _reading = false;
+
+    if (_receiveRing->TakeWaitingWriter())
+    {
+        Notify();
+    }
+
+    PostCompletion([this, bytesTransferred] { _listener->OnAsyncReadSomeDone(*this, bytesTransferred); });
+}
+
+
+void SharedMemoryRawByteStream::TryCompleteWrite()
+{
+    if (!_writing)
+    {
+        return;
+    }
+
+    auto bytesTransferred{_sendRing->Write(_writeBufferSequence)};
+
+    if (bytesTransferred == 0)
+    {
+        if (_sendRing->PrepareWriterWait())
+        {
+            return;
+        }
+
+        // the other side read data after the first attempt
+        bytesTransferred = _sendRing->Write(_writeBufferSequence);
+    }
+
+    _writing = false;
+
+    if (_sendRing->TakeWaitingReader())
+    {
+        Notify();
+    }
+
+    PostCompletion([this, bytesTransferred] { _listener->OnAsyncWriteSomeDone(*this, bytesTransferred); });
+}
+
+
+void SharedMemoryRawByteStream::UpdateStreamRead()
+{
+    // notifications are only expected while waiting for data or space, the read also detects the shutdown of the other
+    // side while waiting
+    if (_streamReading || _streamShutdown || _shutdownRequested || !(_reading || _writing))
+    {
+        return;
+    }
+
+    _streamReading = true;
+    MutableBuffer readBuffer{_notificationBuffer.data(), _notificationBuffer.size()};
+    _stream->AsyncReadSome(MutableBufferSequence{&readBuffer, 1});
+}
+
+
+void SharedMemoryRawByteStream::Notify()
+{
+    if (_streamShutdown || _shutdownRequested)
+    {
+        return;
+    }
+
+    if (_streamWriting)
+    {
+        _notificationPending = true;
+        return;
+    }
+
+    _streamWriting = true;
+    ConstBuffer writeBuffer{&NOTIFICATION, 1};
+    _stream->AsyncWriteSome(ConstBufferSequence{&writeBuffer, 1});
+}
+
+
+void SharedMemoryRawByteStream::PostCompletion(std::function<void()> function)
+{
+    ++_postedCompletions;
+
+    _ioContext->Post([this, function = std::move(function)] {
+        function();
+        OnCompletionDone();
+    });
+}
+
+
+void SharedMemoryRawByteStream::OnCompletionDone()
+{
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+
+    --_postedCompletions;
+
+    PostShutdownIfDone();
+}
+
+
+void SharedMemoryRawByteStream::PostShutdownIfDone()
+{
+    // the listener must not be notified about the shutdown while a completion may still be executed, and the data
+    // written by the other side is delivered before the shutdown, unless the shutdown was requested on this side
+    if (!_established || !_streamShutdown || _shutdownPosted || _postedCompletions != 0)
+    {
+        return;
+    }
+
+    if (!_shutdownRequested && _receiveRing->Size() != 0)
+    {
+        return;
+    }
+
+    SILKIT_TRACE_METHOD_(_logger, "posting shutdown on listener {}", static_cast<const void*>(_listener));
+
+    _shutdownPosted = true;
+    _reading = false;
+
+    _ioContext->Post([this] { _listener->OnShutdown(*this); });
+}
+
+
+} // namespace VSilKit
+
+
+#undef SILKIT_TRACE_METHOD_
@@ -0,0 +1,144 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+
+#include "IIoContext.hpp"
+#include "IRawByteStream.hpp"
+#include "ITimer.hpp"
+
+#include "SharedMemoryRing.hpp"
+
+#include "LoggerMessage.hpp"
+
+#include <array>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <cstdint>
+
+
+namespace VSilKit {
+
+
+struct SharedMemoryRawByteStreamOptions
+{
+    //! Capacity of the ring buffer of each direction, rounded up to the next power of two.
+    std::size_t ringCapacity{1024 * 1024};
+    //! The underlying stream is shut down if the handshake did not complete within this duration.
+    std::chrono::milliseconds handshakeTimeout{5000};
+};
+
+
+//! Transforms the local-domain endpoint of the underlying stream (local://<path>) into shm://<path>.
+auto MakeSharedMemoryEndpoint(const std::string& localEndpoint) -> std::string;
+
+
+//! Byte stream between two processes on the same host, which transfers the bytes through a pair of shared memory
+//! rings (one per direction). The underlying local-domain stream is used to exchange the names of the rings, to wake
+//! up a side which waits for data or space, and to detect that the other side has shut down (or crashed).
+class SharedMemoryRawByteStream final
+    : public IRawByteStream
+    , private IRawByteStreamListener
+    , private ITimerListener
+{
+    static constexpr std::size_t HELLO_SIZE{64};
+
+    SharedMemoryRawByteStreamOptions _options;
+    IIoContext* _ioContext{nullptr};
+    std::unique_ptr<IRawByteStream> _stream;
+    SilKit::Services::Logging::ILogger* _logger{nullptr};
+
+    IRawByteStreamListener* _listener{nullptr};
+
+    std::mutex _mutex;
+
+    // handshake: each side sends the name of the ring it writes into, opens the ring of the other side for reading, and
+    // confirms this with a single byte, after which the name of the own ring is removed
+    std::function<void(bool)> _handshakeHandler;
+    std::unique_ptr<ITimer> _handshakeTimer;
+    std::array<std::uint8_t, HELLO_SIZE> _helloOut{};
+    std::size_t _helloOutWritten{0};
+    std::array<std::uint8_t, HELLO_SIZE> _helloIn{};
+    std::size_t _helloInRead{0};
+    bool _openedOutWritten{false};
+    std::uint8_t _openedIn{0};
+    bool _openedInRead{false};
+    bool _established{false};
+
+    std::unique_ptr<SharedMemoryRing> _sendRing;
+    std::unique_ptr<SharedMemoryRing> _receiveRing;
+
+    // pending operations of the listener, waiting for data or space in the rings
+    bool _reading{false};
+    std::vector<MutableBuffer> _readBufferSequence;
+    bool _writing{false};
+    std::vector<ConstBuffer> _writeBufferSequence;
+
+    // wake-up notifications on the underlying stream, multiple notifications are coalesced while one is written
+    bool _streamReading{false};
+    std::array<std::uint8_t, 64> _notificationBuffer{};
+    bool _streamWriting{false};
+    bool _notificationPending{false};
+
+    bool _shutdownRequested{false};
+    bool _streamShutdown{false};
+    bool _shutdownPosted{false};
+    // number of listener callbacks (read / write completion) posted but not yet completed
+    int _postedCompletions{0};
+
+public:
+    SharedMemoryRawByteStream(const SharedMemoryRawByteStreamOptions& options, IIoContext& ioContext,
+                              std::unique_ptr<IRawByteStream> stream, SilKit::Services::Logging::ILogger& logger);
+    ~SharedMemoryRawByteStream() override;
+
+    //! Exchanges the names of the rings with the other side. The handler is posted to the io context. If the handshake
+    //! failed or timed out, it is called with false after the underlying stream was shut down, and the stream may be
+    //! destroyed.
+    void AsyncHandshake(std::function<void(bool)> handler);
+
+public: // IRawByteStream
+    void SetListener(IRawByteStreamListener& listener) override;
+    auto GetLocalEndpoint() const -> std::string override;
+    auto GetRemoteEndpoint() const -> std::string override;
+    void AsyncReadSome(MutableBufferSequence bufferSequence) override;
+    void AsyncWriteSome(ConstBufferSequence bufferSequence) override;
+    void Shutdown() override;
+
+private: // IRawByteStreamListener (of the underlying stream)
+    void OnAsyncReadSomeDone(IRawByteStream& stream, size_t bytesTransferred) override;
+    void OnAsyncWriteSomeDone(IRawByteStream& stream, size_t bytesTransferred) override;
+    void OnShutdown(IRawByteStream& stream) override;
+
+private: // ITimerListener (of the handshake timer)
+    void OnTimerExpired(ITimer& timer) override;
+
+private:
+    void ContinueHandshake();
+    void CompleteHandshake(bool success);
+
+    void TryCompleteRead();
+    void TryCompleteWrite();
+    void UpdateStreamRead();
+    void Notify();
+    void PostCompletion(std::function<void()> function);
+    void OnCompletionDone();
+    void PostShutdownIfDone();
+};
+
+
+} // namespace VSilKit
+
+
+namespace SilKit {
+namespace Core {
+using VSilKit::SharedMemoryRawByteStream;
+using VSilKit::SharedMemoryRawByteStreamOptions;
+} // namespace Core
+} // namespace SilKit
@@ -0,0 +1,394 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "SharedMemoryRing.hpp"
+
+#include "silkit/participant/exception.hpp"
+
+#include "fmt/format.h"
+
+#include <algorithm>
+#include <atomic>
+#include <new>
+#include <random>
+
+#include <cerrno>
+#include <cstring>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+
+namespace VSilKit {
+
+
+// the header is shared between processes, which requires address-free (i.e., lock-free) atomics
+static_assert(ATOMIC_LLONG_LOCK_FREE == 2, "shared memory rings require lock-free 64 bit atomics");
+static_assert(ATOMIC_INT_LOCK_FREE == 2, "shared memory rings require lock-free 32 bit atomics");
+
+
+// the writer and reader modify their position and flag on separate cache lines
+struct SharedMemoryRing::Header
+{
+    std::uint64_t magic;
+    std::uint32_t version;
+    std::uint32_t reserved;
+    std::uint64_t capacity;
+    char padding0[64 - 3 * sizeof(std::uint64_t)];
+
+    std::atomic<std::uint64_t> writePosition;
+    char padding1[64 - sizeof(std::atomic<std::uint64_t>)];
+
+    std::atomic<std::uint64_t> readPosition;
+    char padding2[64 - sizeof(std::atomic<std::uint64_t>)];
+
+    std::atomic<std::uint32_t> readerWaiting;
+    char padding3[64 - sizeof(std::atomic<std::uint32_t>)];
+
+    std::atomic<std::uint32_t> writerWaiting;
+    char padding4[64 - sizeof(std::atomic<std::uint32_t>)];
+};
+
+
+namespace {
+
+constexpr std::uint64_t HEADER_MAGIC{0x4d485354494b4c53}; // "SLKITSHM" in little-endian byte order
+constexpr std::uint32_t HEADER_VERSION{1};
+
+constexpr std::size_t MIN_CAPACITY{4096};
+// keeps the size of the mapping representable in an off_t on all platforms
+constexpr std::size_t MAX_CAPACITY{std::size_t{1} << 30};
+
+auto RoundUpToPowerOfTwo(std::size_t value) -> std::size_t
+{
+    std::size_t result{MIN_CAPACITY};
+    while (result < value && result < MAX_CAPACITY)
+    {
+        result *= 2;
+    }
+    return result;
+}
+
+auto IsPowerOfTwo(std::uint64_t value) -> bool
+{
+    return value != 0 && (value & (value - 1)) == 0;
+}
+
+} // namespace
+
+
+#if !defined(_WIN32)
+
+namespace {
+
+auto MakeUniqueName() -> std::string
+{
+    // the random part keeps other processes from guessing the name of a ring before it was opened by the other side
+    thread_local std::mt19937_64 generator{[] {
+        std::random_device device;
+        return (static_cast<std::uint64_t>(device()) << 32) ^ device();
+    }()};
+
+    // macOS limits the names of shared memory objects to 31 characters
+    return fmt::format("/sk-{:x}-{:016x}", static_cast<unsigned>(::getpid()), generator());
+}
+
+auto ErrnoMessage(const char* operation, const std::string& name) -> std::string
+{
+    const auto error{errno};
+    return fmt::format("SharedMemoryRing: {} of '{}' failed: {}", operation, name, std::strerror(error));
+}
+
+} // namespace
+
+
+auto SharedMemoryRing::IsSupported() -> bool
+{
+    return true;
+}
+
+
+auto SharedMemoryRing::Create(std::size_t capacity) -> std::unique_ptr<SharedMemoryRing>
+{
+    capacity = RoundUpToPowerOfTwo(capacity);
+    const auto mappingSize{sizeof(Header) + capacity};
+
+    std::string name;
+    int fd{-1};
+
+    for (unsigned attempt = 0; fd == -1; ++attempt)
+    {
+        name = MakeUniqueName();
+        fd = ::shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+
+        // an object with the same name may exist by chance, or was left behind by a crashed process
+        if (fd == -1 && (errno != EEXIST || attempt >= 16))
+        {
+            throw SilKit::SilKitError{ErrnoMessage("shm_open", name)};
+        }
+    }
+
+    if (::ftruncate(fd, static_cast<off_t>(mappingSize)) != 0)
+    {
+        const auto message{ErrnoMessage("ftruncate", name)};
+        (void)::close(fd);
+        (void)::shm_unlink(name.c_str());
+        throw SilKit::SilKitError{message};
+    }
+
+    void* mapping{::mmap(nullptr, mappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0)};
+    const auto mmapMessage{mapping == MAP_FAILED ? ErrnoMessage("mmap", name) : std::string{}};
+    (void)::close(fd);
+
+    if (mapping == MAP_FAILED)
+    {
+        (void)::shm_unlink(name.c_str());
+        throw SilKit::SilKitError{mmapMessage};
+    }
+
+    auto* header{new (mapping) Header{}};
+    header->magic = HEADER_MAGIC;
+    header->version = HEADER_VERSION;
+    header->capacity = capacity;
+
+    return std::unique_ptr<SharedMemoryRing>{new SharedMemoryRing{std::move(name), true, mapping, mappingSize}};
+}
+
+
+auto SharedMemoryRing::Open(const std::string& name) -> std::unique_ptr<SharedMemoryRing>
+{
+    const int fd{::shm_open(name.c_str(), O_RDWR, 0)};
+    if (fd == -1)
+    {
+        throw SilKit::SilKitError{ErrnoMessage("shm_open", name)};
+    }
+
+    struct stat status
+    {
+    };
+    if (::fstat(fd, &status) != 0)
+    {
+        const auto message{ErrnoMessage("fstat", name)};
+        (void)::close(fd);
+        throw SilKit::SilKitError{message};
+    }
+
+    const auto mappingSize{static_cast<std::size_t>(status.st_size)};
+    if (mappingSize < sizeof(Header) + MIN_CAPACITY || mappingSize > sizeof(Header) + MAX_CAPACITY)
+    {
+        (void)::close(fd);
+        throw SilKit::SilKitError{fmt::format("SharedMemoryRing: '{}' has an invalid size", name)};
+    }
+
+    void* mapping{::mmap(nullptr, mappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0)};
+    const auto mmapMessage{mapping == MAP_FAILED ? ErrnoMessage("mmap", name) : std::string{}};
+    (void)::close(fd);
+
+    if (mapping == MAP_FAILED)
+    {
+        throw SilKit::SilKitError{mmapMessage};
+    }
+
+    const auto* header{static_cast<const Header*>(mapping)};
+    if (header->magic != HEADER_MAGIC || header->version != HEADER_VERSION || !IsPowerOfTwo(header->capacity)
+        || sizeof(Header) + header->capacity != mappingSize)
+    {
+        (void)::munmap(mapping, mappingSize);
+        throw SilKit::SilKitError{fmt::format("SharedMemoryRing: '{}' has an invalid header", name)};
+    }
+
+    return std::unique_ptr<SharedMemoryRing>{new SharedMemoryRing{name, false, mapping, mappingSize}};
+}
+
+
+SharedMemoryRing::~SharedMemoryRing()
+{
+    (void)::munmap(_mapping, _mappingSize);
+
+    Unlink();
+}
+
+
+void SharedMemoryRing::Unlink()
+{
+    if (_owner)
+    {
+        _owner = false;
+        (void)::shm_unlink(_name.c_str());
+    }
+}
+
+#else
+
+auto SharedMemoryRing::IsSupported() -> bool
+{
+    return false;
+}
+
+
+auto SharedMemoryRing::Create(std::size_t) -> std::unique_ptr<SharedMemoryRing>
+{
+    throw SilKit::SilKitError{"SharedMemoryRing: shared memory is not supported on this platform"};
+}
+
+
+auto SharedMemoryRing::Open(const std::string&) -> std::unique_ptr<SharedMemoryRing>
+{
+    throw SilKit::SilKitError{"SharedMemoryRing: shared memory is not supported on this platform"};
+}
+
+
+SharedMemoryRing::~SharedMemoryRing() = default;
+
+
+void SharedMemoryRing::Unlink()
+{
+}
+
+#endif
+
+
+SharedMemoryRing::SharedMemoryRing(std::string name, bool owner, void* mapping, std::size_t mappingSize)
+    : _name{std::move(name)}
+    , _owner{owner}
+    , _mapping{mapping}
+    , _mappingSize{mappingSize}
+    , _header{static_cast<Header*>(mapping)}
+    , _data{static_cast<std::uint8_t*>(mapping) + sizeof(Header)}
+    , _mask{static_cast<std::size_t>(_header->capacity) - 1}
+{
+}
+
+
+auto SharedMemoryRing::GetName() const -> const std::string&
+{
+    return _name;
+}
+
+
+auto SharedMemoryRing::Capacity() const -> std::size_t
+{
+    return _mask + 1;
+}
+
+
+auto SharedMemoryRing::Size() const -> std::size_t
+{
+    const auto readPosition{_header->readPosition.load(std::memory_order_acquire)};
+    const auto writePosition{_header->writePosition.load(std::memory_order_acquire)};
+    return static_cast<std::size_t>(writePosition - readPosition);
+}
+
+
+auto SharedMemoryRing::Write(ConstBufferSequence bufferSequence) -> std::size_t
+{
+    const auto writePosition{_header->writePosition.load(std::memory_order_relaxed)};
+    const auto readPosition{_header->readPosition.load(std::memory_order_acquire)};
+
+    auto free{Capacity() - static_cast<std::size_t>(writePosition - readPosition)};
+    auto position{writePosition};
+
+    for (auto buffer : bufferSequence)
+    {
+        while (buffer.GetSize() != 0 && free != 0)
+        {
+            const auto offset{static_cast<std::size_t>(position) & _mask};
+            const auto chunk{buffer.SliceOff((std::min)({buffer.GetSize(), free, Capacity() - offset}))};
+
+            std::memcpy(_data + offset, chunk.GetData(), chunk.GetSize());
+            position += chunk.GetSize();
+            free -= chunk.GetSize();
+        }
+    }
+
+    // sequentially consistent, such that a reader announcing that it waits either sees the data, or is seen waiting
+    _header->writePosition.store(position, std::memory_order_seq_cst);
+    return static_cast<std::size_t>(position - writePosition);
+}
+
+
+auto SharedMemoryRing::Read(MutableBufferSequence bufferSequence) -> std::size_t
+{
+    const auto readPosition{_header->readPosition.load(std::memory_order_relaxed)};
+    const auto writePosition{_header->writePosition.load(std::memory_order_acquire)};
+
+    auto available{static_cast<std::size_t>(writePosition - readPosition)};
+    auto position{readPosition};
+
+    for (auto buffer : bufferSequence)
+    {
+        while (buffer.GetSize() != 0 && available != 0)
+        {
+            const auto offset{static_cast<std::size_t>(position) & _mask};
+            const auto chunk{buffer.SliceOff((std::min)({buffer.GetSize(), available, Capacity() - offset}))};
+
+            std::memcpy(chunk.GetData(), _data + offset, chunk.GetSize());
+            position += chunk.GetSize();
+            available -= chunk.GetSize();
+        }
+    }
+
+    // sequentially consistent, such that a writer announcing that it waits either sees the space, or is seen waiting
+    _header->readPosition.store(position, std::memory_order_seq_cst);
+    return static_cast<std::size_t>(position - readPosition);
+}
+
+
+bool SharedMemoryRing::PrepareReaderWait()
+{
+    _header->readerWaiting.store(1, std::memory_order_seq_cst);
+
+    if (_header->writePosition.load(std::memory_order_seq_cst) != _header->readPosition.load(std::memory_order_relaxed))
+    {
+        _header->readerWaiting.store(0, std::memory_order_relaxed);
+        return false;
+    }
+
+    return true;
+}
+
+
+bool SharedMemoryRing::PrepareWriterWait()
+{
+    _header->writerWaiting.store(1, std::memory_order_seq_cst);
+
+    const auto readPosition{_header->readPosition.load(std::memory_order_seq_cst)};
+    if (_header->writePosition.load(std::memory_order_relaxed) - readPosition < Capacity())
+    {
+        _header->writerWaiting.store(0, std::memory_order_relaxed);
+        return false;
+    }
+
+    return true;
+}
+
+
+bool SharedMemoryRing::TakeWaitingReader()
+{
+    // avoid the read-modify-write in the common case of a reader that is busy
+    if (_header->readerWaiting.load(std::memory_order_seq_cst) == 0)
+    {
+        return false;
+    }
+
+    return _header->readerWaiting.exchange(0, std::memory_order_seq_cst) != 0;
+}
+
+
+bool SharedMemoryRing::TakeWaitingWriter()
+{
+    if (_header->writerWaiting.load(std::memory_order_seq_cst) == 0)
+    {
+        return false;
+    }
+
+    return _header->writerWaiting.exchange(0, std::memory_order_seq_cst) != 0;
+}
+
+
+} // namespace VSilKit
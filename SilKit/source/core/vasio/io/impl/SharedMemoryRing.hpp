@@ -0,0 +1,93 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+
+#include "util/Buffer.hpp"
+
+#include <memory>
+#include <string>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace VSilKit {
+
+
+//! Byte ring buffer in a named POSIX shared memory object, for a single writer and a single reader which may live in
+//! different processes. The ring never blocks, the writer and reader announce that they wait for space or data via
+//! flags in the shared memory, and the opposite side tells whether it has to wake them up.
+class SharedMemoryRing
+{
+public:
+    struct Header;
+
+public:
+    //! Creates a new shared memory object with a unique, random name, which is only accessible by the current user.
+    //! The capacity is rounded up to the next power of two.
+    static auto Create(std::size_t capacity) -> std::unique_ptr<SharedMemoryRing>;
+    //! Maps the shared memory object created by another process. The name is left alone, it is removed by the creator
+    //! once the other side confirmed that it opened the object.
+    static auto Open(const std::string& name) -> std::unique_ptr<SharedMemoryRing>;
+
+    //! True if shared memory rings are supported on this platform.
+    static auto IsSupported() -> bool;
+
+    SharedMemoryRing(const SharedMemoryRing&) = delete;
+    SharedMemoryRing& operator=(const SharedMemoryRing&) = delete;
+    ~SharedMemoryRing();
+
+public:
+    auto GetName() const -> const std::string&;
+    //! Removes the name of a created shared memory object, such that it cannot be opened anymore. The memory is
+    //! released once both sides have destroyed their SharedMemoryRing. Does nothing for an opened ring, or if the name
+    //! was already removed. Called by the destructor.
+    void Unlink();
+    auto Capacity() const -> std::size_t;
+    //! Number of bytes which can be read. Exact only from the reader, an upper bound of the free space for the writer.
+    auto Size() const -> std::size_t;
+
+    //! Copies as many bytes as fit into the ring and returns their number. Writer only.
+    auto Write(ConstBufferSequence bufferSequence) -> std::size_t;
+    //! Copies as many bytes as are available from the ring and returns their number. Reader only.
+    auto Read(MutableBufferSequence bufferSequence) -> std::size_t;
+
+    //! Announces that the reader waits for data. Returns false, and withdraws the announcement, if data became
+    //! available in the meantime. Reader only.
+    bool PrepareReaderWait();
+    //! Announces that the writer waits for space. Returns false, and withdraws the announcement, if space became
+    //! available in the meantime. Writer only.
+    bool PrepareWriterWait();
+    //! Withdraws the announcement of a waiting reader. Returns true if the reader was waiting, i.e., it has to be woken
+    //! up. Writer only, called after data was written.
+    bool TakeWaitingReader();
+    //! Withdraws the announcement of a waiting writer. Returns true if the writer was waiting, i.e., it has to be woken
+    //! up. Reader only, called after data was read.
+    bool TakeWaitingWriter();
+
+private:
+    SharedMemoryRing(std::string name, bool owner, void* mapping, std::size_t mappingSize);
+
+private:
+    std::string _name;
+    // the name of the shared memory object was created by this side, and was not removed yet
+    bool _owner{false};
+    void* _mapping{nullptr};
+    std::size_t _mappingSize{0};
+    Header* _header{nullptr};
+    std::uint8_t* _data{nullptr};
+    std::size_t _mask{0};
+};
+
+
+} // namespace VSilKit
+
+
+namespace SilKit {
+namespace Core {
+using VSilKit::SharedMemoryRing;
+} // namespace Core
+} // namespace SilKit
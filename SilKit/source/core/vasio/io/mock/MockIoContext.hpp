@@ -42,6 +42,8 @@ struct MockIoContext : IIoContext
 
     MOCK_METHOD(void, Dispatch, (std::function<void()>), (override));
 
+    MOCK_METHOD(bool, IsRunningInThisThread, (), (const, override));
+
     MOCK_METHOD(std::unique_ptr<IAcceptor>, MakeTcpAcceptor, (std::string const&, uint16_t), (override));
 
     MOCK_METHOD(std::unique_ptr<IAcceptor>, MakeLocalAcceptor, (std::string const&), (override));
@@ -50,6 +52,10 @@ struct MockIoContext : IIoContext
 
     MOCK_METHOD(std::unique_ptr<IConnector>, MakeLocalConnector, (std::string const&), (override));
 
+    MOCK_METHOD(std::unique_ptr<IAcceptor>, MakeSharedMemoryAcceptor, (std::string const&), (override));
+
+    MOCK_METHOD(std::unique_ptr<IConnector>, MakeSharedMemoryConnector, (std::string const&), (override));
+
     MOCK_METHOD(std::unique_ptr<ITimer>, MakeTimer, (), (override));
 
     MOCK_METHOD(std::vector<std::string>, Resolve, (std::string const&), (override));
@@ -95,6 +101,11 @@ struct MockIoContextWithExecutionQueue : IIoContext
         }
     }
 
+    auto IsRunningInThisThread() const -> bool override
+    {
+        return executingHandler;
+    }
+
     MOCK_METHOD(std::unique_ptr<IAcceptor>, MakeTcpAcceptor, (std::string const&, uint16_t), (override));
 
     MOCK_METHOD(std::unique_ptr<IAcceptor>, MakeLocalAcceptor, (std::string const&), (override));
@@ -103,6 +114,10 @@ struct MockIoContextWithExecutionQueue : IIoContext
 
     MOCK_METHOD(std::unique_ptr<IConnector>, MakeLocalConnector, (std::string const&), (override));
 
+    MOCK_METHOD(std::unique_ptr<IAcceptor>, MakeSharedMemoryAcceptor, (std::string const&), (override));
+
+    MOCK_METHOD(std::unique_ptr<IConnector>, MakeSharedMemoryConnector, (std::string const&), (override));
+
     MOCK_METHOD(std::unique_ptr<ITimer>, MakeTimer, (), (override));
 
     MOCK_METHOD(std::vector<std::string>, Resolve, (std::string const&), (override));
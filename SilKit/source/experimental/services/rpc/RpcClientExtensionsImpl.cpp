@@ -0,0 +1,39 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "silkit/services/rpc/IRpcClient.hpp"
+
+#include "RpcClientExtensionsImpl.hpp"
+#include "IRpcClientExtensions.hpp"
+
+namespace {
+
+auto GetRpcClient(SilKit::Services::Rpc::IRpcClient* rpcClient) -> SilKit::Services::Rpc::IRpcClientExtensions*
+{
+    auto rpcClientExtensions = dynamic_cast<SilKit::Services::Rpc::IRpcClientExtensions*>(rpcClient);
+    if (rpcClientExtensions == nullptr)
+    {
+        throw SilKit::SilKitError("rpcClient is not a valid SilKit::Services::Rpc::IRpcClient*");
+    }
+    return rpcClientExtensions;
+}
+
+} // namespace
+
+namespace SilKit {
+namespace Experimental {
+namespace Services {
+namespace Rpc {
+
+void CallBatchImpl(SilKit::Services::Rpc::IRpcClient* rpcClient,
+                   SilKit::Util::Span<const SilKit::Util::Span<const uint8_t>> data,
+                   SilKit::Util::Span<void* const> userContexts)
+{
+    GetRpcClient(rpcClient)->CallBatch(data, userContexts);
+}
+
+} // namespace Rpc
+} // namespace Services
+} // namespace Experimental
+} // namespace SilKit
@@ -0,0 +1,46 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+// ================================================================================
+//  ATTENTION: This header must NOT include any SIL Kit header (neither internal,
+//             nor public), as it is used to implement the 'legacy' ABI functions.
+// ================================================================================
+
+#include <cstdint>
+
+// Forward Declarations
+
+namespace SilKit {
+namespace Services {
+namespace Rpc {
+class IRpcClient;
+} // namespace Rpc
+} // namespace Services
+} // namespace SilKit
+
+namespace SilKit {
+namespace Util {
+template <typename T>
+class Span;
+} // namespace Util
+} // namespace SilKit
+
+
+// Function Declarations
+
+namespace SilKit {
+namespace Experimental {
+namespace Services {
+namespace Rpc {
+
+void CallBatchImpl(SilKit::Services::Rpc::IRpcClient* rpcClient,
+                   SilKit::Util::Span<const SilKit::Util::Span<const uint8_t>> data,
+                   SilKit::Util::Span<void* const> userContexts);
+
+} // namespace Rpc
+} // namespace Services
+} // namespace Experimental
+} // namespace SilKit
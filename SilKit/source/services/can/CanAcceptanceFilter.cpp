@@ -0,0 +1,117 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "CanAcceptanceFilter.hpp"
+
+#include <algorithm>
+
+#include "ServiceConfigKeys.hpp"
+#include "YamlParser.hpp"
+
+namespace SilKit {
+namespace Services {
+namespace Can {
+
+bool IsAcceptedByFilters(const std::vector<Config::CanAcceptanceFilter>& filters, uint32_t canId)
+{
+    if (filters.empty())
+    {
+        return true;
+    }
+
+    return std::any_of(filters.begin(), filters.end(), [canId](const Config::CanAcceptanceFilter& filter) {
+        return (canId & filter.mask) == (filter.id & filter.mask);
+    });
+}
+
+namespace {
+
+bool IsCanController(const Core::ServiceDescriptor& serviceDescriptor)
+{
+    std::string controllerType;
+    return serviceDescriptor.GetServiceType() == Core::ServiceType::Controller
+           && serviceDescriptor.GetSupplementalDataItem(Core::Discovery::controllerType, controllerType)
+           && controllerType == Core::Discovery::controllerTypeCan;
+}
+
+bool IsCanNetworkSimulator(const Core::ServiceDescriptor& serviceDescriptor)
+{
+    return serviceDescriptor.GetServiceType() == Core::ServiceType::Link
+           && serviceDescriptor.GetNetworkType() == Config::NetworkType::CAN;
+}
+
+} // namespace
+
+bool RemoteCanAcceptanceFilters::AddService(const Core::ServiceDescriptor& serviceDescriptor)
+{
+    std::vector<Config::CanAcceptanceFilter> filters;
+    if (IsCanController(serviceDescriptor))
+    {
+        std::string filtersStr;
+        if (serviceDescriptor.GetSupplementalDataItem(Core::Discovery::supplKeyCanControllerAcceptanceFilters,
+                                                      filtersStr))
+        {
+            filters = Config::Deserialize<std::vector<Config::CanAcceptanceFilter>>(filtersStr);
+        }
+    }
+    else if (!IsCanNetworkSimulator(serviceDescriptor))
+    {
+        return false;
+    }
+
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+    auto& serviceFilters = _filtersByParticipant[{serviceDescriptor.GetNetworkName(),
+                                                  serviceDescriptor.GetParticipantName()}];
+    serviceFilters[{serviceDescriptor.GetServiceType(), serviceDescriptor.GetServiceId()}] = std::move(filters);
+    return true;
+}
+
+bool RemoteCanAcceptanceFilters::RemoveService(const Core::ServiceDescriptor& serviceDescriptor)
+{
+    if (!IsCanController(serviceDescriptor) && !IsCanNetworkSimulator(serviceDescriptor))
+    {
+        return false;
+    }
+
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+    auto it = _filtersByParticipant.find({serviceDescriptor.GetNetworkName(), serviceDescriptor.GetParticipantName()});
+    if (it != _filtersByParticipant.end())
+    {
+        it->second.erase({serviceDescriptor.GetServiceType(), serviceDescriptor.GetServiceId()});
+        if (it->second.empty())
+        {
+            _filtersByParticipant.erase(it);
+        }
+    }
+    return true;
+}
+
+auto RemoteCanAcceptanceFilters::GetFrameFilter(const std::string& networkName,
+                                                const std::string& participantName) const -> FrameFilter
+{
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+    auto it = _filtersByParticipant.find({networkName, participantName});
+    if (it == _filtersByParticipant.end())
+    {
+        return nullptr;
+    }
+
+    std::vector<Config::CanAcceptanceFilter> filters;
+    for (const auto& service : it->second)
+    {
+        if (service.second.empty())
+        {
+            return nullptr;
+        }
+        filters.insert(filters.end(), service.second.begin(), service.second.end());
+    }
+
+    return [filters = std::move(filters)](const WireCanFrameEvent& msg) {
+        return IsAcceptedByFilters(filters, msg.frame.canId);
+    };
+}
+
+} // namespace Can
+} // namespace Services
+} // namespace SilKit
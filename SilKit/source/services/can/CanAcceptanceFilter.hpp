@@ -0,0 +1,65 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ParticipantConfiguration.hpp"
+#include "ServiceDescriptor.hpp"
+#include "WireCanMessages.hpp"
+
+namespace SilKit {
+namespace Services {
+namespace Can {
+
+//! True if any of the filters accepts the CAN ID. An empty list of filters accepts all CAN IDs.
+bool IsAcceptedByFilters(const std::vector<Config::CanAcceptanceFilter>& filters, uint32_t canId);
+
+//! \brief Tracks the acceptance filters of the CAN controllers of remote participants.
+//!
+//! The frames sent to a participant only need to pass the union of the acceptance filters of its controllers on the
+//! network. A participant accepts all frames if any of its controllers has no filters, or if it simulates the network.
+class RemoteCanAcceptanceFilters
+{
+public:
+    // ----------------------------------------
+    // Public Data Types
+    using FrameFilter = std::function<bool(const WireCanFrameEvent&)>;
+
+public:
+    // ----------------------------------------
+    // Public Methods
+
+    //! Returns false if the service is not relevant for the acceptance filters.
+    bool AddService(const Core::ServiceDescriptor& serviceDescriptor);
+    //! Returns false if the service is not relevant for the acceptance filters.
+    bool RemoveService(const Core::ServiceDescriptor& serviceDescriptor);
+
+    //! The filter for the frames sent to the participant on the network, nullptr if it accepts all frames.
+    auto GetFrameFilter(const std::string& networkName, const std::string& participantName) const -> FrameFilter;
+
+private:
+    // ----------------------------------------
+    // Private Data Types
+    using ParticipantKey = std::pair<std::string, std::string>;
+    using ServiceKey = std::pair<Core::ServiceType, Core::EndpointId>;
+    // an empty list of filters accepts all frames
+    using ServiceFilters = std::map<ServiceKey, std::vector<Config::CanAcceptanceFilter>>;
+
+private:
+    // ----------------------------------------
+    // Private Members
+    mutable std::mutex _mutex;
+    std::map<ParticipantKey, ServiceFilters> _filtersByParticipant;
+};
+
+} // namespace Can
+} // namespace Services
+} // namespace SilKit
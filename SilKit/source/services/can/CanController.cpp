@@ -24,6 +24,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "IServiceDiscovery.hpp"
 #include "ServiceDatatypes.hpp"
 #include "CanController.hpp"
+#include "CanAcceptanceFilter.hpp"
 #include "Tracing.hpp"
 
 namespace SilKit {
@@ -194,6 +195,12 @@ void CanController::ReceiveMsg(const IServiceEndpoint* from, const WireCanFrameE
         return;
     }
 
+    // received frames have to pass the acceptance filters, like in a hardware controller
+    if (msg.direction == TransmitDirection::RX && !IsAcceptedByFilters(_config.acceptanceFilters, msg.frame.canId))
+    {
+        return;
+    }
+
     auto canFrameEvent = ToCanFrameEvent(msg);
 
     const auto frameDirection = static_cast<DirectionMask>(msg.direction);
@@ -154,6 +154,19 @@ void Deserialize(MessageBuffer& buffer, Services::Can::CanSetControllerMode& out
     buffer >> out;
 }
 
+//////////////////////////////////////////////////////////////////////
+// SerializedSizeOf
+//////////////////////////////////////////////////////////////////////
+
+auto SerializedSizeOf(const Services::Can::WireCanFrameEvent& msg) -> size_t
+{
+    using SilKit::Core::SerializedSizeOf;
+    return SerializedSizeOf(msg.timestamp) + SerializedSizeOf(msg.frame.canId) + SerializedSizeOf(msg.frame.flags)
+           + SerializedSizeOf(msg.frame.dlc) + SerializedSizeOf(msg.frame.sdt) + SerializedSizeOf(msg.frame.vcid)
+           + SerializedSizeOf(msg.frame.af) + SerializedSizeOf(msg.frame.dataField) + SerializedSizeOf(msg.direction)
+           + SerializedSizeOf(msg.userContext);
+}
+
 } // namespace Can
 } // namespace Services
 } // namespace SilKit
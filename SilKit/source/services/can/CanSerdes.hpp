@@ -42,6 +42,8 @@ void Deserialize(SilKit::Core::MessageBuffer& buffer, Services::Can::CanControll
 void Deserialize(SilKit::Core::MessageBuffer& buffer, Services::Can::CanConfigureBaudrate& out);
 void Deserialize(SilKit::Core::MessageBuffer& buffer, Services::Can::CanSetControllerMode& out);
 
+auto SerializedSizeOf(const Services::Can::WireCanFrameEvent& msg) -> size_t;
+
 } // namespace Can
 } // namespace Services
 } // namespace SilKit
@@ -0,0 +1,114 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "gtest/gtest.h"
+
+#include "CanAcceptanceFilter.hpp"
+#include "ServiceConfigKeys.hpp"
+#include "YamlParser.hpp"
+
+namespace {
+
+using namespace SilKit::Core;
+using namespace SilKit::Services::Can;
+
+using SilKit::Config::CanAcceptanceFilter;
+
+auto MakeCanController(const std::string& participantName, EndpointId serviceId,
+                       const std::vector<CanAcceptanceFilter>& filters) -> ServiceDescriptor
+{
+    ServiceDescriptor serviceDescriptor{participantName, "CAN1", "CanController" + std::to_string(serviceId),
+                                        serviceId};
+    serviceDescriptor.SetServiceType(ServiceType::Controller);
+    serviceDescriptor.SetNetworkType(SilKit::Config::NetworkType::CAN);
+    serviceDescriptor.SetSupplementalDataItem(Discovery::controllerType, Discovery::controllerTypeCan);
+    if (!filters.empty())
+    {
+        serviceDescriptor.SetSupplementalDataItem(Discovery::supplKeyCanControllerAcceptanceFilters,
+                                                  SilKit::Config::Serialize(filters));
+    }
+    return serviceDescriptor;
+}
+
+auto MakeFrame(uint32_t canId) -> WireCanFrameEvent
+{
+    WireCanFrameEvent frameEvent{};
+    frameEvent.frame.canId = canId;
+    return frameEvent;
+}
+
+TEST(Test_CanAcceptanceFilter, frame_is_accepted_if_any_filter_matches)
+{
+    const std::vector<CanAcceptanceFilter> filters{{0x100, 0x7F0}, {0x200, 0x7FF}};
+
+    EXPECT_TRUE(IsAcceptedByFilters(filters, 0x100));
+    EXPECT_TRUE(IsAcceptedByFilters(filters, 0x10F));
+    EXPECT_TRUE(IsAcceptedByFilters(filters, 0x200));
+    EXPECT_FALSE(IsAcceptedByFilters(filters, 0x110));
+    EXPECT_FALSE(IsAcceptedByFilters(filters, 0x201));
+
+    EXPECT_TRUE(IsAcceptedByFilters({}, 0x123));
+}
+
+TEST(Test_CanAcceptanceFilter, remote_filter_is_the_union_of_the_controllers_of_the_participant)
+{
+    RemoteCanAcceptanceFilters remoteFilters;
+    EXPECT_EQ(remoteFilters.GetFrameFilter("CAN1", "P1"), nullptr);
+
+    EXPECT_TRUE(remoteFilters.AddService(MakeCanController("P1", 1, {{0x100, 0x7FF}})));
+    EXPECT_TRUE(remoteFilters.AddService(MakeCanController("P1", 2, {{0x200, 0x7FF}})));
+
+    auto filter = remoteFilters.GetFrameFilter("CAN1", "P1");
+    ASSERT_NE(filter, nullptr);
+    EXPECT_TRUE(filter(MakeFrame(0x100)));
+    EXPECT_TRUE(filter(MakeFrame(0x200)));
+    EXPECT_FALSE(filter(MakeFrame(0x300)));
+
+    // other participants and networks are not affected
+    EXPECT_EQ(remoteFilters.GetFrameFilter("CAN1", "P2"), nullptr);
+    EXPECT_EQ(remoteFilters.GetFrameFilter("CAN2", "P1"), nullptr);
+
+    EXPECT_TRUE(remoteFilters.RemoveService(MakeCanController("P1", 2, {{0x200, 0x7FF}})));
+    filter = remoteFilters.GetFrameFilter("CAN1", "P1");
+    ASSERT_NE(filter, nullptr);
+    EXPECT_FALSE(filter(MakeFrame(0x200)));
+
+    EXPECT_TRUE(remoteFilters.RemoveService(MakeCanController("P1", 1, {{0x100, 0x7FF}})));
+    EXPECT_EQ(remoteFilters.GetFrameFilter("CAN1", "P1"), nullptr);
+}
+
+TEST(Test_CanAcceptanceFilter, controller_without_filters_accepts_all_frames)
+{
+    RemoteCanAcceptanceFilters remoteFilters;
+    EXPECT_TRUE(remoteFilters.AddService(MakeCanController("P1", 1, {{0x100, 0x7FF}})));
+    EXPECT_TRUE(remoteFilters.AddService(MakeCanController("P1", 2, {})));
+
+    EXPECT_EQ(remoteFilters.GetFrameFilter("CAN1", "P1"), nullptr);
+}
+
+TEST(Test_CanAcceptanceFilter, network_simulator_accepts_all_frames)
+{
+    RemoteCanAcceptanceFilters remoteFilters;
+    EXPECT_TRUE(remoteFilters.AddService(MakeCanController("P1", 1, {{0x100, 0x7FF}})));
+
+    ServiceDescriptor linkDescriptor{"P1", "CAN1", "CAN1", 0};
+    linkDescriptor.SetServiceType(ServiceType::Link);
+    linkDescriptor.SetNetworkType(SilKit::Config::NetworkType::CAN);
+    EXPECT_TRUE(remoteFilters.AddService(linkDescriptor));
+
+    EXPECT_EQ(remoteFilters.GetFrameFilter("CAN1", "P1"), nullptr);
+}
+
+TEST(Test_CanAcceptanceFilter, other_services_are_ignored)
+{
+    RemoteCanAcceptanceFilters remoteFilters;
+
+    ServiceDescriptor serviceDescriptor{"P1", "CAN1", "Publisher", 1};
+    serviceDescriptor.SetServiceType(ServiceType::Controller);
+    serviceDescriptor.SetSupplementalDataItem(Discovery::controllerType, Discovery::controllerTypeDataPublisher);
+    EXPECT_FALSE(remoteFilters.AddService(serviceDescriptor));
+    EXPECT_FALSE(remoteFilters.RemoveService(serviceDescriptor));
+}
+
+} // namespace
@@ -29,6 +29,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "NullConnectionParticipant.hpp"
 
 #include "CanController.hpp"
+#include "ServiceConfigKeys.hpp"
 
 namespace {
 using namespace SilKit::Core;
@@ -54,6 +55,11 @@ auto PrepareParticipantConfiguration() -> std::shared_ptr<SilKit::Config::Partic
     controllerWithNetworkCfg.network = "ConfigNet";
     mockConfig->canControllers.push_back(controllerWithNetworkCfg);
 
+    SilKit::Config::CanController controllerWithFiltersCfg;
+    controllerWithFiltersCfg.name = "ControllerWithFilters";
+    controllerWithFiltersCfg.acceptanceFilters.push_back({0x100, 0x700});
+    mockConfig->canControllers.push_back(controllerWithFiltersCfg);
+
     return mockConfig;
 }
 
@@ -89,4 +95,22 @@ TEST(Test_CanControllerConfig, create_controller_configured_with_network)
     EXPECT_EQ(serviceDescr.GetNetworkName(), expectedNetworkName);
 }
 
+TEST(Test_CanControllerConfig, acceptance_filters_are_announced_in_the_service_descriptor)
+{
+    auto&& config = PrepareParticipantConfiguration();
+
+    auto participant = SilKit::Core::CreateNullConnectionParticipantImpl(config, "TestParticipant");
+
+    std::string filters;
+    auto controllerWithFilters = dynamic_cast<CanController*>(
+        participant->CreateCanController("ControllerWithFilters", "TestNetwork"));
+    EXPECT_TRUE(controllerWithFilters->GetServiceDescriptor().GetSupplementalDataItem(
+        SilKit::Core::Discovery::supplKeyCanControllerAcceptanceFilters, filters));
+
+    auto controllerWithoutFilters = dynamic_cast<CanController*>(
+        participant->CreateCanController("ControllerWithNetwork", "TestNetwork"));
+    EXPECT_FALSE(controllerWithoutFilters->GetServiceDescriptor().GetSupplementalDataItem(
+        SilKit::Core::Discovery::supplKeyCanControllerAcceptanceFilters, filters));
+}
+
 } // anonymous namespace
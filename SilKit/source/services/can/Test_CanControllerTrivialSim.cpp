@@ -208,6 +208,41 @@ TEST(Test_CanControllerTrivialSim, receive_can_message_rx_filter2)
     canController.ReceiveMsg(&canControllerPlaceholder, testFrameEvent);
 }
 
+TEST(Test_CanControllerTrivialSim, receive_can_message_acceptance_filter)
+{
+    using namespace std::placeholders;
+
+    ServiceDescriptor senderDescriptor{};
+    senderDescriptor.SetParticipantNameAndComputeId("canControllerPlaceholder");
+    senderDescriptor.SetServiceId(17);
+
+    MockParticipant mockParticipant;
+    CanControllerCallbacks callbackProvider;
+
+    SilKit::Config::CanController cfg;
+    cfg.acceptanceFilters.push_back({0x100, 0x700});
+    CanController canController(&mockParticipant, cfg, mockParticipant.GetTimeProvider());
+    canController.AddFrameHandler(std::bind(&CanControllerCallbacks::FrameHandler, &callbackProvider, _1, _2));
+    canController.Start();
+
+    WireCanFrameEvent acceptedFrameEvent{};
+    acceptedFrameEvent.frame.canId = 0x123;
+    acceptedFrameEvent.direction = SilKit::Services::TransmitDirection::RX;
+
+    WireCanFrameEvent rejectedFrameEvent{};
+    rejectedFrameEvent.frame.canId = 0x223;
+    rejectedFrameEvent.direction = SilKit::Services::TransmitDirection::RX;
+
+    EXPECT_CALL(callbackProvider, FrameHandler(&canController, ToCanFrameEvent(acceptedFrameEvent))).Times(1);
+    EXPECT_CALL(callbackProvider, FrameHandler(&canController, ToCanFrameEvent(rejectedFrameEvent))).Times(0);
+
+    SilKit::Config::CanController placeholderCfg;
+    CanController canControllerPlaceholder(&mockParticipant, placeholderCfg, mockParticipant.GetTimeProvider());
+    canControllerPlaceholder.SetServiceDescriptor(senderDescriptor);
+    canController.ReceiveMsg(&canControllerPlaceholder, acceptedFrameEvent);
+    canController.ReceiveMsg(&canControllerPlaceholder, rejectedFrameEvent);
+}
+
 TEST(Test_CanControllerTrivialSim, receive_can_message_tx_filter1)
 {
     using namespace std::placeholders;
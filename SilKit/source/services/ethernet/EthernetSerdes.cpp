@@ -132,6 +132,13 @@ void Deserialize(MessageBuffer& buffer, EthernetSetMode& out)
     buffer >> out;
 }
 
+auto SerializedSizeOf(const WireEthernetFrameEvent& msg) -> size_t
+{
+    using SilKit::Core::SerializedSizeOf;
+    return SerializedSizeOf(msg.timestamp) + SerializedSizeOf(msg.frame.raw) + SerializedSizeOf(msg.direction)
+           + SerializedSizeOf(msg.userContext);
+}
+
 } // namespace Ethernet
 } // namespace Services
 } // namespace SilKit
@@ -40,6 +40,8 @@ void Deserialize(SilKit::Core::MessageBuffer& buffer, EthernetFrameTransmitEvent
 void Deserialize(SilKit::Core::MessageBuffer& buffer, EthernetStatus& out);
 void Deserialize(SilKit::Core::MessageBuffer& buffer, EthernetSetMode& out);
 
+auto SerializedSizeOf(const WireEthernetFrameEvent& msg) -> size_t;
+
 } // namespace Ethernet
 } // namespace Services
 } // namespace SilKit
@@ -367,6 +367,34 @@ void Deserialize(MessageBuffer& buffer, FlexrayPocStatusEvent& out)
     buffer >> out;
 }
 
+inline auto SerializedSizeOf(const WireFlexrayFrame& frame) -> size_t
+{
+    using SilKit::Core::SerializedSizeOf;
+    return SerializedSizeOf(frame.header.flags) + SerializedSizeOf(frame.header.frameId)
+           + SerializedSizeOf(frame.header.payloadLength) + SerializedSizeOf(frame.header.headerCrc)
+           + SerializedSizeOf(frame.header.cycleCount) + SerializedSizeOf(frame.payload);
+}
+
+auto SerializedSizeOf(const WireFlexrayFrameEvent& msg) -> size_t
+{
+    using SilKit::Core::SerializedSizeOf;
+    return SerializedSizeOf(msg.timestamp) + SerializedSizeOf(msg.channel) + SerializedSizeOf(msg.frame);
+}
+
+auto SerializedSizeOf(const WireFlexrayFrameTransmitEvent& msg) -> size_t
+{
+    using SilKit::Core::SerializedSizeOf;
+    return SerializedSizeOf(msg.timestamp) + SerializedSizeOf(msg.txBufferIndex) + SerializedSizeOf(msg.channel)
+           + SerializedSizeOf(msg.frame);
+}
+
+auto SerializedSizeOf(const WireFlexrayTxBufferUpdate& msg) -> size_t
+{
+    using SilKit::Core::SerializedSizeOf;
+    return SerializedSizeOf(msg.txBufferIndex) + SerializedSizeOf(msg.payloadDataValid)
+           + SerializedSizeOf(msg.payload);
+}
+
 } // namespace Flexray
 } // namespace Services
 } // namespace SilKit
@@ -52,6 +52,10 @@ void Deserialize(SilKit::Core::MessageBuffer& buffer, FlexrayTxBufferConfigUpdat
 void Deserialize(SilKit::Core::MessageBuffer& buffer, WireFlexrayTxBufferUpdate& out);
 void Deserialize(SilKit::Core::MessageBuffer& buffer, FlexrayPocStatusEvent& out);
 
+auto SerializedSizeOf(const WireFlexrayFrameEvent& msg) -> size_t;
+auto SerializedSizeOf(const WireFlexrayFrameTransmitEvent& msg) -> size_t;
+auto SerializedSizeOf(const WireFlexrayTxBufferUpdate& msg) -> size_t;
+
 } // namespace Flexray
 } // namespace Services
 } // namespace SilKit
@@ -22,6 +22,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #pragma once
 
 #include <atomic>
+#include <memory>
 
 #include "silkit/services/logging/ILogger.hpp"
 
@@ -29,17 +30,29 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "SilKitFmtFormatters.hpp"
 #include "fmt/format.h"
 
+namespace SilKit {
+namespace Core {
+class ServiceDescriptor;
+} // namespace Core
+} // namespace SilKit
+
 namespace SilKit {
 namespace Services {
 namespace Logging {
 
 
 class LoggerMessage;
+struct MessageTrace;
 
 struct ILoggerInternal : ILogger
 {
     virtual void ProcessLoggerMessage(const LoggerMessage& msg) = 0;
     virtual void LogReceivedMsg(const LogMsg& msg) = 0;
+    //! Logs a sent or received message at the trace level. The trace may be formatted and written asynchronously.
+    virtual void TraceMessage(MessageTrace trace) = 0;
+    //! Returns a shared copy of the descriptor, which is reused for all traces of the same service.
+    virtual auto InternServiceDescriptor(const Core::ServiceDescriptor& descriptor)
+        -> std::shared_ptr<const Core::ServiceDescriptor> = 0;
 };
 
 
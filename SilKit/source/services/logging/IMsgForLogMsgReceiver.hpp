@@ -31,7 +31,7 @@ namespace Services {
 namespace Logging {
 
 class IMsgForLogMsgReceiver
-    : public Core::IReceiver<LogMsg>
+    : public Core::IReceiver<LogMsg, LogMsgBatch>
     , public Core::ISender<>
 {
 };
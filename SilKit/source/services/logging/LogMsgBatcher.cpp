@@ -0,0 +1,139 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "LogMsgBatcher.hpp"
+
+#include <algorithm>
+
+#include "SetThreadName.hpp"
+
+
+namespace SilKit {
+namespace Services {
+namespace Logging {
+
+
+LogMsgBatcher::LogMsgBatcher(std::string loggerName, std::size_t capacity, std::size_t maxBatchSize,
+                             std::chrono::milliseconds flushInterval, Level flushLevel, BatchHandler batchHandler)
+    : _loggerName{std::move(loggerName)}
+    , _maxBatchSize{maxBatchSize}
+    , _flushInterval{flushInterval}
+    , _flushLevel{flushLevel}
+    , _batchHandler{std::move(batchHandler)}
+    , _queue{capacity}
+{
+    _thread = std::thread{[this] { Run(); }};
+}
+
+LogMsgBatcher::~LogMsgBatcher()
+{
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        _isStopping = true;
+    }
+    _cv.notify_one();
+
+    if (_thread.joinable())
+    {
+        _thread.join();
+    }
+}
+
+bool LogMsgBatcher::Push(LogMsg msg)
+{
+    const bool isFlushLevel = _flushLevel <= msg.level;
+
+    // counted before the push, such that the consumer never takes more messages from the count than were added
+    const auto queuedCount = _queuedCount.fetch_add(1, std::memory_order_relaxed) + 1;
+
+    if (!_queue.TryPush(msg))
+    {
+        _queuedCount.fetch_sub(1, std::memory_order_relaxed);
+        _droppedCount.fetch_add(1, std::memory_order_relaxed);
+        RequestFlush();
+        return false;
+    }
+
+    if (isFlushLevel || queuedCount >= _maxBatchSize)
+    {
+        RequestFlush();
+    }
+    return true;
+}
+
+void LogMsgBatcher::RequestFlush()
+{
+    // only the first producer takes the lock, until the background thread picks up the request
+    if (!_isFlushRequested.exchange(true))
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        _cv.notify_one();
+    }
+}
+
+void LogMsgBatcher::Run()
+{
+    try
+    {
+        SilKit::Util::SetThreadName("SK RemoteLog");
+
+        for (;;)
+        {
+            bool isStopping;
+            {
+                std::unique_lock<std::mutex> lock{_mutex};
+                _cv.wait_for(lock, _flushInterval, [this] { return _isFlushRequested.load() || _isStopping; });
+                isStopping = _isStopping;
+            }
+
+            _isFlushRequested.store(false);
+            Flush();
+
+            if (isStopping)
+            {
+                break;
+            }
+        }
+    }
+    catch (...)
+    {
+        // leaking an exception here can result in a hard crash
+    }
+}
+
+void LogMsgBatcher::Flush()
+{
+    LogMsg msg;
+    for (;;)
+    {
+        LogMsgBatch batch;
+        batch.loggerName = _loggerName;
+        batch.msgs.reserve(std::min(_queuedCount.load(std::memory_order_relaxed), _maxBatchSize));
+        while (batch.msgs.size() < _maxBatchSize && _queue.TryPop(msg))
+        {
+            batch.msgs.emplace_back(std::move(msg));
+        }
+        _queuedCount.fetch_sub(batch.msgs.size(), std::memory_order_relaxed);
+        batch.droppedCount = _droppedCount.exchange(0, std::memory_order_relaxed);
+
+        if (batch.msgs.empty() && batch.droppedCount == 0)
+        {
+            return;
+        }
+
+        try
+        {
+            _batchHandler(std::move(batch));
+        }
+        catch (...)
+        {
+            // ignore exceptions thrown while sending a single batch
+        }
+    }
+}
+
+
+} // namespace Logging
+} // namespace Services
+} // namespace SilKit
@@ -0,0 +1,87 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "LoggingDatatypesInternal.hpp"
+#include "MpscQueue.hpp"
+
+
+namespace SilKit {
+namespace Services {
+namespace Logging {
+
+
+//! \brief Collects the log messages for the remote sink and hands them to a background thread in batches.
+//!
+//! A batch is sent once the flush interval has elapsed, once the maximum batch size is queued, or immediately for
+//! messages with at least the flush level. If the queue is full, the log message is dropped and counted in the next
+//! batch.
+class LogMsgBatcher
+{
+public:
+    //! Sends a batch. Called on the background thread.
+    using BatchHandler = std::function<void(LogMsgBatch)>;
+
+public:
+    // ----------------------------------------
+    // Constructors and Destructor
+    LogMsgBatcher(std::string loggerName, std::size_t capacity, std::size_t maxBatchSize,
+                  std::chrono::milliseconds flushInterval, Level flushLevel, BatchHandler batchHandler);
+    LogMsgBatcher(const LogMsgBatcher&) = delete;
+    LogMsgBatcher& operator=(const LogMsgBatcher&) = delete;
+
+    //! Sends all queued log messages before the background thread is stopped.
+    ~LogMsgBatcher();
+
+public:
+    // ----------------------------------------
+    // Public Methods
+
+    //! May be called from any thread. Returns false if the log message was dropped, because the queue is full.
+    bool Push(LogMsg msg);
+
+private:
+    // ----------------------------------------
+    // Private Methods
+    void Run();
+    void Flush();
+    void RequestFlush();
+
+private:
+    // ----------------------------------------
+    // Private Members
+    std::string _loggerName;
+    std::size_t _maxBatchSize;
+    std::chrono::milliseconds _flushInterval;
+    Level _flushLevel;
+    BatchHandler _batchHandler;
+
+    Util::MpscQueue<LogMsg> _queue;
+    //! Number of queued log messages, counted by the producers (MpscQueue::Size is only exact for the consumer).
+    std::atomic<std::size_t> _queuedCount{0};
+    std::atomic<uint64_t> _droppedCount{0};
+
+    //! Set by a producer that wants the next batch sent immediately, reset by the background thread.
+    std::atomic<bool> _isFlushRequested{false};
+    std::mutex _mutex;
+    std::condition_variable _cv;
+    bool _isStopping{false};
+
+    std::thread _thread;
+};
+
+
+} // namespace Logging
+} // namespace Services
+} // namespace SilKit
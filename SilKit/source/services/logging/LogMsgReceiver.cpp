@@ -21,6 +21,8 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "LogMsgReceiver.hpp"
 
+#include "LogFunctions.hpp"
+
 namespace SilKit {
 namespace Services {
 namespace Logging {
@@ -37,6 +39,20 @@ void LogMsgReceiver::ReceiveMsg(const Core::IServiceEndpoint* /*from*/, const Lo
     _logger->LogReceivedMsg(msg);
 }
 
+void LogMsgReceiver::ReceiveMsg(const Core::IServiceEndpoint* /*from*/, const LogMsgBatch& msg)
+{
+    for (const auto& logMsg : msg.msgs)
+    {
+        _logger->LogReceivedMsg(logMsg);
+    }
+
+    if (msg.droppedCount != 0)
+    {
+        Logging::Warn(_logger, "{} log messages of participant {} were dropped, because its remote log queue was full",
+                      msg.droppedCount, msg.loggerName);
+    }
+}
+
 } // namespace Logging
 } // namespace Services
 } // namespace SilKit
@@ -40,6 +40,23 @@ void LogMsgSender::SendLogMsg(LogMsg&& msg)
     _participant->SendMsg(this, std::move(msg));
 }
 
+void LogMsgSender::SendLogMsgBatch(LogMsgBatch&& msg)
+{
+    // Receivers of older versions do not subscribe to batches
+    const auto numBatchReceivers = _participant->GetNumberOfRemoteReceivers(this, "LOGMSGBATCH");
+    if (numBatchReceivers >= _participant->GetNumberOfRemoteReceivers(this, "LOGMSG"))
+    {
+        _participant->SendMsg(this, std::move(msg));
+        return;
+    }
+
+    for (auto&& logMsg : msg.msgs)
+    {
+        logMsg.loggerName = msg.loggerName;
+        _participant->SendMsg(this, std::move(logMsg));
+    }
+}
+
 } // namespace Logging
 } // namespace Services
 } // namespace SilKit
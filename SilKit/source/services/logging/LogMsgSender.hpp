@@ -41,6 +41,8 @@ public:
 public:
     void SendLogMsg(const LogMsg& msg);
     void SendLogMsg(LogMsg&& msg);
+    //! Sends the log messages individually if any remote receiver is of a version without batches.
+    void SendLogMsgBatch(LogMsgBatch&& msg);
 
     // IServiceEndpoint
     inline void SetServiceDescriptor(const Core::ServiceDescriptor& serviceDescriptor) override;
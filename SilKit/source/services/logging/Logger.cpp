@@ -203,6 +203,9 @@ namespace Logging {
 
 
 namespace {
+// number of traced messages which may wait for the background thread, before further traces are dropped
+constexpr std::size_t traceQueueCapacity{8192};
+
 class SilKitRemoteSink : public spdlog::sinks::base_sink<spdlog::details::null_mutex>
 {
 public:
@@ -358,27 +361,78 @@ Logger::Logger(const std::string& participantName, Config::Logging config)
     {
         _loggerJson->flush_on(to_spdlog(_config.flushLevel));
     }
+
+    // Sent and received messages are traced on a background thread, which only writes to the local sinks. The remote
+    // sink sends via the connection of the participant, so traces for a remote sink are still logged synchronously.
+    const bool isRemoteTraceEnabled = nullptr != _loggerRemote && _loggerRemote->level() == Level::Trace;
+    if (GetLogLevel() == Level::Trace && !isRemoteTraceEnabled)
+    {
+        _traceQueue = std::make_unique<MessageTraceQueue>(
+            traceQueueCapacity, [this](const MessageTrace& trace) {
+                LoggerMessage lm{this, Level::Trace};
+                FormatMessageTrace(trace, lm);
+                LogToLocalSinks(trace.time, lm);
+            },
+            [this](uint64_t droppedCount) {
+                LoggerMessage lm{this, Level::Warn};
+                lm.FormatMessage("{} sent or received messages were not traced, because the trace queue was full",
+                                 droppedCount);
+                LogToLocalSinks(log_clock::now(), lm);
+            });
+    }
 }
 
 void Logger::ProcessLoggerMessage(const LoggerMessage& msg)
 {
     const auto now = log_clock::now();
+    LogToLocalSinks(now, msg);
+    if (nullptr != _loggerRemote)
+    {
+        _loggerRemote->Log(now, msg);
+    }
+}
+
+void Logger::LogToLocalSinks(log_clock::time_point logTime, const LoggerMessage& msg)
+{
     if (nullptr != _loggerJson)
     {
         JsonLogMessage myJsonMsg{msg.GetMsgString(), msg.GetKeyValues()};
 
-        _loggerJson->log(now, spdlog::source_loc{}, to_spdlog(msg.GetLevel()), fmt::format("{}", myJsonMsg));
+        _loggerJson->log(logTime, spdlog::source_loc{}, to_spdlog(msg.GetLevel()), fmt::format("{}", myJsonMsg));
     }
 
     if (nullptr != _loggerSimple)
     {
         SimpleLogMessage myMsg{msg.GetMsgString(), msg.GetKeyValues()};
-        _loggerSimple->log(now, spdlog::source_loc{}, to_spdlog(msg.GetLevel()), fmt::format("{}", myMsg));
+        _loggerSimple->log(logTime, spdlog::source_loc{}, to_spdlog(msg.GetLevel()), fmt::format("{}", myMsg));
     }
-    if (nullptr != _loggerRemote)
+}
+
+void Logger::TraceMessage(MessageTrace trace)
+{
+    if (nullptr != _traceQueue)
     {
-        _loggerRemote->Log(now, msg);
+        _traceQueue->Push(std::move(trace));
+        return;
+    }
+
+    LoggerMessage lm{this, Level::Trace};
+    FormatMessageTrace(trace, lm);
+    lm.Dispatch();
+}
+
+auto Logger::InternServiceDescriptor(const Core::ServiceDescriptor& descriptor)
+    -> std::shared_ptr<const Core::ServiceDescriptor>
+{
+    std::lock_guard<decltype(_serviceDescriptorsMutex)> lock{_serviceDescriptorsMutex};
+
+    auto& interned = _serviceDescriptors[descriptor.to_endpointAddress()];
+    // a participant rejoining under the same name may use the address for another service
+    if (interned == nullptr || *interned != descriptor || interned->GetServiceName() != descriptor.GetServiceName())
+    {
+        interned = std::make_shared<const Core::ServiceDescriptor>(descriptor);
     }
+    return interned;
 }
 
 void Logger::LogReceivedMsg(const LogMsg& msg)
@@ -21,13 +21,16 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #pragma once
 
+#include <map>
 #include <memory>
+#include <mutex>
 #include <functional>
 
 #include "silkit/services/logging/LoggingDatatypes.hpp"
 
 #include "ILoggerInternal.hpp"
 #include "LoggerMessage.hpp"
+#include "MessageTraceQueue.hpp"
 #include "Configuration.hpp"
 
 namespace spdlog {
@@ -161,6 +164,16 @@ public:
 
     void LogReceivedMsg(const LogMsg& msg) override;
 
+    void TraceMessage(MessageTrace trace) override;
+
+    auto InternServiceDescriptor(const Core::ServiceDescriptor& descriptor)
+        -> std::shared_ptr<const Core::ServiceDescriptor> override;
+
+private:
+    // ----------------------------------------
+    // Private methods
+    void LogToLocalSinks(log_clock::time_point logTime, const LoggerMessage& msg);
+
 private:
     // ----------------------------------------
     // Private members
@@ -169,6 +182,12 @@ private:
     std::shared_ptr<spdlog::logger> _loggerJson;
     std::shared_ptr<spdlog::logger> _loggerSimple;
     std::shared_ptr<RemoteLogger> _loggerRemote;
+
+    std::mutex _serviceDescriptorsMutex;
+    std::map<Core::EndpointAddress, std::shared_ptr<const Core::ServiceDescriptor>> _serviceDescriptors;
+
+    // NB: must be destroyed before the loggers, because the queued traces are written to them
+    std::unique_ptr<MessageTraceQueue> _traceQueue;
 };
 
 } // namespace Logging
@@ -54,6 +54,29 @@ inline MessageBuffer& operator>>(MessageBuffer& buffer, LogMsg& msg)
     return buffer;
 }
 
+// The entries of a batch are serialized without their logger name, which is part of the batch
+inline MessageBuffer& operator<<(MessageBuffer& buffer, const LogMsgBatch& msg)
+{
+    buffer << msg.loggerName << msg.droppedCount << static_cast<uint32_t>(msg.msgs.size());
+    for (const auto& entry : msg.msgs)
+    {
+        buffer << entry.level << entry.time << entry.source << entry.payload << entry.keyValues;
+    }
+    return buffer;
+}
+inline MessageBuffer& operator>>(MessageBuffer& buffer, LogMsgBatch& msg)
+{
+    uint32_t numMsgs{0};
+    buffer >> msg.loggerName >> msg.droppedCount >> numMsgs;
+    msg.msgs.resize(numMsgs);
+    for (auto& entry : msg.msgs)
+    {
+        entry.loggerName = msg.loggerName;
+        buffer >> entry.level >> entry.time >> entry.source >> entry.payload >> entry.keyValues;
+    }
+    return buffer;
+}
+
 
 void Serialize(MessageBuffer& buffer, const LogMsg& msg)
 {
@@ -65,6 +88,16 @@ void Deserialize(MessageBuffer& buffer, LogMsg& out)
 {
     buffer >> out;
 }
+
+void Serialize(MessageBuffer& buffer, const LogMsgBatch& msg)
+{
+    buffer << msg;
+}
+
+void Deserialize(MessageBuffer& buffer, LogMsgBatch& out)
+{
+    buffer >> out;
+}
 } // namespace Logging
 } // namespace Services
 } // namespace SilKit
@@ -31,6 +31,9 @@ namespace Logging {
 void Serialize(SilKit::Core::MessageBuffer& buffer, const LogMsg& msg);
 void Deserialize(SilKit::Core::MessageBuffer& buffer, LogMsg& out);
 
+void Serialize(SilKit::Core::MessageBuffer& buffer, const LogMsgBatch& msg);
+void Deserialize(SilKit::Core::MessageBuffer& buffer, LogMsgBatch& out);
+
 } // namespace Logging
 } // namespace Services
 } // namespace SilKit
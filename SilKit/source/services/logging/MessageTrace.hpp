@@ -0,0 +1,254 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "LoggingDatatypesInternal.hpp"
+#include "LoggerMessage.hpp"
+#include "ServiceDescriptor.hpp"
+
+#include "fmt/format.h"
+
+
+namespace SilKit {
+namespace Services {
+namespace Logging {
+
+
+//! \brief A copy of a traced message, which is formatted when the trace is written.
+//!
+//! Messages of up to InlineSize bytes are stored in place, so capturing them only costs the copy of the message
+//! itself. Larger messages are copied to the heap.
+class TracedMessage
+{
+public:
+    static constexpr std::size_t InlineSize{128};
+
+public:
+    // ----------------------------------------
+    // Constructors and Destructor
+    TracedMessage() = default;
+    template <typename MsgT>
+    explicit TracedMessage(const MsgT& msg);
+    TracedMessage(TracedMessage&& other) noexcept;
+    TracedMessage& operator=(TracedMessage&& other) noexcept;
+    ~TracedMessage();
+
+public:
+    // ----------------------------------------
+    // Public Methods
+
+    //! Formats the message with fmt. Must not be called on an empty TracedMessage.
+    auto Format() const -> std::string;
+
+    explicit operator bool() const;
+
+private:
+    // ----------------------------------------
+    // Private Types
+    struct Operations
+    {
+        std::string (*format)(const void* storage);
+        //! Move-constructs the message in the target storage and destroys it in the source storage.
+        void (*relocate)(void* source, void* target);
+        void (*destroy)(void* storage);
+    };
+
+    template <typename MsgT>
+    struct IsStoredInline
+        : std::integral_constant<bool, sizeof(MsgT) <= InlineSize && alignof(MsgT) <= alignof(std::max_align_t)
+                                           && std::is_nothrow_move_constructible<MsgT>::value>
+    {
+    };
+
+    template <typename MsgT, bool = IsStoredInline<MsgT>::value>
+    struct OperationsFor;
+
+private:
+    // ----------------------------------------
+    // Private Methods
+    void Reset();
+
+private:
+    // ----------------------------------------
+    // Private Members
+    const Operations* _operations{nullptr};
+    //! Holds the message itself, or a pointer to the message on the heap.
+    typename std::aligned_storage<InlineSize, alignof(std::max_align_t)>::type _storage;
+};
+
+//! \brief A sent or received message, which is captured for tracing.
+//!
+//! Capturing copies the message, but not the descriptors of the services, which are interned by the logger (see
+//! ILoggerInternal::InternServiceDescriptor). Formatting them into a LoggerMessage is deferred until the trace is
+//! written to the sinks.
+struct MessageTrace
+{
+    enum class Direction
+    {
+        Send,
+        Receive
+    };
+
+    Direction direction{Direction::Send};
+    log_clock::time_point time;
+    std::shared_ptr<const Core::ServiceDescriptor> service;
+    //! The descriptor of the sending service, null for sent messages.
+    std::shared_ptr<const Core::ServiceDescriptor> from;
+    //! The virtual time of the message, or duration::min() if the message has no timestamp.
+    std::chrono::nanoseconds virtualTime{std::chrono::nanoseconds::duration::min()};
+    TracedMessage message;
+};
+
+//! Fills the LoggerMessage (which must have the trace level) with the captured message.
+inline void FormatMessageTrace(const MessageTrace& trace, LoggerMessage& lm);
+
+// ================================================================================
+//  Inline Implementations
+// ================================================================================
+
+template <typename MsgT>
+struct TracedMessage::OperationsFor<MsgT, true>
+{
+    static std::string Format(const void* storage)
+    {
+        return fmt::format("{}", *static_cast<const MsgT*>(storage));
+    }
+
+    static void Relocate(void* source, void* target)
+    {
+        new (target) MsgT(std::move(*static_cast<MsgT*>(source)));
+        static_cast<MsgT*>(source)->~MsgT();
+    }
+
+    static void Destroy(void* storage)
+    {
+        static_cast<MsgT*>(storage)->~MsgT();
+    }
+
+    static const Operations operations;
+};
+
+template <typename MsgT>
+const TracedMessage::Operations TracedMessage::OperationsFor<MsgT, true>::operations{&Format, &Relocate, &Destroy};
+
+template <typename MsgT>
+struct TracedMessage::OperationsFor<MsgT, false>
+{
+    static std::string Format(const void* storage)
+    {
+        return fmt::format("{}", **static_cast<const MsgT* const*>(storage));
+    }
+
+    static void Relocate(void* source, void* target)
+    {
+        new (target) MsgT*{*static_cast<MsgT**>(source)};
+    }
+
+    static void Destroy(void* storage)
+    {
+        delete *static_cast<MsgT**>(storage);
+    }
+
+    static const Operations operations;
+};
+
+template <typename MsgT>
+const TracedMessage::Operations TracedMessage::OperationsFor<MsgT, false>::operations{&Format, &Relocate, &Destroy};
+
+template <typename MsgT>
+TracedMessage::TracedMessage(const MsgT& msg)
+{
+    if (IsStoredInline<MsgT>::value)
+    {
+        new (&_storage) MsgT(msg);
+    }
+    else
+    {
+        new (&_storage) MsgT*{new MsgT(msg)};
+    }
+    _operations = &OperationsFor<MsgT>::operations;
+}
+
+inline TracedMessage::TracedMessage(TracedMessage&& other) noexcept
+{
+    *this = std::move(other);
+}
+
+inline TracedMessage& TracedMessage::operator=(TracedMessage&& other) noexcept
+{
+    if (this != &other)
+    {
+        Reset();
+        if (other._operations != nullptr)
+        {
+            other._operations->relocate(&other._storage, &_storage);
+            _operations = other._operations;
+            other._operations = nullptr;
+        }
+    }
+    return *this;
+}
+
+inline TracedMessage::~TracedMessage()
+{
+    Reset();
+}
+
+inline auto TracedMessage::Format() const -> std::string
+{
+    return _operations->format(&_storage);
+}
+
+inline TracedMessage::operator bool() const
+{
+    return _operations != nullptr;
+}
+
+inline void TracedMessage::Reset()
+{
+    if (_operations != nullptr)
+    {
+        _operations->destroy(&_storage);
+        _operations = nullptr;
+    }
+}
+
+void FormatMessageTrace(const MessageTrace& trace, LoggerMessage& lm)
+{
+    if (trace.direction == MessageTrace::Direction::Receive)
+    {
+        lm.SetMessage("Recv message");
+        lm.SetKeyValue(*trace.service);
+        lm.SetKeyValue(Keys::from, trace.from->GetParticipantName());
+    }
+    else
+    {
+        lm.SetMessage("Send message");
+        lm.SetKeyValue(*trace.service);
+    }
+
+    if (trace.message)
+    {
+        lm.SetKeyValue(Keys::msg, trace.message.Format());
+    }
+
+    if (trace.virtualTime != std::chrono::nanoseconds::duration::min())
+    {
+        lm.FormatKeyValue(Keys::virtualTimeNS, "{}", trace.virtualTime.count());
+    }
+}
+
+
+} // namespace Logging
+} // namespace Services
+} // namespace SilKit
@@ -0,0 +1,115 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "MessageTraceQueue.hpp"
+
+#include "SetThreadName.hpp"
+
+
+namespace SilKit {
+namespace Services {
+namespace Logging {
+
+
+MessageTraceQueue::MessageTraceQueue(std::size_t capacity, TraceHandler traceHandler, DroppedHandler droppedHandler)
+    : _traceHandler{std::move(traceHandler)}
+    , _droppedHandler{std::move(droppedHandler)}
+    , _queue{capacity}
+{
+    _thread = std::thread{[this] { Run(); }};
+}
+
+MessageTraceQueue::~MessageTraceQueue()
+{
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        _isStopping = true;
+    }
+    _cv.notify_one();
+
+    if (_thread.joinable())
+    {
+        _thread.join();
+    }
+}
+
+bool MessageTraceQueue::Push(MessageTrace trace)
+{
+    if (!_queue.TryPush(trace))
+    {
+        _droppedCount.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    // pairs with the fence in Run: either the background thread sees the new trace, or this thread sees it waiting
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (_isWaiting.load(std::memory_order_relaxed) && _isWaiting.exchange(false))
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        _cv.notify_one();
+    }
+    return true;
+}
+
+void MessageTraceQueue::Run()
+{
+    try
+    {
+        SilKit::Util::SetThreadName("SK Tracing");
+
+        for (;;)
+        {
+            Drain();
+
+            _isWaiting.store(true, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (_queue.Front() != nullptr)
+            {
+                _isWaiting.store(false, std::memory_order_relaxed);
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock{_mutex};
+            _cv.wait(lock, [this] { return !_isWaiting.load() || _isStopping; });
+            if (_isStopping)
+            {
+                break;
+            }
+        }
+
+        // the producers must not push after the destructor was called, so this writes the last traces
+        Drain();
+    }
+    catch (...)
+    {
+        // leaking an exception here can result in a hard crash
+    }
+}
+
+void MessageTraceQueue::Drain()
+{
+    MessageTrace trace;
+    while (_queue.TryPop(trace))
+    {
+        try
+        {
+            _traceHandler(trace);
+        }
+        catch (...)
+        {
+            // ignore exceptions thrown while formatting a single trace
+        }
+    }
+
+    const auto droppedCount = _droppedCount.exchange(0, std::memory_order_relaxed);
+    if (droppedCount != 0 && _droppedHandler)
+    {
+        _droppedHandler(droppedCount);
+    }
+}
+
+
+} // namespace Logging
+} // namespace Services
+} // namespace SilKit
@@ -0,0 +1,79 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#include "MessageTrace.hpp"
+#include "MpscQueue.hpp"
+
+
+namespace SilKit {
+namespace Services {
+namespace Logging {
+
+
+//! \brief Hands message traces over to a background thread, which formats and writes them.
+//!
+//! Push only moves the trace into a bounded lock-free queue, so tracing does not block the threads sending and
+//! receiving messages on formatting or on the I/O of the sinks. If the queue is full, the trace is dropped.
+class MessageTraceQueue
+{
+public:
+    //! Formats and writes a trace. Called on the background thread.
+    using TraceHandler = std::function<void(const MessageTrace&)>;
+    //! Reports the number of traces dropped since the last report. Called on the background thread.
+    using DroppedHandler = std::function<void(uint64_t)>;
+
+public:
+    // ----------------------------------------
+    // Constructors and Destructor
+    MessageTraceQueue(std::size_t capacity, TraceHandler traceHandler, DroppedHandler droppedHandler);
+    MessageTraceQueue(const MessageTraceQueue&) = delete;
+    MessageTraceQueue& operator=(const MessageTraceQueue&) = delete;
+
+    //! Writes all queued traces before the background thread is stopped.
+    ~MessageTraceQueue();
+
+public:
+    // ----------------------------------------
+    // Public Methods
+
+    //! May be called from any thread. Returns false if the trace was dropped, because the queue is full.
+    bool Push(MessageTrace trace);
+
+private:
+    // ----------------------------------------
+    // Private Methods
+    void Run();
+    void Drain();
+
+private:
+    // ----------------------------------------
+    // Private Members
+    TraceHandler _traceHandler;
+    DroppedHandler _droppedHandler;
+
+    Util::MpscQueue<MessageTrace> _queue;
+    std::atomic<uint64_t> _droppedCount{0};
+
+    //! Set by the background thread before it waits for new traces, reset by the producer that wakes it up.
+    std::atomic<bool> _isWaiting{false};
+    std::mutex _mutex;
+    std::condition_variable _cv;
+    bool _isStopping{false};
+
+    std::thread _thread;
+};
+
+
+} // namespace Logging
+} // namespace Services
+} // namespace SilKit
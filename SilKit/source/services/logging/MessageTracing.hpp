@@ -22,6 +22,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #pragma once
 
 #include "LoggerMessage.hpp"
+#include "MessageTrace.hpp"
 #include "IServiceEndpoint.hpp"
 #include "ServiceDescriptor.hpp"
 #include "traits/SilKitMsgTraits.hpp"
@@ -48,24 +49,29 @@ std::chrono::nanoseconds GetTimestamp(MsgT& /*msg*/,
 
 
 
+template <class SilKitMessageT>
+auto MakeMessageTrace(Logging::ILoggerInternal* logger, Logging::MessageTrace::Direction direction,
+                      const Core::IServiceEndpoint* addr, const SilKitMessageT& msg) -> Logging::MessageTrace
+{
+    Logging::MessageTrace trace;
+    trace.direction = direction;
+    trace.time = Logging::log_clock::now();
+    trace.service = logger->InternServiceDescriptor(addr->GetServiceDescriptor());
+    trace.virtualTime = GetTimestamp(msg);
+    // the message is copied, formatting it is left to the logger
+    trace.message = Logging::TracedMessage{msg};
+    return trace;
+}
+
 template <class SilKitMessageT>
 void TraceRx(Logging::ILoggerInternal* logger, const Core::IServiceEndpoint* addr, const SilKitMessageT& msg,
              const Core::ServiceDescriptor& from)
 {
     if (logger->GetLogLevel() == Logging::Level::Trace)
     {
-        Logging::LoggerMessage lm{logger, Logging::Level::Trace};
-        lm.SetMessage("Recv message");
-        lm.SetKeyValue(addr->GetServiceDescriptor());
-        lm.SetKeyValue(Logging::Keys::from, from.GetParticipantName());
-        lm.FormatKeyValue(Logging::Keys::msg, "{}", msg);
-
-        auto virtualTimeStamp = GetTimestamp(msg);
-        if (virtualTimeStamp != std::chrono::nanoseconds::duration::min())
-        {
-            lm.FormatKeyValue(Logging::Keys::virtualTimeNS, "{}", virtualTimeStamp.count());
-        }
-    lm.Dispatch();
+        auto trace = MakeMessageTrace(logger, Logging::MessageTrace::Direction::Receive, addr, msg);
+        trace.from = logger->InternServiceDescriptor(from);
+        logger->TraceMessage(std::move(trace));
     }
 }
 
@@ -74,17 +80,7 @@ void TraceTx(Logging::ILoggerInternal* logger, const Core::IServiceEndpoint* add
 {
     if (logger->GetLogLevel() == Logging::Level::Trace)
     {
-        Logging::LoggerMessage lm{logger, Logging::Level::Trace};
-        lm.SetMessage("Send message");
-        lm.SetKeyValue(addr->GetServiceDescriptor());
-        lm.FormatKeyValue(Logging::Keys::msg, "{}", msg);
-
-        auto virtualTimeStamp = GetTimestamp(msg);
-        if (virtualTimeStamp != std::chrono::nanoseconds::duration::min())
-        {
-                lm.FormatKeyValue(Logging::Keys::virtualTimeNS, "{}", virtualTimeStamp.count());
-        }
-        lm.Dispatch();
+        logger->TraceMessage(MakeMessageTrace(logger, Logging::MessageTrace::Direction::Send, addr, msg));
     }
 }
 
@@ -94,5 +90,15 @@ inline void TraceTx(Logging::ILoggerInternal* /*logger*/, Core::IServiceEndpoint
 
 inline void TraceRx(Logging::ILoggerInternal* /*logger*/, Core::IServiceEndpoint* /*addr*/, Logging::LogMsg&& /*msg*/) {}
 inline void TraceTx(Logging::ILoggerInternal* /*logger*/, Core::IServiceEndpoint* /*addr*/, Logging::LogMsg&& /*msg*/) {}
+
+// Batches are sent periodically, tracing them would add a log message to every following batch
+inline void TraceRx(Logging::ILoggerInternal* /*logger*/, const Core::IServiceEndpoint* /*addr*/,
+                    const Logging::LogMsgBatch& /*msg*/, const Core::ServiceDescriptor& /*from*/)
+{
+}
+inline void TraceTx(Logging::ILoggerInternal* /*logger*/, const Core::IServiceEndpoint* /*addr*/,
+                    const Logging::LogMsgBatch& /*msg*/)
+{
+}
 } // namespace Services
 } // namespace SilKit
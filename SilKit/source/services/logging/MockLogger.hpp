@@ -23,6 +23,7 @@
 
 
 #include "LoggerMessage.hpp"
+#include "MessageTrace.hpp"
 
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
@@ -50,6 +51,19 @@ public:
     MOCK_METHOD(void, ProcessLoggerMessage, (const LoggerMessage& msg), (override));
     MOCK_METHOD(void, LogReceivedMsg, (const LogMsg& msg), (override));
 
+    void TraceMessage(MessageTrace trace) override
+    {
+        LoggerMessage lm{this, Level::Trace};
+        FormatMessageTrace(trace, lm);
+        lm.Dispatch();
+    }
+
+    auto InternServiceDescriptor(const Core::ServiceDescriptor& descriptor)
+        -> std::shared_ptr<const Core::ServiceDescriptor> override
+    {
+        return std::make_shared<const Core::ServiceDescriptor>(descriptor);
+    }
+
     void Trace(const std::string& msg) override
     {
         Log(Level::Trace, msg);
@@ -98,11 +98,14 @@ MAKE_FORMATTER(SilKit::Services::Lin::LinWakeupPulse);
 MAKE_FORMATTER(SilKit::Services::Lin::WireLinControllerConfig);
 
 MAKE_FORMATTER(SilKit::Services::Logging::LogMsg);
+MAKE_FORMATTER(SilKit::Services::Logging::LogMsgBatch);
 
 MAKE_FORMATTER(VSilKit::MetricKind);
 MAKE_FORMATTER(VSilKit::MetricsUpdate);
+MAKE_FORMATTER(VSilKit::WireMetricsUpdate);
 
 MAKE_FORMATTER(SilKit::Services::Orchestration::NextSimTask);
+MAKE_FORMATTER(SilKit::Services::Orchestration::UserDataMessageCounts);
 MAKE_FORMATTER(SilKit::Services::Orchestration::ParticipantState);
 MAKE_FORMATTER(SilKit::Services::Orchestration::ParticipantStatus);
 MAKE_FORMATTER(SilKit::Services::Orchestration::SystemState);
@@ -112,6 +115,7 @@ MAKE_FORMATTER(SilKit::Services::Orchestration::WorkflowConfiguration);
 MAKE_FORMATTER(SilKit::Services::PubSub::WireDataMessageEvent);
 
 MAKE_FORMATTER(SilKit::Services::Rpc::FunctionCall);
+MAKE_FORMATTER(SilKit::Services::Rpc::FunctionCallBatch);
 MAKE_FORMATTER(SilKit::Services::Rpc::FunctionCallResponse);
 
 MAKE_FORMATTER(SilKit::Services::MatchingLabel::Kind);
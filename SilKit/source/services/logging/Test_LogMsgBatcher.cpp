@@ -0,0 +1,134 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include <future>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "LogMsgBatcher.hpp"
+
+namespace {
+
+using namespace std::chrono_literals;
+using namespace SilKit::Services::Logging;
+
+auto MakeLogMsg(Level level, const std::string& payload) -> LogMsg
+{
+    LogMsg msg{};
+    msg.level = level;
+    msg.payload = payload;
+    return msg;
+}
+
+TEST(Test_LogMsgBatcher, queued_messages_are_sent_in_one_batch_before_destruction)
+{
+    std::vector<LogMsgBatch> batches;
+
+    {
+        LogMsgBatcher batcher{"Participant1", 16, 16, 1h, Level::Off,
+                              [&batches](LogMsgBatch batch) { batches.push_back(std::move(batch)); }};
+
+        for (int index = 0; index < 8; ++index)
+        {
+            EXPECT_TRUE(batcher.Push(MakeLogMsg(Level::Info, std::to_string(index))));
+        }
+    }
+
+    ASSERT_EQ(batches.size(), 1u);
+    EXPECT_EQ(batches[0].loggerName, "Participant1");
+    EXPECT_EQ(batches[0].droppedCount, 0u);
+    ASSERT_EQ(batches[0].msgs.size(), 8u);
+    for (int index = 0; index < 8; ++index)
+    {
+        EXPECT_EQ(batches[0].msgs[index].payload, std::to_string(index));
+    }
+}
+
+TEST(Test_LogMsgBatcher, batch_is_sent_once_the_maximum_batch_size_is_queued)
+{
+    std::promise<LogMsgBatch> sent;
+    auto sentFuture = sent.get_future();
+    bool isFirst{true};
+
+    LogMsgBatcher batcher{"Participant1", 16, 4, 1h, Level::Off, [&sent, &isFirst](LogMsgBatch batch) {
+                              if (isFirst)
+                              {
+                                  isFirst = false;
+                                  sent.set_value(std::move(batch));
+                              }
+                          }};
+
+    for (int index = 0; index < 4; ++index)
+    {
+        EXPECT_TRUE(batcher.Push(MakeLogMsg(Level::Info, std::to_string(index))));
+    }
+
+    ASSERT_EQ(sentFuture.wait_for(10s), std::future_status::ready);
+    EXPECT_EQ(sentFuture.get().msgs.size(), 4u);
+}
+
+TEST(Test_LogMsgBatcher, messages_with_the_flush_level_are_sent_immediately)
+{
+    std::promise<LogMsgBatch> sent;
+    auto sentFuture = sent.get_future();
+    bool isFirst{true};
+
+    LogMsgBatcher batcher{"Participant1", 16, 16, 1h, Level::Warn, [&sent, &isFirst](LogMsgBatch batch) {
+                              if (isFirst)
+                              {
+                                  isFirst = false;
+                                  sent.set_value(std::move(batch));
+                              }
+                          }};
+
+    EXPECT_TRUE(batcher.Push(MakeLogMsg(Level::Info, "info")));
+    EXPECT_TRUE(batcher.Push(MakeLogMsg(Level::Warn, "warn")));
+
+    ASSERT_EQ(sentFuture.wait_for(10s), std::future_status::ready);
+    auto batch = sentFuture.get();
+    ASSERT_EQ(batch.msgs.size(), 2u);
+    EXPECT_EQ(batch.msgs[0].payload, "info");
+    EXPECT_EQ(batch.msgs[1].payload, "warn");
+}
+
+TEST(Test_LogMsgBatcher, messages_pushed_to_a_full_queue_are_dropped_and_counted)
+{
+    std::promise<void> started;
+    std::promise<void> release;
+    auto released = release.get_future().share();
+    bool isFirst{true};
+    size_t sentCount{0};
+    uint64_t droppedCount{0};
+
+    {
+        LogMsgBatcher batcher{"Participant1", 4, 16, 1h, Level::Error, [&, released](LogMsgBatch batch) {
+                                  if (isFirst)
+                                  {
+                                      isFirst = false;
+                                      started.set_value();
+                                      released.wait();
+                                  }
+                                  sentCount += batch.msgs.size();
+                                  droppedCount += batch.droppedCount;
+                              }};
+
+        // the background thread blocks in sending the first batch, so the queue fills up
+        ASSERT_TRUE(batcher.Push(MakeLogMsg(Level::Error, "first")));
+        started.get_future().wait();
+
+        for (int index = 0; index < 6; ++index)
+        {
+            EXPECT_EQ(batcher.Push(MakeLogMsg(Level::Info, std::to_string(index))), index < 4);
+        }
+        release.set_value();
+    }
+
+    EXPECT_EQ(sentCount, 5u);
+    EXPECT_EQ(droppedCount, 2u);
+}
+
+} // anonymous namespace
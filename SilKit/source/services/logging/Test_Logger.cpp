@@ -61,6 +61,18 @@ public:
     {
         SendMsg_LogMsg(from, msg);
     }
+
+    MOCK_METHOD((void), SendMsg_LogMsgBatch, (const IServiceEndpoint*, LogMsgBatch));
+    void SendMsg(const IServiceEndpoint* from, Services::Logging::LogMsgBatch&& msg) override
+    {
+        SendMsg_LogMsgBatch(from, msg);
+    }
+    void SendMsg(const IServiceEndpoint* from, const Services::Logging::LogMsgBatch& msg) override
+    {
+        SendMsg_LogMsgBatch(from, msg);
+    }
+
+    MOCK_METHOD(size_t, GetNumberOfRemoteReceivers, (const IServiceEndpoint*, const std::string&), (override));
 };
 
 
@@ -110,6 +122,61 @@ TEST(Test_Logger, send_log_message_with_sender)
     logMsgSender.SendLogMsg(msg);
 }
 
+auto MakeLogMsgBatch(const std::string& loggerName) -> LogMsgBatch
+{
+    LogMsgBatch batch;
+    batch.loggerName = loggerName;
+    for (const auto level : {Level::Info, Level::Warn})
+    {
+        LogMsg msg{};
+        msg.level = level;
+        msg.payload = "some payload";
+        batch.msgs.push_back(msg);
+    }
+    return batch;
+}
+
+TEST(Test_Logger, send_log_message_batch_with_sender)
+{
+    ServiceDescriptor controllerAddress{"P1", "N1", "C2", 8};
+    NiceMock<MockParticipant> mockParticipant;
+    LogMsgSender logMsgSender(&mockParticipant);
+    logMsgSender.SetServiceDescriptor(controllerAddress);
+
+    ON_CALL(mockParticipant, GetNumberOfRemoteReceivers(_, "LOGMSG")).WillByDefault(Return(2));
+    ON_CALL(mockParticipant, GetNumberOfRemoteReceivers(_, "LOGMSGBATCH")).WillByDefault(Return(2));
+
+    auto batch = MakeLogMsgBatch("Logger");
+    EXPECT_CALL(mockParticipant, SendMsg_LogMsgBatch(&logMsgSender, batch)).Times(1);
+    EXPECT_CALL(mockParticipant, SendMsg_LogMsg(_, _)).Times(0);
+
+    logMsgSender.SendLogMsgBatch(MakeLogMsgBatch("Logger"));
+}
+
+TEST(Test_Logger, send_log_message_batch_individually_if_a_receiver_does_not_receive_batches)
+{
+    ServiceDescriptor controllerAddress{"P1", "N1", "C2", 8};
+    NiceMock<MockParticipant> mockParticipant;
+    LogMsgSender logMsgSender(&mockParticipant);
+    logMsgSender.SetServiceDescriptor(controllerAddress);
+
+    ON_CALL(mockParticipant, GetNumberOfRemoteReceivers(_, "LOGMSG")).WillByDefault(Return(2));
+    ON_CALL(mockParticipant, GetNumberOfRemoteReceivers(_, "LOGMSGBATCH")).WillByDefault(Return(1));
+
+    EXPECT_CALL(mockParticipant, SendMsg_LogMsgBatch(_, _)).Times(0);
+    {
+        InSequence sequence;
+        EXPECT_CALL(mockParticipant,
+                    SendMsg_LogMsg(&logMsgSender, ALogMsgWith("Logger", Level::Info, "some payload")))
+            .Times(1);
+        EXPECT_CALL(mockParticipant,
+                    SendMsg_LogMsg(&logMsgSender, ALogMsgWith("Logger", Level::Warn, "some payload")))
+            .Times(1);
+    }
+
+    logMsgSender.SendLogMsgBatch(MakeLogMsgBatch("Logger"));
+}
+
 TEST(Test_Logger, send_log_message_from_logger)
 {
     std::string loggerName{"ParticipantAndLogger"};
@@ -214,4 +281,47 @@ TEST(Test_Logger, send_loggermessage_from_logger)
     lm2.Dispatch();
 }
 
+TEST(Test_Logger, traced_message_is_sent_to_remote_sink)
+{
+    std::string loggerName{"ParticipantAndLogger"};
+
+    Config::Logging config;
+    auto sink = Config::Sink{};
+    sink.level = Level::Trace;
+    sink.type = Config::Sink::Type::Remote;
+
+    config.sinks.push_back(sink);
+
+    Logger logger{loggerName, config};
+
+    ServiceDescriptor controllerAddress{"P1", "N1", "C2", 8};
+    MockParticipant mockParticipant;
+    LogMsgSender logMsgSender(&mockParticipant);
+    logMsgSender.SetServiceDescriptor(controllerAddress);
+
+    logger.RegisterRemoteLogging([&logMsgSender](LogMsg logMsg) { logMsgSender.SendLogMsg(std::move(logMsg)); });
+
+    EXPECT_CALL(mockParticipant, SendMsg_LogMsg(&logMsgSender, ALogMsgWith(loggerName, Level::Trace, "Send message")))
+        .Times(1);
+
+    MessageTrace trace;
+    trace.service = logger.InternServiceDescriptor(controllerAddress);
+    trace.message = TracedMessage{std::string{"payload"}};
+    logger.TraceMessage(std::move(trace));
+}
+
+TEST(Test_Logger, traces_of_the_same_service_share_the_descriptor)
+{
+    Logger logger{"ParticipantAndLogger", Config::Logging{}};
+
+    const auto interned = logger.InternServiceDescriptor(ServiceDescriptor{"P1", "N1", "C1", 5});
+    EXPECT_EQ(logger.InternServiceDescriptor(ServiceDescriptor{"P1", "N1", "C1", 5}), interned);
+    EXPECT_EQ(*interned, (ServiceDescriptor{"P1", "N1", "C1", 5}));
+
+    // another service under the same address replaces the interned descriptor
+    const auto replaced = logger.InternServiceDescriptor(ServiceDescriptor{"P1", "N1", "C2", 5});
+    EXPECT_NE(replaced, interned);
+    EXPECT_EQ(replaced->GetServiceName(), "C2");
+}
+
 } // anonymous namespace
@@ -39,3 +39,24 @@ TEST(Test_LoggingSerdes, LoggingSerdes)
     Deserialize(buffer, out);
     ASSERT_EQ(in, out);
 }
+
+TEST(Test_LoggingSerdes, LogMsgBatch_entries_get_the_logger_name_of_the_batch)
+{
+    SilKit::Core::MessageBuffer buffer;
+    SilKit::Services::Logging::LogMsgBatch in, out;
+    in.loggerName = "Participant1";
+    in.droppedCount = 3;
+    for (int i = 0; i < 2; ++i)
+    {
+        SilKit::Services::Logging::LogMsg msg{};
+        msg.loggerName = in.loggerName;
+        msg.level = SilKit::Services::Logging::Level::Info;
+        msg.payload = "Message " + std::to_string(i);
+        msg.keyValues = {{"key", "value"}};
+        in.msgs.push_back(msg);
+    }
+
+    Serialize(buffer, in);
+    Deserialize(buffer, out);
+    ASSERT_EQ(in, out);
+}
@@ -0,0 +1,190 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include "MessageTraceQueue.hpp"
+#include "MockLogger.hpp"
+
+namespace {
+
+using namespace std::chrono_literals;
+using namespace SilKit::Services::Logging;
+
+using SilKit::Core::ServiceDescriptor;
+
+using testing::NiceMock;
+
+//! Too large to be stored inline by TracedMessage
+struct LargeMessage
+{
+    std::string text;
+    char padding[TracedMessage::InlineSize]{};
+};
+
+std::ostream& operator<<(std::ostream& out, const LargeMessage& msg)
+{
+    return out << msg.text;
+}
+
+} // anonymous namespace
+
+template <>
+struct fmt::formatter<LargeMessage> : fmt::ostream_formatter
+{
+};
+
+namespace {
+
+auto MakeTrace(const std::string& text) -> MessageTrace
+{
+    MessageTrace trace;
+    trace.message = TracedMessage{text};
+    return trace;
+}
+
+TEST(Test_MessageTraceQueue, traces_are_handled_in_push_order_on_another_thread)
+{
+    std::mutex mutex;
+    std::vector<std::string> handled;
+    std::vector<std::thread::id> threadIds;
+
+    {
+        MessageTraceQueue queue{
+            16,
+            [&](const MessageTrace& trace) {
+                std::lock_guard<std::mutex> lock{mutex};
+                handled.push_back(trace.message.Format());
+                threadIds.push_back(std::this_thread::get_id());
+            },
+            {}};
+
+        for (int index = 0; index < 10; ++index)
+        {
+            EXPECT_TRUE(queue.Push(MakeTrace(std::to_string(index))));
+            // give the background thread a chance to wait for the next trace
+            std::this_thread::sleep_for(1ms);
+        }
+    }
+
+    ASSERT_EQ(handled.size(), 10u);
+    for (int index = 0; index < 10; ++index)
+    {
+        EXPECT_EQ(handled[index], std::to_string(index));
+        EXPECT_NE(threadIds[index], std::this_thread::get_id());
+    }
+}
+
+TEST(Test_MessageTraceQueue, queued_traces_are_handled_before_destruction)
+{
+    std::promise<void> release;
+    auto released = release.get_future().share();
+    std::vector<std::string> handled;
+
+    {
+        MessageTraceQueue queue{16,
+                                [&handled, released](const MessageTrace& trace) {
+                                    released.wait();
+                                    handled.push_back(trace.message.Format());
+                                },
+                                {}};
+
+        for (int index = 0; index < 8; ++index)
+        {
+            EXPECT_TRUE(queue.Push(MakeTrace(std::to_string(index))));
+        }
+        release.set_value();
+    }
+
+    EXPECT_EQ(handled.size(), 8u);
+}
+
+TEST(Test_MessageTraceQueue, traces_pushed_to_a_full_queue_are_dropped_and_reported)
+{
+    std::promise<void> started;
+    std::promise<void> release;
+    auto released = release.get_future().share();
+    bool isFirst{true};
+    size_t handledCount{0};
+    uint64_t droppedCount{0};
+
+    {
+        MessageTraceQueue queue{4,
+                                [&, released](const MessageTrace&) {
+                                    if (isFirst)
+                                    {
+                                        isFirst = false;
+                                        started.set_value();
+                                        released.wait();
+                                    }
+                                    ++handledCount;
+                                },
+                                [&droppedCount](uint64_t count) { droppedCount += count; }};
+
+        // the background thread blocks in the first trace, so the queue fills up
+        ASSERT_TRUE(queue.Push(MakeTrace("first")));
+        started.get_future().wait();
+
+        for (int index = 0; index < 6; ++index)
+        {
+            EXPECT_EQ(queue.Push(MakeTrace(std::to_string(index))), index < 4);
+        }
+        release.set_value();
+    }
+
+    EXPECT_EQ(handledCount, 5u);
+    EXPECT_EQ(droppedCount, 2u);
+}
+
+TEST(Test_MessageTraceQueue, received_message_is_formatted_with_sender_and_virtual_time)
+{
+    NiceMock<MockLogger> logger;
+
+    auto trace = MakeTrace("payload");
+    trace.direction = MessageTrace::Direction::Receive;
+    trace.service = std::make_shared<const ServiceDescriptor>(ServiceDescriptor{"P1", "N1", "C1", 5});
+    trace.from = std::make_shared<const ServiceDescriptor>(ServiceDescriptor{"P2", "N1", "C2", 7});
+    trace.virtualTime = 42ns;
+
+    LoggerMessage lm{&logger, Level::Trace};
+    FormatMessageTrace(trace, lm);
+
+    EXPECT_EQ(lm.GetMsgString(), "Recv message");
+    const auto& keyValues = lm.GetKeyValues();
+    EXPECT_NE(std::find(keyValues.begin(), keyValues.end(), std::make_pair(Keys::from, std::string{"P2"})),
+              keyValues.end());
+    EXPECT_NE(std::find(keyValues.begin(), keyValues.end(), std::make_pair(Keys::msg, std::string{"payload"})),
+              keyValues.end());
+    EXPECT_NE(std::find(keyValues.begin(), keyValues.end(), std::make_pair(Keys::virtualTimeNS, std::string{"42"})),
+              keyValues.end());
+}
+
+TEST(Test_MessageTraceQueue, traced_messages_are_moved_with_the_trace_regardless_of_their_size)
+{
+    std::vector<std::string> handled;
+
+    {
+        MessageTraceQueue queue{
+            16, [&](const MessageTrace& trace) { handled.push_back(trace.message.Format()); }, {}};
+
+        MessageTrace smallTrace;
+        smallTrace.message = TracedMessage{std::string{"small"}};
+        EXPECT_TRUE(queue.Push(std::move(smallTrace)));
+
+        MessageTrace largeTrace;
+        largeTrace.message = TracedMessage{LargeMessage{"large"}};
+        EXPECT_TRUE(queue.Push(std::move(largeTrace)));
+    }
+
+    EXPECT_EQ(handled, (std::vector<std::string>{"small", "large"}));
+}
+
+} // anonymous namespace
@@ -0,0 +1,123 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "HdrHistogram.hpp"
+
+#include <algorithm>
+
+
+namespace {
+
+auto FloorLog2(uint64_t value) -> unsigned
+{
+    unsigned result{0};
+    for (unsigned shift = 32; shift != 0; shift /= 2)
+    {
+        if (value >= (uint64_t{1} << shift))
+        {
+            value >>= shift;
+            result += shift;
+        }
+    }
+    return result;
+}
+
+} // namespace
+
+
+namespace VSilKit {
+
+
+constexpr unsigned HdrHistogram::SubBucketBits;
+constexpr size_t HdrHistogram::SubBucketHalfCount;
+constexpr size_t HdrHistogram::BucketCount;
+
+
+void HdrHistogram::Record(uint64_t value)
+{
+    _counts[BucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+
+    auto maximum = _maximum.load(std::memory_order_relaxed);
+    while (value > maximum && !_maximum.compare_exchange_weak(maximum, value, std::memory_order_relaxed))
+    {
+    }
+}
+
+auto HdrHistogram::GetSnapshot() const -> MetricHistogram
+{
+    MetricHistogram snapshot;
+
+    for (const auto& count : _counts)
+    {
+        snapshot.count += count.load(std::memory_order_relaxed);
+    }
+
+    snapshot.maximum = _maximum.load(std::memory_order_relaxed);
+
+    if (snapshot.count == 0)
+    {
+        return snapshot;
+    }
+
+    // the number of values which must be less than or equal to the percentile (rounded up)
+    const auto rank = [&snapshot](const uint64_t perMille) {
+        return std::max<uint64_t>(1, (snapshot.count * perMille + 999) / 1000);
+    };
+
+    struct Target
+    {
+        uint64_t rank;
+        uint64_t* value;
+    };
+
+    const std::array<Target, 4> targets{{
+        {rank(500), &snapshot.p50},
+        {rank(900), &snapshot.p90},
+        {rank(990), &snapshot.p99},
+        {rank(999), &snapshot.p999},
+    }};
+
+    // values recorded after the count was taken only move the percentiles up, which is fine for a snapshot
+    size_t targetIndex{0};
+    uint64_t cumulativeCount{0};
+    for (size_t index = 0; index != BucketCount && targetIndex != targets.size(); ++index)
+    {
+        cumulativeCount += _counts[index].load(std::memory_order_relaxed);
+
+        while (targetIndex != targets.size() && cumulativeCount >= targets[targetIndex].rank)
+        {
+            *targets[targetIndex].value = std::min(BucketUpperBound(index), snapshot.maximum);
+            ++targetIndex;
+        }
+    }
+
+    return snapshot;
+}
+
+auto HdrHistogram::BucketIndex(uint64_t value) -> size_t
+{
+    if (value < (uint64_t{1} << SubBucketBits))
+    {
+        return static_cast<size_t>(value);
+    }
+
+    // the top SubBucketBits bits of the value select the sub-bucket, the position of the highest bit the bucket
+    const auto shift = FloorLog2(value) - SubBucketBits + 1;
+    return static_cast<size_t>(shift * SubBucketHalfCount + (value >> shift));
+}
+
+auto HdrHistogram::BucketUpperBound(size_t index) -> uint64_t
+{
+    if (index < (size_t{1} << SubBucketBits))
+    {
+        return static_cast<uint64_t>(index);
+    }
+
+    const auto shift = index / SubBucketHalfCount - 1;
+    const auto subBucket = static_cast<uint64_t>(index - shift * SubBucketHalfCount);
+    return (subBucket << shift) + ((uint64_t{1} << shift) - 1);
+}
+
+
+} // namespace VSilKit
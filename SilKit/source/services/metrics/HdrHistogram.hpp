@@ -0,0 +1,46 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "MetricsDatatypes.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+
+namespace VSilKit {
+
+
+//! Lock-free histogram of non-negative integer values with a fixed memory footprint, in the style of HdrHistogram.
+//!
+//! Values below 2^SubBucketBits are counted exactly. Larger values are counted in buckets whose width is 1/64 of their
+//! lower bound, i.e., reported percentiles are at most 1.6% above the actual value. The maximum is tracked exactly.
+class HdrHistogram
+{
+public:
+    static constexpr unsigned SubBucketBits = 7;
+    static constexpr size_t SubBucketHalfCount = size_t{1} << (SubBucketBits - 1);
+    static constexpr size_t BucketCount = (66 - SubBucketBits) * SubBucketHalfCount;
+
+public:
+    void Record(uint64_t value);
+
+    //! Count, percentiles, and maximum of all values recorded so far. May be called concurrently with Record.
+    auto GetSnapshot() const -> MetricHistogram;
+
+public:
+    static auto BucketIndex(uint64_t value) -> size_t;
+    //! The largest value which is counted in the bucket with the given index
+    static auto BucketUpperBound(size_t index) -> uint64_t;
+
+private:
+    std::array<std::atomic<uint64_t>, BucketCount> _counts{};
+    std::atomic<uint64_t> _maximum{0};
+};
+
+
+} // namespace VSilKit
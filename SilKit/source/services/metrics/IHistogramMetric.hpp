@@ -0,0 +1,19 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstdint>
+
+namespace VSilKit {
+
+//! Distribution of non-negative integer values (e.g., durations in nanoseconds), reported as percentiles
+struct IHistogramMetric
+{
+    virtual ~IHistogramMetric() = default;
+    //! May be called concurrently from multiple threads
+    virtual void Take(uint64_t value) = 0;
+};
+
+} // namespace VSilKit
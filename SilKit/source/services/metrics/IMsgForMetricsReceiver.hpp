@@ -15,7 +15,7 @@ namespace VSilKit {
 
 struct IMsgForMetricsReceiver
     : SilKit::Core::ISender<>
-    , SilKit::Core::IReceiver<MetricsUpdate>
+    , SilKit::Core::IReceiver<WireMetricsUpdate, MetricsUpdate>
 {
 };
 
@@ -14,7 +14,7 @@ namespace VSilKit {
 
 
 struct IMsgForMetricsSender
-    : SilKit::Core::ISender<MetricsUpdate>
+    : SilKit::Core::ISender<WireMetricsUpdate, MetricsUpdate>
     , SilKit::Core::IReceiver<>
 {
 };
@@ -8,6 +8,7 @@
 #include <chrono>
 
 #include "ICounterMetric.hpp"
+#include "IHistogramMetric.hpp"
 #include "IStatisticMetric.hpp"
 #include "IStringListMetric.hpp"
 #include "IMetricsManager.hpp"
@@ -18,6 +19,7 @@
 namespace SilKit {
 namespace Core {
 using VSilKit::ICounterMetric;
+using VSilKit::IHistogramMetric;
 using VSilKit::IStatisticMetric;
 using VSilKit::IStringListMetric;
 using VSilKit::IMetricsManager;
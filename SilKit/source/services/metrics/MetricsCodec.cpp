@@ -0,0 +1,219 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "MetricsCodec.hpp"
+
+#include <algorithm>
+
+
+namespace VSilKit {
+
+
+// MetricsEncoder
+
+auto MetricsEncoder::Encode(const MetricsUpdate& metricsUpdate) -> WireMetricsUpdate
+{
+    for (const auto& data : metricsUpdate.metrics)
+    {
+        const auto it = _ids.find(data.name);
+        if (it == _ids.end())
+        {
+            _ids.emplace(data.name, static_cast<MetricId>(_entries.size()));
+            _entries.emplace_back(Entry{data, true, true});
+            continue;
+        }
+
+        auto& entry = _entries[it->second];
+
+        if (entry.last.kind != data.kind)
+        {
+            // the MetricsManager never changes the kind of a metric, but the receivers must learn about it anyway
+            entry.announce = true;
+        }
+
+        if (entry.announce || !HasSameValue(entry.last, data))
+        {
+            entry.changed = true;
+        }
+
+        entry.last = data;
+    }
+
+    WireMetricsUpdate wireMetricsUpdate;
+
+    for (size_t index = 0; index != _entries.size(); ++index)
+    {
+        auto& entry = _entries[index];
+        const auto id = static_cast<MetricId>(index);
+        const auto& data = entry.last;
+
+        if (entry.announce)
+        {
+            wireMetricsUpdate.descriptors.emplace_back(WireMetricDescriptor{id, data.name, data.kind});
+            entry.announce = false;
+        }
+
+        if (!entry.changed)
+        {
+            continue;
+        }
+
+        entry.changed = false;
+
+        switch (data.kind)
+        {
+        case MetricKind::COUNTER:
+        {
+            auto& columns = wireMetricsUpdate.counters;
+            columns.ids.push_back(id);
+            columns.timestamps.push_back(data.timestamp);
+            columns.values.push_back(data.counter);
+            break;
+        }
+        case MetricKind::STATISTIC:
+        {
+            auto& columns = wireMetricsUpdate.statistics;
+            columns.ids.push_back(id);
+            columns.timestamps.push_back(data.timestamp);
+            columns.means.push_back(data.statistic.mean);
+            columns.stddevs.push_back(data.statistic.stddev);
+            columns.minimums.push_back(data.statistic.minimum);
+            columns.maximums.push_back(data.statistic.maximum);
+            break;
+        }
+        case MetricKind::STRING_LIST:
+        {
+            auto& columns = wireMetricsUpdate.stringLists;
+            columns.ids.push_back(id);
+            columns.timestamps.push_back(data.timestamp);
+            columns.values.push_back(data.stringList);
+            break;
+        }
+        case MetricKind::HISTOGRAM:
+        {
+            auto& columns = wireMetricsUpdate.histograms;
+            columns.ids.push_back(id);
+            columns.timestamps.push_back(data.timestamp);
+            columns.counts.push_back(data.histogram.count);
+            columns.p50s.push_back(data.histogram.p50);
+            columns.p90s.push_back(data.histogram.p90);
+            columns.p99s.push_back(data.histogram.p99);
+            columns.p999s.push_back(data.histogram.p999);
+            columns.maximums.push_back(data.histogram.maximum);
+            break;
+        }
+        default:
+            break;
+        }
+    }
+
+    return wireMetricsUpdate;
+}
+
+void MetricsEncoder::Reset()
+{
+    for (auto& entry : _entries)
+    {
+        entry.announce = true;
+        entry.changed = true;
+    }
+}
+
+
+// MetricsDecoder
+
+auto MetricsDecoder::Decode(const WireMetricsUpdate& wireMetricsUpdate) -> MetricsUpdate
+{
+    for (const auto& descriptor : wireMetricsUpdate.descriptors)
+    {
+        _descriptors[descriptor.id] = descriptor;
+    }
+
+    MetricsUpdate metricsUpdate;
+
+    const auto makeMetricData = [this, &metricsUpdate](const MetricId id, const MetricTimestamp timestamp,
+                                                       const MetricKind kind) -> MetricData* {
+        const auto it = _descriptors.find(id);
+        if (it == _descriptors.end() || it->second.kind != kind)
+        {
+            return nullptr;
+        }
+
+        metricsUpdate.metrics.emplace_back();
+
+        auto& data = metricsUpdate.metrics.back();
+        data.timestamp = timestamp;
+        data.name = it->second.name;
+        data.kind = kind;
+        return &data;
+    };
+
+    {
+        const auto& columns = wireMetricsUpdate.counters;
+        const auto count = std::min({columns.ids.size(), columns.timestamps.size(), columns.values.size()});
+
+        for (size_t index = 0; index != count; ++index)
+        {
+            if (auto* data = makeMetricData(columns.ids[index], columns.timestamps[index], MetricKind::COUNTER))
+            {
+                data->counter = columns.values[index];
+            }
+        }
+    }
+
+    {
+        const auto& columns = wireMetricsUpdate.statistics;
+        const auto count = std::min({columns.ids.size(), columns.timestamps.size(), columns.means.size(),
+                                     columns.stddevs.size(), columns.minimums.size(), columns.maximums.size()});
+
+        for (size_t index = 0; index != count; ++index)
+        {
+            if (auto* data = makeMetricData(columns.ids[index], columns.timestamps[index], MetricKind::STATISTIC))
+            {
+                data->statistic.mean = columns.means[index];
+                data->statistic.stddev = columns.stddevs[index];
+                data->statistic.minimum = columns.minimums[index];
+                data->statistic.maximum = columns.maximums[index];
+            }
+        }
+    }
+
+    {
+        const auto& columns = wireMetricsUpdate.stringLists;
+        const auto count = std::min({columns.ids.size(), columns.timestamps.size(), columns.values.size()});
+
+        for (size_t index = 0; index != count; ++index)
+        {
+            if (auto* data = makeMetricData(columns.ids[index], columns.timestamps[index], MetricKind::STRING_LIST))
+            {
+                data->stringList = columns.values[index];
+            }
+        }
+    }
+
+    {
+        const auto& columns = wireMetricsUpdate.histograms;
+        const auto count =
+            std::min({columns.ids.size(), columns.timestamps.size(), columns.counts.size(), columns.p50s.size(),
+                      columns.p90s.size(), columns.p99s.size(), columns.p999s.size(), columns.maximums.size()});
+
+        for (size_t index = 0; index != count; ++index)
+        {
+            if (auto* data = makeMetricData(columns.ids[index], columns.timestamps[index], MetricKind::HISTOGRAM))
+            {
+                data->histogram.count = columns.counts[index];
+                data->histogram.p50 = columns.p50s[index];
+                data->histogram.p90 = columns.p90s[index];
+                data->histogram.p99 = columns.p99s[index];
+                data->histogram.p999 = columns.p999s[index];
+                data->histogram.maximum = columns.maximums[index];
+            }
+        }
+    }
+
+    return metricsUpdate;
+}
+
+
+} // namespace VSilKit
@@ -0,0 +1,58 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "MetricsDatatypes.hpp"
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+
+namespace VSilKit {
+
+
+//! Encodes metrics updates of a single participant for sending over the wire.
+//!
+//! Every metric is assigned an id on its first occurrence, which is announced together with the name and kind of the
+//! metric. Afterwards, only the id is sent. Metrics whose value did not change since they were last encoded are
+//! omitted.
+class MetricsEncoder
+{
+public:
+    auto Encode(const MetricsUpdate& metricsUpdate) -> WireMetricsUpdate;
+
+    //! The next encoded update announces all known metrics again and contains their last values, e.g., for new
+    //! receivers which have not seen the previous updates.
+    void Reset();
+
+private:
+    struct Entry
+    {
+        MetricData last;
+        bool announce{true};
+        bool changed{true};
+    };
+
+private:
+    std::unordered_map<std::string, MetricId> _ids;
+    std::vector<Entry> _entries;
+};
+
+
+//! Decodes the metrics updates sent by a single participant's MetricsEncoder.
+//!
+//! Values of metrics which have not been announced yet are ignored.
+class MetricsDecoder
+{
+public:
+    auto Decode(const WireMetricsUpdate& wireMetricsUpdate) -> MetricsUpdate;
+
+private:
+    std::unordered_map<MetricId, WireMetricDescriptor> _descriptors;
+};
+
+
+} // namespace VSilKit
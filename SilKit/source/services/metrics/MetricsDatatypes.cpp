@@ -4,16 +4,35 @@
 
 #include "MetricsDatatypes.hpp"
 
+#include "StringHelpers.hpp"
+
+#include <cstdio>
+#include <cstdlib>
 #include <ostream>
+#include <sstream>
 #include <type_traits>
 
+#include "fmt/format.h"
+
 
 namespace VSilKit {
 
 
+auto operator==(const MetricStatistic& lhs, const MetricStatistic& rhs) -> bool
+{
+    return lhs.mean == rhs.mean && lhs.stddev == rhs.stddev && lhs.minimum == rhs.minimum
+           && lhs.maximum == rhs.maximum;
+}
+
+auto operator==(const MetricHistogram& lhs, const MetricHistogram& rhs) -> bool
+{
+    return lhs.count == rhs.count && lhs.p50 == rhs.p50 && lhs.p90 == rhs.p90 && lhs.p99 == rhs.p99
+           && lhs.p999 == rhs.p999 && lhs.maximum == rhs.maximum;
+}
+
 auto operator==(const MetricData& lhs, const MetricData& rhs) -> bool
 {
-    return lhs.timestamp == rhs.timestamp && lhs.name == rhs.name && lhs.kind == rhs.kind && lhs.value == rhs.value;
+    return lhs.timestamp == rhs.timestamp && lhs.name == rhs.name && HasSameValue(lhs, rhs);
 }
 
 auto operator==(const MetricsUpdate& lhs, const MetricsUpdate& rhs) -> bool
@@ -21,6 +40,192 @@ auto operator==(const MetricsUpdate& lhs, const MetricsUpdate& rhs) -> bool
     return lhs.metrics == rhs.metrics;
 }
 
+auto operator==(const WireMetricDescriptor& lhs, const WireMetricDescriptor& rhs) -> bool
+{
+    return lhs.id == rhs.id && lhs.name == rhs.name && lhs.kind == rhs.kind;
+}
+
+auto operator==(const WireMetricsUpdate& lhs, const WireMetricsUpdate& rhs) -> bool
+{
+    return lhs.descriptors == rhs.descriptors && lhs.counters.ids == rhs.counters.ids
+           && lhs.counters.timestamps == rhs.counters.timestamps && lhs.counters.values == rhs.counters.values
+           && lhs.statistics.ids == rhs.statistics.ids && lhs.statistics.timestamps == rhs.statistics.timestamps
+           && lhs.statistics.means == rhs.statistics.means && lhs.statistics.stddevs == rhs.statistics.stddevs
+           && lhs.statistics.minimums == rhs.statistics.minimums && lhs.statistics.maximums == rhs.statistics.maximums
+           && lhs.stringLists.ids == rhs.stringLists.ids && lhs.stringLists.timestamps == rhs.stringLists.timestamps
+           && lhs.stringLists.values == rhs.stringLists.values && lhs.histograms.ids == rhs.histograms.ids
+           && lhs.histograms.timestamps == rhs.histograms.timestamps && lhs.histograms.counts == rhs.histograms.counts
+           && lhs.histograms.p50s == rhs.histograms.p50s && lhs.histograms.p90s == rhs.histograms.p90s
+           && lhs.histograms.p99s == rhs.histograms.p99s && lhs.histograms.p999s == rhs.histograms.p999s
+           && lhs.histograms.maximums == rhs.histograms.maximums;
+}
+
+
+auto HasSameValue(const MetricData& lhs, const MetricData& rhs) -> bool
+{
+    if (lhs.kind != rhs.kind)
+    {
+        return false;
+    }
+
+    switch (lhs.kind)
+    {
+    case MetricKind::COUNTER:
+        return lhs.counter == rhs.counter;
+    case MetricKind::STATISTIC:
+        return lhs.statistic == rhs.statistic;
+    case MetricKind::STRING_LIST:
+        return lhs.stringList == rhs.stringList;
+    case MetricKind::HISTOGRAM:
+        return lhs.histogram == rhs.histogram;
+    default:
+        return false;
+    }
+}
+
+auto FormatMetricValue(const MetricData& metricData) -> std::string
+{
+    switch (metricData.kind)
+    {
+    case MetricKind::COUNTER:
+        return std::to_string(metricData.counter);
+    case MetricKind::STATISTIC:
+    {
+        const auto& statistic = metricData.statistic;
+        return fmt::format(R"([{},{},{},{}])", statistic.mean, statistic.stddev, statistic.minimum, statistic.maximum);
+    }
+    case MetricKind::STRING_LIST:
+    {
+        std::ostringstream os;
+        os << '[';
+
+        const char* separator = "";
+        for (const auto& string : metricData.stringList)
+        {
+            os << separator << '"' << SilKit::Util::EscapedJsonString{string} << '"';
+            separator = ",";
+        }
+
+        os << ']';
+        return os.str();
+    }
+    case MetricKind::HISTOGRAM:
+    {
+        const auto& histogram = metricData.histogram;
+        return fmt::format(R"({{"count":{},"p50":{},"p90":{},"p99":{},"p999":{},"max":{}}})", histogram.count,
+                           histogram.p50, histogram.p90, histogram.p99, histogram.p999, histogram.maximum);
+    }
+    default:
+        return "null";
+    }
+}
+
+
+namespace {
+
+// Parses a JSON array of strings, as formatted by FormatMetricValue
+bool ParseStringList(const std::string& value, std::vector<std::string>& stringList)
+{
+    auto it = value.begin();
+    if (it == value.end() || *it++ != '[')
+    {
+        return false;
+    }
+
+    std::vector<std::string> result;
+    while (it != value.end() && *it != ']')
+    {
+        if (!result.empty() && *it++ != ',')
+        {
+            return false;
+        }
+        if (it == value.end() || *it++ != '"')
+        {
+            return false;
+        }
+
+        std::string string;
+        while (it != value.end() && *it != '"')
+        {
+            auto ch = *it++;
+            if (ch == '\\' && it != value.end())
+            {
+                switch (*it++)
+                {
+                case 'b':
+                    ch = '\b';
+                    break;
+                case 't':
+                    ch = '\t';
+                    break;
+                case 'n':
+                    ch = '\n';
+                    break;
+                case 'f':
+                    ch = '\f';
+                    break;
+                case 'r':
+                    ch = '\r';
+                    break;
+                default:
+                    ch = *(it - 1);
+                    break;
+                }
+            }
+            string.push_back(ch);
+        }
+        if (it == value.end())
+        {
+            return false;
+        }
+
+        ++it;
+        result.emplace_back(std::move(string));
+    }
+    if (it == value.end())
+    {
+        return false;
+    }
+
+    stringList = std::move(result);
+    return true;
+}
+
+} // namespace
+
+void ParseMetricValue(MetricData& metricData, const std::string& value)
+{
+    switch (metricData.kind)
+    {
+    case MetricKind::COUNTER:
+    {
+        char* end{nullptr};
+        const auto counter = std::strtoull(value.c_str(), &end, 10);
+        if (!value.empty() && *end == '\0')
+        {
+            metricData.counter = counter;
+        }
+        break;
+    }
+    case MetricKind::STATISTIC:
+    {
+        MetricStatistic statistic;
+        if (std::sscanf(value.c_str(), "[%lf,%lf,%lf,%lf]", &statistic.mean, &statistic.stddev, &statistic.minimum,
+                        &statistic.maximum)
+            == 4)
+        {
+            metricData.statistic = statistic;
+        }
+        break;
+    }
+    case MetricKind::STRING_LIST:
+        ParseStringList(value, metricData.stringList);
+        break;
+    default:
+        break;
+    }
+}
+
 
 auto operator<<(std::ostream& os, const MetricKind& metricKind) -> std::ostream&
 {
@@ -32,6 +237,8 @@ auto operator<<(std::ostream& os, const MetricKind& metricKind) -> std::ostream&
         return os << "MetricKind::STATISTIC";
     case MetricKind::STRING_LIST:
         return os << "MetricKind::STRING_LIST";
+    case MetricKind::HISTOGRAM:
+        return os << "MetricKind::HISTOGRAM";
     default:
         return os << "MetricKind(" << static_cast<std::underlying_type_t<MetricKind>>(metricKind) << ")";
     }
@@ -40,7 +247,7 @@ auto operator<<(std::ostream& os, const MetricKind& metricKind) -> std::ostream&
 auto operator<<(std::ostream& os, const MetricData& metricData) -> std::ostream&
 {
     return os << "MetricData{timestamp=" << metricData.timestamp << ", name=" << metricData.name
-              << ", kind=" << metricData.kind << ", value=" << metricData.value << "}";
+              << ", kind=" << metricData.kind << ", value=" << FormatMetricValue(metricData) << "}";
 }
 
 auto operator<<(std::ostream& os, const MetricsUpdate& metricsUpdate) -> std::ostream&
@@ -58,5 +265,14 @@ auto operator<<(std::ostream& os, const MetricsUpdate& metricsUpdate) -> std::os
     return os;
 }
 
+auto operator<<(std::ostream& os, const WireMetricsUpdate& wireMetricsUpdate) -> std::ostream&
+{
+    return os << "WireMetricsUpdate{descriptors=" << wireMetricsUpdate.descriptors.size()
+              << ", counters=" << wireMetricsUpdate.counters.ids.size()
+              << ", statistics=" << wireMetricsUpdate.statistics.ids.size()
+              << ", stringLists=" << wireMetricsUpdate.stringLists.ids.size()
+              << ", histograms=" << wireMetricsUpdate.histograms.ids.size() << "}";
+}
+
 
 } // namespace VSilKit
@@ -23,6 +23,27 @@ enum struct MetricKind
     COUNTER,
     STATISTIC,
     STRING_LIST,
+    HISTOGRAM,
+};
+
+
+struct MetricStatistic
+{
+    double mean{0.0};
+    double stddev{0.0};
+    double minimum{0.0};
+    double maximum{0.0};
+};
+
+
+struct MetricHistogram
+{
+    uint64_t count{0};
+    uint64_t p50{0};
+    uint64_t p90{0};
+    uint64_t p99{0};
+    uint64_t p999{0};
+    uint64_t maximum{0};
 };
 
 
@@ -31,20 +52,109 @@ struct MetricData
     MetricTimestamp timestamp;
     std::string name;
     MetricKind kind;
-    std::string value;
+
+    //! Value of a COUNTER metric
+    uint64_t counter{0};
+    //! Value of a STATISTIC metric
+    MetricStatistic statistic{};
+    //! Value of a STRING_LIST metric
+    std::vector<std::string> stringList{};
+    //! Value of a HISTOGRAM metric
+    MetricHistogram histogram{};
 };
 
 
+//! Also sent over the wire to and by participants of older versions, with preformatted values, see MetricsSerdes
 struct MetricsUpdate
 {
     std::vector<MetricData> metrics;
 };
 
 
+//! Announces the name and kind of a metric, which is referenced only by its id afterwards
+struct WireMetricDescriptor
+{
+    MetricId id;
+    std::string name;
+    MetricKind kind;
+};
+
+
+struct WireCounterColumns
+{
+    std::vector<MetricId> ids;
+    std::vector<MetricTimestamp> timestamps;
+    std::vector<uint64_t> values;
+};
+
+
+struct WireStatisticColumns
+{
+    std::vector<MetricId> ids;
+    std::vector<MetricTimestamp> timestamps;
+    std::vector<double> means;
+    std::vector<double> stddevs;
+    std::vector<double> minimums;
+    std::vector<double> maximums;
+};
+
+
+struct WireHistogramColumns
+{
+    std::vector<MetricId> ids;
+    std::vector<MetricTimestamp> timestamps;
+    std::vector<uint64_t> counts;
+    std::vector<uint64_t> p50s;
+    std::vector<uint64_t> p90s;
+    std::vector<uint64_t> p99s;
+    std::vector<uint64_t> p999s;
+    std::vector<uint64_t> maximums;
+};
+
+
+struct WireStringListColumns
+{
+    std::vector<MetricId> ids;
+    std::vector<MetricTimestamp> timestamps;
+    std::vector<std::vector<std::string>> values;
+};
+
+
+//! Metrics update as sent over the wire, see MetricsEncoder and MetricsDecoder
+struct WireMetricsUpdate
+{
+    std::vector<WireMetricDescriptor> descriptors;
+    WireCounterColumns counters;
+    WireStatisticColumns statistics;
+    WireStringListColumns stringLists;
+    WireHistogramColumns histograms;
+};
+
+
+auto operator==(const MetricStatistic& lhs, const MetricStatistic& rhs) -> bool;
+
+auto operator==(const MetricHistogram& lhs, const MetricHistogram& rhs) -> bool;
+
 auto operator==(const MetricData& lhs, const MetricData& rhs) -> bool;
 
 auto operator==(const MetricsUpdate& lhs, const MetricsUpdate& rhs) -> bool;
 
+auto operator==(const WireMetricDescriptor& lhs, const WireMetricDescriptor& rhs) -> bool;
+
+auto operator==(const WireMetricsUpdate& lhs, const WireMetricsUpdate& rhs) -> bool;
+
+
+//! Returns true if both metrics have the same kind and the same value, ignoring name and timestamp
+auto HasSameValue(const MetricData& lhs, const MetricData& rhs) -> bool;
+
+//! Formats the value of the metric as JSON (number for counters, [mean,stddev,min,max] for statistics, string array
+//! for string lists, {"count":..,"p50":..,"p90":..,"p99":..,"p999":..,"max":..} for histograms)
+auto FormatMetricValue(const MetricData& metricData) -> std::string;
+
+//! Sets the value of the metric from its formatted value (see FormatMetricValue), as sent by participants of older
+//! versions. A malformed value leaves the value of the metric unchanged.
+void ParseMetricValue(MetricData& metricData, const std::string& value);
+
 
 auto operator<<(std::ostream& os, const MetricKind& metricKind) -> std::ostream&;
 
@@ -52,5 +162,7 @@ auto operator<<(std::ostream& os, const MetricData& metricData) -> std::ostream&
 
 auto operator<<(std::ostream& os, const MetricsUpdate& metricValue) -> std::ostream&;
 
+auto operator<<(std::ostream& os, const WireMetricsUpdate& wireMetricsUpdate) -> std::ostream&;
+
 
 } // namespace VSilKit
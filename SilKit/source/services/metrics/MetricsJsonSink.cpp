@@ -24,6 +24,8 @@ struct MetricKindString
             return ostream << "STATISTIC";
         case VSilKit::MetricKind::STRING_LIST:
             return ostream << "STRING_LIST";
+        case VSilKit::MetricKind::HISTOGRAM:
+            return ostream << "HISTOGRAM";
         default:
             return ostream << static_cast<std::underlying_type_t<VSilKit::MetricKind>>(self.kind);
         }
@@ -47,7 +49,7 @@ void MetricsJsonSink::Process(const std::string& origin, const MetricsUpdate& me
     {
         *_ostream << R"({"ts":)" << data.timestamp << R"(,"pn":")" << SilKit::Util::EscapedJsonString{origin}
                   << R"(","mn":")" << SilKit::Util::EscapedJsonString{data.name} << R"(","mk":")"
-                  << MetricKindString{data.kind} << R"(","mv":)" << data.value << R"(})" << '\n';
+                  << MetricKindString{data.kind} << R"(","mv":)" << FormatMetricValue(data) << R"(})" << '\n';
     }
 
     *_ostream << std::flush;
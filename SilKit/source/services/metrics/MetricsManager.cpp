@@ -5,6 +5,7 @@
 #include "MetricsManager.hpp"
 
 #include "Assert.hpp"
+#include "HdrHistogram.hpp"
 #include "MetricsProcessor.hpp"
 
 #include <string>
@@ -59,7 +60,7 @@ public: // ICounterMetric
 public: // MetricsManager::IMetric
     auto GetMetricKind() const -> MetricKind override;
     auto GetUpdateTime() const -> MetricTimePoint override;
-    auto FormatValue() const -> std::string override;
+    void WriteValue(MetricData &data) const override;
 
 private:
     MetricTimePoint _timestamp;
@@ -80,7 +81,7 @@ public: // IStatisticMetric
 public: // MetricsManager::IMetric
     auto GetMetricKind() const -> MetricKind override;
     auto GetUpdateTime() const -> MetricTimePoint override;
-    auto FormatValue() const -> std::string override;
+    void WriteValue(MetricData &data) const override;
 
 private:
     MetricTimePoint _timestamp;
@@ -109,7 +110,7 @@ public: // IStringListMetric
 public: // MetricsManager::IMetric
     auto GetMetricKind() const -> MetricKind override;
     auto GetUpdateTime() const -> MetricTimePoint override;
-    auto FormatValue() const -> std::string override;
+    void WriteValue(MetricData &data) const override;
 
 private:
     MetricTimePoint _timestamp;
@@ -117,6 +118,28 @@ private:
 };
 
 
+class MetricsManager::HistogramMetric
+    : public IHistogramMetric
+    , public IMetric
+{
+public:
+    HistogramMetric();
+
+public: // IHistogramMetric
+    void Take(uint64_t value) override;
+
+public: // MetricsManager::IMetric
+    auto GetMetricKind() const -> MetricKind override;
+    auto GetUpdateTime() const -> MetricTimePoint override;
+    void WriteValue(MetricData &data) const override;
+
+private:
+    // values are taken concurrently, unlike for the other metrics
+    std::atomic<MetricTimePoint> _timestamp{};
+    HdrHistogram _histogram;
+};
+
+
 MetricsManager::MetricsManager(std::string participantName, IMetricsProcessor &processor)
     : _participantName{std::move(participantName)}
     , _processor{&processor}
@@ -158,7 +181,7 @@ void MetricsManager::SubmitUpdates()
             data.timestamp = to_ns(timepoint);
             data.name = name;
             data.kind = metric->GetMetricKind();
-            data.value = metric->FormatValue();
+            metric->WriteValue(data);
 
             msg.metrics.emplace_back(std::move(data));
         }
@@ -190,6 +213,11 @@ auto MetricsManager::GetStringList(const std::string &name) -> IStringListMetric
     return &dynamic_cast<IStringListMetric &>(*GetOrCreateMetric(name, MetricKind::STRING_LIST));
 }
 
+auto MetricsManager::GetHistogram(const std::string &name) -> IHistogramMetric *
+{
+    return &dynamic_cast<IHistogramMetric &>(*GetOrCreateMetric(name, MetricKind::HISTOGRAM));
+}
+
 
 // MetricsManager
 
@@ -212,6 +240,9 @@ auto MetricsManager::GetOrCreateMetric(std::string name, MetricKind kind) -> IMe
         case MetricKind::STRING_LIST:
             it = _metrics.emplace(name, std::make_unique<StringListMetric>()).first;
             break;
+        case MetricKind::HISTOGRAM:
+            it = _metrics.emplace(name, std::make_unique<HistogramMetric>()).first;
+            break;
         default:
             throw SilKit::SilKitError{fmt::format("Invalid MetricKind ({})", kind)};
         }
@@ -254,9 +285,9 @@ auto MetricsManager::CounterMetric::GetUpdateTime() const -> MetricTimePoint
     return _timestamp;
 }
 
-auto MetricsManager::CounterMetric::FormatValue() const -> std::string
+void MetricsManager::CounterMetric::WriteValue(MetricData &data) const
 {
-    return std::to_string(_value);
+    data.counter = _value;
 }
 
 
@@ -289,9 +320,12 @@ auto MetricsManager::StatisticMetric::GetUpdateTime() const -> MetricTimePoint
     return _timestamp;
 }
 
-auto MetricsManager::StatisticMetric::FormatValue() const -> std::string
+void MetricsManager::StatisticMetric::WriteValue(MetricData &data) const
 {
-    return fmt::format(R"([{},{},{},{}])", _mean, std::sqrt(_variance), _minimum, _maximum);
+    data.statistic.mean = _mean;
+    data.statistic.stddev = std::sqrt(_variance);
+    data.statistic.minimum = _minimum;
+    data.statistic.maximum = _maximum;
 }
 
 
@@ -321,43 +355,36 @@ auto MetricsManager::StringListMetric::GetUpdateTime() const -> MetricTimePoint
     return _timestamp;
 }
 
-auto MetricsManager::StringListMetric::FormatValue() const -> std::string
+void MetricsManager::StringListMetric::WriteValue(MetricData &data) const
 {
-    std::string result;
-    const auto formatString = [](std::string &result, const std::string &string) {
-        result.push_back('"');
-        for (const char ch : string)
-        {
-            switch (ch)
-            {
-            case '\\':
-                result.push_back(ch);
-                result.push_back(ch);
-                break;
-            case '"':
-                result.push_back('\\');
-                result.push_back(ch);
-                break;
-            default:
-                result.push_back(ch);
-                break;
-            }
-        }
-        result.push_back('"');
-    };
+    data.stringList = _strings;
+}
 
-    result.push_back('[');
-    for (size_t index = 0; index != _strings.size(); ++index)
-    {
-        if (index != 0)
-        {
-            result.push_back(',');
-        }
-        formatString(result, _strings[index]);
-    }
-    result.push_back(']');
-    return result;
+
+
+// HistogramMetric
+
+MetricsManager::HistogramMetric::HistogramMetric() = default;
+
+void MetricsManager::HistogramMetric::Take(uint64_t value)
+{
+    _histogram.Record(value);
+    _timestamp.store(MetricClockNow(), std::memory_order_relaxed);
 }
 
+auto MetricsManager::HistogramMetric::GetMetricKind() const -> MetricKind
+{
+    return MetricKind::HISTOGRAM;
+}
+
+auto MetricsManager::HistogramMetric::GetUpdateTime() const -> MetricTimePoint
+{
+    return _timestamp.load(std::memory_order_relaxed);
+}
+
+void MetricsManager::HistogramMetric::WriteValue(MetricData &data) const
+{
+    data.histogram = _histogram.GetSnapshot();
+}
 
 } // namespace VSilKit
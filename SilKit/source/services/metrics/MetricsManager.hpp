@@ -40,12 +40,13 @@ private:
         virtual ~IMetric() = default;
         virtual auto GetMetricKind() const -> MetricKind = 0;
         virtual auto GetUpdateTime() const -> MetricTimePoint = 0;
-        virtual auto FormatValue() const -> std::string = 0;
+        virtual void WriteValue(MetricData& data) const = 0;
     };
 
     class CounterMetric;
     class StatisticMetric;
     class StringListMetric;
+    class HistogramMetric;
 
 public:
     MetricsManager(std::string participantName, IMetricsProcessor& processor);
@@ -57,6 +58,7 @@ public: // IMetricsManager
     auto GetCounter(const std::string& name) -> ICounterMetric* override;
     auto GetStatistic(const std::string& name) -> IStatisticMetric* override;
     auto GetStringList(const std::string& name) -> IStringListMetric* override;
+    auto GetHistogram(const std::string& name) -> IHistogramMetric* override;
 
 private:
     auto GetOrCreateMetric(std::string name, MetricKind kind) -> IMetric*;
@@ -5,6 +5,8 @@
 #include "MetricsReceiver.hpp"
 
 #include "LoggerMessage.hpp"
+#include "IServiceDiscovery.hpp"
+#include "ServiceConfigKeys.hpp"
 
 
 namespace Log = SilKit::Services::Logging;
@@ -13,17 +15,40 @@ namespace Log = SilKit::Services::Logging;
 namespace VSilKit {
 
 
-MetricsReceiver::MetricsReceiver(SilKit::Core::IParticipantInternal *, IMetricsReceiverListener &listener)
-    : _listener{&listener}
+MetricsReceiver::MetricsReceiver(SilKit::Core::IParticipantInternal *participant, IMetricsReceiverListener &listener)
+    : _participant{participant}
+    , _listener{&listener}
 {
     _serviceDescriptor.SetNetworkName("default");
 }
 
 
+void MetricsReceiver::RegisterServiceDiscovery()
+{
+    namespace Discovery = SilKit::Core::Discovery;
+
+    _participant->GetServiceDiscovery()->RegisterServiceDiscoveryHandler(
+        [this](Discovery::ServiceDiscoveryEvent::Type discoveryType,
+               const SilKit::Core::ServiceDescriptor &serviceDescriptor) {
+        std::string controllerType;
+        if (discoveryType != Discovery::ServiceDiscoveryEvent::Type::ServiceRemoved
+            || !serviceDescriptor.GetSupplementalDataItem(Discovery::controllerType, controllerType)
+            || controllerType != Discovery::controllerTypeMetricsSender)
+        {
+            return;
+        }
+
+        // a sender which rejoins under the same name starts over with its announcements
+        _decoders.erase(serviceDescriptor.GetParticipantName());
+    });
+}
+
+
 // IMsgForMetricsReceiver
 
 void MetricsReceiver::ReceiveMsg(const SilKit::Core::IServiceEndpoint *from, const VSilKit::MetricsUpdate &msg)
 {
+    // sent by participants of older versions, which do not encode the metrics
     if (_listener == nullptr)
     {
         return;
@@ -32,6 +57,24 @@ void MetricsReceiver::ReceiveMsg(const SilKit::Core::IServiceEndpoint *from, con
     _listener->OnMetricsUpdate(from->GetServiceDescriptor().GetParticipantName(), msg);
 }
 
+void MetricsReceiver::ReceiveMsg(const SilKit::Core::IServiceEndpoint *from, const VSilKit::WireMetricsUpdate &msg)
+{
+    if (_listener == nullptr)
+    {
+        return;
+    }
+
+    const auto &participantName = from->GetServiceDescriptor().GetParticipantName();
+
+    auto metricsUpdate = _decoders[participantName].Decode(msg);
+    if (metricsUpdate.metrics.empty())
+    {
+        return;
+    }
+
+    _listener->OnMetricsUpdate(participantName, metricsUpdate);
+}
+
 
 // IServiceEndpoint
 
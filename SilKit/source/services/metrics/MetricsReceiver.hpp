@@ -5,11 +5,15 @@
 #pragma once
 
 #include "IMsgForMetricsReceiver.hpp"
+#include "MetricsCodec.hpp"
 
 #include "LoggerMessage.hpp"
 #include "IServiceEndpoint.hpp"
 #include "IParticipantInternal.hpp"
 
+#include <string>
+#include <unordered_map>
+
 
 namespace VSilKit {
 
@@ -31,17 +35,23 @@ public:
     // NB: The first constructor argument is present to enable using the CreateController function template. It is
     //     allowed to be nullptr.
 
+    void RegisterServiceDiscovery();
+
 public: // IMsgForMetricsReceiver
     void ReceiveMsg(const SilKit::Core::IServiceEndpoint* from, const MetricsUpdate& msg) override;
+    void ReceiveMsg(const SilKit::Core::IServiceEndpoint* from, const WireMetricsUpdate& msg) override;
 
 public: // IServiceEndpoint
     void SetServiceDescriptor(const SilKit::Core::ServiceDescriptor& serviceDescriptor) override;
     auto GetServiceDescriptor() const -> const SilKit::Core::ServiceDescriptor& override;
 
 private:
+    SilKit::Core::IParticipantInternal* _participant{nullptr};
     IMetricsReceiverListener* _listener{nullptr};
 
     SilKit::Core::ServiceDescriptor _serviceDescriptor;
+
+    std::unordered_map<std::string, MetricsDecoder> _decoders;
 };
 
 
@@ -5,6 +5,11 @@
 #include "MetricsSender.hpp"
 
 #include "LoggerMessage.hpp"
+#include "IServiceDiscovery.hpp"
+#include "ServiceConfigKeys.hpp"
+
+#include <algorithm>
+#include <iterator>
 
 
 namespace Log = SilKit::Services::Logging;
@@ -21,11 +26,98 @@ MetricsSender::MetricsSender(SilKit::Core::IParticipantInternal *participant)
 }
 
 
+void MetricsSender::RegisterServiceDiscovery()
+{
+    namespace Discovery = SilKit::Core::Discovery;
+
+    _participant->GetServiceDiscovery()->RegisterServiceDiscoveryHandler(
+        [this](Discovery::ServiceDiscoveryEvent::Type discoveryType,
+               const SilKit::Core::ServiceDescriptor &serviceDescriptor) {
+        std::string controllerType;
+        if (!serviceDescriptor.GetSupplementalDataItem(Discovery::controllerType, controllerType)
+            || controllerType != Discovery::controllerTypeMetricsReceiver
+            || serviceDescriptor.GetParticipantName() == _participant->GetParticipantName())
+        {
+            return;
+        }
+
+        // a receiver which (re-)joined has not seen the announced metrics and values, even if a receiver of the
+        // same participant name was known before
+        std::lock_guard<decltype(_mutex)> lock{_mutex};
+        if (discoveryType == Discovery::ServiceDiscoveryEvent::Type::ServiceCreated)
+        {
+            _joinedReceiverNames.insert(serviceDescriptor.GetParticipantName());
+        }
+        else if (discoveryType == Discovery::ServiceDiscoveryEvent::Type::ServiceRemoved)
+        {
+            _joinedReceiverNames.erase(serviceDescriptor.GetParticipantName());
+        }
+    });
+}
+
+
 // IMetricsSender
 
 void MetricsSender::Send(const VSilKit::MetricsUpdate &msg)
 {
-    _participant->SendMsg(this, msg);
+    std::lock_guard<decltype(_mutex)> lock{_mutex};
+
+    const auto receiverNames = _participant->GetParticipantNamesOfRemoteReceivers(this, "WIREMETRICSUPDATE");
+
+    SendToReceiversOfOlderVersions(msg, receiverNames);
+
+    if (!_joinedReceiverNames.empty())
+    {
+        // re-announce once the joined receivers are subscribed, i.e., will actually get this update
+        size_t subscribedJoinedReceivers{0};
+        for (const auto &receiverName : receiverNames)
+        {
+            subscribedJoinedReceivers += _joinedReceiverNames.erase(receiverName);
+        }
+
+        if (subscribedJoinedReceivers != 0)
+        {
+            _encoder.Reset();
+        }
+    }
+
+    auto wireMsg = _encoder.Encode(msg);
+
+    if (wireMsg.descriptors.empty() && wireMsg.counters.ids.empty() && wireMsg.statistics.ids.empty()
+        && wireMsg.stringLists.ids.empty() && wireMsg.histograms.ids.empty())
+    {
+        return;
+    }
+
+    _participant->SendMsg(this, wireMsg);
+}
+
+void MetricsSender::SendToReceiversOfOlderVersions(const MetricsUpdate &msg,
+                                                    const std::vector<std::string> &wireReceiverNames)
+{
+    // receivers of older versions only subscribe to MetricsUpdate, all others subscribe to both
+    const auto receiverNames = _participant->GetParticipantNamesOfRemoteReceivers(this, "METRICSUPDATE");
+    if (receiverNames.size() <= wireReceiverNames.size())
+    {
+        return;
+    }
+
+    // older versions do not know histograms
+    MetricsUpdate olderMsg;
+    std::copy_if(msg.metrics.begin(), msg.metrics.end(), std::back_inserter(olderMsg.metrics),
+                 [](const MetricData &data) { return data.kind != MetricKind::HISTOGRAM; });
+    if (olderMsg.metrics.empty())
+    {
+        return;
+    }
+
+    for (const auto &receiverName : receiverNames)
+    {
+        if (std::find(wireReceiverNames.begin(), wireReceiverNames.end(), receiverName) == wireReceiverNames.end())
+        {
+            _participant->SendMsg(this, receiverName, olderMsg);
+        }
+    }
 }
 
 
@@ -5,11 +5,17 @@
 #pragma once
 
 #include "IMsgForMetricsSender.hpp"
+#include "MetricsCodec.hpp"
 
 #include "LoggerMessage.hpp"
 #include "IServiceEndpoint.hpp"
 #include "IParticipantInternal.hpp"
 
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
 
 namespace VSilKit {
 
@@ -25,6 +31,8 @@ public:
     // NB: The first constructor argument is present to enable using the CreateController function template. It is
     //     allowed to be nullptr.
 
+    void RegisterServiceDiscovery();
+
 public: // IMetricsSender
     void Send(const MetricsUpdate& msg) override;
 
@@ -32,11 +40,19 @@ public: // IServiceEndpoint
     void SetServiceDescriptor(const SilKit::Core::ServiceDescriptor& serviceDescriptor) override;
     auto GetServiceDescriptor() const -> const SilKit::Core::ServiceDescriptor& override;
 
+private:
+    void SendToReceiversOfOlderVersions(const MetricsUpdate& msg, const std::vector<std::string>& wireReceiverNames);
+
 private:
     SilKit::Core::IParticipantInternal* _participant{nullptr};
     SilKit::Services::Logging::ILogger* _logger{nullptr};
 
     SilKit::Core::ServiceDescriptor _serviceDescriptor;
+
+    std::mutex _mutex;
+    MetricsEncoder _encoder;
+    //! Participants whose MetricsReceiver was discovered, but which have not been sent the announcements yet
+    std::unordered_set<std::string> _joinedReceiverNames;
 };
 
 
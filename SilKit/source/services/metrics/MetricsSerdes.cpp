@@ -8,14 +8,76 @@
 namespace VSilKit {
 
 
+inline auto operator<<(SilKit::Core::MessageBuffer& buffer, const WireMetricDescriptor& msg)
+    -> SilKit::Core::MessageBuffer&
+{
+    return buffer << msg.id << msg.name << msg.kind;
+}
+
+inline auto operator>>(SilKit::Core::MessageBuffer& buffer, WireMetricDescriptor& out) -> SilKit::Core::MessageBuffer&
+{
+    return buffer >> out.id >> out.name >> out.kind;
+}
+
+inline auto operator<<(SilKit::Core::MessageBuffer& buffer, const WireCounterColumns& msg)
+    -> SilKit::Core::MessageBuffer&
+{
+    return buffer << msg.ids << msg.timestamps << msg.values;
+}
+
+inline auto operator>>(SilKit::Core::MessageBuffer& buffer, WireCounterColumns& out) -> SilKit::Core::MessageBuffer&
+{
+    return buffer >> out.ids >> out.timestamps >> out.values;
+}
+
+inline auto operator<<(SilKit::Core::MessageBuffer& buffer, const WireStatisticColumns& msg)
+    -> SilKit::Core::MessageBuffer&
+{
+    return buffer << msg.ids << msg.timestamps << msg.means << msg.stddevs << msg.minimums << msg.maximums;
+}
+
+inline auto operator>>(SilKit::Core::MessageBuffer& buffer, WireStatisticColumns& out) -> SilKit::Core::MessageBuffer&
+{
+    return buffer >> out.ids >> out.timestamps >> out.means >> out.stddevs >> out.minimums >> out.maximums;
+}
+
+inline auto operator<<(SilKit::Core::MessageBuffer& buffer, const WireStringListColumns& msg)
+    -> SilKit::Core::MessageBuffer&
+{
+    return buffer << msg.ids << msg.timestamps << msg.values;
+}
+
+inline auto operator>>(SilKit::Core::MessageBuffer& buffer, WireStringListColumns& out)
+    -> SilKit::Core::MessageBuffer&
+{
+    return buffer >> out.ids >> out.timestamps >> out.values;
+}
+
+inline auto operator<<(SilKit::Core::MessageBuffer& buffer, const WireHistogramColumns& msg)
+    -> SilKit::Core::MessageBuffer&
+{
+    return buffer << msg.ids << msg.timestamps << msg.counts << msg.p50s << msg.p90s << msg.p99s << msg.p999s
+                  << msg.maximums;
+}
+
+inline auto operator>>(SilKit::Core::MessageBuffer& buffer, WireHistogramColumns& out) -> SilKit::Core::MessageBuffer&
+{
+    return buffer >> out.ids >> out.timestamps >> out.counts >> out.p50s >> out.p90s >> out.p99s >> out.p999s
+           >> out.maximums;
+}
+
+// participants of older versions send and receive the values formatted as strings
 inline auto operator<<(SilKit::Core::MessageBuffer& buffer, const MetricData& msg) -> SilKit::Core::MessageBuffer&
 {
-    return buffer << msg.timestamp << msg.name << msg.kind << msg.value;
+    return buffer << msg.timestamp << msg.name << msg.kind << FormatMetricValue(msg);
 }
 
 inline auto operator>>(SilKit::Core::MessageBuffer& buffer, MetricData& out) -> SilKit::Core::MessageBuffer&
 {
-    return buffer >> out.timestamp >> out.name >> out.kind >> out.value;
+    std::string value;
+    buffer >> out.timestamp >> out.name >> out.kind >> value;
+    ParseMetricValue(out, value);
+    return buffer;
 }
 
 
@@ -29,5 +91,15 @@ void Deserialize(SilKit::Core::MessageBuffer& buffer, MetricsUpdate& out)
     buffer >> out.metrics;
 }
 
+void Serialize(SilKit::Core::MessageBuffer& buffer, const WireMetricsUpdate& msg)
+{
+    buffer << msg.descriptors << msg.counters << msg.statistics << msg.stringLists << msg.histograms;
+}
+
+void Deserialize(SilKit::Core::MessageBuffer& buffer, WireMetricsUpdate& out)
+{
+    buffer >> out.descriptors >> out.counters >> out.statistics >> out.stringLists >> out.histograms;
+}
+
 
 } // namespace VSilKit
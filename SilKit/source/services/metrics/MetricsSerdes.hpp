@@ -15,5 +15,8 @@ namespace VSilKit {
 void Serialize(SilKit::Core::MessageBuffer& buffer, const MetricsUpdate& msg);
 void Deserialize(SilKit::Core::MessageBuffer& buffer, MetricsUpdate& out);
 
+void Serialize(SilKit::Core::MessageBuffer& buffer, const WireMetricsUpdate& msg);
+void Deserialize(SilKit::Core::MessageBuffer& buffer, WireMetricsUpdate& out);
+
 
 } // namespace VSilKit
@@ -0,0 +1,132 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "gtest/gtest.h"
+
+#include "HdrHistogram.hpp"
+
+#include <limits>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using VSilKit::HdrHistogram;
+
+
+TEST(Test_HdrHistogram, small_values_are_exact)
+{
+    for (uint64_t value = 0; value != (uint64_t{1} << HdrHistogram::SubBucketBits); ++value)
+    {
+        ASSERT_EQ(HdrHistogram::BucketUpperBound(HdrHistogram::BucketIndex(value)), value);
+    }
+}
+
+TEST(Test_HdrHistogram, bucket_bounds_have_bounded_relative_error)
+{
+    uint64_t previousIndex{0};
+
+    for (uint64_t value = 1; value < std::numeric_limits<uint64_t>::max() / 3; value = value * 3 + 1)
+    {
+        for (const auto v : {value, value + 1, value * 2 - 1})
+        {
+            const auto index = HdrHistogram::BucketIndex(v);
+            ASSERT_LT(index, HdrHistogram::BucketCount);
+
+            const auto upperBound = HdrHistogram::BucketUpperBound(index);
+            ASSERT_GE(upperBound, v);
+            ASSERT_LE(static_cast<double>(upperBound - v), static_cast<double>(v) / 64.0);
+        }
+
+        const auto index = HdrHistogram::BucketIndex(value);
+        ASSERT_GE(index, previousIndex);
+        previousIndex = index;
+    }
+
+    const auto maxIndex = HdrHistogram::BucketIndex(std::numeric_limits<uint64_t>::max());
+    ASSERT_EQ(maxIndex, HdrHistogram::BucketCount - 1);
+    ASSERT_EQ(HdrHistogram::BucketUpperBound(maxIndex), std::numeric_limits<uint64_t>::max());
+}
+
+TEST(Test_HdrHistogram, empty_snapshot)
+{
+    HdrHistogram histogram;
+    const auto snapshot = histogram.GetSnapshot();
+
+    EXPECT_EQ(snapshot.count, 0u);
+    EXPECT_EQ(snapshot.p50, 0u);
+    EXPECT_EQ(snapshot.maximum, 0u);
+}
+
+TEST(Test_HdrHistogram, percentiles_of_uniform_values)
+{
+    auto histogram = std::make_unique<HdrHistogram>();
+    for (uint64_t value = 1; value <= 10000; ++value)
+    {
+        histogram->Record(value);
+    }
+
+    const auto snapshot = histogram->GetSnapshot();
+
+    EXPECT_EQ(snapshot.count, 10000u);
+    EXPECT_NEAR(static_cast<double>(snapshot.p50), 5000.0, 5000.0 / 64.0);
+    EXPECT_NEAR(static_cast<double>(snapshot.p90), 9000.0, 9000.0 / 64.0);
+    EXPECT_NEAR(static_cast<double>(snapshot.p99), 9900.0, 9900.0 / 64.0);
+    EXPECT_NEAR(static_cast<double>(snapshot.p999), 9990.0, 9990.0 / 64.0);
+    EXPECT_EQ(snapshot.maximum, 10000u);
+    EXPECT_LE(snapshot.p999, snapshot.maximum);
+}
+
+TEST(Test_HdrHistogram, tail_latency_is_visible)
+{
+    auto histogram = std::make_unique<HdrHistogram>();
+    for (int i = 0; i != 990; ++i)
+    {
+        histogram->Record(100);
+    }
+    for (int i = 0; i != 10; ++i)
+    {
+        histogram->Record(1000000);
+    }
+
+    const auto snapshot = histogram->GetSnapshot();
+
+    EXPECT_EQ(snapshot.p50, 100u);
+    EXPECT_EQ(snapshot.p90, 100u);
+    EXPECT_EQ(snapshot.p99, 100u);
+    EXPECT_NEAR(static_cast<double>(snapshot.p999), 1000000.0, 1000000.0 / 64.0);
+    EXPECT_EQ(snapshot.maximum, 1000000u);
+}
+
+TEST(Test_HdrHistogram, concurrent_records_are_counted)
+{
+    constexpr int threadCount = 4;
+    constexpr uint64_t valuesPerThread = 10000;
+
+    auto histogram = std::make_unique<HdrHistogram>();
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t != threadCount; ++t)
+    {
+        threads.emplace_back([&histogram, t] {
+            for (uint64_t value = 0; value != valuesPerThread; ++value)
+            {
+                histogram->Record(value * threadCount + static_cast<uint64_t>(t));
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    const auto snapshot = histogram->GetSnapshot();
+
+    EXPECT_EQ(snapshot.count, threadCount * valuesPerThread);
+    EXPECT_EQ(snapshot.maximum, threadCount * valuesPerThread - 1);
+}
+
+
+} // anonymous namespace
@@ -0,0 +1,109 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include "MetricsCodec.hpp"
+#include "MetricsDatatypes.hpp"
+
+namespace {
+
+using VSilKit::MetricData;
+using VSilKit::MetricHistogram;
+using VSilKit::MetricKind;
+using VSilKit::MetricStatistic;
+using VSilKit::MetricsDecoder;
+using VSilKit::MetricsEncoder;
+using VSilKit::MetricsUpdate;
+using VSilKit::WireMetricDescriptor;
+
+using testing::ElementsAre;
+using testing::IsEmpty;
+
+auto MakeUpdate() -> MetricsUpdate
+{
+    MetricsUpdate update;
+    update.metrics.emplace_back(MetricData{1, "Counter", MetricKind::COUNTER, 1});
+    update.metrics.emplace_back(MetricData{2, "Statistic", MetricKind::STATISTIC, {}, MetricStatistic{1, 2, 3, 4}});
+    update.metrics.emplace_back(MetricData{3, "StringList", MetricKind::STRING_LIST, {}, {}, {"A", "B"}});
+    update.metrics.emplace_back(
+        MetricData{4, "Histogram", MetricKind::HISTOGRAM, {}, {}, {}, MetricHistogram{5, 6, 7, 8, 9, 10}});
+    return update;
+}
+
+
+TEST(Test_MetricsCodec, first_update_announces_metrics_and_roundtrips)
+{
+    const auto update = MakeUpdate();
+
+    MetricsEncoder encoder;
+    const auto wire = encoder.Encode(update);
+
+    EXPECT_THAT(wire.descriptors, ElementsAre(WireMetricDescriptor{0, "Counter", MetricKind::COUNTER},
+                                              WireMetricDescriptor{1, "Statistic", MetricKind::STATISTIC},
+                                              WireMetricDescriptor{2, "StringList", MetricKind::STRING_LIST},
+                                              WireMetricDescriptor{3, "Histogram", MetricKind::HISTOGRAM}));
+    EXPECT_THAT(wire.counters.ids, ElementsAre(0));
+    EXPECT_THAT(wire.statistics.ids, ElementsAre(1));
+    EXPECT_THAT(wire.stringLists.ids, ElementsAre(2));
+    EXPECT_THAT(wire.histograms.ids, ElementsAre(3));
+
+    MetricsDecoder decoder;
+    EXPECT_EQ(decoder.Decode(wire), update);
+}
+
+TEST(Test_MetricsCodec, unchanged_metrics_are_omitted)
+{
+    MetricsEncoder encoder;
+    MetricsDecoder decoder;
+    decoder.Decode(encoder.Encode(MakeUpdate()));
+
+    auto update = MakeUpdate();
+    update.metrics[0].timestamp = 10;
+    update.metrics[0].counter = 2;
+    update.metrics[1].timestamp = 20;
+    update.metrics[2].timestamp = 30;
+    update.metrics[3].timestamp = 40;
+
+    const auto wire = encoder.Encode(update);
+
+    EXPECT_THAT(wire.descriptors, IsEmpty());
+    EXPECT_THAT(wire.counters.ids, ElementsAre(0));
+    EXPECT_THAT(wire.counters.values, ElementsAre(2u));
+    EXPECT_THAT(wire.statistics.ids, IsEmpty());
+    EXPECT_THAT(wire.stringLists.ids, IsEmpty());
+    EXPECT_THAT(wire.histograms.ids, IsEmpty());
+
+    const auto decoded = decoder.Decode(wire);
+    EXPECT_THAT(decoded.metrics, ElementsAre(update.metrics[0]));
+}
+
+TEST(Test_MetricsCodec, reset_announces_all_metrics_with_their_last_values)
+{
+    const auto update = MakeUpdate();
+
+    MetricsEncoder encoder;
+    encoder.Encode(update);
+    encoder.Reset();
+
+    // a decoder which did not see the first update
+    MetricsDecoder decoder;
+    EXPECT_EQ(decoder.Decode(encoder.Encode(MetricsUpdate{})), update);
+}
+
+TEST(Test_MetricsCodec, values_of_unknown_metrics_are_ignored)
+{
+    MetricsEncoder encoder;
+    encoder.Encode(MakeUpdate());
+
+    auto update = MakeUpdate();
+    update.metrics[0].counter = 2;
+
+    MetricsDecoder decoder;
+    EXPECT_THAT(decoder.Decode(encoder.Encode(update)).metrics, IsEmpty());
+}
+
+
+} // anonymous namespace
@@ -7,13 +7,10 @@
 
 #include "MetricsDatatypes.hpp"
 #include "MetricsJsonSink.hpp"
-#include "StringHelpers.hpp"
 
 #include <algorithm>
 #include <sstream>
 
-#include "fmt/format.h"
-
 #include "yaml-cpp/yaml.h"
 
 namespace {
@@ -24,8 +21,6 @@ using VSilKit::MetricTimestamp;
 using VSilKit::MetricsJsonSink;
 using VSilKit::MetricsUpdate;
 
-using SilKit::Util::EscapeString;
-
 
 TEST(Test_MetricsJsonSink, test_json_escaping_and_structure)
 {
@@ -34,24 +29,29 @@ TEST(Test_MetricsJsonSink, test_json_escaping_and_structure)
     const MetricTimestamp ts1{1};
     const std::string mn1{"Metric\rName\n1"};
     const auto mk1 = MetricKind::COUNTER;
-    const std::string mv1{"1"};
+    const uint64_t mv1{1};
 
     const MetricTimestamp ts2{2};
     const std::string mn2{"Metric\rName\n2"};
     const auto mk2 = MetricKind::STATISTIC;
-    const std::string mv2{"[1,2,3,4]"};
+    const VSilKit::MetricStatistic mv2{1.0, 2.0, 3.0, 4.0};
 
     const MetricTimestamp ts3{3};
     const std::string mn3{"Metric\rName\n3"};
     const auto mk3 = MetricKind::STRING_LIST;
     const std::string mv3a{"A\r\nB\nC"};
     const std::string mv3b{"D\tE\nF\tG"};
-    const std::string mv3{fmt::format(R"(["{}","{}"])", EscapeString(mv3a), EscapeString(mv3b))};
+
+    const MetricTimestamp ts4{4};
+    const std::string mn4{"Metric\rName\n4"};
+    const auto mk4 = MetricKind::HISTOGRAM;
+    const VSilKit::MetricHistogram mv4{5, 6, 7, 8, 9, 10};
 
     MetricsUpdate update;
     update.metrics.emplace_back(MetricData{ts1, mn1, mk1, mv1});
-    update.metrics.emplace_back(MetricData{ts2, mn2, mk2, mv2});
-    update.metrics.emplace_back(MetricData{ts3, mn3, mk3, mv3});
+    update.metrics.emplace_back(MetricData{ts2, mn2, mk2, {}, mv2});
+    update.metrics.emplace_back(MetricData{ts3, mn3, mk3, {}, {}, {mv3a, mv3b}});
+    update.metrics.emplace_back(MetricData{ts4, mn4, mk4, {}, {}, {}, mv4});
 
     auto ownedOstream = std::make_unique<std::ostringstream>();
     auto& ostream = *ownedOstream;
@@ -80,13 +80,13 @@ TEST(Test_MetricsJsonSink, test_json_escaping_and_structure)
 
     // checks
 
-    ASSERT_EQ(nodes.size(), 3);
+    ASSERT_EQ(nodes.size(), 4);
 
     ASSERT_TRUE(nodes[0].IsMap());
     ASSERT_EQ(nodes[0]["ts"].as<MetricTimestamp>(), ts1);
     ASSERT_EQ(nodes[0]["mn"].as<std::string>(), mn1);
     ASSERT_EQ(nodes[0]["mk"].as<std::string>(), "COUNTER");
-    ASSERT_EQ(nodes[0]["mv"].as<std::string>(), mv1);
+    ASSERT_EQ(nodes[0]["mv"].as<uint64_t>(), mv1);
 
     ASSERT_TRUE(nodes[1].IsMap());
     ASSERT_EQ(nodes[1]["ts"].as<MetricTimestamp>(), ts2);
@@ -99,6 +99,18 @@ TEST(Test_MetricsJsonSink, test_json_escaping_and_structure)
     ASSERT_EQ(nodes[2]["mn"].as<std::string>(), mn3);
     ASSERT_EQ(nodes[2]["mk"].as<std::string>(), "STRING_LIST");
     ASSERT_EQ(nodes[2]["mv"].as<std::vector<std::string>>(), (std::vector<std::string>{mv3a, mv3b}));
+
+    ASSERT_TRUE(nodes[3].IsMap());
+    ASSERT_EQ(nodes[3]["ts"].as<MetricTimestamp>(), ts4);
+    ASSERT_EQ(nodes[3]["mn"].as<std::string>(), mn4);
+    ASSERT_EQ(nodes[3]["mk"].as<std::string>(), "HISTOGRAM");
+    ASSERT_TRUE(nodes[3]["mv"].IsMap());
+    ASSERT_EQ(nodes[3]["mv"]["count"].as<uint64_t>(), mv4.count);
+    ASSERT_EQ(nodes[3]["mv"]["p50"].as<uint64_t>(), mv4.p50);
+    ASSERT_EQ(nodes[3]["mv"]["p90"].as<uint64_t>(), mv4.p90);
+    ASSERT_EQ(nodes[3]["mv"]["p99"].as<uint64_t>(), mv4.p99);
+    ASSERT_EQ(nodes[3]["mv"]["p999"].as<uint64_t>(), mv4.p999);
+    ASSERT_EQ(nodes[3]["mv"]["max"].as<uint64_t>(), mv4.maximum);
 }
 
 
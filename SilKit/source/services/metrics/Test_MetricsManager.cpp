@@ -119,4 +119,34 @@ TEST(Test_MetricsManager, string_list_metric_create_and_update_only_submits_afte
 }
 
 
+TEST(Test_MetricsManager, histogram_metric_create_and_update_only_submits_after_change)
+{
+    const std::string participantName{"Participant Name"};
+    const std::string metricName{"Histogram Metric"};
+
+    MockMetricsProcessor mockMetricsProcessor;
+    EXPECT_CALL(mockMetricsProcessor, Process(participantName, MetricsUpdateWithSingleMetricWithNameAndKind(
+                                                                   metricName, MetricKind::HISTOGRAM)))
+        .WillOnce([](const std::string&, const MetricsUpdate& metricsUpdate) {
+            const auto& histogram = metricsUpdate.metrics.front().histogram;
+            EXPECT_EQ(histogram.count, 2u);
+            EXPECT_EQ(histogram.p50, 10u);
+            EXPECT_EQ(histogram.maximum, 20u);
+        });
+
+    MetricsManager metricsManager{participantName, mockMetricsProcessor};
+    // no metrics to report, no Process call should be made
+    metricsManager.SubmitUpdates();
+
+    auto metric = metricsManager.GetHistogram(metricName);
+    // no metric value to report, no Process call should be made
+    metricsManager.SubmitUpdates();
+
+    metric->Take(10);
+    metric->Take(20);
+    // metric value to report, single Process call
+    metricsManager.SubmitUpdates();
+}
+
+
 } // anonymous namespace
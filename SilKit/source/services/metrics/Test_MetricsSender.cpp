@@ -0,0 +1,215 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include "MetricsSender.hpp"
+#include "MetricsReceiver.hpp"
+#include "MockParticipant.hpp"
+#include "ServiceConfigKeys.hpp"
+
+namespace {
+
+using SilKit::Core::IServiceEndpoint;
+using SilKit::Core::ServiceDescriptor;
+using SilKit::Core::Discovery::ServiceDiscoveryEvent;
+using SilKit::Core::Discovery::ServiceDiscoveryHandler;
+using SilKit::Core::Tests::DummyParticipant;
+
+using VSilKit::IMetricsReceiverListener;
+using VSilKit::MetricData;
+using VSilKit::MetricKind;
+using VSilKit::MetricsEncoder;
+using VSilKit::MetricsReceiver;
+using VSilKit::MetricsSender;
+using VSilKit::MetricsUpdate;
+using VSilKit::WireMetricsUpdate;
+
+using testing::_;
+using testing::Field;
+using testing::IsEmpty;
+using testing::Not;
+using testing::Return;
+using testing::SaveArg;
+
+struct MockParticipant : DummyParticipant
+{
+    MOCK_METHOD(void, SendMsg_WireMetricsUpdate, (const IServiceEndpoint*, const WireMetricsUpdate&));
+    void SendMsg(const IServiceEndpoint* from, const WireMetricsUpdate& msg) override
+    {
+        SendMsg_WireMetricsUpdate(from, msg);
+    }
+
+    MOCK_METHOD(void, SendMsg_MetricsUpdate, (const IServiceEndpoint*, const std::string&, const MetricsUpdate&));
+    void SendMsg(const IServiceEndpoint* from, const std::string& targetParticipantName,
+                 const MetricsUpdate& msg) override
+    {
+        SendMsg_MetricsUpdate(from, targetParticipantName, msg);
+    }
+
+    MOCK_METHOD(std::vector<std::string>, GetParticipantNamesOfRemoteReceivers,
+                (const IServiceEndpoint*, const std::string&), (override));
+};
+
+struct MockMetricsReceiverListener : IMetricsReceiverListener
+{
+    MOCK_METHOD(void, OnMetricsUpdate, (const std::string&, const MetricsUpdate&), (override));
+};
+
+auto MakeUpdate(uint64_t counter) -> MetricsUpdate
+{
+    MetricsUpdate update;
+    update.metrics.emplace_back(MetricData{counter, "Counter", MetricKind::COUNTER, counter});
+    return update;
+}
+
+auto MakeServiceDescriptor(const std::string& participantName, const std::string& controllerType) -> ServiceDescriptor
+{
+    ServiceDescriptor serviceDescriptor{participantName, "default", controllerType, 1};
+    serviceDescriptor.SetSupplementalDataItem(SilKit::Core::Discovery::controllerType, controllerType);
+    return serviceDescriptor;
+}
+
+auto AnnouncesMetrics() -> testing::Matcher<const WireMetricsUpdate&>
+{
+    return Field(&WireMetricsUpdate::descriptors, Not(IsEmpty()));
+}
+
+auto OnlyUpdatesValues() -> testing::Matcher<const WireMetricsUpdate&>
+{
+    return Field(&WireMetricsUpdate::descriptors, IsEmpty());
+}
+
+class Test_MetricsSender : public testing::Test
+{
+protected:
+    Test_MetricsSender()
+    {
+        ON_CALL(participant.mockServiceDiscovery, RegisterServiceDiscoveryHandler(_))
+            .WillByDefault(SaveArg<0>(&discoveryHandler));
+        ON_CALL(participant, GetParticipantNamesOfRemoteReceivers(_, _))
+            .WillByDefault(Return(std::vector<std::string>{"Receiver"}));
+
+        sender.RegisterServiceDiscovery();
+    }
+
+    void NotifyReceiver(ServiceDiscoveryEvent::Type type)
+    {
+        const auto& controllerType = SilKit::Core::Discovery::controllerTypeMetricsReceiver;
+        discoveryHandler(type, MakeServiceDescriptor("Receiver", controllerType));
+    }
+
+protected:
+    testing::NiceMock<MockParticipant> participant;
+    MetricsSender sender{&participant};
+    ServiceDiscoveryHandler discoveryHandler;
+};
+
+TEST_F(Test_MetricsSender, receiver_rejoining_under_the_same_name_gets_the_metrics_announced_again)
+{
+    NotifyReceiver(ServiceDiscoveryEvent::Type::ServiceCreated);
+
+    testing::InSequence sequence;
+    EXPECT_CALL(participant, SendMsg_WireMetricsUpdate(&sender, AnnouncesMetrics()));
+    EXPECT_CALL(participant, SendMsg_WireMetricsUpdate(&sender, OnlyUpdatesValues()));
+    EXPECT_CALL(participant, SendMsg_WireMetricsUpdate(&sender, AnnouncesMetrics()));
+
+    sender.Send(MakeUpdate(1));
+    sender.Send(MakeUpdate(2));
+
+    NotifyReceiver(ServiceDiscoveryEvent::Type::ServiceRemoved);
+    NotifyReceiver(ServiceDiscoveryEvent::Type::ServiceCreated);
+
+    sender.Send(MakeUpdate(3));
+}
+
+TEST_F(Test_MetricsSender, metrics_are_announced_again_once_the_joined_receiver_is_subscribed)
+{
+    // the receiver is subscribed from the third update on
+    EXPECT_CALL(participant, GetParticipantNamesOfRemoteReceivers(_, "WIREMETRICSUPDATE"))
+        .WillOnce(Return(std::vector<std::string>{}))
+        .WillOnce(Return(std::vector<std::string>{}))
+        .WillRepeatedly(Return(std::vector<std::string>{"Receiver"}));
+    EXPECT_CALL(participant, GetParticipantNamesOfRemoteReceivers(_, "METRICSUPDATE"))
+        .WillRepeatedly(Return(std::vector<std::string>{}));
+
+    testing::InSequence sequence;
+    EXPECT_CALL(participant, SendMsg_WireMetricsUpdate(&sender, AnnouncesMetrics()));
+    EXPECT_CALL(participant, SendMsg_WireMetricsUpdate(&sender, OnlyUpdatesValues()));
+    EXPECT_CALL(participant, SendMsg_WireMetricsUpdate(&sender, AnnouncesMetrics()));
+    EXPECT_CALL(participant, SendMsg_WireMetricsUpdate(&sender, OnlyUpdatesValues()));
+
+    sender.Send(MakeUpdate(1));
+
+    NotifyReceiver(ServiceDiscoveryEvent::Type::ServiceCreated);
+
+    sender.Send(MakeUpdate(2));
+    sender.Send(MakeUpdate(3));
+    sender.Send(MakeUpdate(4));
+}
+
+TEST_F(Test_MetricsSender, receivers_of_older_versions_get_the_metrics_they_know)
+{
+    ON_CALL(participant, GetParticipantNamesOfRemoteReceivers(_, "METRICSUPDATE"))
+        .WillByDefault(Return(std::vector<std::string>{"Receiver", "OlderReceiver"}));
+
+    auto update = MakeUpdate(1);
+    MetricData histogram{1, "Histogram", MetricKind::HISTOGRAM};
+    histogram.histogram.count = 1;
+    update.metrics.emplace_back(histogram);
+
+    EXPECT_CALL(participant, SendMsg_WireMetricsUpdate(&sender, AnnouncesMetrics())).Times(1);
+    EXPECT_CALL(participant, SendMsg_MetricsUpdate(&sender, "OlderReceiver", MakeUpdate(1))).Times(1);
+    EXPECT_CALL(participant, SendMsg_MetricsUpdate(&sender, "Receiver", _)).Times(0);
+
+    sender.Send(update);
+}
+
+TEST(Test_MetricsReceiver, decoder_of_a_leaving_sender_is_dropped)
+{
+    testing::NiceMock<MockParticipant> participant;
+    ServiceDiscoveryHandler discoveryHandler;
+    ON_CALL(participant.mockServiceDiscovery, RegisterServiceDiscoveryHandler(_))
+        .WillByDefault(SaveArg<0>(&discoveryHandler));
+
+    MockMetricsReceiverListener listener;
+    MetricsReceiver receiver{&participant, listener};
+    receiver.RegisterServiceDiscovery();
+
+    const auto senderDescriptor = MakeServiceDescriptor("Sender", SilKit::Core::Discovery::controllerTypeMetricsSender);
+    MetricsSender sender{&participant};
+    sender.SetServiceDescriptor(senderDescriptor);
+
+    MetricsEncoder encoder;
+    const auto announcement = encoder.Encode(MakeUpdate(1));
+    const auto valueUpdate = encoder.Encode(MakeUpdate(2));
+
+    EXPECT_CALL(listener, OnMetricsUpdate("Sender", MakeUpdate(1))).Times(1);
+    EXPECT_CALL(listener, OnMetricsUpdate("Sender", MakeUpdate(2))).Times(0);
+
+    receiver.ReceiveMsg(&sender, announcement);
+
+    discoveryHandler(ServiceDiscoveryEvent::Type::ServiceRemoved, senderDescriptor);
+
+    // the values refer to metrics announced by the previous incarnation of the sender
+    receiver.ReceiveMsg(&sender, valueUpdate);
+}
+
+TEST(Test_MetricsReceiver, metrics_of_senders_of_older_versions_are_passed_on_as_they_are)
+{
+    testing::NiceMock<MockParticipant> participant;
+
+    MockMetricsReceiverListener listener;
+    MetricsReceiver receiver{&participant, listener};
+
+    MetricsSender sender{&participant};
+    sender.SetServiceDescriptor(MakeServiceDescriptor("Sender", SilKit::Core::Discovery::controllerTypeMetricsSender));
+
+    EXPECT_CALL(listener, OnMetricsUpdate("Sender", MakeUpdate(1))).Times(1);
+
+    receiver.ReceiveMsg(&sender, MakeUpdate(1));
+}
+
+} // anonymous namespace
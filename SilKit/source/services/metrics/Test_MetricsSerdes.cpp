@@ -3,7 +3,6 @@
 // SPDX-License-Identifier: MIT
 
 #include "gtest/gtest.h"
-#include "gmock/gmock.h"
 
 #include "MetricsDatatypes.hpp"
 #include "MetricsSerdes.hpp"
@@ -11,19 +10,57 @@
 
 namespace {
 
-using VSilKit::MetricsUpdate;
 using VSilKit::MetricData;
 using VSilKit::MetricKind;
-
-using testing::ContainerEq;
+using VSilKit::MetricsUpdate;
+using VSilKit::WireMetricDescriptor;
+using VSilKit::WireMetricsUpdate;
 
 
 TEST(Test_MetricsSerdes, serialize_deserialize_roundtrip)
+{
+    WireMetricsUpdate original;
+    original.descriptors.emplace_back(WireMetricDescriptor{0, "1", MetricKind::COUNTER});
+    original.descriptors.emplace_back(WireMetricDescriptor{1, "2", MetricKind::STATISTIC});
+    original.descriptors.emplace_back(WireMetricDescriptor{2, "3", MetricKind::STRING_LIST});
+    original.descriptors.emplace_back(WireMetricDescriptor{3, "4", MetricKind::HISTOGRAM});
+    original.counters.ids = {0};
+    original.counters.timestamps = {1};
+    original.counters.values = {1};
+    original.statistics.ids = {1};
+    original.statistics.timestamps = {2};
+    original.statistics.means = {1.0};
+    original.statistics.stddevs = {2.0};
+    original.statistics.minimums = {3.0};
+    original.statistics.maximums = {4.0};
+    original.stringLists.ids = {2};
+    original.stringLists.timestamps = {3};
+    original.stringLists.values = {{"1", "2", "3", "4"}};
+    original.histograms.ids = {3};
+    original.histograms.timestamps = {4};
+    original.histograms.counts = {5};
+    original.histograms.p50s = {6};
+    original.histograms.p90s = {7};
+    original.histograms.p99s = {8};
+    original.histograms.p999s = {9};
+    original.histograms.maximums = {10};
+
+    SilKit::Core::MessageBuffer buffer;
+    VSilKit::Serialize(buffer, original);
+
+    WireMetricsUpdate copy;
+    VSilKit::Deserialize(buffer, copy);
+
+    ASSERT_EQ(copy, original);
+}
+
+
+TEST(Test_MetricsSerdes, metrics_update_of_older_versions_roundtrip)
 {
     MetricsUpdate original;
-    original.metrics.emplace_back(MetricData{1, "1", MetricKind::COUNTER, "1"});
-    original.metrics.emplace_back(MetricData{2, "2", MetricKind::STATISTIC, "[1,2,3,4]"});
-    original.metrics.emplace_back(MetricData{3, "3", MetricKind::STRING_LIST, R"(["1","2","3","4"])"});
+    original.metrics.emplace_back(MetricData{1, "1", MetricKind::COUNTER, 1});
+    original.metrics.emplace_back(MetricData{2, "2", MetricKind::STATISTIC, 0, {1.5, 2.0, -3.0, 4.0}});
+    original.metrics.emplace_back(MetricData{3, "3", MetricKind::STRING_LIST, 0, {}, {"", "\"a\"", "b\\c", "d\ne"}});
 
     SilKit::Core::MessageBuffer buffer;
     VSilKit::Serialize(buffer, original);
@@ -31,8 +68,28 @@ TEST(Test_MetricsSerdes, serialize_deserialize_roundtrip)
     MetricsUpdate copy;
     VSilKit::Deserialize(buffer, copy);
 
-    ASSERT_THAT(copy.metrics, ContainerEq(original.metrics));
+    ASSERT_EQ(copy, original);
 }
 
+TEST(Test_MetricsSerdes, metric_values_are_parsed_as_formatted_by_older_versions)
+{
+    MetricData counter{1, "1", MetricKind::COUNTER};
+    VSilKit::ParseMetricValue(counter, "42");
+    EXPECT_EQ(counter.counter, 42u);
+
+    MetricData statistic{2, "2", MetricKind::STATISTIC};
+    VSilKit::ParseMetricValue(statistic, "[1.5,0,1,2]");
+    EXPECT_EQ(statistic.statistic, (VSilKit::MetricStatistic{1.5, 0.0, 1.0, 2.0}));
+
+    MetricData stringList{3, "3", MetricKind::STRING_LIST};
+    VSilKit::ParseMetricValue(stringList, R"(["a\\b","\"c\""])");
+    EXPECT_EQ(stringList.stringList, (std::vector<std::string>{"a\\b", "\"c\""}));
+
+    // malformed values are ignored
+    VSilKit::ParseMetricValue(counter, "x");
+    EXPECT_EQ(counter.counter, 42u);
+    VSilKit::ParseMetricValue(stringList, R"(["a")");
+    EXPECT_EQ(stringList.stringList, (std::vector<std::string>{"a\\b", "\"c\""}));
+}
 
-} // anonymous namespace
\ No newline at end of file
+} // anonymous namespace
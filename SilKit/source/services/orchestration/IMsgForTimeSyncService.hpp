@@ -30,8 +30,8 @@ namespace Services {
 namespace Orchestration {
 
 class IMsgForTimeSyncService
-    : public Core::IReceiver<NextSimTask>
-    , public Core::ISender<ParticipantStatus, NextSimTask>
+    : public Core::IReceiver<NextSimTask, UserDataMessageCounts>
+    , public Core::ISender<ParticipantStatus, NextSimTask, UserDataMessageCounts>
 {
 };
 
@@ -507,12 +507,14 @@ void PausedState::ContinueSimulation(std::string reason)
 
 void PausedState::StopSimulation(std::string reason)
 {
+    _lifecycleManager->StopTime();
     _lifecycleManager->SetStateAndForwardIntent(_lifecycleManager->GetStoppingState(), &ILifecycleState::StopSimulation,
                                                 std::move(reason));
 }
 
 void PausedState::AbortSimulation(std::string /*reason*/)
 {
+    _lifecycleManager->StopTime();
     // TODO handle abort during executeSimStep
     // For now, just abort and hope for the best...
     ResolveAbortSimulation("Received abort simulation.");
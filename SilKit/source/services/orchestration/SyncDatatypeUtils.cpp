@@ -46,6 +46,21 @@ bool operator==(const ParticipantConnectionInformation& lhs, const ParticipantCo
     return lhs.participantName == rhs.participantName;
 }
 
+bool operator==(const NextSimTask& lhs, const NextSimTask& rhs)
+{
+    return lhs.timePoint == rhs.timePoint && lhs.duration == rhs.duration;
+}
+
+bool operator==(const UserDataMessageCount& lhs, const UserDataMessageCount& rhs)
+{
+    return lhs.participantName == rhs.participantName && lhs.count == rhs.count;
+}
+
+bool operator==(const UserDataMessageCounts& lhs, const UserDataMessageCounts& rhs)
+{
+    return lhs.counts == rhs.counts;
+}
+
 } // namespace Orchestration
 } // namespace Services
 } // namespace SilKit
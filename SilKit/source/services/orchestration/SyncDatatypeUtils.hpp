@@ -31,6 +31,9 @@ bool operator==(const ParticipantStatus& lhs, const ParticipantStatus& rhs);
 bool operator==(const SystemCommand& lhs, const SystemCommand& rhs);
 bool operator==(const WorkflowConfiguration& lhs, const WorkflowConfiguration& rhs);
 bool operator==(const ParticipantConnectionInformation& lhs, const ParticipantConnectionInformation& rhs);
+bool operator==(const NextSimTask& lhs, const NextSimTask& rhs);
+bool operator==(const UserDataMessageCount& lhs, const UserDataMessageCount& rhs);
+bool operator==(const UserDataMessageCounts& lhs, const UserDataMessageCounts& rhs);
 
 } // namespace Orchestration
 } // namespace Services
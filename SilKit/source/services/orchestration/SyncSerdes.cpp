@@ -39,6 +39,32 @@ inline SilKit::Core::MessageBuffer& operator>>(SilKit::Core::MessageBuffer& buff
     return buffer;
 }
 
+inline SilKit::Core::MessageBuffer& operator<<(SilKit::Core::MessageBuffer& buffer,
+                                               const SilKit::Services::Orchestration::UserDataMessageCount& count)
+{
+    buffer << count.participantName << count.count;
+    return buffer;
+}
+inline SilKit::Core::MessageBuffer& operator>>(SilKit::Core::MessageBuffer& buffer,
+                                               SilKit::Services::Orchestration::UserDataMessageCount& count)
+{
+    buffer >> count.participantName >> count.count;
+    return buffer;
+}
+
+inline SilKit::Core::MessageBuffer& operator<<(SilKit::Core::MessageBuffer& buffer,
+                                               const SilKit::Services::Orchestration::UserDataMessageCounts& counts)
+{
+    buffer << counts.counts;
+    return buffer;
+}
+inline SilKit::Core::MessageBuffer& operator>>(SilKit::Core::MessageBuffer& buffer,
+                                               SilKit::Services::Orchestration::UserDataMessageCounts& counts)
+{
+    buffer >> counts.counts;
+    return buffer;
+}
+
 
 inline SilKit::Core::MessageBuffer& operator<<(SilKit::Core::MessageBuffer& buffer,
                                                const SilKit::Services::Orchestration::SystemCommand& cmd)
@@ -102,6 +128,11 @@ void Serialize(SilKit::Core::MessageBuffer& buffer, const NextSimTask& msg)
     buffer << msg;
     return;
 }
+void Serialize(SilKit::Core::MessageBuffer& buffer, const UserDataMessageCounts& msg)
+{
+    buffer << msg;
+    return;
+}
 
 void Deserialize(SilKit::Core::MessageBuffer& buffer, SystemCommand& out)
 {
@@ -119,6 +150,10 @@ void Deserialize(SilKit::Core::MessageBuffer& buffer, NextSimTask& out)
 {
     buffer >> out;
 }
+void Deserialize(SilKit::Core::MessageBuffer& buffer, UserDataMessageCounts& out)
+{
+    buffer >> out;
+}
 
 } // namespace Orchestration
 } // namespace Services
@@ -32,11 +32,13 @@ void Serialize(SilKit::Core::MessageBuffer& buffer, const SystemCommand& msg);
 void Serialize(SilKit::Core::MessageBuffer& buffer, const ParticipantStatus& msg);
 void Serialize(SilKit::Core::MessageBuffer& buffer, const WorkflowConfiguration& msg);
 void Serialize(SilKit::Core::MessageBuffer& buffer, const NextSimTask& msg);
+void Serialize(SilKit::Core::MessageBuffer& buffer, const UserDataMessageCounts& msg);
 
 void Deserialize(SilKit::Core::MessageBuffer& buffer, SystemCommand& out);
 void Deserialize(SilKit::Core::MessageBuffer& buffer, ParticipantStatus& out);
 void Deserialize(SilKit::Core::MessageBuffer& buffer, WorkflowConfiguration& out);
 void Deserialize(SilKit::Core::MessageBuffer& buffer, NextSimTask& out);
+void Deserialize(SilKit::Core::MessageBuffer& buffer, UserDataMessageCounts& out);
 
 } // namespace Orchestration
 } // namespace Services
@@ -71,4 +71,22 @@ TEST(Test_SyncSerdes, MwSync_ParticipantStatus)
     EXPECT_EQ(in.refreshTime, out.refreshTime);
 }
 
+TEST(Test_SyncSerdes, MwSync_UserDataMessageCounts)
+{
+    using namespace SilKit::Services::Orchestration;
+    SilKit::Core::MessageBuffer buffer;
+
+    UserDataMessageCounts in{{{"P1", 3}, {"P2", 0x1'0000'0000ull}}};
+    UserDataMessageCounts out{};
+
+    Serialize(buffer, in);
+    Deserialize(buffer, out);
+
+    ASSERT_EQ(out.counts.size(), 2u);
+    EXPECT_EQ(out.counts[0].participantName, "P1");
+    EXPECT_EQ(out.counts[0].count, 3u);
+    EXPECT_EQ(out.counts[1].participantName, "P2");
+    EXPECT_EQ(out.counts[1].count, 0x1'0000'0000ull);
+}
+
 } // anonymous namespace
@@ -19,9 +19,14 @@ LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
 OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
 WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
+#include <algorithm>
 #include <chrono>
 #include <functional>
+#include <iterator>
+#include <map>
 #include <string>
+#include <tuple>
+#include <utility>
 
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
@@ -50,6 +55,71 @@ using namespace SilKit::Util;
 
 using ::SilKit::Core::Tests::DummyParticipant;
 
+// Records the NextSimTask and UserDataMessageCounts messages, which are sent to all or to a single participant
+struct NextSimTaskRecordingParticipant : DummyParticipant
+{
+    using DummyParticipant::SendMsg;
+
+    void SendMsg(const IServiceEndpoint* /*from*/, const NextSimTask& msg) override
+    {
+        sentTasks.push_back(msg);
+    }
+
+    void SendMsg(const IServiceEndpoint* /*from*/, const std::string& targetParticipantName,
+                 const NextSimTask& msg) override
+    {
+        sentTargetedTasks.emplace_back(targetParticipantName, msg);
+    }
+
+    // the number of targeted NextSimTask messages sent before is recorded as well, to check the order
+    void SendMsg(const IServiceEndpoint* /*from*/, const std::string& targetParticipantName,
+                 const UserDataMessageCounts& msg) override
+    {
+        sentTargetedCounts.emplace_back(targetParticipantName, msg, sentTasks.size() + sentTargetedTasks.size());
+    }
+
+    std::map<std::string, uint64_t> TakeSentUserDataMessageCounts() override
+    {
+        return std::exchange(sentUserDataMessageCounts, {});
+    }
+
+    void AwaitReceivedUserDataMessages(std::map<std::string, uint64_t> counts, std::function<void()> handler) override
+    {
+        awaitedUserDataMessageCounts = std::move(counts);
+        awaitedUserDataMessagesHandler = std::move(handler);
+    }
+
+    void DelayReceivedUserDataMessages(const std::string& participantName,
+                                       std::chrono::nanoseconds releaseTimePoint) override
+    {
+        receivedUserDataDelays[participantName] = releaseTimePoint;
+    }
+
+    void ReleaseReceivedUserDataMessages(std::chrono::nanoseconds timePoint) override
+    {
+        releaseTimePoints.push_back(timePoint);
+    }
+
+    std::vector<NextSimTask> sentTasks;
+    std::vector<std::pair<std::string, NextSimTask>> sentTargetedTasks;
+    std::vector<std::tuple<std::string, UserDataMessageCounts, size_t>> sentTargetedCounts;
+    std::map<std::string, uint64_t> sentUserDataMessageCounts;
+    std::map<std::string, uint64_t> awaitedUserDataMessageCounts;
+    std::function<void()> awaitedUserDataMessagesHandler;
+    std::map<std::string, std::chrono::nanoseconds> receivedUserDataDelays;
+    std::vector<std::chrono::nanoseconds> releaseTimePoints;
+};
+
+auto MakeTimeSyncServiceDescriptor(const std::string& participantName,
+                                   const std::string& timeSyncAggregator) -> ServiceDescriptor
+{
+    ServiceDescriptor descriptor{participantName, "default", "TimeSyncService", 1};
+    descriptor.SetServiceType(ServiceType::InternalController);
+    descriptor.SetSupplementalDataItem(Discovery::controllerType, Discovery::controllerTypeTimeSyncService);
+    descriptor.SetSupplementalDataItem(Discovery::timeSyncActive, "1");
+    descriptor.SetSupplementalDataItem(Discovery::timeSyncAggregator, timeSyncAggregator);
+    return descriptor;
+}
 
 class Test_TimeSyncService : public testing::Test
 {
@@ -66,22 +136,32 @@ protected:
 protected: // CTor
     Test_TimeSyncService()
     {
+        CreateServices();
+    }
+
+protected: // Methods
+    void CreateServices(std::string timeSyncAggregator = {})
+    {
+        timeSyncService.reset();
+
         // this CTor calls CreateTimeSyncService implicitly
         lifecycleService = std::make_unique<LifecycleService>(&participant);
         lifecycleService->SetLifecycleConfiguration(LifecycleConfiguration{OperationMode::Coordinated});
-        timeSyncService =
-            std::make_unique<TimeSyncService>(&participant, &timeProvider, healthCheckConfig, lifecycleService.get());
+        timeSyncService = std::make_unique<TimeSyncService>(&participant, &timeProvider, healthCheckConfig,
+                                                            lifecycleService.get(), 0.0, std::move(timeSyncAggregator));
         lifecycleService->SetTimeSyncService(timeSyncService.get());
     }
 
-protected: // Methods
-    void PrepareLifecycle()
+    void PrepareLifecycle(bool addOtherParticipant = true)
     {
         lifecycleService->SetTimeSyncActive(true);
         (void)lifecycleService->StartLifecycle();
 
-        // Add other participant to lookup
-        timeSyncService->GetTimeConfiguration()->AddSynchronizedParticipant("P1");
+        if (addOtherParticipant)
+        {
+            // Add other participant to lookup
+            timeSyncService->GetTimeConfiguration()->AddSynchronizedParticipant("P1");
+        }
 
         // skip uninteresting states
         lifecycleService->NewSystemState(SystemState::ServicesCreated);
@@ -96,7 +176,7 @@ protected:
     // Members
     NiceMock<MockServiceEndpoint> endpoint{"P1", "N1", "C1"};
 
-    NiceMock<DummyParticipant> participant;
+    NiceMock<NextSimTaskRecordingParticipant> participant;
     Callbacks callbacks;
     Config::HealthCheck healthCheckConfig;
 
@@ -161,4 +241,213 @@ TEST_F(Test_TimeSyncService, async_simtask_mismatching_number_of_complete_calls)
     ASSERT_EQ(numAsyncTaskCalled, 3) << "Calling too many CompleteSimulationStep() should not wreak havoc";
 }
 
+TEST_F(Test_TimeSyncService, simtask_runs_ahead_within_minimum_reaction_delay)
+{
+    std::vector<std::chrono::nanoseconds> timePoints;
+    timeSyncService->SetSimulationStepHandler([&](auto now, auto) { timePoints.push_back(now); }, 1ms);
+
+    // P1 guarantees that its messages take effect 3ms after its own simulation step
+    timeSyncService->GetTimeConfiguration()->AddSynchronizedParticipant("P1", 3ms);
+    PrepareLifecycle();
+    ASSERT_TRUE(timePoints.empty()) << "No lookahead before the first NextSimTask of P1 is known";
+
+    timeSyncService->ReceiveMsg(&endpoint, {0ms});
+    EXPECT_EQ(timePoints, (std::vector<std::chrono::nanoseconds>{0ms, 1ms, 2ms, 3ms}));
+
+    timeSyncService->ReceiveMsg(&endpoint, {2ms});
+    EXPECT_EQ(timePoints.back(), 5ms);
+    EXPECT_EQ(timePoints.size(), 6u);
+}
+
+TEST_F(Test_TimeSyncService, messages_sent_during_the_lookahead_are_delivered_in_a_deterministic_step)
+{
+    std::vector<std::chrono::nanoseconds> timePoints;
+    timeSyncService->SetSimulationStepHandler([&](auto now, auto) { timePoints.push_back(now); }, 1ms);
+
+    timeSyncService->GetTimeConfiguration()->AddSynchronizedParticipant("P1", 3ms);
+    PrepareLifecycle();
+
+    // The messages of P1's step at 0ms may arrive during any of our steps up to 3ms, they are held back regardless
+    timeSyncService->ReceiveMsg(&endpoint, {0ms});
+    EXPECT_EQ(participant.receivedUserDataDelays.at("P1"), 3ms);
+    EXPECT_EQ(participant.releaseTimePoints, (std::vector<std::chrono::nanoseconds>{0ms, 1ms, 2ms, 3ms}));
+
+    // P1 finished its step at 0ms, its messages are delivered right before our first step after 0ms + 3ms
+    timeSyncService->ReceiveMsg(&endpoint, {1ms});
+    EXPECT_EQ(participant.receivedUserDataDelays.at("P1"), 4ms);
+    EXPECT_EQ(participant.releaseTimePoints.back(), 4ms);
+    EXPECT_EQ(timePoints.back(), 4ms);
+}
+
+TEST_F(Test_TimeSyncService, messages_are_no_longer_held_back_after_the_simulation_time_stopped)
+{
+    timeSyncService->SetSimulationStepHandler([](auto, auto) {}, 1ms);
+
+    timeSyncService->GetTimeConfiguration()->AddSynchronizedParticipant("P1", 3ms);
+    PrepareLifecycle();
+
+    timeSyncService->ReceiveMsg(&endpoint, {0ms});
+    ASSERT_EQ(participant.receivedUserDataDelays.size(), 1u);
+
+    lifecycleService->Stop("Test");
+    EXPECT_EQ(participant.releaseTimePoints.back(), std::chrono::nanoseconds::max());
+
+    // the NextSimTask of P1's step that overlapped with the stop must not hold back its messages again
+    participant.receivedUserDataDelays.clear();
+    timeSyncService->ReceiveMsg(&endpoint, {1ms});
+    EXPECT_TRUE(participant.receivedUserDataDelays.empty());
+}
+
+TEST_F(Test_TimeSyncService, aggregated_participant_steps_with_the_grants_of_the_aggregator)
+{
+    NiceMock<MockServiceEndpoint> aggregatorEndpoint{"TimeSyncAggregator", "default", "TimeSyncService"};
+
+    std::vector<std::chrono::nanoseconds> timePoints;
+    CreateServices("TimeSyncAggregator");
+    timeSyncService->SetSimulationStepHandler([&](auto now, auto) { timePoints.push_back(now); }, 1ms);
+
+    // the aggregator is awaited even before it is discovered
+    PrepareLifecycle(false);
+    ASSERT_TRUE(timePoints.empty());
+
+    timeSyncService->ReceiveMsg(&aggregatorEndpoint, {0ms, 0ms});
+    EXPECT_EQ(timePoints, (std::vector<std::chrono::nanoseconds>{0ms}));
+
+    timeSyncService->ReceiveMsg(&aggregatorEndpoint, {2ms, 2ms});
+    EXPECT_EQ(timePoints, (std::vector<std::chrono::nanoseconds>{0ms, 1ms, 2ms}));
+
+    // the NextSimTask is only sent to the aggregator
+    EXPECT_TRUE(participant.sentTasks.empty());
+    ASSERT_EQ(participant.sentTargetedTasks.size(), 4u);
+    for (const auto& sentTargetedTask : participant.sentTargetedTasks)
+    {
+        EXPECT_EQ(sentTargetedTask.first, "TimeSyncAggregator");
+    }
+    EXPECT_EQ(participant.sentTargetedTasks.back().second.timePoint, 3ms);
+}
+
+TEST_F(Test_TimeSyncService, aggregator_grants_the_lowest_safe_time_point)
+{
+    NiceMock<MockServiceEndpoint> endpoint2{"P2", "N1", "C1"};
+
+    // the participant acts as the aggregator, if its own name is configured
+    CreateServices(participant.GetParticipantName());
+
+    // P2 guarantees that its messages take effect 2ms after its own simulation step
+    timeSyncService->GetTimeConfiguration()->AddSynchronizedParticipant("P2", 2ms);
+    PrepareLifecycle();
+    EXPECT_TRUE(participant.sentTasks.empty()) << "The aggregator does not execute simulation steps on its own";
+
+    timeSyncService->ReceiveMsg(&endpoint, {0ms, 1ms});
+    EXPECT_TRUE(participant.sentTasks.empty()) << "No grant before the first NextSimTask of P2 is known";
+
+    timeSyncService->ReceiveMsg(&endpoint2, {0ms, 1ms});
+    timeSyncService->ReceiveMsg(&endpoint, {1ms, 1ms});
+    timeSyncService->ReceiveMsg(&endpoint, {2ms, 1ms});
+    timeSyncService->ReceiveMsg(&endpoint, {3ms, 1ms});
+    timeSyncService->ReceiveMsg(&endpoint2, {1ms, 1ms});
+
+    const std::vector<NextSimTask> expectedGrants{{0ms, 0ms}, {1ms, 1ms}, {2ms, 2ms}, {3ms, 2ms}};
+    EXPECT_EQ(participant.sentTasks, expectedGrants);
+    EXPECT_TRUE(participant.sentTargetedTasks.empty());
+}
+
+TEST_F(Test_TimeSyncService, aggregator_sends_the_last_grant_only_to_a_joining_participant)
+{
+    Discovery::ServiceDiscoveryHandler discoveryHandler;
+    ON_CALL(participant.mockServiceDiscovery, RegisterServiceDiscoveryHandler(_))
+        .WillByDefault(SaveArg<0>(&discoveryHandler));
+
+    CreateServices(participant.GetParticipantName());
+    PrepareLifecycle();
+    timeSyncService->ReceiveMsg(&endpoint, {2ms, 1ms});
+    ASSERT_EQ(participant.sentTasks, (std::vector<NextSimTask>{{2ms, 0ms}}));
+
+    discoveryHandler(Discovery::ServiceDiscoveryEvent::Type::ServiceCreated,
+                     MakeTimeSyncServiceDescriptor("P2", participant.GetParticipantName()));
+
+    EXPECT_EQ(participant.sentTasks.size(), 1u);
+    ASSERT_EQ(participant.sentTargetedTasks.size(), 1u);
+    EXPECT_EQ(participant.sentTargetedTasks[0].first, "P2");
+    EXPECT_EQ(participant.sentTargetedTasks[0].second, (NextSimTask{2ms, 0ms}));
+}
+
+TEST_F(Test_TimeSyncService, aggregated_participant_sends_its_user_data_message_counts_before_the_next_sim_task)
+{
+    NiceMock<MockServiceEndpoint> aggregatorEndpoint{"TimeSyncAggregator", "default", "TimeSyncService"};
+
+    CreateServices("TimeSyncAggregator");
+    // the simulation step sends two user data messages to P2
+    timeSyncService->SetSimulationStepHandler(
+        [&](auto, auto) { participant.sentUserDataMessageCounts = {{"P2", 2}}; }, 1ms);
+    PrepareLifecycle(false);
+    ASSERT_EQ(participant.sentTargetedTasks.size(), 1u);
+    EXPECT_TRUE(participant.sentTargetedCounts.empty()) << "No counts without user data messages";
+
+    timeSyncService->ReceiveMsg(&aggregatorEndpoint, {0ms, 0ms});
+
+    ASSERT_EQ(participant.sentTargetedTasks.size(), 2u);
+    EXPECT_EQ(participant.sentTargetedTasks[1].second, (NextSimTask{1ms, 1ms}));
+    ASSERT_EQ(participant.sentTargetedCounts.size(), 1u);
+    EXPECT_EQ(std::get<0>(participant.sentTargetedCounts[0]), "TimeSyncAggregator");
+    EXPECT_EQ(std::get<1>(participant.sentTargetedCounts[0]), (UserDataMessageCounts{{{"P2", 2}}}));
+    EXPECT_EQ(std::get<2>(participant.sentTargetedCounts[0]), 1u) << "The counts precede the NextSimTask";
+}
+
+TEST_F(Test_TimeSyncService, aggregator_forwards_the_changed_user_data_message_counts_before_its_grant)
+{
+    NiceMock<MockServiceEndpoint> endpoint2{"P2", "N1", "C1"};
+
+    CreateServices(participant.GetParticipantName());
+    timeSyncService->GetTimeConfiguration()->AddSynchronizedParticipant("P2");
+    PrepareLifecycle();
+
+    // P1 sent messages to P2 and to the aggregator, which is not synchronized
+    timeSyncService->ReceiveMsg(&endpoint, UserDataMessageCounts{{{"P2", 3}, {participant.GetParticipantName(), 1}}});
+    timeSyncService->ReceiveMsg(&endpoint, {0ms, 0ms});
+    EXPECT_TRUE(participant.sentTargetedCounts.empty()) << "The counts are only forwarded with a grant";
+
+    timeSyncService->ReceiveMsg(&endpoint2, UserDataMessageCounts{{{"P1", 1}}});
+    timeSyncService->ReceiveMsg(&endpoint2, {0ms, 0ms});
+    ASSERT_EQ(participant.sentTasks, (std::vector<NextSimTask>{{0ms, 0ms}}));
+    ASSERT_EQ(participant.sentTargetedCounts.size(), 2u);
+    EXPECT_EQ(std::get<0>(participant.sentTargetedCounts[0]), "P1");
+    EXPECT_EQ(std::get<1>(participant.sentTargetedCounts[0]), (UserDataMessageCounts{{{"P2", 1}}}));
+    EXPECT_EQ(std::get<2>(participant.sentTargetedCounts[0]), 0u) << "The counts precede the grant";
+    EXPECT_EQ(std::get<0>(participant.sentTargetedCounts[1]), "P2");
+    EXPECT_EQ(std::get<1>(participant.sentTargetedCounts[1]), (UserDataMessageCounts{{{"P1", 3}}}));
+    EXPECT_EQ(std::get<2>(participant.sentTargetedCounts[1]), 0u) << "The counts precede the grant";
+
+    // unchanged counts are not sent again
+    timeSyncService->ReceiveMsg(&endpoint, {1ms, 0ms});
+    timeSyncService->ReceiveMsg(&endpoint2, {1ms, 0ms});
+    EXPECT_EQ(participant.sentTasks.size(), 2u);
+    EXPECT_EQ(participant.sentTargetedCounts.size(), 2u);
+}
+
+TEST_F(Test_TimeSyncService, aggregated_participant_waits_for_the_user_data_messages_sent_before_the_grant)
+{
+    NiceMock<MockServiceEndpoint> aggregatorEndpoint{"TimeSyncAggregator", "default", "TimeSyncService"};
+
+    std::vector<std::chrono::nanoseconds> timePoints;
+    CreateServices("TimeSyncAggregator");
+    timeSyncService->SetSimulationStepHandler([&](auto now, auto) { timePoints.push_back(now); }, 1ms);
+    PrepareLifecycle(false);
+
+    // the grant overtook the two user data messages of P2
+    timeSyncService->ReceiveMsg(&aggregatorEndpoint, UserDataMessageCounts{{{"P2", 2}}});
+    timeSyncService->ReceiveMsg(&aggregatorEndpoint, {0ms, 0ms});
+    EXPECT_EQ(participant.awaitedUserDataMessageCounts, (std::map<std::string, uint64_t>{{"P2", 2}}));
+    EXPECT_TRUE(timePoints.empty());
+
+    // the connection calls the handler once the messages were received
+    ASSERT_TRUE(participant.awaitedUserDataMessagesHandler);
+    participant.awaitedUserDataMessagesHandler();
+    EXPECT_EQ(timePoints, (std::vector<std::chrono::nanoseconds>{0ms}));
+
+    // a grant without counts is not held back
+    timeSyncService->ReceiveMsg(&aggregatorEndpoint, {1ms, 1ms});
+    EXPECT_EQ(timePoints, (std::vector<std::chrono::nanoseconds>{0ms, 1ms}));
+}
+
 } // namespace
@@ -19,6 +19,8 @@ LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
 OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
 WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
+#include <algorithm>
+
 #include "TimeConfiguration.hpp"
 #include "LoggerMessage.hpp"
 
@@ -42,40 +44,49 @@ void TimeConfiguration::SetBlockingMode(bool blocking)
     _blocking = blocking;
 }
 
-void TimeConfiguration::AddSynchronizedParticipant(const std::string& otherParticipantName)
+void TimeConfiguration::AddSynchronizedParticipant(const std::string& otherParticipantName,
+                                                   std::chrono::nanoseconds minimumReactionDelay)
 {
     Lock lock{_mx};
-    if (_otherNextTasks.find(otherParticipantName) != _otherNextTasks.end())
-    {
-        // ignore already known participants
-        return;
-    }
-    NextSimTask task;
-    task.timePoint = -1ns;
-    task.duration = 0ns;
-    _otherNextTasks.emplace(otherParticipantName, task);
+    OtherNextTask otherTask;
+    otherTask.task.timePoint = -1ns;
+    otherTask.task.duration = 0ns;
+    otherTask.minimumReactionDelay = minimumReactionDelay;
+    // already known participants are ignored
+    _otherNextTasks.Insert(otherParticipantName, otherTask);
 }
 
 
 bool TimeConfiguration::RemoveSynchronizedParticipant(const std::string& otherParticipantName)
 {
     Lock lock{_mx};
-    auto it = _otherNextTasks.find(otherParticipantName);
-    if (it != _otherNextTasks.end())
-    {
-        _otherNextTasks.erase(it);
-        return true;
-    }
-    return false;
+    return _otherNextTasks.Erase(otherParticipantName);
+}
+
+bool TimeConfiguration::IsSynchronizedParticipant(const std::string& otherParticipantName) const
+{
+    Lock lock{_mx};
+    return _otherNextTasks.Find(otherParticipantName) != nullptr;
+}
+
+auto TimeConfiguration::GetMinimumReactionDelay(const std::string& otherParticipantName) const
+    -> std::chrono::nanoseconds
+{
+    Lock lock{_mx};
+    const auto* otherNextTask = _otherNextTasks.Find(otherParticipantName);
+    return otherNextTask == nullptr ? 0ns : otherNextTask->minimumReactionDelay;
 }
 
 auto TimeConfiguration::GetSynchronizedParticipantNames() -> std::vector<std::string>
 {
+    Lock lock{_mx};
     std::vector<std::string> participantNames;
-    for (auto const& it : _otherNextTasks)
+    for (auto const& entry : _otherNextTasks.Entries())
     {
-        participantNames.push_back(it.first);
+        participantNames.push_back(entry.key);
     }
+    // the entries are in heap order, the names are reported in a stable order
+    std::sort(participantNames.begin(), participantNames.end());
     return participantNames;
 }
 
@@ -83,40 +94,38 @@ void TimeConfiguration::OnReceiveNextSimStep(const std::string& participantName,
 {
     Lock lock{_mx};
 
-    auto&& itOtherNextTask = _otherNextTasks.find(participantName);
-    if (itOtherNextTask == _otherNextTasks.end())
+    const auto* otherNextTask = _otherNextTasks.Find(participantName);
+    if (otherNextTask == nullptr)
     {
         Logging::Error(_logger, "Received NextSimTask from unknown participant {}", participantName);
         return;
     }
 
-    if (nextStep.timePoint < itOtherNextTask->second.timePoint)
+    if (nextStep.timePoint < otherNextTask->task.timePoint)
     {
         Logging::Error(
             _logger,
             "Chonology error: Received NextSimTask from participant \'{}\' with lower timePoint {} than last "
             "known timePoint {}",
-            participantName, nextStep.timePoint.count(), itOtherNextTask->second.timePoint.count());
+            participantName, nextStep.timePoint.count(), otherNextTask->task.timePoint.count());
     }
 
-    _otherNextTasks.at(participantName) = std::move(nextStep);
     Logging::Debug(_logger, "Updated _otherNextTasks for participant {} with time {}", participantName,
                    nextStep.timePoint.count());
+    OtherNextTask otherTask{*otherNextTask};
+    otherTask.task = std::move(nextStep);
+    _otherNextTasks.Update(participantName, std::move(otherTask));
 }
 
 void TimeConfiguration::SynchronizedParticipantRemoved(const std::string& otherParticipantName)
 {
     Lock lock{_mx};
-    if (_otherNextTasks.find(otherParticipantName) != _otherNextTasks.end())
+    if (_otherNextTasks.Find(otherParticipantName) != nullptr)
     {
         const std::string errorMessage{"Participant " + otherParticipantName + " unknown."};
         throw SilKitError{errorMessage};
     }
-    auto it = _otherNextTasks.find(otherParticipantName);
-    if (it != _otherNextTasks.end())
-    {
-        _otherNextTasks.erase(it);
-    }
+    _otherNextTasks.Erase(otherParticipantName);
 }
 void TimeConfiguration::SetStepDuration(std::chrono::nanoseconds duration)
 {
@@ -147,18 +156,52 @@ bool TimeConfiguration::OtherParticipantHasLowerTimepoint() const
 {
     Lock lock{_mx};
 
-    for (const auto& otherTask : _otherNextTasks)
+    if (_otherNextTasks.Empty())
     {
-        if (_myNextTask.timePoint > otherTask.second.timePoint)
-        {
-            Debug(_logger, "Not advancing because participant \'{}\' has lower timepoint {}", otherTask.first,
-                  otherTask.second.timePoint.count());
-            return true;
-        }
+        return false;
+    }
+
+    // Not >=: without a minimum reaction delay, the steps at the same time point must run concurrently (lockstep)
+    const auto& lowestOtherTask = _otherNextTasks.Top();
+    if (_myNextTask.timePoint > lowestOtherTask.value.SafeTimePoint())
+    {
+        Debug(_logger, "Not advancing because participant \'{}\' has lower timepoint {} (minimum reaction delay {})",
+              lowestOtherTask.key, lowestOtherTask.value.task.timePoint.count(),
+              lowestOtherTask.value.minimumReactionDelay.count());
+        return true;
     }
     return false;
 }
 
+auto TimeConfiguration::LowestSafeTimePoint() const -> std::chrono::nanoseconds
+{
+    Lock lock{_mx};
+
+    if (_otherNextTasks.Empty())
+    {
+        return -1ns;
+    }
+    return _otherNextTasks.Top().value.SafeTimePoint();
+}
+
+auto TimeConfiguration::LowestTimePoint() const -> std::chrono::nanoseconds
+{
+    Lock lock{_mx};
+
+    if (_otherNextTasks.Empty())
+    {
+        return -1ns;
+    }
+
+    // the heap is ordered by the safe time point, which differs by the minimum reaction delay of each participant
+    auto lowestTimePoint = std::chrono::nanoseconds::max();
+    for (const auto& otherTask : _otherNextTasks.Entries())
+    {
+        lowestTimePoint = (std::min)(lowestTimePoint, otherTask.value.task.timePoint);
+    }
+    return lowestTimePoint;
+}
+
 void TimeConfiguration::Initialize()
 {
     Lock lock{_mx};
@@ -185,15 +228,15 @@ bool TimeConfiguration::IsHopOn()
     if (_currentTask.timePoint == -1ns) // On initial time
     {
         std::chrono::nanoseconds minimalOtherTime = std::chrono::nanoseconds::max();
-        for (const auto& otherTask : _otherNextTasks)
+        for (const auto& otherTask : _otherNextTasks.Entries())
         {
             // Any other participant has already advanced further that its duration -> HopOn
-            if (otherTask.second.timePoint > otherTask.second.duration)
+            if (otherTask.value.task.timePoint > otherTask.value.task.duration)
             {
                 _hoppedOn = true;
-                if (otherTask.second.timePoint < minimalOtherTime)
+                if (otherTask.value.task.timePoint < minimalOtherTime)
                 {
-                    minimalOtherTime = otherTask.second.timePoint;
+                    minimalOtherTime = otherTask.value.task.timePoint;
                 }
             }
         }
@@ -21,11 +21,11 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include <string>
 #include <chrono>
-#include <map>
 #include <mutex>
 
 #include "OrchestrationDatatypes.hpp"
 #include "LoggerMessage.hpp"
+#include "IndexedMinHeap.hpp"
 
 namespace SilKit {
 namespace Services {
@@ -39,8 +39,14 @@ public: //Ctor
 
 public: //Methods
     void SetBlockingMode(bool blocking);
-    void AddSynchronizedParticipant(const std::string& otherParticipantName);
+    //! The other participant guarantees that the messages of its simulation step at time t take effect at
+    //! t + minimumReactionDelay or later. Our simulation steps may run ahead of it up to that delay.
+    void AddSynchronizedParticipant(const std::string& otherParticipantName,
+                                    std::chrono::nanoseconds minimumReactionDelay = 0ns);
     bool RemoveSynchronizedParticipant(const std::string& otherParticipantName);
+    bool IsSynchronizedParticipant(const std::string& otherParticipantName) const;
+    //! Minimum reaction delay of the other participant (0ns if it is unknown)
+    auto GetMinimumReactionDelay(const std::string& otherParticipantName) const -> std::chrono::nanoseconds;
     auto GetSynchronizedParticipantNames() -> std::vector<std::string>;
     void OnReceiveNextSimStep(const std::string& participantName, NextSimTask nextStep);
     void SynchronizedParticipantRemoved(const std::string& otherParticipantName);
@@ -48,7 +54,14 @@ public: //Methods
     void AdvanceTimeStep();
     auto CurrentSimStep() const -> NextSimTask;
     auto NextSimStep() const -> NextSimTask;
+    //! True if our next simulation step is after the safe time point of another participant. Steps at the same time
+    //! point run concurrently, so a message sent in the step at time t is received before our steps after
+    //! t + minimumReactionDelay.
     bool OtherParticipantHasLowerTimepoint() const;
+    //! Lowest time point up to which the other participants cannot affect a simulation step (-1ns if there are none)
+    auto LowestSafeTimePoint() const -> std::chrono::nanoseconds;
+    //! Lowest next time point of the other participants, without their minimum reaction delays (-1ns if there are none)
+    auto LowestTimePoint() const -> std::chrono::nanoseconds;
     void Initialize();
     bool IsBlocking() const;
 
@@ -58,12 +71,35 @@ public: //Methods
     bool IsHopOn();
     bool HoppedOn();
 
+private: //Types
+    struct OtherNextTask
+    {
+        NextSimTask task;
+        std::chrono::nanoseconds minimumReactionDelay{0};
+
+        // Our simulation steps up to this time point cannot be affected by the other participant
+        auto SafeTimePoint() const -> std::chrono::nanoseconds
+        {
+            // No lookahead before the first NextSimTask of the other participant is known
+            return task.timePoint < 0ns ? task.timePoint : task.timePoint + minimumReactionDelay;
+        }
+    };
+
+    struct SafeTimePointLess
+    {
+        bool operator()(const OtherNextTask& lhs, const OtherNextTask& rhs) const
+        {
+            return lhs.SafeTimePoint() < rhs.SafeTimePoint();
+        }
+    };
+
 private: //Members
     mutable std::mutex _mx;
     using Lock = std::unique_lock<decltype(_mx)>;
     NextSimTask _currentTask;
     NextSimTask _myNextTask;
-    std::map<std::string, NextSimTask> _otherNextTasks;
+    // Ordered by the safe time point, so the lowest one of all other participants is available in O(1)
+    Util::IndexedMinHeap<std::string, OtherNextTask, SafeTimePointLess> _otherNextTasks;
     bool _blocking;
 
     bool _hoppedOn = false;
@@ -47,6 +47,27 @@ auto GetDefaultTimerResolution() -> std::chrono::nanoseconds
     return 1ms;
 }
 #endif
+
+// Returns zero if the other participant does not advertise a minimum reaction delay (e.g., older versions)
+auto GetMinimumReactionDelay(const SilKit::Core::ServiceDescriptor& descriptor) -> std::chrono::nanoseconds
+{
+    std::string minimumReactionDelay;
+    if (!descriptor.GetSupplementalDataItem(SilKit::Core::Discovery::timeSyncMinimumReactionDelay,
+                                            minimumReactionDelay))
+    {
+        return 0ns;
+    }
+
+    try
+    {
+        const std::chrono::nanoseconds delay{std::stoll(minimumReactionDelay)};
+        return delay > 0ns ? delay : 0ns;
+    }
+    catch (const std::exception&)
+    {
+        return 0ns;
+    }
+}
 } // namespace
 
 namespace SilKit {
@@ -62,7 +83,11 @@ public:
     virtual void SetSimStepCompleted() = 0;
     virtual auto IsExecutingSimStep() -> bool = 0;
     virtual void ReceiveNextSimTask(const Core::IServiceEndpoint* from, const NextSimTask& task) = 0;
+    virtual void ReceiveUserDataMessageCounts(const Core::IServiceEndpoint* from,
+                                              const UserDataMessageCounts& counts) = 0;
     virtual void ProcessSimulationTimeUpdate() = 0;
+    virtual void SynchronizedParticipantAdded(const std::string& participantName) = 0;
+    virtual void SynchronizedParticipantRemoved(const std::string& participantName) = 0;
 };
 
 //! brief Synchronization policy for unsynchronized participants
@@ -78,7 +103,13 @@ public:
         return false;
     }
     void ReceiveNextSimTask(const Core::IServiceEndpoint* /*from*/, const NextSimTask& /*task*/) override {}
+    void ReceiveUserDataMessageCounts(const Core::IServiceEndpoint* /*from*/,
+                                      const UserDataMessageCounts& /*counts*/) override
+    {
+    }
     void ProcessSimulationTimeUpdate() override {};
+    void SynchronizedParticipantAdded(const std::string& /*participantName*/) override {}
+    void SynchronizedParticipantRemoved(const std::string& /*participantName*/) override {}
 };
 
 //! brief Synchronization policy of the VAsio middleware
@@ -119,7 +150,7 @@ public:
                 != _configuration->NextSimStep().timePoint) // Prevent sending same step more than once
             {
                 _lastSentNextSimTask = _configuration->NextSimStep().timePoint;
-                _controller.SendMsg(_configuration->NextSimStep());
+                _controller.SendNextSimTask(_configuration->NextSimStep());
             }
             // Bootstrap checked execution, in case there is no other participant.
             // Else, checked execution is initiated when we receive their NextSimTask messages.
@@ -129,7 +160,8 @@ public:
 
     void ReceiveNextSimTask(const Core::IServiceEndpoint* from, const NextSimTask& task) override
     {
-        _configuration->OnReceiveNextSimStep(from->GetServiceDescriptor().GetParticipantName(), task);
+        const auto& participantName = from->GetServiceDescriptor().GetParticipantName();
+        _configuration->OnReceiveNextSimStep(participantName, task);
 
         switch (_controller.State())
         {
@@ -138,9 +170,11 @@ public:
         case ParticipantState::CommunicationInitializing: // [[fallthrough]]
         case ParticipantState::CommunicationInitialized: // [[fallthrough]]
         case ParticipantState::ReadyToRun:
+            DelayReceivedUserDataMessages(participantName, task);
             return;
         case ParticipantState::Paused: // [[fallthrough]]
         case ParticipantState::Running:
+            DelayReceivedUserDataMessages(participantName, task);
             ProcessSimulationTimeUpdate();
             return;
         case ParticipantState::Stopping: // [[fallthrough]]
@@ -148,6 +182,7 @@ public:
         case ParticipantState::Error: // [[fallthrough]]
         case ParticipantState::ShuttingDown: // [[fallthrough]]
         case ParticipantState::Shutdown: // [[fallthrough]]
+            // No simulation step follows, the held back user data messages were released when the time stopped
             return;
         default:
             _participant->GetLifecycleService()->ReportError("Received NextSimTask in state ParticipantState::"
@@ -156,6 +191,43 @@ public:
         }
     }
 
+    void ReceiveUserDataMessageCounts(const Core::IServiceEndpoint* /*from*/,
+                                      const UserDataMessageCounts& counts) override
+    {
+        // The counts precede the grant of the aggregator, which could overtake the user data messages of the previous
+        // simulation steps of the other participants otherwise
+        std::map<std::string, uint64_t> awaitedCounts;
+        for (const auto& count : counts.counts)
+        {
+            awaitedCounts[count.participantName] = count.count;
+        }
+
+        _isWaitingForUserDataMessages = true;
+        _participant->AwaitReceivedUserDataMessages(std::move(awaitedCounts), [this] {
+            _isWaitingForUserDataMessages = false;
+            ProcessSimulationTimeUpdate();
+        });
+    }
+
+    void SynchronizedParticipantAdded(const std::string& participantName) override
+    {
+        // If our time has advanced, we just added a late-joining participant.
+        // The aggregator may also have missed our first NextSimTask, if it was sent before the aggregator connected.
+        const auto resendToAggregator = _controller.IsTimeSyncAggregated() && _lastSentNextSimTask >= 0ns;
+        if (_configuration->CurrentSimStep().timePoint >= 0ns || resendToAggregator)
+        {
+            // Resend our NextSimTask again because it is not assured that the late-joiner has seen our last update.
+            // At this point, the late-joiner will receive it because its TimeSyncPolicy is configured when the
+            // discovery arrives that triggered this handler.
+            Debug(_participant->GetLogger(),
+                  "Participant \'{}\' is joining an already running simulation. Resending our NextSimTask.",
+                  participantName);
+            _controller.SendNextSimTask(_configuration->NextSimStep());
+        }
+    }
+
+    void SynchronizedParticipantRemoved(const std::string& /*participantName*/) override {}
+
     void ProcessSimulationTimeUpdate() override
     {
         // Check if we meet the conditions to trigger our local time advancement
@@ -178,6 +250,18 @@ private:
         return _configuration->IsBlocking();
     }
 
+    void DelayReceivedUserDataMessages(const std::string& participantName, const NextSimTask& task)
+    {
+        // The following user data messages belong to the simulation step of the task. They are held back until our
+        // first step after the time point plus the minimum reaction delay, which waits for the next NextSimTask of the
+        // participant. Otherwise, the step they arrive in would depend on the scheduling.
+        const auto minimumReactionDelay = _configuration->GetMinimumReactionDelay(participantName);
+        if (minimumReactionDelay > 0ns)
+        {
+            _participant->DelayReceivedUserDataMessages(participantName, task.timePoint + minimumReactionDelay);
+        }
+    }
+
     bool IsTimeAdvancePossible()
     {
         // Deferred execution of this callback was initiated, but simulation stopped/paused in the meantime
@@ -205,6 +289,12 @@ private:
             return false;
         }
 
+        // The user data messages sent before the grant of the aggregator have not arrived yet
+        if (_isWaitingForUserDataMessages)
+        {
+            return false;
+        }
+
         // With real-time sync, the time advance is not possible if less then current real-time.
         if (_controller.IsCoupledToWallClock())
         {
@@ -278,11 +368,13 @@ private:
             _configuration->AdvanceTimeStep();
             // Execute the simulation step callback with the current simulation time
             auto currentStep = _configuration->CurrentSimStep();
+            _participant->ReleaseReceivedUserDataMessages(currentStep.timePoint);
             _controller.ExecuteSimStep(currentStep.timePoint, currentStep.duration);
         }
     }
 
     std::atomic<bool> _isExecutingSimStep{false};
+    std::atomic<bool> _isWaitingForUserDataMessages{false};
     TimeSyncService& _controller;
     std::chrono::nanoseconds _lastSentNextSimTask{-1ns};
     Core::IParticipantInternal* _participant;
@@ -290,9 +382,139 @@ private:
     bool _hopOnEvaluated = false;
 };
 
+//! brief Synchronization policy of the time synchronization aggregator
+//!
+//! The aggregator collects the NextSimTask of all synchronized participants and grants the lowest safe time point to
+//! all of them at once. The grant is sent as a NextSimTask, so each participant waits for a single other participant,
+//! and the number of messages per simulation step grows linearly with the number of participants.
+//!
+//! The user data messages between the participants travel on other connections than the grant. The participants send
+//! the number of user data messages they sent to each other participant before their NextSimTask, and the aggregator
+//! forwards the changed numbers to the receivers before its next grant, so they wait for the messages.
+struct AggregatorPolicy : public ITimeSyncPolicy
+{
+public:
+    AggregatorPolicy(TimeSyncService& controller, Core::IParticipantInternal* participant,
+                     TimeConfiguration* configuration)
+        : _controller(controller)
+        , _participant(participant)
+        , _configuration(configuration)
+    {
+    }
+
+    void Initialize() override
+    {
+        _configuration->Initialize();
+        _lastGrant.timePoint = -1ns;
+        _lastGrant.duration = 0ns;
+    }
+
+    void RequestNextStep() override
+    {
+        Grant();
+    }
+
+    void SetSimStepCompleted() override {}
+
+    auto IsExecutingSimStep() -> bool override
+    {
+        return false;
+    }
+
+    void ReceiveNextSimTask(const Core::IServiceEndpoint* from, const NextSimTask& task) override
+    {
+        _configuration->OnReceiveNextSimStep(from->GetServiceDescriptor().GetParticipantName(), task);
+        Grant();
+    }
+
+    void ReceiveUserDataMessageCounts(const Core::IServiceEndpoint* from, const UserDataMessageCounts& counts) override
+    {
+        const auto& senderName = from->GetServiceDescriptor().GetParticipantName();
+        for (const auto& count : counts.counts)
+        {
+            // participants which are not synchronized (e.g., the aggregator itself) do not wait for a grant
+            if (_configuration->IsSynchronizedParticipant(count.participantName))
+            {
+                _changedUserDataMessageCounts[count.participantName][senderName] = count.count;
+            }
+        }
+    }
+
+    void ProcessSimulationTimeUpdate() override
+    {
+        Grant();
+    }
+
+    void SynchronizedParticipantAdded(const std::string& participantName) override
+    {
+        if (_lastGrant.timePoint >= 0ns)
+        {
+            // The other participants already received the last grant. The joining participant hops on at its time
+            // point, which cannot be affected by the joining participant, as no other participant advances beyond it
+            // before the joining participant sent its NextSimTask.
+            Debug(_participant->GetLogger(),
+                  "Participant \'{}\' is joining an already running simulation. Sending the last time grant.",
+                  participantName);
+            _participant->SendMsg(&_controller, participantName, _lastGrant);
+        }
+    }
+
+    void SynchronizedParticipantRemoved(const std::string& participantName) override
+    {
+        // a returning participant counts its user data messages from zero again
+        _changedUserDataMessageCounts.erase(participantName);
+        for (auto&& receiverCounts : _changedUserDataMessageCounts)
+        {
+            receiverCounts.second.erase(participantName);
+        }
+    }
+
+private:
+    void Grant()
+    {
+        if (_controller.State() != ParticipantState::Running)
+        {
+            return;
+        }
+
+        // Grants never go back in time, e.g., when a participant joins the running simulation
+        const auto grantedTimePoint = _configuration->LowestSafeTimePoint();
+        if (grantedTimePoint <= _lastGrant.timePoint)
+        {
+            return;
+        }
+
+        _lastGrant.timePoint = grantedTimePoint;
+        // The duration is the share of the grant which stems from the minimum reaction delays. This way, the hop-on
+        // detection of the participants (time point beyond the duration) only triggers once all participants advanced.
+        _lastGrant.duration = grantedTimePoint - _configuration->LowestTimePoint();
+
+        // the counts travel on the same connection as the grant, so they arrive before it
+        for (const auto& receiverCounts : _changedUserDataMessageCounts)
+        {
+            UserDataMessageCounts counts;
+            for (const auto& senderCount : receiverCounts.second)
+            {
+                counts.counts.push_back({senderCount.first, senderCount.second});
+            }
+            _participant->SendMsg(&_controller, receiverCounts.first, counts);
+        }
+        _changedUserDataMessageCounts.clear();
+
+        _controller.SendNextSimTask(_lastGrant);
+    }
+
+    TimeSyncService& _controller;
+    Core::IParticipantInternal* _participant;
+    TimeConfiguration* _configuration;
+    NextSimTask _lastGrant;
+    // The numbers of user data messages which changed since the last grant, by receiver and sender
+    std::map<std::string, std::map<std::string, uint64_t>> _changedUserDataMessageCounts;
+};
+
 TimeSyncService::TimeSyncService(Core::IParticipantInternal* participant, ITimeProvider* timeProvider,
                                  const Config::HealthCheck& healthCheckConfig, LifecycleService* lifecycleService,
-                                 double animationFactor)
+                                 double animationFactor, std::string timeSyncAggregator)
     : _participant{participant}
     , _lifecycleService{lifecycleService}
     , _logger{participant->GetLoggerInternal()}
@@ -302,9 +524,27 @@ TimeSyncService::TimeSyncService(Core::IParticipantInternal* participant, ITimeP
     , _simStepHandlerExecutionTimeStatisticMetric{participant->GetMetricsManager()->GetStatistic("SimStepHandlerExecutionDuration")}
     , _simStepCompletionTimeStatisticMetric{participant->GetMetricsManager()->GetStatistic("SimStepCompletionDuration")}
     , _simStepWaitingTimeStatisticMetric{participant->GetMetricsManager()->GetStatistic("SimStepWaitingDuration")}
+    , _simStepHandlerExecutionTimeHistogramMetric{
+          participant->GetMetricsManager()->GetHistogram("SimStepHandlerExecutionDurationNs")}
+    , _simStepCompletionTimeHistogramMetric{
+          participant->GetMetricsManager()->GetHistogram("SimStepCompletionDurationNs")}
+    , _simStepWaitingTimeHistogramMetric{participant->GetMetricsManager()->GetHistogram("SimStepWaitingDurationNs")}
     , _watchDog{healthCheckConfig}
     , _animationFactor{animationFactor}
+    , _timeSyncAggregator{std::move(timeSyncAggregator)}
 {
+    _isTimeSyncAggregator =
+        !_timeSyncAggregator.empty() && _timeSyncAggregator == participant->GetParticipantName();
+    if (_isTimeSyncAggregator)
+    {
+        Debug(_logger, "TimeSyncService: Acting as the time synchronization aggregator");
+    }
+    else if (IsTimeSyncAggregated())
+    {
+        Debug(_logger, "TimeSyncService: Synchronizing with the time grants of aggregator \'{}\'",
+              _timeSyncAggregator);
+    }
+
     _isCoupledToWallClock = _animationFactor != 0.0;
     if (_isCoupledToWallClock)
     {
@@ -354,27 +594,69 @@ TimeSyncService::TimeSyncService(Core::IParticipantInternal* participant, ITimeP
                             return;
                         }
 
+                        // Participants with and without (or with another) aggregator would wait for each other
+                        std::string timeSyncAggregator;
+                        descriptor.GetSupplementalDataItem(Core::Discovery::timeSyncAggregator, timeSyncAggregator);
+                        if (timeSyncAggregator != _timeSyncAggregator)
+                        {
+                            Logging::LoggerMessage lm{_logger, Logging::Level::Error};
+                            lm.SetMessage("The participant uses another time synchronization aggregator. Aborting "
+                                          "simulation...");
+                            lm.SetKeyValue(Logging::Keys::participantName, descriptorParticipantName);
+                            lm.Dispatch();
+
+                            _participant->GetSystemController()->AbortSimulation();
+                            return;
+                        }
+
+                        if (IsTimeSyncAggregated() && descriptorParticipantName != _timeSyncAggregator)
+                        {
+                            // only the time grants of the aggregator are relevant
+                            return;
+                        }
+
                         Debug(_participant->GetLogger(),
                               "TimeSyncService: Participant \'{}\' is added to the distributed time synchronization",
                               descriptorParticipantName);
 
-                        _timeConfiguration.AddSynchronizedParticipant(descriptorParticipantName);
-
-                        // If our time has advanced, we just added a late-joining participant.
-                        if (_timeConfiguration.CurrentSimStep().timePoint >= 0ns)
+                        const auto minimumReactionDelay = GetMinimumReactionDelay(descriptor);
+                        if (minimumReactionDelay > 0ns)
                         {
-                            // Resend our NextSimTask again because it is not assured that the late-joiner has seen our last update.
-                            // At this point, the late-joiner will receive it because its TimeSyncPolicy is configured when the
-                            // discovery arrives that triggered this handler.
                             Debug(_participant->GetLogger(),
-                                  "Participant \'{}\' is joining an already running simulation. Resending our "
-                                  "NextSimTask.",
-                                  descriptorParticipantName);
-                            SendMsg(_timeConfiguration.NextSimStep());
+                                  "TimeSyncService: Participant \'{}\' has a minimum reaction delay of {}ns",
+                                  descriptorParticipantName, minimumReactionDelay.count());
+                        }
+
+                        _timeConfiguration.AddSynchronizedParticipant(descriptorParticipantName,
+                                                                      minimumReactionDelay);
+
+                        if (_timeSyncPolicy)
+                        {
+                            GetTimeSyncPolicy()->SynchronizedParticipantAdded(descriptorParticipantName);
                         }
                     }
                     else if (discoveryEventType == Core::Discovery::ServiceDiscoveryEvent::Type::ServiceRemoved)
                     {
+                        if (IsTimeSyncAggregated() && descriptorParticipantName == _timeSyncAggregator)
+                        {
+                            // Without the aggregator, the time of the other participants is unknown
+                            Warn(_logger,
+                                 "TimeSyncService: The time synchronization aggregator '{}' left the simulation. "
+                                 "Waiting for its return.",
+                                 descriptorParticipantName);
+
+                            // The grants of a returning aggregator start over, keep waiting for them
+                            _timeConfiguration.RemoveSynchronizedParticipant(descriptorParticipantName);
+                            _timeConfiguration.AddSynchronizedParticipant(descriptorParticipantName);
+                            return;
+                        }
+
+                        if (IsTimeSyncAggregated())
+                        {
+                            // the connection stops waiting for the user data messages of a leaving participant
+                            return;
+                        }
+
                         // Other participant hopped off
                         if (_timeConfiguration.RemoveSynchronizedParticipant(descriptorParticipantName))
                         {
@@ -385,6 +667,7 @@ TimeSyncService::TimeSyncService(Core::IParticipantInternal* participant, ITimeP
 
                             if (_timeSyncPolicy)
                             {
+                                GetTimeSyncPolicy()->SynchronizedParticipantRemoved(descriptorParticipantName);
                                 // _otherNextTasks has changed, check if our sim task is due
                                 GetTimeSyncPolicy()->ProcessSimulationTimeUpdate();
                             }
@@ -425,6 +708,36 @@ auto TimeSyncService::IsCoupledToWallClock() const -> bool
     return _isCoupledToWallClock;
 }
 
+auto TimeSyncService::IsTimeSyncAggregated() const -> bool
+{
+    return !_timeSyncAggregator.empty() && !_isTimeSyncAggregator;
+}
+
+void TimeSyncService::SendNextSimTask(const NextSimTask& task)
+{
+    if (IsTimeSyncAggregated())
+    {
+        // Deferred, so that the user data messages sent before (e.g., in the simulation step) are handed over first.
+        // The aggregator forwards their numbers to the receivers before its grant, which could overtake them otherwise.
+        _participant->ExecuteDeferred([this, task] {
+            UserDataMessageCounts counts;
+            for (const auto& receiverCount : _participant->TakeSentUserDataMessageCounts())
+            {
+                counts.counts.push_back({receiverCount.first, receiverCount.second});
+            }
+            if (!counts.counts.empty())
+            {
+                _participant->SendMsg(this, _timeSyncAggregator, counts);
+            }
+            _participant->SendMsg(this, _timeSyncAggregator, task);
+        });
+    }
+    else
+    {
+        _participant->SendMsg(this, task);
+    }
+}
+
 void TimeSyncService::RequestNextStep()
 {
     _participant->ExecuteDeferred([this] { GetTimeSyncPolicy()->RequestNextStep(); });
@@ -460,8 +773,17 @@ bool TimeSyncService::SetupTimeSyncPolicy(bool isSynchronizingVirtualTime)
     }
 
     _timeSyncConfigured = true;
-    if (isSynchronizingVirtualTime)
+    if (isSynchronizingVirtualTime && _isTimeSyncAggregator)
+    {
+        _timeSyncPolicy = std::make_shared<AggregatorPolicy>(*this, _participant, &_timeConfiguration);
+    }
+    else if (isSynchronizingVirtualTime)
     {
+        if (IsTimeSyncAggregated())
+        {
+            // Wait for the time grants of the aggregator, even before it is discovered
+            _timeConfiguration.AddSynchronizedParticipant(_timeSyncAggregator);
+        }
         _timeSyncPolicy = std::make_shared<SynchronizedPolicy>(*this, _participant, &_timeConfiguration);
     }
     else
@@ -488,6 +810,15 @@ void TimeSyncService::ReceiveMsg(const IServiceEndpoint* from, const NextSimTask
     }
 }
 
+void TimeSyncService::ReceiveMsg(const IServiceEndpoint* from, const UserDataMessageCounts& counts)
+{
+    const auto timeSyncPolicy = GetTimeSyncPolicy();
+    if (timeSyncPolicy != nullptr)
+    {
+        timeSyncPolicy->ReceiveUserDataMessageCounts(from, counts);
+    }
+}
+
 void TimeSyncService::ExecuteSimStep(std::chrono::nanoseconds timePoint, std::chrono::nanoseconds duration)
 {
     SILKIT_ASSERT(_simTask);
@@ -511,6 +842,7 @@ void TimeSyncService::ExecuteSimStep(std::chrono::nanoseconds timePoint, std::ch
     {
         // skip the first sample, since it was never 'started' (it is always the current epoch of the underlying clock)
         _simStepWaitingTimeStatisticMetric->Take(waitingDurationS.count());
+        _simStepWaitingTimeHistogramMetric->Take(static_cast<uint64_t>(waitingDuration.count()));
     }
 
     _timeProvider->SetTime(timePoint, duration);
@@ -531,6 +863,7 @@ void TimeSyncService::ExecuteSimStep(std::chrono::nanoseconds timePoint, std::ch
     const auto executionDurationMs = std::chrono::duration_cast<DoubleMSecs>(executionDuration);
     const auto executionDurationS = std::chrono::duration_cast<DoubleSecs>(executionDuration);
     _simStepHandlerExecutionTimeStatisticMetric->Take(executionDurationS.count());
+    _simStepHandlerExecutionTimeHistogramMetric->Take(static_cast<uint64_t>(executionDuration.count()));
     _lastHandlerExecutionTimeMs = executionDurationMs;
 
     if (IsBlocking())
@@ -575,6 +908,7 @@ void TimeSyncService::CompleteSimulationStep()
         const auto completionDurationMs = std::chrono::duration_cast<DoubleMSecs>(completionDuration);
         const auto completionDurationS = std::chrono::duration_cast<DoubleSecs>(completionDuration);
         _simStepCompletionTimeStatisticMetric->Take(completionDurationS.count());
+        _simStepCompletionTimeHistogramMetric->Take(static_cast<uint64_t>(completionDuration.count()));
 
         // With the SimulationStepHandlerAsync, the sim step ends here
         LogicalSimStepCompleted(_lastHandlerExecutionTimeMs + completionDurationMs);
@@ -638,6 +972,11 @@ void TimeSyncService::StartTime()
             bool missingCapability = false;
             for (auto&& participantName : _timeConfiguration.GetSynchronizedParticipantNames())
             {
+                if (IsTimeSyncAggregated() && participantName == _timeSyncAggregator)
+                {
+                    // the aggregator is not necessarily connected yet, it is checked once it is discovered
+                    continue;
+                }
                 if (!ParticipantHasAutonomousSynchronousCapability(participantName))
                 {
                     missingCapability = true;
@@ -660,6 +999,11 @@ void TimeSyncService::StopTime()
     {
         StopWallClockCouplingThread();
     }
+
+    // Without simulation steps, the held back user data messages are delivered right away
+    auto* participant = _participant;
+    participant->ExecuteDeferred(
+        [participant] { participant->ReleaseReceivedUserDataMessages(std::chrono::nanoseconds::max()); });
 }
 
 auto TimeSyncService::Now() const -> std::chrono::nanoseconds
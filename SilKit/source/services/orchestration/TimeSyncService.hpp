@@ -61,7 +61,7 @@ public:
     // Constructors, Destructor, and Assignment
     TimeSyncService(Core::IParticipantInternal* participant, ITimeProvider* timeProvider,
                     const Config::HealthCheck& healthCheckConfig, LifecycleService* lifecycleService,
-                    double animationFactor = 0);
+                    double animationFactor = 0, std::string timeSyncAggregator = {});
 
     ~TimeSyncService();
 
@@ -75,11 +75,14 @@ public:
     void CompleteSimulationStep() override;
     void SetPeriod(std::chrono::nanoseconds period);
     void ReceiveMsg(const IServiceEndpoint* from, const NextSimTask& task) override;
+    void ReceiveMsg(const IServiceEndpoint* from, const UserDataMessageCounts& counts) override;
     auto Now() const -> std::chrono::nanoseconds override;
 
     // Used by Policies
     template <class MsgT>
     void SendMsg(MsgT&& msg) const;
+    //! Sends the task to the time synchronization aggregator, if one is used, or to all other participants.
+    void SendNextSimTask(const NextSimTask& task);
     void ExecuteSimStep(std::chrono::nanoseconds timePoint, std::chrono::nanoseconds duration);
 
     // Get the instance of the internal ITimeProvider that is updated with our simulation time
@@ -107,6 +110,8 @@ public:
     void RequestNextStep();
 
     auto IsCoupledToWallClock() const -> bool;
+    //! This participant only synchronizes with the time grants of an aggregator.
+    auto IsTimeSyncAggregated() const -> bool;
     auto GetCurrentWallClockSyncPoint() const -> std::chrono::nanoseconds;
 
     bool IsBlocking() const;
@@ -141,6 +146,9 @@ private:
     VSilKit::IStatisticMetric* _simStepHandlerExecutionTimeStatisticMetric;
     VSilKit::IStatisticMetric* _simStepCompletionTimeStatisticMetric;
     VSilKit::IStatisticMetric* _simStepWaitingTimeStatisticMetric;
+    VSilKit::IHistogramMetric* _simStepHandlerExecutionTimeHistogramMetric;
+    VSilKit::IHistogramMetric* _simStepCompletionTimeHistogramMetric;
+    VSilKit::IHistogramMetric* _simStepWaitingTimeHistogramMetric;
     std::chrono::duration<double, std::milli> _lastHandlerExecutionTimeMs;
 
     mutable std::mutex _timeSyncPolicyMx;
@@ -165,6 +173,8 @@ private:
     double _animationFactor{0};
     std::atomic<bool> _wallClockCouplingThreadRunning{false};
     std::atomic<bool> _wallClockReachedBeforeCompletion{false};
+    std::string _timeSyncAggregator;
+    bool _isTimeSyncAggregator{false};
 };
 
 // ================================================================================
@@ -0,0 +1,234 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "DataMessageFilter.hpp"
+
+#include <algorithm>
+#include <vector>
+
+#include "ServiceConfigKeys.hpp"
+#include "YamlParser.hpp"
+
+namespace SilKit {
+namespace Services {
+namespace PubSub {
+
+DataMessageFilter::DataMessageFilter(Config::DataSubscriberFilter filter)
+    : _filter{std::move(filter)}
+{
+}
+
+bool DataMessageFilter::Matches(Util::Span<const uint8_t> data) const
+{
+    const auto& pattern = _filter.payloadPattern;
+    if (pattern.empty())
+    {
+        return true;
+    }
+
+    if (_filter.payloadOffset > data.size() || pattern.size() > data.size() - _filter.payloadOffset)
+    {
+        return false;
+    }
+
+    return std::equal(pattern.begin(), pattern.end(), data.begin() + _filter.payloadOffset);
+}
+
+bool DataMessageFilter::Accept(Util::Span<const uint8_t> data, bool applyDecimation)
+{
+    if (!Matches(data))
+    {
+        return false;
+    }
+
+    if (!applyDecimation || _filter.decimation <= 1)
+    {
+        return true;
+    }
+
+    return (_numMatching++ % _filter.decimation) == 0;
+}
+
+auto DataMessageFilter::GetFilter() const -> const Config::DataSubscriberFilter&
+{
+    return _filter;
+}
+
+bool PublisherAppliesDecimation(const std::vector<Util::Optional<Config::DataSubscriberFilter>>& filters)
+{
+    if (filters.empty() || !filters.front().has_value())
+    {
+        return false;
+    }
+
+    const auto& first = filters.front();
+    return std::all_of(filters.begin(), filters.end(), [&first](const auto& filter) { return filter == first; });
+}
+
+namespace {
+
+bool IsDataSubscriberInternal(const Core::ServiceDescriptor& serviceDescriptor)
+{
+    std::string controllerType;
+    return serviceDescriptor.GetServiceType() == Core::ServiceType::Controller
+           && serviceDescriptor.GetSupplementalDataItem(Core::Discovery::controllerType, controllerType)
+           && controllerType == Core::Discovery::controllerTypeDataSubscriberInternal;
+}
+
+} // namespace
+
+void RemoteDataSubscriberFilters::AddPublisherNetwork(const std::string& networkName)
+{
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+    _publisherNetworks.insert(networkName);
+}
+
+bool RemoteDataSubscriberFilters::AddService(const Core::ServiceDescriptor& serviceDescriptor)
+{
+    if (!IsDataSubscriberInternal(serviceDescriptor))
+    {
+        return false;
+    }
+
+    Util::Optional<Config::DataSubscriberFilter> filter;
+    std::string filterStr;
+    if (serviceDescriptor.GetSupplementalDataItem(Core::Discovery::supplKeyDataSubscriberInternalFilter, filterStr))
+    {
+        filter = Config::Deserialize<Config::DataSubscriberFilter>(filterStr);
+    }
+
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+    if (_publisherNetworks.count(serviceDescriptor.GetNetworkName()) == 0)
+    {
+        return false;
+    }
+
+    auto& serviceFilters = _filtersByParticipant[{serviceDescriptor.GetNetworkName(),
+                                                  serviceDescriptor.GetParticipantName()}];
+    serviceFilters[serviceDescriptor.GetServiceId()] = std::move(filter);
+    return true;
+}
+
+bool RemoteDataSubscriberFilters::RemoveService(const Core::ServiceDescriptor& serviceDescriptor)
+{
+    if (!IsDataSubscriberInternal(serviceDescriptor))
+    {
+        return false;
+    }
+
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+    if (_publisherNetworks.count(serviceDescriptor.GetNetworkName()) == 0)
+    {
+        return false;
+    }
+
+    auto it = _filtersByParticipant.find({serviceDescriptor.GetNetworkName(), serviceDescriptor.GetParticipantName()});
+    if (it != _filtersByParticipant.end())
+    {
+        it->second.erase(serviceDescriptor.GetServiceId());
+        if (it->second.empty())
+        {
+            _decimatingFilters.erase(it->first);
+            _filtersByParticipant.erase(it);
+        }
+    }
+    return true;
+}
+
+auto RemoteDataSubscriberFilters::GetMessageFilter(const std::string& networkName,
+                                                   const std::string& participantName) const -> MessageFilter
+{
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+    auto it = _filtersByParticipant.find({networkName, participantName});
+    if (it == _filtersByParticipant.end())
+    {
+        return nullptr;
+    }
+
+    std::vector<Util::Optional<Config::DataSubscriberFilter>> serviceFilters;
+    for (const auto& service : it->second)
+    {
+        if (!service.second.has_value())
+        {
+            return nullptr;
+        }
+        serviceFilters.push_back(service.second);
+    }
+
+    if (PublisherAppliesDecimation(serviceFilters))
+    {
+        // all subscribers have the same filter, so the decimation is applied once for all of them
+        auto& filter = _decimatingFilters[it->first];
+        if (filter == nullptr || !(filter->GetFilter() == serviceFilters.front().value()))
+        {
+            filter = std::make_shared<DataMessageFilter>(serviceFilters.front().value());
+        }
+        return [filter](const WireDataMessageEvent& msg) { return filter->Accept(msg.data.AsSpan()); };
+    }
+
+    std::vector<DataMessageFilter> filters;
+    for (const auto& serviceFilter : serviceFilters)
+    {
+        filters.emplace_back(serviceFilter.value());
+    }
+
+    // the subscribers apply their different decimations by themselves
+    return [filters = std::move(filters)](const WireDataMessageEvent& msg) {
+        const auto data = msg.data.AsSpan();
+        return std::any_of(filters.begin(), filters.end(),
+                           [data](const DataMessageFilter& filter) { return filter.Matches(data); });
+    };
+}
+
+void LocalDataSubscriberFilters::AddSubscriber(const std::string& networkName, Core::EndpointId serviceId,
+                                               Util::Optional<Config::DataSubscriberFilter> filter,
+                                               DecimationHandler handler)
+{
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+    auto& subscribers = _subscribersByNetwork[networkName];
+    subscribers.push_back(Subscriber{serviceId, std::move(filter), std::move(handler)});
+
+    UpdateDecimation(subscribers);
+}
+
+void LocalDataSubscriberFilters::RemoveSubscriber(const std::string& networkName, Core::EndpointId serviceId)
+{
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+    auto it = _subscribersByNetwork.find(networkName);
+    if (it == _subscribersByNetwork.end())
+    {
+        return;
+    }
+
+    auto& subscribers = it->second;
+    auto isRemoved = [serviceId](const Subscriber& subscriber) { return subscriber.serviceId == serviceId; };
+    subscribers.erase(std::remove_if(subscribers.begin(), subscribers.end(), isRemoved), subscribers.end());
+
+    if (subscribers.empty())
+    {
+        _subscribersByNetwork.erase(it);
+        return;
+    }
+
+    UpdateDecimation(subscribers);
+}
+
+void LocalDataSubscriberFilters::UpdateDecimation(const std::vector<Subscriber>& subscribers)
+{
+    std::vector<Util::Optional<Config::DataSubscriberFilter>> filters;
+    for (const auto& subscriber : subscribers)
+    {
+        filters.push_back(subscriber.filter);
+    }
+
+    const auto publisherAppliesDecimation = PublisherAppliesDecimation(filters);
+    for (const auto& subscriber : subscribers)
+    {
+        subscriber.handler(publisherAppliesDecimation);
+    }
+}
+
+} // namespace PubSub
+} // namespace Services
+} // namespace SilKit
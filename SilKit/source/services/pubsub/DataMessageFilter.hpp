@@ -0,0 +1,152 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "silkit/util/Span.hpp"
+
+#include "ParticipantConfiguration.hpp"
+#include "ServiceDescriptor.hpp"
+#include "WireDataMessages.hpp"
+
+namespace SilKit {
+namespace Services {
+namespace PubSub {
+
+//! \brief Applies the content filter of a DataSubscriber to the messages of a single publisher.
+class DataMessageFilter
+{
+public:
+    // ----------------------------------------
+    // Constructors and Destructor
+    DataMessageFilter() = default;
+    explicit DataMessageFilter(Config::DataSubscriberFilter filter);
+
+public:
+    // ----------------------------------------
+    // Public Methods
+
+    //! True if the payload contains the pattern of the filter at its offset.
+    bool Matches(Util::Span<const uint8_t> data) const;
+
+    //! True if the payload matches and, if the decimation is applied, it is the n-th matching payload.
+    bool Accept(Util::Span<const uint8_t> data, bool applyDecimation = true);
+
+    auto GetFilter() const -> const Config::DataSubscriberFilter&;
+
+private:
+    // ----------------------------------------
+    // Private Members
+    Config::DataSubscriberFilter _filter;
+    uint64_t _numMatching{0};
+};
+
+//! True if the publisher applies the decimation for a participant with internal subscribers of these filters. This is
+//! only the case if all of them have the same filter, otherwise each subscriber would get the rate of the least
+//! decimated one. The subscribers then apply their decimation on reception.
+bool PublisherAppliesDecimation(const std::vector<Util::Optional<Config::DataSubscriberFilter>>& filters);
+
+//! \brief Tracks the content filters of the DataSubscribers of remote participants.
+//!
+//! A message of a publisher is only sent to a participant if the filter of any of its internal subscribers of the
+//! publisher accepts it. A participant receives all messages if any of these subscribers has no filter.
+class RemoteDataSubscriberFilters
+{
+public:
+    // ----------------------------------------
+    // Public Data Types
+    using MessageFilter = std::function<bool(const WireDataMessageEvent&)>;
+
+public:
+    // ----------------------------------------
+    // Public Methods
+
+    //! Only the subscribers of the publishers of this participant are tracked, each publisher has a unique network.
+    void AddPublisherNetwork(const std::string& networkName);
+
+    //! Returns false if the service is not relevant for the content filters.
+    bool AddService(const Core::ServiceDescriptor& serviceDescriptor);
+    //! Returns false if the service is not relevant for the content filters.
+    bool RemoveService(const Core::ServiceDescriptor& serviceDescriptor);
+
+    //! The filter for the messages sent to the participant on the network, nullptr if it receives all messages.
+    //! The returned filter keeps the decimation state and must only be used by a single thread. Filters returned for
+    //! the same participant share this state while the decimated filter is unchanged, such that replacing the filter
+    //! after a discovery does not restart the decimation.
+    auto GetMessageFilter(const std::string& networkName, const std::string& participantName) const -> MessageFilter;
+
+private:
+    // ----------------------------------------
+    // Private Data Types
+    using ParticipantKey = std::pair<std::string, std::string>;
+    // an unset filter accepts all messages
+    using ServiceFilters = std::map<Core::EndpointId, Util::Optional<Config::DataSubscriberFilter>>;
+
+private:
+    // ----------------------------------------
+    // Private Members
+    mutable std::mutex _mutex;
+    std::set<std::string> _publisherNetworks;
+    std::map<ParticipantKey, ServiceFilters> _filtersByParticipant;
+    // the decimation state of the last filter applied by the publisher
+    mutable std::map<ParticipantKey, std::shared_ptr<DataMessageFilter>> _decimatingFilters;
+};
+
+//! \brief Tracks the content filters of the internal DataSubscribers of this participant.
+//!
+//! Tells the internal subscribers of a publisher whether the publisher applies their decimation, by the same rule as
+//! the publisher uses for the filters tracked by RemoteDataSubscriberFilters.
+class LocalDataSubscriberFilters
+{
+public:
+    // ----------------------------------------
+    // Public Data Types
+    using DecimationHandler = std::function<void(bool publisherAppliesDecimation)>;
+
+public:
+    // ----------------------------------------
+    // Public Methods
+
+    //! The handlers of all internal subscribers of the publisher's network are called with the updated decision.
+    void AddSubscriber(const std::string& networkName, Core::EndpointId serviceId,
+                       Util::Optional<Config::DataSubscriberFilter> filter, DecimationHandler handler);
+    //! Drops the handler of the subscriber, the handlers of the remaining subscribers are called with the updated
+    //! decision.
+    void RemoveSubscriber(const std::string& networkName, Core::EndpointId serviceId);
+
+private:
+    // ----------------------------------------
+    // Private Data Types
+    struct Subscriber
+    {
+        Core::EndpointId serviceId;
+        Util::Optional<Config::DataSubscriberFilter> filter;
+        DecimationHandler handler;
+    };
+
+private:
+    // ----------------------------------------
+    // Private Methods
+    static void UpdateDecimation(const std::vector<Subscriber>& subscribers);
+
+private:
+    // ----------------------------------------
+    // Private Members
+    std::mutex _mutex;
+    std::map<std::string, std::vector<Subscriber>> _subscribersByNetwork;
+};
+
+} // namespace PubSub
+} // namespace Services
+} // namespace SilKit
@@ -48,6 +48,12 @@ void Deserialize(SilKit::Core::MessageBuffer& buffer, WireDataMessageEvent& out)
     buffer >> out;
 }
 
+auto SerializedSizeOf(const WireDataMessageEvent& msg) -> size_t
+{
+    using SilKit::Core::SerializedSizeOf;
+    return SerializedSizeOf(msg.data) + SerializedSizeOf(msg.timestamp);
+}
+
 } // namespace PubSub
 } // namespace Services
 } // namespace SilKit
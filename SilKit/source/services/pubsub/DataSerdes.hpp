@@ -33,6 +33,8 @@ namespace PubSub {
 void Serialize(SilKit::Core::MessageBuffer& buffer, const WireDataMessageEvent& msg);
 void Deserialize(SilKit::Core::MessageBuffer& buffer, WireDataMessageEvent& out);
 
+auto SerializedSizeOf(const WireDataMessageEvent& msg) -> size_t;
+
 } // namespace PubSub
 } // namespace Services
 } // namespace SilKit
@@ -81,7 +81,14 @@ void DataSubscriber::RegisterServiceDiscovery()
 
                     if (discoveryType == SilKit::Core::Discovery::ServiceDiscoveryEvent::Type::ServiceCreated)
                     {
-                        AddInternalSubscriber(pubUUID, pubMediaType, publisherLabels);
+                        // messages of a local publisher are not sent via the network and are therefore not filtered
+                        std::string appliesFilters;
+                        const bool publisherAppliesFilter =
+                            serviceDescriptor.GetParticipantName() != _participant->GetParticipantName()
+                            && serviceDescriptor.GetSupplementalDataItem(
+                                Core::Discovery::supplKeyDataPublisherAppliesSubscriberFilters, appliesFilters)
+                            && appliesFilters == "1";
+                        AddInternalSubscriber(pubUUID, pubMediaType, publisherLabels, publisherAppliesFilter);
                     }
                     else if (discoveryType == SilKit::Core::Discovery::ServiceDiscoveryEvent::Type::ServiceRemoved)
                     {
@@ -109,10 +116,15 @@ void DataSubscriber::SetDataMessageHandler(DataMessageHandler callback)
 }
 
 void DataSubscriber::AddInternalSubscriber(const std::string& pubUUID, const std::string& joinedMediaType,
-                                           const std::vector<SilKit::Services::MatchingLabel>& publisherLabels)
+                                           const std::vector<SilKit::Services::MatchingLabel>& publisherLabels,
+                                           bool publisherAppliesFilter)
 {
     auto internalSubscriber = dynamic_cast<DataSubscriberInternal*>(_participant->CreateDataSubscriberInternal(
         _topic, pubUUID, joinedMediaType, publisherLabels, _defaultDataHandler, this));
+    if (internalSubscriber)
+    {
+        internalSubscriber->SetPublisherAppliesFilter(publisherAppliesFilter);
+    }
 
     _internalSubscribers.emplace(pubUUID, internalSubscriber);
 }
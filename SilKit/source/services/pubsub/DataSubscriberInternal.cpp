@@ -45,7 +45,12 @@ DataSubscriberInternal::DataSubscriberInternal(Core::IParticipantInternal* parti
 
     if (_parent)
     {
-        _replayConfig = dynamic_cast<DataSubscriber&>(*_parent).GetConfig().replay;
+        const auto& parentConfig = dynamic_cast<DataSubscriber&>(*_parent).GetConfig();
+        _replayConfig = parentConfig.replay;
+        if (parentConfig.filter.has_value())
+        {
+            _filter = DataMessageFilter{parentConfig.filter.value()};
+        }
     }
 }
 
@@ -54,6 +59,16 @@ void DataSubscriberInternal::SetDataMessageHandler(DataMessageHandler handler)
     _defaultHandler = std::move(handler);
 }
 
+void DataSubscriberInternal::SetPublisherAppliesFilter(bool publisherAppliesFilter)
+{
+    _publisherAppliesFilter = publisherAppliesFilter;
+}
+
+void DataSubscriberInternal::SetPublisherAppliesDecimation(bool publisherAppliesDecimation)
+{
+    _publisherAppliesDecimation = publisherAppliesDecimation;
+}
+
 void DataSubscriberInternal::ReceiveMsg(const IServiceEndpoint* /*from*/, const WireDataMessageEvent& dataMessageEvent)
 {
     if (Tracing::IsReplayEnabledFor(_replayConfig, Config::Replay::Direction::Receive))
@@ -61,6 +76,12 @@ void DataSubscriberInternal::ReceiveMsg(const IServiceEndpoint* /*from*/, const
         return;
     }
 
+    const bool applyDecimation = !(_publisherAppliesFilter && _publisherAppliesDecimation);
+    if (_filter.has_value() && !_filter.value().Accept(dataMessageEvent.data.AsSpan(), applyDecimation))
+    {
+        return;
+    }
+
     ReceiveInternal(dataMessageEvent);
 }
 
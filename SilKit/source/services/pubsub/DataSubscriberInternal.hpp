@@ -21,6 +21,8 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #pragma once
 
+#include <atomic>
+
 #include "ITimeConsumer.hpp"
 
 #include "IMsgForDataSubscriberInternal.hpp"
@@ -28,6 +30,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "DataMessageDatatypeUtils.hpp"
 #include "SynchronizedHandlers.hpp"
 #include "IReplayDataController.hpp"
+#include "DataMessageFilter.hpp"
 
 namespace SilKit {
 namespace Services {
@@ -48,6 +51,14 @@ public: //Ctor
 public: //Methods
     void SetDataMessageHandler(DataMessageHandler handler);
 
+    //! \brief The content filter is always checked on reception, but the decimation is skipped if the publisher
+    //!        already applies it before sending.
+    void SetPublisherAppliesFilter(bool publisherAppliesFilter);
+
+    //! \brief A publisher which applies the filters does not apply the decimation if the subscribers of this
+    //!        participant have different filters (see PublisherAppliesDecimation).
+    void SetPublisherAppliesDecimation(bool publisherAppliesDecimation);
+
     //! \brief Accepts messages originating from SilKit communications.
     void ReceiveMsg(const IServiceEndpoint* from, const WireDataMessageEvent& dataMessageEvent) override;
 
@@ -81,6 +92,10 @@ private: // Member
 
     Config::Replay _replayConfig;
 
+    Util::Optional<DataMessageFilter> _filter;
+    std::atomic<bool> _publisherAppliesFilter{false};
+    std::atomic<bool> _publisherAppliesDecimation{true};
+
     IDataSubscriber* _parent{nullptr};
     Core::ServiceDescriptor _serviceDescriptor{};
     Services::Orchestration::ITimeProvider* _timeProvider{nullptr};
@@ -0,0 +1,253 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "gtest/gtest.h"
+
+#include "DataMessageFilter.hpp"
+#include "ServiceConfigKeys.hpp"
+#include "YamlParser.hpp"
+
+namespace {
+
+using namespace std::chrono_literals;
+
+using namespace SilKit::Core;
+using namespace SilKit::Services::PubSub;
+
+using SilKit::Config::DataSubscriberFilter;
+
+auto MakeFilter(uint64_t payloadOffset, std::vector<uint8_t> payloadPattern, uint64_t decimation)
+    -> DataSubscriberFilter
+{
+    DataSubscriberFilter filter;
+    filter.payloadOffset = payloadOffset;
+    filter.payloadPattern = std::move(payloadPattern);
+    filter.decimation = decimation;
+    return filter;
+}
+
+auto MakeSubscriberInternal(const std::string& participantName, const std::string& networkName,
+                            EndpointId serviceId, const SilKit::Util::Optional<DataSubscriberFilter>& filter)
+    -> ServiceDescriptor
+{
+    ServiceDescriptor serviceDescriptor{participantName, networkName, "Subscriber" + std::to_string(serviceId),
+                                        serviceId};
+    serviceDescriptor.SetServiceType(ServiceType::Controller);
+    serviceDescriptor.SetNetworkType(SilKit::Config::NetworkType::Data);
+    serviceDescriptor.SetSupplementalDataItem(Discovery::controllerType,
+                                              Discovery::controllerTypeDataSubscriberInternal);
+    if (filter.has_value())
+    {
+        serviceDescriptor.SetSupplementalDataItem(Discovery::supplKeyDataSubscriberInternalFilter,
+                                                  SilKit::Config::Serialize(filter.value()));
+    }
+    return serviceDescriptor;
+}
+
+auto CountAccepted(const RemoteDataSubscriberFilters::MessageFilter& filter, const std::vector<uint8_t>& data,
+                   size_t numMessages) -> size_t
+{
+    const WireDataMessageEvent msg{0ns, data};
+
+    size_t numAccepted{0};
+    for (size_t i = 0; i < numMessages; ++i)
+    {
+        if (filter(msg))
+        {
+            ++numAccepted;
+        }
+    }
+    return numAccepted;
+}
+
+TEST(Test_DataMessageFilter, payload_must_contain_the_pattern_at_the_offset)
+{
+    const std::vector<uint8_t> data{0x10, 0x20, 0x30, 0x40};
+
+    EXPECT_TRUE(DataMessageFilter{MakeFilter(0, {}, 1)}.Matches(data));
+    EXPECT_TRUE(DataMessageFilter{MakeFilter(1, {0x20, 0x30}, 1)}.Matches(data));
+    EXPECT_TRUE(DataMessageFilter{MakeFilter(3, {0x40}, 1)}.Matches(data));
+    EXPECT_FALSE(DataMessageFilter{MakeFilter(0, {0x20, 0x30}, 1)}.Matches(data));
+
+    // the pattern must not exceed the payload
+    EXPECT_FALSE(DataMessageFilter{MakeFilter(3, {0x40, 0x50}, 1)}.Matches(data));
+    EXPECT_FALSE(DataMessageFilter{MakeFilter(5, {0x40}, 1)}.Matches(data));
+}
+
+TEST(Test_DataMessageFilter, decimation_only_counts_matching_payloads)
+{
+    const std::vector<uint8_t> matching{0x01};
+    const std::vector<uint8_t> other{0x02};
+
+    DataMessageFilter filter{MakeFilter(0, {0x01}, 3)};
+
+    std::vector<bool> accepted;
+    for (size_t i = 0; i < 6; ++i)
+    {
+        EXPECT_FALSE(filter.Accept(other));
+        accepted.push_back(filter.Accept(matching));
+    }
+    EXPECT_EQ(accepted, (std::vector<bool>{true, false, false, true, false, false}));
+
+    // without the decimation, every matching payload is accepted
+    EXPECT_TRUE(filter.Accept(matching, false));
+    EXPECT_TRUE(filter.Accept(matching, false));
+    EXPECT_FALSE(filter.Accept(other, false));
+}
+
+TEST(Test_DataMessageFilter, only_subscribers_of_the_own_publishers_are_relevant)
+{
+    RemoteDataSubscriberFilters filters;
+    filters.AddPublisherNetwork("pubUUID");
+
+    EXPECT_TRUE(filters.AddService(MakeSubscriberInternal("P2", "pubUUID", 1, MakeFilter(0, {}, 10))));
+    EXPECT_FALSE(filters.AddService(MakeSubscriberInternal("P2", "otherPubUUID", 2, MakeFilter(0, {}, 10))));
+
+    ServiceDescriptor publisher{"P2", "pubUUID", "Publisher", 3};
+    publisher.SetServiceType(ServiceType::Controller);
+    publisher.SetSupplementalDataItem(Discovery::controllerType, Discovery::controllerTypeDataPublisher);
+    EXPECT_FALSE(filters.AddService(publisher));
+
+    EXPECT_NE(filters.GetMessageFilter("pubUUID", "P2"), nullptr);
+    EXPECT_EQ(filters.GetMessageFilter("otherPubUUID", "P2"), nullptr);
+    EXPECT_EQ(filters.GetMessageFilter("pubUUID", "P3"), nullptr);
+}
+
+TEST(Test_DataMessageFilter, participant_receives_all_messages_if_any_subscriber_has_no_filter)
+{
+    RemoteDataSubscriberFilters filters;
+    filters.AddPublisherNetwork("pubUUID");
+
+    const auto filteredSubscriber = MakeSubscriberInternal("P2", "pubUUID", 1, MakeFilter(0, {0x01}, 1));
+    const auto unfilteredSubscriber = MakeSubscriberInternal("P2", "pubUUID", 2, {});
+
+    filters.AddService(filteredSubscriber);
+    auto messageFilter = filters.GetMessageFilter("pubUUID", "P2");
+    ASSERT_NE(messageFilter, nullptr);
+    EXPECT_EQ(CountAccepted(messageFilter, {0x02}, 1), 0u);
+
+    filters.AddService(unfilteredSubscriber);
+    EXPECT_EQ(filters.GetMessageFilter("pubUUID", "P2"), nullptr);
+
+    EXPECT_TRUE(filters.RemoveService(unfilteredSubscriber));
+    EXPECT_NE(filters.GetMessageFilter("pubUUID", "P2"), nullptr);
+
+    EXPECT_TRUE(filters.RemoveService(filteredSubscriber));
+    EXPECT_EQ(filters.GetMessageFilter("pubUUID", "P2"), nullptr);
+}
+
+TEST(Test_DataMessageFilter, message_is_sent_if_any_subscriber_of_the_participant_accepts_it)
+{
+    RemoteDataSubscriberFilters filters;
+    filters.AddPublisherNetwork("pubUUID");
+    filters.AddService(MakeSubscriberInternal("P2", "pubUUID", 1, MakeFilter(0, {0x01}, 1)));
+    filters.AddService(MakeSubscriberInternal("P2", "pubUUID", 2, MakeFilter(0, {0x02}, 1)));
+
+    const auto messageFilter = filters.GetMessageFilter("pubUUID", "P2");
+    EXPECT_EQ(CountAccepted(messageFilter, {0x01}, 10), 10u);
+    EXPECT_EQ(CountAccepted(messageFilter, {0x02}, 10), 10u);
+    EXPECT_EQ(CountAccepted(messageFilter, {0x03}, 10), 0u);
+}
+
+TEST(Test_DataMessageFilter, publisher_applies_the_decimation_only_for_identical_filters)
+{
+    EXPECT_TRUE(PublisherAppliesDecimation({MakeFilter(0, {}, 10)}));
+    EXPECT_TRUE(PublisherAppliesDecimation({MakeFilter(0, {0x01}, 10), MakeFilter(0, {0x01}, 10)}));
+    EXPECT_FALSE(PublisherAppliesDecimation({MakeFilter(0, {}, 100), MakeFilter(0, {}, 10)}));
+    EXPECT_FALSE(PublisherAppliesDecimation({MakeFilter(0, {0x01}, 10), MakeFilter(0, {0x02}, 10)}));
+    EXPECT_FALSE(PublisherAppliesDecimation({MakeFilter(0, {}, 10), {}}));
+    EXPECT_FALSE(PublisherAppliesDecimation({}));
+
+    RemoteDataSubscriberFilters filters;
+    filters.AddPublisherNetwork("pubUUID");
+    filters.AddService(MakeSubscriberInternal("P2", "pubUUID", 1, MakeFilter(0, {}, 10)));
+    filters.AddService(MakeSubscriberInternal("P2", "pubUUID", 2, MakeFilter(0, {}, 10)));
+    EXPECT_EQ(CountAccepted(filters.GetMessageFilter("pubUUID", "P2"), {0x01}, 1000), 100u);
+}
+
+TEST(Test_DataMessageFilter, subscribers_with_different_decimations_get_their_own_rate)
+{
+    const auto slowFilter = MakeFilter(0, {}, 100);
+    const auto fastFilter = MakeFilter(0, {}, 10);
+
+    // publishing participant
+    RemoteDataSubscriberFilters remoteFilters;
+    remoteFilters.AddPublisherNetwork("pubUUID");
+    remoteFilters.AddService(MakeSubscriberInternal("P2", "pubUUID", 1, slowFilter));
+    remoteFilters.AddService(MakeSubscriberInternal("P2", "pubUUID", 2, fastFilter));
+    auto messageFilter = remoteFilters.GetMessageFilter("pubUUID", "P2");
+    ASSERT_NE(messageFilter, nullptr);
+
+    // subscribing participant
+    LocalDataSubscriberFilters localFilters;
+    bool slowAppliesDecimation{false};
+    bool fastAppliesDecimation{false};
+    localFilters.AddSubscriber("pubUUID", 1, slowFilter, [&](bool publisherAppliesDecimation) {
+        slowAppliesDecimation = !publisherAppliesDecimation;
+    });
+    EXPECT_FALSE(slowAppliesDecimation) << "A single subscriber is decimated by the publisher";
+    localFilters.AddSubscriber("pubUUID", 2, fastFilter, [&](bool publisherAppliesDecimation) {
+        fastAppliesDecimation = !publisherAppliesDecimation;
+    });
+    EXPECT_TRUE(slowAppliesDecimation);
+    EXPECT_TRUE(fastAppliesDecimation);
+
+    DataMessageFilter slowSubscriber{slowFilter};
+    DataMessageFilter fastSubscriber{fastFilter};
+    size_t numSlowReceived{0};
+    size_t numFastReceived{0};
+    const WireDataMessageEvent msg{0ns, std::vector<uint8_t>{0x01}};
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        if (!messageFilter(msg))
+        {
+            continue;
+        }
+        numSlowReceived += slowSubscriber.Accept(msg.data.AsSpan(), slowAppliesDecimation) ? 1 : 0;
+        numFastReceived += fastSubscriber.Accept(msg.data.AsSpan(), fastAppliesDecimation) ? 1 : 0;
+    }
+    EXPECT_EQ(numSlowReceived, 10u);
+    EXPECT_EQ(numFastReceived, 100u);
+}
+
+TEST(Test_DataMessageFilter, removed_subscribers_no_longer_affect_the_decimation)
+{
+    LocalDataSubscriberFilters localFilters;
+    bool slowAppliesDecimation{false};
+    size_t numFastCalls{0};
+    localFilters.AddSubscriber("pubUUID", 1, MakeFilter(0, {}, 100), [&](bool publisherAppliesDecimation) {
+        slowAppliesDecimation = !publisherAppliesDecimation;
+    });
+    localFilters.AddSubscriber("pubUUID", 2, MakeFilter(0, {}, 10), [&](bool) { ++numFastCalls; });
+    EXPECT_TRUE(slowAppliesDecimation);
+    EXPECT_EQ(numFastCalls, 1u);
+
+    localFilters.RemoveSubscriber("pubUUID", 2);
+    EXPECT_FALSE(slowAppliesDecimation) << "The remaining subscriber is decimated by the publisher again";
+    EXPECT_EQ(numFastCalls, 1u) << "The handler of a removed subscriber must not be called anymore";
+
+    localFilters.RemoveSubscriber("pubUUID", 1);
+    localFilters.AddSubscriber("pubUUID", 3, MakeFilter(0, {}, 10), [](bool) {});
+    EXPECT_EQ(numFastCalls, 1u);
+}
+
+TEST(Test_DataMessageFilter, decimation_continues_after_the_message_filter_is_rebuilt)
+{
+    RemoteDataSubscriberFilters filters;
+    filters.AddPublisherNetwork("pubUUID");
+    filters.AddService(MakeSubscriberInternal("P2", "pubUUID", 1, MakeFilter(0, {}, 10)));
+
+    const WireDataMessageEvent msg{0ns, std::vector<uint8_t>{0x01}};
+    auto messageFilter = filters.GetMessageFilter("pubUUID", "P2");
+    EXPECT_TRUE(messageFilter(msg));
+    EXPECT_FALSE(messageFilter(msg));
+
+    // another subscriber with the same filter is discovered, the first message of the new filter is not sent
+    filters.AddService(MakeSubscriberInternal("P2", "pubUUID", 2, MakeFilter(0, {}, 10)));
+    messageFilter = filters.GetMessageFilter("pubUUID", "P2");
+    EXPECT_EQ(CountAccepted(messageFilter, {0x01}, 8), 0u);
+    EXPECT_TRUE(messageFilter(msg));
+}
+
+} // anonymous namespace
@@ -20,6 +20,7 @@ OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
 WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "DataSubscriberInternal.hpp"
+#include "DataSubscriber.hpp"
 
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
@@ -79,4 +80,53 @@ TEST_F(Test_DataSubscriberInternal, trigger_default_data_handler)
 
     subscriber.ReceiveMsg(&subscriberOther, msg);
 }
+
+TEST_F(Test_DataSubscriberInternal, filter_of_the_parent_is_applied_on_reception)
+{
+    SilKit::Config::DataSubscriber config;
+    config.filter = SilKit::Config::DataSubscriberFilter{};
+    config.filter.value().payloadOffset = 1;
+    config.filter.value().payloadPattern = {0xAA};
+    config.filter.value().decimation = 2;
+
+    DataSubscriber parent{&participant, config, participant.GetTimeProvider(), {"Topic", {}}, {}};
+    DataSubscriberInternal filteredSubscriber{
+        &participant, participant.GetTimeProvider(), "Topic", {}, {},
+        SilKit::Util::bind_method(&callbacks, &Callbacks::ReceiveDataDefault), &parent};
+    filteredSubscriber.SetServiceDescriptor(endpointAddress);
+
+    const WireDataMessageEvent matching{0ns, {0u, 0xAAu, 2u}};
+    const WireDataMessageEvent other{0ns, {0u, 1u, 2u}};
+
+    // the decimation is applied, because the publisher does not filter
+    EXPECT_CALL(callbacks, ReceiveDataDefault(&parent, ToDataMessageEvent(matching))).Times(2);
+    EXPECT_CALL(callbacks, ReceiveDataDefault(&parent, ToDataMessageEvent(other))).Times(0);
+    for (int i = 0; i < 4; ++i)
+    {
+        filteredSubscriber.ReceiveMsg(&subscriberOther, matching);
+        filteredSubscriber.ReceiveMsg(&subscriberOther, other);
+    }
+    Mock::VerifyAndClearExpectations(&callbacks);
+
+    // the publisher already applied the decimation, but the pattern is still checked
+    filteredSubscriber.SetPublisherAppliesFilter(true);
+    EXPECT_CALL(callbacks, ReceiveDataDefault(&parent, ToDataMessageEvent(matching))).Times(4);
+    EXPECT_CALL(callbacks, ReceiveDataDefault(&parent, ToDataMessageEvent(other))).Times(0);
+    for (int i = 0; i < 4; ++i)
+    {
+        filteredSubscriber.ReceiveMsg(&subscriberOther, matching);
+        filteredSubscriber.ReceiveMsg(&subscriberOther, other);
+    }
+    Mock::VerifyAndClearExpectations(&callbacks);
+
+    // another subscriber of the participant has a different filter, the publisher only applies the patterns
+    filteredSubscriber.SetPublisherAppliesDecimation(false);
+    EXPECT_CALL(callbacks, ReceiveDataDefault(&parent, ToDataMessageEvent(matching))).Times(2);
+    EXPECT_CALL(callbacks, ReceiveDataDefault(&parent, ToDataMessageEvent(other))).Times(0);
+    for (int i = 0; i < 4; ++i)
+    {
+        filteredSubscriber.ReceiveMsg(&subscriberOther, matching);
+        filteredSubscriber.ReceiveMsg(&subscriberOther, other);
+    }
+}
 } // anonymous namespace
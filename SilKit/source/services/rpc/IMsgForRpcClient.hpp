@@ -34,7 +34,7 @@ namespace Rpc {
 //! \brief IMsgForRpcClient interface used by the Participant
 class IMsgForRpcClient
     : public Core::IReceiver<FunctionCallResponse>
-    , public Core::ISender<FunctionCall>
+    , public Core::ISender<FunctionCall, FunctionCallBatch>
 {
 public:
     virtual ~IMsgForRpcClient() noexcept = default;
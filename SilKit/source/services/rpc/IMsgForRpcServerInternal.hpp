@@ -32,7 +32,7 @@ namespace Rpc {
 
 //! \brief IMsgForRpcServer interface used by the Participant
 class IMsgForRpcServerInternal
-    : public Core::IReceiver<FunctionCall>
+    : public Core::IReceiver<FunctionCall, FunctionCallBatch>
     , public Core::ISender<FunctionCallResponse>
 {
 public:
@@ -0,0 +1,24 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "silkit/services/rpc/IRpcClient.hpp"
+#include "silkit/util/Span.hpp"
+
+namespace SilKit {
+namespace Services {
+namespace Rpc {
+
+class IRpcClientExtensions
+{
+public:
+    virtual ~IRpcClientExtensions() = default;
+
+    virtual void CallBatch(Util::Span<const Util::Span<const uint8_t>> data, Util::Span<void* const> userContexts) = 0;
+};
+
+} // namespace Rpc
+} // namespace Services
+} // namespace SilKit
@@ -83,15 +83,30 @@ void RpcClient::RegisterServiceDiscovery()
 
         auto clientUUID = getVal(Core::Discovery::supplKeyRpcServerInternalClientUUID);
 
+        // Servers of older versions do not announce this key and receive the calls of a batch individually
+        std::string receivesCallBatches;
+        const bool isBatchCounterpart = serviceDescriptor.GetSupplementalDataItem(
+                                            Core::Discovery::supplKeyRpcServerInternalReceivesCallBatches,
+                                            receivesCallBatches)
+                                        && receivesCallBatches == "1";
+
         if (clientUUID == _clientUUID)
         {
             if (discoveryType == SilKit::Core::Discovery::ServiceDiscoveryEvent::Type::ServiceCreated)
             {
                 _numCounterparts++;
+                if (isBatchCounterpart)
+                {
+                    _numBatchCounterparts++;
+                }
             }
             else if (discoveryType == SilKit::Core::Discovery::ServiceDiscoveryEvent::Type::ServiceRemoved)
             {
                 _numCounterparts--;
+                if (isBatchCounterpart)
+                {
+                    _numBatchCounterparts--;
+                }
             }
         }
     };
@@ -111,47 +126,101 @@ void RpcClient::CallWithTimeout(Util::Span<const uint8_t> data, std::chrono::nan
     TriggerCall(std::move(data), true, timeout, userContext);
 }
 
+void RpcClient::CallBatch(Util::Span<const Util::Span<const uint8_t>> data, Util::Span<void* const> userContexts)
+{
+    if (!userContexts.empty() && userContexts.size() != data.size())
+    {
+        throw SilKit::SilKitError{"RpcClient: The number of user contexts must match the number of calls"};
+    }
+
+    const auto getUserContext = [&userContexts](size_t index) -> void* {
+        return userContexts.empty() ? nullptr : userContexts[index];
+    };
+
+    const uint32_t numCounterparts = _numCounterparts;
+    if (numCounterparts == 0 || _numBatchCounterparts != numCounterparts)
+    {
+        // Without servers, or if not all servers receive batches, the calls are made individually
+        for (size_t index = 0; index < data.size(); ++index)
+        {
+            TriggerCall(data[index], false, {}, getUserContext(index));
+        }
+        return;
+    }
+
+    if (data.empty())
+    {
+        return;
+    }
+
+    // The calls are identified by their index within the batch, only a single random uuid is generated
+    FunctionCallBatch msg{_timeProvider->Now(), Util::Uuid::GenerateRandom(), {}};
+
+    // The argument data of all calls is copied into a single allocation, which is shared by the calls
+    size_t totalSize{0};
+    for (const auto& callData : data)
+    {
+        totalSize += callData.size();
+    }
+
+    auto storage = std::make_shared<std::vector<uint8_t>>();
+    storage->reserve(totalSize);
+    for (const auto& callData : data)
+    {
+        storage->insert(storage->end(), callData.begin(), callData.end());
+    }
+
+    msg.data.reserve(data.size());
+    size_t offset{0};
+    for (const auto& callData : data)
+    {
+        msg.data.emplace_back(storage, Util::Span<const uint8_t>{storage->data() + offset, callData.size()});
+        offset += callData.size();
+    }
+
+    {
+        std::unique_lock<decltype(_activeCallsMx)> lock{_activeCallsMx};
+        _activeCalls.reserve(_activeCalls.size() + data.size());
+        for (size_t index = 0; index < data.size(); ++index)
+        {
+            _activeCalls.emplace(BatchCallUuid(msg.batchUuid, index),
+                                 RpcCallInfo{static_cast<int32_t>(numCounterparts), getUserContext(index)});
+        }
+    }
+
+    _participant->SendMsg(this, std::move(msg));
+}
 
 void RpcClient::TimeHandler(std::chrono::nanoseconds now, std::chrono::nanoseconds duration)
 {
-    std::vector<TimeoutEntry> timeoutedEntries;
+    std::vector<Util::Uuid> timedOutCalls;
 
     {
         std::unique_lock<decltype(_timeoutQueueMx)> lockTimeout{_timeoutQueueMx};
 
-        for (auto it = _timeoutEntries.begin(); it != _timeoutEntries.end();)
+        // Only the expired calls are visited, the remaining ones are not touched
+        _timeoutClock += duration;
+        while (!_timeoutDeadlines.Empty() && _timeoutDeadlines.Top().value <= _timeoutClock)
         {
-            it->timeLeft -= duration;
-            if (it->timeLeft <= static_cast<std::chrono::nanoseconds>(0))
-            {
-                timeoutedEntries.insert(timeoutedEntries.end(), std::make_move_iterator(it),
-                                        std::make_move_iterator(it + 1));
-                it = _timeoutEntries.erase(it);
-            }
-            else
-            {
-                ++it;
-            }
+            timedOutCalls.push_back(_timeoutDeadlines.Top().key);
+            _timeoutDeadlines.Erase(timedOutCalls.back());
         }
     }
 
-    for (auto&& entry : timeoutedEntries)
+    for (const auto& uuid : timedOutCalls)
     {
-        auto uuid = entry.callUuid;
-
         std::unique_lock<decltype(_activeCallsMx)> lock{_activeCallsMx};
         auto it = _activeCalls.find(uuid);
-        auto userContext = it->second.GetUserContext();
 
         if (it != _activeCalls.end())
         {
+            auto userContext = it->second.GetUserContext();
             _activeCalls.erase(it);
             lock.unlock();
 
             _handler(this, RpcCallResultEvent{now, userContext, RpcCallStatus::Timeout, {}});
         }
     }
-    timeoutedEntries.clear();
 }
 
 
@@ -170,7 +239,8 @@ void RpcClient::TriggerCall(Util::Span<const uint8_t> data, bool hasTimeout, std
     {
         const auto callUuid = Util::Uuid::GenerateRandom();
 
-        FunctionCall msg{_timeProvider->Now(), callUuid, Util::ToStdVector(data)};
+        // The argument data is copied once, the serialized message and local receivers share it
+        FunctionCall msg{_timeProvider->Now(), callUuid, Util::SharedVector<uint8_t>{data}};
 
         {
             {
@@ -182,7 +252,7 @@ void RpcClient::TriggerCall(Util::Span<const uint8_t> data, bool hasTimeout, std
             {
                 {
                     std::unique_lock<decltype(_timeoutQueueMx)> lockTimeout{_timeoutQueueMx};
-                    _timeoutEntries.push_back({timeout, callUuid});
+                    _timeoutDeadlines.Insert(callUuid, _timeoutClock + timeout);
                 }
 
                 if (!_isTimeoutHandlerSet)
@@ -212,11 +282,13 @@ void RpcClient::ReceiveMsg(const Core::IServiceEndpoint* /*from*/, const Functio
 
 void RpcClient::ReceiveMessage(const FunctionCallResponse& msg)
 {
-    std::map<SilKit::Util::Uuid, SilKit::Services::Rpc::RpcClient::RpcCallInfo>::iterator it;
+    void* userContext{nullptr};
+    bool isLastReturn{false};
     {
         std::unique_lock<decltype(_activeCallsMx)> lock{_activeCallsMx};
 
-        it = _activeCalls.find(msg.callUuid);
+        // NB: Iterators of the unordered map are invalidated by concurrent calls, so the call is looked up only once
+        auto it = _activeCalls.find(msg.callUuid);
 
         if (it == _activeCalls.end())
         {
@@ -225,20 +297,29 @@ void RpcClient::ReceiveMessage(const FunctionCallResponse& msg)
             _logger->Warn(warningMsg);
             return;
         }
-    };
 
-    if (_handler)
+        userContext = it->second.GetUserContext();
+
+        // NB: If the call was made to multiple servers, multiple returns will be received. Only forget about the call
+        //     after all returns have been received.
+        if (it->second.DecrementRemainingReturnCount() <= 0)
+        {
+            _activeCalls.erase(it);
+            isLastReturn = true;
+        }
+    }
+
+    if (isLastReturn)
     {
-        _handler(this,
-                 RpcCallResultEvent{msg.timestamp, it->second.GetUserContext(), ToRpcCallStatus(msg.status), msg.data});
+        // the call cannot time out anymore
+        std::unique_lock<decltype(_timeoutQueueMx)> lockTimeout{_timeoutQueueMx};
+        _timeoutDeadlines.Erase(msg.callUuid);
     }
 
-    // NB: If the call was made to multiple servers, multiple returns will be received. Only forget about the call
-    //     after all returns have been received.
-    if (it->second.DecrementRemainingReturnCount() <= 0)
+    if (_handler)
     {
-        std::unique_lock<decltype(_activeCallsMx)> lock{_activeCallsMx};
-        _activeCalls.erase(it);
+        _handler(this,
+                 RpcCallResultEvent{msg.timestamp, userContext, ToRpcCallStatus(msg.status), msg.data.AsSpan()});
     }
 }
 
@@ -25,6 +25,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include <future>
 #include <queue>
 #include <set>
+#include <unordered_map>
 
 #include "silkit/services/rpc/IRpcClient.hpp"
 #include "silkit/services/rpc/IRpcCallHandle.hpp"
@@ -33,8 +34,10 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "ITimeConsumer.hpp"
 #include "ITimeProvider.hpp"
 #include "IMsgForRpcClient.hpp"
+#include "IRpcClientExtensions.hpp"
 #include "IParticipantInternal.hpp"
 #include "RpcCallHandle.hpp"
+#include "IndexedMinHeap.hpp"
 #include "Uuid.hpp"
 
 namespace SilKit {
@@ -43,6 +46,7 @@ namespace Rpc {
 
 class RpcClient
     : public IRpcClient
+    , public IRpcClientExtensions
     , public IMsgForRpcClient
     , public Services::Orchestration::ITimeConsumer
     , public Core::IServiceEndpoint
@@ -62,6 +66,9 @@ public:
 
     void SetCallResultHandler(RpcCallResultHandler handler) override;
 
+    // IRpcClientExtensions
+    void CallBatch(Util::Span<const Util::Span<const uint8_t>> data, Util::Span<void* const> userContexts) override;
+
     //! \brief Accepts messages originating from SIL Kit communications.
     void ReceiveMsg(const Core::IServiceEndpoint* from, const FunctionCallResponse& msg) override;
     void ReceiveMessage(const FunctionCallResponse& msg);
@@ -109,6 +116,8 @@ private:
 
     Core::ServiceDescriptor _serviceDescriptor{};
     std::atomic<uint32_t> _numCounterparts{0};
+    //! Number of counterparts, which receive the calls of a batch in a single message
+    std::atomic<uint32_t> _numBatchCounterparts{0};
     std::map<std::string, std::pair<uint32_t, std::unique_ptr<RpcCallHandle>>> _detachedCallHandles;
     Services::Logging::ILogger* _logger;
     Services::Orchestration::ITimeProvider* _timeProvider{nullptr};
@@ -116,16 +125,12 @@ private:
 
     std::mutex _activeCallsMx;
     std::mutex _timeoutQueueMx;
-    std::map<Util::Uuid, RpcCallInfo> _activeCalls;
-
-    struct TimeoutEntry
-    {
-        std::chrono::nanoseconds timeLeft;
-        Util::Uuid callUuid;
-    };
-
+    std::unordered_map<Util::Uuid, RpcCallInfo> _activeCalls;
 
-    std::vector<TimeoutEntry> _timeoutEntries{};
+    //! Sum of the durations of all simulation steps, since the first call with a timeout was made
+    std::chrono::nanoseconds _timeoutClock{0};
+    //! Deadlines (on the _timeoutClock) of the calls with a timeout, the earliest one on top
+    Util::IndexedMinHeap<Util::Uuid, std::chrono::nanoseconds> _timeoutDeadlines;
     std::function<void(std::chrono::nanoseconds now, std::chrono::nanoseconds duration)> _timeoutHandler{};
     Services::HandlerId _timeoutHandlerId{};
     std::atomic<bool> _isTimeoutHandlerSet{false};
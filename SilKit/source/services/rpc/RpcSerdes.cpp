@@ -37,6 +37,18 @@ inline SilKit::Core::MessageBuffer& operator>>(SilKit::Core::MessageBuffer& buff
     return buffer;
 }
 
+inline SilKit::Core::MessageBuffer& operator<<(SilKit::Core::MessageBuffer& buffer, const FunctionCallBatch& msg)
+{
+    buffer << msg.timestamp << msg.batchUuid << msg.data;
+    return buffer;
+}
+
+inline SilKit::Core::MessageBuffer& operator>>(SilKit::Core::MessageBuffer& buffer, FunctionCallBatch& msg)
+{
+    buffer >> msg.timestamp >> msg.batchUuid >> msg.data;
+    return buffer;
+}
+
 inline SilKit::Core::MessageBuffer& operator<<(SilKit::Core::MessageBuffer& buffer, const FunctionCallResponse& msg)
 {
     buffer << msg.timestamp << msg.callUuid << msg.data << msg.status;
@@ -55,6 +67,10 @@ void Serialize(MessageBuffer& buffer, const FunctionCall& msg)
 {
     buffer << msg;
 }
+void Serialize(MessageBuffer& buffer, const FunctionCallBatch& msg)
+{
+    buffer << msg;
+}
 void Serialize(MessageBuffer& buffer, const FunctionCallResponse& msg)
 {
     buffer << msg;
@@ -64,10 +80,36 @@ void Deserialize(MessageBuffer& buffer, FunctionCall& out)
 {
     buffer >> out;
 }
+void Deserialize(MessageBuffer& buffer, FunctionCallBatch& out)
+{
+    buffer >> out;
+}
 void Deserialize(MessageBuffer& buffer, FunctionCallResponse& out)
 {
     buffer >> out;
 }
+
+auto SerializedSizeOf(const FunctionCall& msg) -> size_t
+{
+    using SilKit::Core::SerializedSizeOf;
+    return SerializedSizeOf(msg.timestamp) + SerializedSizeOf(msg.callUuid) + SerializedSizeOf(msg.data);
+}
+auto SerializedSizeOf(const FunctionCallBatch& msg) -> size_t
+{
+    using SilKit::Core::SerializedSizeOf;
+    auto size = SerializedSizeOf(msg.timestamp) + SerializedSizeOf(msg.batchUuid) + sizeof(uint32_t);
+    for (const auto& data : msg.data)
+    {
+        size += SerializedSizeOf(data);
+    }
+    return size;
+}
+auto SerializedSizeOf(const FunctionCallResponse& msg) -> size_t
+{
+    using SilKit::Core::SerializedSizeOf;
+    return SerializedSizeOf(msg.timestamp) + SerializedSizeOf(msg.callUuid) + SerializedSizeOf(msg.data)
+           + SerializedSizeOf(msg.status);
+}
 } // namespace Rpc
 } // namespace Services
 } // namespace SilKit
@@ -31,11 +31,17 @@ namespace Services {
 namespace Rpc {
 
 void Serialize(SilKit::Core::MessageBuffer& buffer, const FunctionCall& msg);
+void Serialize(SilKit::Core::MessageBuffer& buffer, const FunctionCallBatch& msg);
 void Serialize(SilKit::Core::MessageBuffer& buffer, const FunctionCallResponse& msg);
 
 void Deserialize(SilKit::Core::MessageBuffer& buffer, FunctionCall& out);
+void Deserialize(SilKit::Core::MessageBuffer& buffer, FunctionCallBatch& out);
 void Deserialize(SilKit::Core::MessageBuffer& buffer, FunctionCallResponse& out);
 
+auto SerializedSizeOf(const FunctionCall& msg) -> size_t;
+auto SerializedSizeOf(const FunctionCallBatch& msg) -> size_t;
+auto SerializedSizeOf(const FunctionCallResponse& msg) -> size_t;
+
 } // namespace Rpc
 } // namespace Services
 } // namespace SilKit
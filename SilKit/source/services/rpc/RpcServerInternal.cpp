@@ -85,7 +85,21 @@ void RpcServerInternal::ReceiveMessage(const FunctionCall& msg)
     // NB: Explicitly _copy_ the call handle to keep the handle itself alive even if it gets removed from the map
     //     due to a call to SubmitResult in the handler.
     std::shared_ptr<RpcCallHandle> callHandle = result.first->second;
-    _handler(_parent, RpcCallEvent{msg.timestamp, callHandle.get(), msg.data});
+    _handler(_parent, RpcCallEvent{msg.timestamp, callHandle.get(), msg.data.AsSpan()});
+}
+
+void RpcServerInternal::ReceiveMsg(const Core::IServiceEndpoint* /*from*/, const FunctionCallBatch& msg)
+{
+    ReceiveMessage(msg);
+}
+
+void RpcServerInternal::ReceiveMessage(const FunctionCallBatch& msg)
+{
+    // The calls of a batch are handled like individual calls, the data of each call still points into the message
+    for (size_t index = 0; index < msg.data.size(); ++index)
+    {
+        ReceiveMessage(FunctionCall{msg.timestamp, BatchCallUuid(msg.batchUuid, index), msg.data[index]});
+    }
 }
 
 bool RpcServerInternal::SubmitResult(IRpcCallHandle* callHandlePtr, Util::Span<const uint8_t> resultData)
@@ -100,8 +114,8 @@ bool RpcServerInternal::SubmitResult(IRpcCallHandle* callHandlePtr, Util::Span<c
     }
 
     _participant->SendMsg(
-        this, FunctionCallResponse{_timeProvider->Now(), callHandle.GetCallUuid(), Util::ToStdVector(resultData),
-                                   FunctionCallResponse::Status::Success});
+        this, FunctionCallResponse{_timeProvider->Now(), callHandle.GetCallUuid(),
+                                   Util::SharedVector<uint8_t>{resultData}, FunctionCallResponse::Status::Success});
     _activeCalls.erase(it);
 
     // The call was handled, therefore return true
@@ -58,6 +58,8 @@ public:
     //! \brief Accepts messages originating from SIL Kit communications.
     void ReceiveMsg(const Core::IServiceEndpoint* from, const FunctionCall& msg) override;
     void ReceiveMessage(const FunctionCall& msg);
+    void ReceiveMsg(const Core::IServiceEndpoint* from, const FunctionCallBatch& msg) override;
+    void ReceiveMessage(const FunctionCallBatch& msg);
 
     // SilKit::Services::Orchestration::ITimeConsumer
     void SetTimeProvider(Services::Orchestration::ITimeProvider* provider) override;
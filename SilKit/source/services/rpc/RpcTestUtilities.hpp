@@ -79,6 +79,12 @@ struct MockConnection
     {
     }
 
+    template <typename SilKitMessageT>
+    void SetRemoteReceiverFilter(const std::string& /*networkName*/, const std::string& /*participantName*/,
+                                 std::function<bool(const SilKitMessageT&)> /*filter*/)
+    {
+    }
+
     template <typename SilKitMessageT>
     void SendMsg(const SilKit::Core::IServiceEndpoint* /*from*/, SilKitMessageT&& /*msg*/)
     {
@@ -93,6 +99,15 @@ struct MockConnection
         Mock_SendMsg(from, std::move(msg));
     }
 
+    void SendMsg(const SilKit::Core::IServiceEndpoint* from, FunctionCallBatch msg)
+    {
+        for (auto& rpcServerInternal : services.rpcServerInternal)
+        {
+            rpcServerInternal->ReceiveMsg(from, msg);
+        }
+        Mock_SendMsg(from, std::move(msg));
+    }
+
     void SendMsg(const SilKit::Core::IServiceEndpoint* from, FunctionCallResponse msg)
     {
         for (auto& rpcClient : services.rpcClient)
@@ -103,6 +118,7 @@ struct MockConnection
     }
 
     MOCK_METHOD(void, Mock_SendMsg, (const SilKit::Core::IServiceEndpoint* /*from*/, FunctionCall /*msg*/));
+    MOCK_METHOD(void, Mock_SendMsg, (const SilKit::Core::IServiceEndpoint* /*from*/, FunctionCallBatch /*msg*/));
     MOCK_METHOD(void, Mock_SendMsg, (const SilKit::Core::IServiceEndpoint* /*from*/, FunctionCallResponse /*msg*/));
 
     template <typename SilKitMessageT>
@@ -114,8 +130,9 @@ struct MockConnection
     void OnAllMessagesDelivered(std::function<void()> /*callback*/) {}
     void FlushSendBuffers() {}
     void ExecuteDeferred(std::function<void()> /*callback*/) {}
+    void UpdateMetrics() {}
     void NotifyShutdown() {}
-    void EnableAggregation() {}
+    void EnableAggregation(SilKit::Core::VAsioAggregationMode /*mode*/) {}
 
     void RegisterMessageReceiver(
         std::function<void(SilKit::Core::IVAsioPeer* /*peer*/, SilKit::Core::ParticipantAnnouncement)> /*callback*/)
@@ -167,6 +184,22 @@ struct MockConnection
         return {};
     };
 
+    std::map<std::string, uint64_t> TakeSentUserDataMessageCounts()
+    {
+        return {};
+    };
+
+    void AwaitReceivedUserDataMessages(std::map<std::string, uint64_t> /*counts*/, std::function<void()> /*handler*/)
+    {
+    }
+
+    void DelayReceivedUserDataMessages(const std::string& /*participantName*/,
+                                       std::chrono::nanoseconds /*releaseTimePoint*/)
+    {
+    }
+
+    void ReleaseReceivedUserDataMessages(std::chrono::nanoseconds /*timePoint*/) {}
+
     bool ParticipantHasCapability(const std::string& /*participantName*/, const std::string& /*capability*/) const
     {
         return true;
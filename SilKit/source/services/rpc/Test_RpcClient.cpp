@@ -87,7 +87,7 @@ TEST_F(Test_RpcClient, rpc_client_call_sends_message_with_current_timestamp_and_
     EXPECT_CALL(participant->GetSilKitConnection(), Mock_SendMsg(testing::_, testing::A<FunctionCall>()))
         .WillOnce([this, &fixedTimeProvider](const SilKit::Core::IServiceEndpoint* /*from*/, const FunctionCall& msg) {
         ASSERT_EQ(msg.timestamp, fixedTimeProvider.now);
-        ASSERT_EQ(msg.data, sampleData);
+        ASSERT_EQ(SilKit::Util::ToStdVector(msg.data.AsSpan()), sampleData);
     });
 
     // HACK: Change the time provider for the captured services. Must happen _after_ the RpcServer and RpcClient (and
@@ -124,4 +124,73 @@ TEST_F(Test_RpcClient, rpc_client_call_receives_internal_server_error_when_serve
     iRpcClient->Call(sampleData, userContext);
 }
 
+TEST_F(Test_RpcClient, rpc_client_call_batch_sends_a_single_message_and_receives_a_result_per_call)
+{
+    IRpcServer* iRpcServer = CreateRpcServer();
+    iRpcServer->SetCallHandler([](IRpcServer* rpcServer, const RpcCallEvent& event) {
+        // the argument data is returned as the result
+        rpcServer->SubmitResult(event.callHandle, event.argumentData);
+    });
+    IRpcClient* iRpcClient = CreateRpcClient();
+
+    std::vector<std::pair<uintptr_t, std::vector<uint8_t>>> results;
+    iRpcClient->SetCallResultHandler([&results](IRpcClient* /*rpcClient*/, const RpcCallResultEvent& event) {
+        ASSERT_EQ(event.callStatus, RpcCallStatus::Success);
+        results.emplace_back(reinterpret_cast<uintptr_t>(event.userContext),
+                             SilKit::Util::ToStdVector(event.resultData));
+    });
+
+    EXPECT_CALL(participant->GetSilKitConnection(), Mock_SendMsg(testing::_, testing::A<FunctionCall>())).Times(0);
+    EXPECT_CALL(participant->GetSilKitConnection(), Mock_SendMsg(testing::_, testing::A<FunctionCallBatch>()))
+        .WillOnce([](const SilKit::Core::IServiceEndpoint* /*from*/, const FunctionCallBatch& msg) {
+        ASSERT_EQ(msg.data.size(), 3u);
+    });
+
+    const std::vector<uint8_t> data1{1};
+    const std::vector<uint8_t> data2{2, 2};
+    const std::vector<uint8_t> data3{3, 3, 3};
+    const std::vector<SilKit::Util::Span<const uint8_t>> data{data1, data2, data3};
+    const std::vector<void*> userContexts{reinterpret_cast<void*>(uintptr_t(1)), reinterpret_cast<void*>(uintptr_t(2)),
+                                          reinterpret_cast<void*>(uintptr_t(3))};
+
+    dynamic_cast<IRpcClientExtensions&>(*iRpcClient).CallBatch(data, userContexts);
+
+    const std::vector<std::pair<uintptr_t, std::vector<uint8_t>>> expectedResults{{1, data1}, {2, data2}, {3, data3}};
+    EXPECT_EQ(results, expectedResults);
+}
+
+TEST_F(Test_RpcClient, rpc_client_calls_time_out_in_the_order_of_their_deadlines)
+{
+    SilKit::Core::Tests::MockTimeProvider timeProvider;
+
+    // the server does not reply, all calls run into their timeout
+    IRpcServer* iRpcServer = CreateRpcServer();
+    iRpcServer->SetCallHandler(SilKit::Util::bind_method(&callbacks, &Callbacks::CallHandler));
+    EXPECT_CALL(callbacks, CallHandler(testing::_, testing::_)).Times(4);
+    IRpcClient* iRpcClient = CreateRpcClient();
+    participant->GetSilKitConnection().Test_SetTimeProvider(&timeProvider);
+
+    std::vector<uintptr_t> timedOutCalls;
+    iRpcClient->SetCallResultHandler([&timedOutCalls](IRpcClient* /*rpcClient*/, const RpcCallResultEvent& event) {
+        ASSERT_EQ(event.callStatus, RpcCallStatus::Timeout);
+        timedOutCalls.push_back(reinterpret_cast<uintptr_t>(event.userContext));
+    });
+
+    iRpcClient->CallWithTimeout(sampleData, std::chrono::milliseconds{3}, reinterpret_cast<void*>(uintptr_t(3)));
+    iRpcClient->CallWithTimeout(sampleData, std::chrono::milliseconds{1}, reinterpret_cast<void*>(uintptr_t(1)));
+    iRpcClient->CallWithTimeout(sampleData, std::chrono::milliseconds{2}, reinterpret_cast<void*>(uintptr_t(2)));
+
+    timeProvider._handlers.InvokeAll(std::chrono::milliseconds{0}, std::chrono::milliseconds{1});
+    EXPECT_EQ(timedOutCalls, (std::vector<uintptr_t>{1}));
+
+    // the deadline of a later call is relative to the time at which it was made
+    iRpcClient->CallWithTimeout(sampleData, std::chrono::microseconds{500}, reinterpret_cast<void*>(uintptr_t(4)));
+
+    timeProvider._handlers.InvokeAll(std::chrono::milliseconds{1}, std::chrono::milliseconds{1});
+    EXPECT_EQ(timedOutCalls, (std::vector<uintptr_t>{1, 4, 2}));
+
+    timeProvider._handlers.InvokeAll(std::chrono::milliseconds{2}, std::chrono::milliseconds{5});
+    EXPECT_EQ(timedOutCalls, (std::vector<uintptr_t>{1, 4, 2, 3}));
+}
+
 } // anonymous namespace
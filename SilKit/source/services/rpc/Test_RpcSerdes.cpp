@@ -46,6 +46,45 @@ TEST(Test_RpcSerdes, SimRpc_functionCall)
     EXPECT_EQ(in, out);
 }
 
+TEST(Test_RpcSerdes, SimRpc_functionCall_data_is_not_copied_out_of_the_buffer)
+{
+    using namespace SilKit::Services::Rpc;
+    using namespace SilKit::Core;
+
+    SilKit::Core::MessageBuffer buffer;
+    FunctionCall in, out;
+    in.data = referenceData;
+
+    Serialize(buffer, in);
+    Deserialize(buffer, out);
+
+    const auto storage = buffer.PeekData();
+    const auto data = out.data.AsSpan();
+    ASSERT_EQ(data.size(), referenceData.size());
+    EXPECT_GE(data.data(), storage.data());
+    EXPECT_LE(data.data() + data.size(), storage.data() + storage.size());
+}
+
+TEST(Test_RpcSerdes, SimRpc_functionCallBatch)
+{
+    using namespace SilKit::Services::Rpc;
+    using namespace SilKit::Core;
+
+    SilKit::Core::MessageBuffer buffer;
+    FunctionCallBatch in, out;
+    in.batchUuid = {1234565, 0x789abcdf};
+    in.data = {referenceData, std::vector<uint8_t>{}, std::vector<uint8_t>{1, 2, 3}};
+    in.timestamp = 12345ns;
+
+    Serialize(buffer, in);
+    EXPECT_EQ(buffer.PeekData().size(), SerializedSizeOf(in));
+    Deserialize(buffer, out);
+    EXPECT_EQ(in, out);
+    EXPECT_EQ(out.timestamp, in.timestamp);
+
+    EXPECT_EQ(BatchCallUuid(in.batchUuid, 2), (SilKit::Util::Uuid{1234565, 0x789abcdf + 2}));
+}
+
 TEST(Test_RpcSerdes, SimRpc_functioncall_response)
 {
     using namespace SilKit::Services::Rpc;
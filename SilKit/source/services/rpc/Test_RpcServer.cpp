@@ -59,7 +59,7 @@ TEST_F(Test_RpcServer, rpc_server_call_response_sends_message_with_timestamp_and
         .WillOnce([this, &fixedTimeProvider](const SilKit::Core::IServiceEndpoint* /*from*/,
                                              const FunctionCallResponse& msg) {
         ASSERT_EQ(msg.timestamp, fixedTimeProvider.now);
-        ASSERT_EQ(msg.data, sampleData);
+        ASSERT_EQ(SilKit::Util::ToStdVector(msg.data.AsSpan()), sampleData);
     });
 
     IRpcClient* iRpcClient = CreateRpcClient();
@@ -0,0 +1,191 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace SilKit {
+namespace Util {
+
+//! \brief Binary min-heap of values, which are addressed by a unique key.
+//!
+//! Inserting, updating, and erasing the value of a key is O(log N), the smallest value is available in O(1).
+template <typename KeyT, typename ValueT, typename CompareT = std::less<ValueT>>
+class IndexedMinHeap
+{
+public:
+    // ----------------------------------------
+    // Public Data Types
+    struct Entry
+    {
+        KeyT key;
+        ValueT value;
+    };
+
+public:
+    // ----------------------------------------
+    // Constructors and Destructor
+    explicit IndexedMinHeap(CompareT compare = CompareT{})
+        : _compare{std::move(compare)}
+    {
+    }
+
+public:
+    // ----------------------------------------
+    // Public Methods
+
+    //! Returns false (and does not modify the heap) if the key is already present.
+    bool Insert(const KeyT& key, ValueT value)
+    {
+        if (_positions.find(key) != _positions.end())
+        {
+            return false;
+        }
+
+        _heap.push_back(Entry{key, std::move(value)});
+        _positions.emplace(key, _heap.size() - 1);
+        SiftUp(_heap.size() - 1);
+        return true;
+    }
+
+    //! Returns false if the key is not present.
+    bool Update(const KeyT& key, ValueT value)
+    {
+        auto it = _positions.find(key);
+        if (it == _positions.end())
+        {
+            return false;
+        }
+
+        const auto position = it->second;
+        _heap[position].value = std::move(value);
+        SiftDown(SiftUp(position));
+        return true;
+    }
+
+    //! Returns false if the key is not present.
+    bool Erase(const KeyT& key)
+    {
+        auto it = _positions.find(key);
+        if (it == _positions.end())
+        {
+            return false;
+        }
+
+        const auto position = it->second;
+        _positions.erase(it);
+
+        const auto last = _heap.size() - 1;
+        if (position != last)
+        {
+            _heap[position] = std::move(_heap[last]);
+            _positions[_heap[position].key] = position;
+            _heap.pop_back();
+            SiftDown(SiftUp(position));
+        }
+        else
+        {
+            _heap.pop_back();
+        }
+        return true;
+    }
+
+    //! Returns nullptr if the key is not present.
+    auto Find(const KeyT& key) const -> const ValueT*
+    {
+        auto it = _positions.find(key);
+        if (it == _positions.end())
+        {
+            return nullptr;
+        }
+        return &_heap[it->second].value;
+    }
+
+    //! The entry with the smallest value. The heap must not be empty.
+    auto Top() const -> const Entry&
+    {
+        return _heap.front();
+    }
+
+    bool Empty() const
+    {
+        return _heap.empty();
+    }
+
+    auto Size() const -> std::size_t
+    {
+        return _heap.size();
+    }
+
+    //! All entries, in no particular order.
+    auto Entries() const -> const std::vector<Entry>&
+    {
+        return _heap;
+    }
+
+private:
+    // ----------------------------------------
+    // Private Methods
+    auto SiftUp(std::size_t position) -> std::size_t
+    {
+        while (position > 0)
+        {
+            const auto parent = (position - 1) / 2;
+            if (!_compare(_heap[position].value, _heap[parent].value))
+            {
+                break;
+            }
+            Swap(position, parent);
+            position = parent;
+        }
+        return position;
+    }
+
+    auto SiftDown(std::size_t position) -> std::size_t
+    {
+        for (;;)
+        {
+            const auto left = 2 * position + 1;
+            const auto right = left + 1;
+
+            auto smallest = position;
+            if (left < _heap.size() && _compare(_heap[left].value, _heap[smallest].value))
+            {
+                smallest = left;
+            }
+            if (right < _heap.size() && _compare(_heap[right].value, _heap[smallest].value))
+            {
+                smallest = right;
+            }
+            if (smallest == position)
+            {
+                return position;
+            }
+            Swap(position, smallest);
+            position = smallest;
+        }
+    }
+
+    void Swap(std::size_t lhs, std::size_t rhs)
+    {
+        std::swap(_heap[lhs], _heap[rhs]);
+        _positions[_heap[lhs].key] = lhs;
+        _positions[_heap[rhs].key] = rhs;
+    }
+
+private:
+    // ----------------------------------------
+    // Private Members
+    CompareT _compare;
+    std::vector<Entry> _heap;
+    std::unordered_map<KeyT, std::size_t> _positions;
+};
+
+} // namespace Util
+} // namespace SilKit
@@ -0,0 +1,175 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace SilKit {
+namespace Util {
+
+//! Bounded lock-free queue for multiple producers and a single consumer.
+//! TryPush may be called concurrently from any thread, Front, TryPop, and Size only from the consumer thread.
+//! The implementation follows Dmitry Vyukov's bounded MPMC queue, with a plain (non-CAS) dequeue for a single consumer.
+template <typename T>
+class MpscQueue
+{
+public:
+    // constructors and destructors
+
+    //! The capacity is rounded up to the next power of two.
+    explicit MpscQueue(std::size_t capacity);
+    MpscQueue(const MpscQueue&) = delete;
+    MpscQueue& operator=(const MpscQueue&) = delete;
+
+public:
+    // public methods
+
+    //! Moves the value into the queue. Returns false, and leaves the value untouched, if the queue is full.
+    bool TryPush(T& value);
+
+    //! The oldest value in the queue, or nullptr if the queue is empty. Consumer only.
+    auto Front() -> T*;
+    //! Moves the oldest value out of the queue. Returns false if the queue is empty. Consumer only.
+    bool TryPop(T& value);
+
+    //! Number of values in the queue. Exact only if no push is in progress.
+    auto Size() const -> std::size_t;
+    auto Capacity() const -> std::size_t;
+
+private:
+    struct Cell
+    {
+        std::atomic<std::size_t> sequence;
+        T value;
+    };
+
+    // producers and the consumer modify their position on separate cache lines (padding instead of alignas, because
+    // C++14 does not support allocating over-aligned types)
+    struct Position
+    {
+        std::atomic<std::size_t> value{0};
+        char padding[64 - sizeof(std::atomic<std::size_t>)];
+    };
+
+    static auto RoundUpToPowerOfTwo(std::size_t value) -> std::size_t;
+
+private:
+    // member variables
+    const std::size_t _mask;
+    std::unique_ptr<Cell[]> _cells;
+    Position _enqueuePosition;
+    Position _dequeuePosition;
+};
+
+// ================================================================================
+//  Inline Implementations
+// ================================================================================
+
+template <typename T>
+MpscQueue<T>::MpscQueue(std::size_t capacity)
+    : _mask{RoundUpToPowerOfTwo(capacity) - 1}
+    , _cells{new Cell[_mask + 1]}
+{
+    for (std::size_t index = 0; index <= _mask; ++index)
+    {
+        _cells[index].sequence.store(index, std::memory_order_relaxed);
+    }
+}
+
+template <typename T>
+bool MpscQueue<T>::TryPush(T& value)
+{
+    Cell* cell;
+    auto position = _enqueuePosition.value.load(std::memory_order_relaxed);
+    for (;;)
+    {
+        cell = &_cells[position & _mask];
+        const auto sequence = cell->sequence.load(std::memory_order_acquire);
+        const auto difference = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position);
+        if (difference == 0)
+        {
+            // the cell is free, claim it
+            if (_enqueuePosition.value.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (difference < 0)
+        {
+            // the cell still holds the value pushed one round earlier
+            return false;
+        }
+        else
+        {
+            // another producer claimed the cell
+            position = _enqueuePosition.value.load(std::memory_order_relaxed);
+        }
+    }
+
+    cell->value = std::move(value);
+    cell->sequence.store(position + 1, std::memory_order_release);
+    return true;
+}
+
+template <typename T>
+auto MpscQueue<T>::Front() -> T*
+{
+    const auto position = _dequeuePosition.value.load(std::memory_order_relaxed);
+    auto& cell = _cells[position & _mask];
+    if (cell.sequence.load(std::memory_order_acquire) != position + 1)
+    {
+        return nullptr;
+    }
+    return &cell.value;
+}
+
+template <typename T>
+bool MpscQueue<T>::TryPop(T& value)
+{
+    const auto position = _dequeuePosition.value.load(std::memory_order_relaxed);
+    auto& cell = _cells[position & _mask];
+    if (cell.sequence.load(std::memory_order_acquire) != position + 1)
+    {
+        return false;
+    }
+
+    value = std::move(cell.value);
+    // hand the cell back to the producers of the next round
+    cell.sequence.store(position + _mask + 1, std::memory_order_release);
+    _dequeuePosition.value.store(position + 1, std::memory_order_relaxed);
+    return true;
+}
+
+template <typename T>
+auto MpscQueue<T>::Size() const -> std::size_t
+{
+    const auto dequeuePosition = _dequeuePosition.value.load(std::memory_order_relaxed);
+    const auto enqueuePosition = _enqueuePosition.value.load(std::memory_order_relaxed);
+    return enqueuePosition - dequeuePosition;
+}
+
+template <typename T>
+auto MpscQueue<T>::Capacity() const -> std::size_t
+{
+    return _mask + 1;
+}
+
+template <typename T>
+auto MpscQueue<T>::RoundUpToPowerOfTwo(std::size_t value) -> std::size_t
+{
+    std::size_t result{2};
+    while (result < value)
+    {
+        result *= 2;
+    }
+    return result;
+}
+
+} // namespace Util
+} // namespace SilKit
@@ -23,6 +23,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include <string>
 #include <iosfwd>
+#include <functional>
 
 #include <cstdint>
 
@@ -48,4 +49,16 @@ auto operator<<(std::ostream& ostream, const Uuid& uuid) -> std::ostream&;
 auto to_string(const Uuid& uuid) -> std::string;
 
 } // namespace Util
-} // namespace SilKit
\ No newline at end of file
+} // namespace SilKit
+
+namespace std {
+template <>
+struct hash<SilKit::Util::Uuid>
+{
+    auto operator()(const SilKit::Util::Uuid& uuid) const -> std::size_t
+    {
+        // random UUIDs are uniformly distributed, combining both halves is sufficient
+        return std::hash<uint64_t>{}(uuid.ab ^ (uuid.cd * 0x9e3779b97f4a7c15ull));
+    }
+};
+} // namespace std
@@ -0,0 +1,118 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "IndexedMinHeap.hpp"
+
+#include <algorithm>
+#include <map>
+#include <random>
+#include <string>
+
+#include "gtest/gtest.h"
+
+namespace {
+
+using SilKit::Util::IndexedMinHeap;
+
+TEST(Test_IndexedMinHeap, top_is_the_smallest_value)
+{
+    IndexedMinHeap<std::string, int> heap;
+    EXPECT_TRUE(heap.Empty());
+
+    EXPECT_TRUE(heap.Insert("a", 5));
+    EXPECT_TRUE(heap.Insert("b", 3));
+    EXPECT_TRUE(heap.Insert("c", 7));
+    EXPECT_FALSE(heap.Insert("b", 1));
+
+    EXPECT_EQ(heap.Size(), 3u);
+    EXPECT_EQ(heap.Top().key, "b");
+    EXPECT_EQ(heap.Top().value, 3);
+}
+
+TEST(Test_IndexedMinHeap, update_moves_the_entry_in_both_directions)
+{
+    IndexedMinHeap<std::string, int> heap;
+    heap.Insert("a", 5);
+    heap.Insert("b", 3);
+    heap.Insert("c", 7);
+
+    // the smallest value becomes the largest
+    EXPECT_TRUE(heap.Update("b", 10));
+    EXPECT_EQ(heap.Top().key, "a");
+
+    // the largest value becomes the smallest
+    EXPECT_TRUE(heap.Update("c", 1));
+    EXPECT_EQ(heap.Top().key, "c");
+
+    EXPECT_FALSE(heap.Update("d", 0));
+    ASSERT_NE(heap.Find("b"), nullptr);
+    EXPECT_EQ(*heap.Find("b"), 10);
+    EXPECT_EQ(heap.Find("d"), nullptr);
+}
+
+TEST(Test_IndexedMinHeap, erase_removes_the_entry)
+{
+    IndexedMinHeap<std::string, int> heap;
+    heap.Insert("a", 5);
+    heap.Insert("b", 3);
+    heap.Insert("c", 7);
+
+    EXPECT_TRUE(heap.Erase("b"));
+    EXPECT_FALSE(heap.Erase("b"));
+    EXPECT_EQ(heap.Find("b"), nullptr);
+    EXPECT_EQ(heap.Top().key, "a");
+
+    EXPECT_TRUE(heap.Erase("a"));
+    EXPECT_TRUE(heap.Erase("c"));
+    EXPECT_TRUE(heap.Empty());
+}
+
+TEST(Test_IndexedMinHeap, random_operations_match_a_linear_scan)
+{
+    IndexedMinHeap<int, int> heap;
+    std::map<int, int> reference;
+
+    std::mt19937 random{1234};
+    std::uniform_int_distribution<int> keys{0, 63};
+    std::uniform_int_distribution<int> values{-1000, 1000};
+    std::uniform_int_distribution<int> operations{0, 2};
+
+    for (int iteration = 0; iteration < 10000; ++iteration)
+    {
+        const auto key = keys(random);
+        const auto value = values(random);
+
+        switch (operations(random))
+        {
+        case 0:
+            EXPECT_EQ(heap.Insert(key, value), reference.emplace(key, value).second);
+            break;
+        case 1:
+            if (reference.count(key) != 0)
+            {
+                reference[key] = value;
+                EXPECT_TRUE(heap.Update(key, value));
+            }
+            else
+            {
+                EXPECT_FALSE(heap.Update(key, value));
+            }
+            break;
+        default:
+            EXPECT_EQ(heap.Erase(key), reference.erase(key) != 0);
+            break;
+        }
+
+        ASSERT_EQ(heap.Size(), reference.size());
+        if (!reference.empty())
+        {
+            const auto smallest =
+                std::min_element(reference.begin(), reference.end(),
+                                 [](const auto& lhs, const auto& rhs) { return lhs.second < rhs.second; });
+            ASSERT_EQ(heap.Top().value, smallest->second);
+        }
+    }
+}
+
+} // namespace
@@ -0,0 +1,113 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "MpscQueue.hpp"
+
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+
+using namespace SilKit::Util;
+
+TEST(Test_MpscQueue, capacity_is_rounded_up_to_power_of_two)
+{
+    EXPECT_EQ(MpscQueue<int>{0}.Capacity(), 2u);
+    EXPECT_EQ(MpscQueue<int>{4}.Capacity(), 4u);
+    EXPECT_EQ(MpscQueue<int>{5}.Capacity(), 8u);
+}
+
+TEST(Test_MpscQueue, values_are_popped_in_push_order)
+{
+    MpscQueue<int> queue{4};
+
+    for (int value = 0; value < 3; ++value)
+    {
+        ASSERT_TRUE(queue.TryPush(value));
+    }
+    EXPECT_EQ(queue.Size(), 3u);
+
+    int value{-1};
+    for (int expected = 0; expected < 3; ++expected)
+    {
+        ASSERT_NE(queue.Front(), nullptr);
+        EXPECT_EQ(*queue.Front(), expected);
+        ASSERT_TRUE(queue.TryPop(value));
+        EXPECT_EQ(value, expected);
+    }
+
+    EXPECT_EQ(queue.Front(), nullptr);
+    EXPECT_FALSE(queue.TryPop(value));
+    EXPECT_EQ(queue.Size(), 0u);
+}
+
+TEST(Test_MpscQueue, push_to_full_queue_fails_and_keeps_the_value)
+{
+    MpscQueue<std::vector<int>> queue{2};
+
+    std::vector<int> value{1};
+    ASSERT_TRUE(queue.TryPush(value));
+    value = {2};
+    ASSERT_TRUE(queue.TryPush(value));
+
+    value = {3};
+    ASSERT_FALSE(queue.TryPush(value));
+    EXPECT_EQ(value, std::vector<int>{3});
+
+    // popping a value frees a cell for the next round
+    std::vector<int> popped;
+    ASSERT_TRUE(queue.TryPop(popped));
+    EXPECT_EQ(popped, std::vector<int>{1});
+    ASSERT_TRUE(queue.TryPush(value));
+    EXPECT_TRUE(value.empty());
+}
+
+TEST(Test_MpscQueue, concurrent_producers_keep_their_own_order)
+{
+    constexpr int producerCount{4};
+    constexpr int valuesPerProducer{10000};
+
+    MpscQueue<std::pair<int, int>> queue{64};
+
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < producerCount; ++producer)
+    {
+        producers.emplace_back([&queue, producer] {
+            for (int index = 0; index < valuesPerProducer; ++index)
+            {
+                std::pair<int, int> value{producer, index};
+                while (!queue.TryPush(value))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    std::vector<int> nextIndex(producerCount, 0);
+    for (int received = 0; received < producerCount * valuesPerProducer;)
+    {
+        std::pair<int, int> value;
+        if (!queue.TryPop(value))
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        ASSERT_EQ(value.second, nextIndex[value.first]);
+        ++nextIndex[value.first];
+        ++received;
+    }
+
+    for (auto& producer : producers)
+    {
+        producer.join();
+    }
+
+    EXPECT_EQ(queue.Size(), 0u);
+}
+
+} // namespace
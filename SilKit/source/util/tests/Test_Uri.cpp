@@ -185,6 +185,14 @@ TEST(Test_Uri, parse_uris)
     ASSERT_EQ(uri.Path(), "/tmp/domainsockets.silkit");
     ASSERT_EQ(uri.EncodedString(), "local:///tmp/domainsockets.silkit");
 
+    uri = Uri::Parse("shm:///tmp/sharedmemory.silkit");
+    ASSERT_EQ(uri.Type(), Uri::UriType::SharedMemory);
+    ASSERT_EQ(uri.Host(), "");
+    ASSERT_EQ(uri.Scheme(), "shm");
+    ASSERT_EQ(uri.Port(), 0);
+    ASSERT_EQ(uri.Path(), "/tmp/sharedmemory.silkit");
+    ASSERT_EQ(uri.EncodedString(), "shm:///tmp/sharedmemory.silkit");
+
     uri = Uri::Parse("tcp://123.123.123.123:3456/");
     ASSERT_EQ(uri.Type(), Uri::UriType::Tcp);
     ASSERT_EQ(uri.Scheme(), "tcp");
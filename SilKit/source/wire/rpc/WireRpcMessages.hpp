@@ -28,6 +28,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "SharedVector.hpp"
 #include "Uuid.hpp"
 
+#include <algorithm>
 #include <chrono>
 #include <vector>
 
@@ -43,7 +44,19 @@ struct FunctionCall
 {
     std::chrono::nanoseconds timestamp;
     Util::Uuid callUuid;
-    std::vector<uint8_t> data;
+    Util::SharedVector<uint8_t> data;
+};
+
+/*! \brief Multiple Rpcs with their function parameter data, transmitted in a single message
+ *
+ * The calls are not identified by individual random uuids, the uuid of a call is derived from the uuid of the batch
+ * and the index of the call within the batch (see BatchCallUuid).
+ */
+struct FunctionCallBatch
+{
+    std::chrono::nanoseconds timestamp;
+    Util::Uuid batchUuid;
+    std::vector<Util::SharedVector<uint8_t>> data;
 };
 
 /*! \brief Rpc response with function return data
@@ -60,16 +73,23 @@ struct FunctionCallResponse
 
     std::chrono::nanoseconds timestamp;
     Util::Uuid callUuid;
-    std::vector<uint8_t> data;
+    Util::SharedVector<uint8_t> data;
     Status status;
 };
 
 inline bool operator==(const FunctionCall& lhs, const FunctionCall& rhs);
+inline bool operator==(const FunctionCallBatch& lhs, const FunctionCallBatch& rhs);
 inline bool operator==(const FunctionCallResponse& lhs, const FunctionCallResponse& rhs);
 
+//! The uuid of the call with the given index within a batch, which is used in the FunctionCallResponse of the call
+inline auto BatchCallUuid(const Util::Uuid& batchUuid, size_t index) -> Util::Uuid;
+
 inline std::string to_string(const FunctionCall& msg);
 inline std::ostream& operator<<(std::ostream& out, const FunctionCall& msg);
 
+inline std::string to_string(const FunctionCallBatch& msg);
+inline std::ostream& operator<<(std::ostream& out, const FunctionCallBatch& msg);
+
 inline std::string to_string(const FunctionCallResponse::Status& status);
 inline std::ostream& operator<<(std::ostream& out, const FunctionCallResponse::Status& status);
 
@@ -82,12 +102,21 @@ inline std::ostream& operator<<(std::ostream& out, const FunctionCallResponse& m
 
 bool operator==(const FunctionCall& lhs, const FunctionCall& rhs)
 {
-    return lhs.callUuid == rhs.callUuid && lhs.data == rhs.data;
+    return lhs.callUuid == rhs.callUuid && Util::ItemsAreEqual(lhs.data, rhs.data);
+}
+
+bool operator==(const FunctionCallBatch& lhs, const FunctionCallBatch& rhs)
+{
+    return lhs.batchUuid == rhs.batchUuid && lhs.data.size() == rhs.data.size()
+           && std::equal(lhs.data.begin(), lhs.data.end(), rhs.data.begin(),
+                         [](const auto& lhsData, const auto& rhsData) {
+                             return Util::ItemsAreEqual(lhsData, rhsData);
+                         });
 }
 
 bool operator==(const FunctionCallResponse& lhs, const FunctionCallResponse& rhs)
 {
-    return lhs.callUuid == rhs.callUuid && lhs.data == rhs.data && lhs.status == rhs.status;
+    return lhs.callUuid == rhs.callUuid && Util::ItemsAreEqual(lhs.data, rhs.data) && lhs.status == rhs.status;
 }
 
 std::string to_string(const FunctionCall& msg)
@@ -100,8 +129,25 @@ std::string to_string(const FunctionCall& msg)
 std::ostream& operator<<(std::ostream& out, const FunctionCall& msg)
 {
     return out << "rpc::FunctionCall{callUUID=" << msg.callUuid
-               << ", data=" << Util::AsHexString(msg.data).WithSeparator(" ").WithMaxLength(16)
-               << ", size=" << msg.data.size() << "}";
+               << ", data=" << Util::AsHexString(msg.data.AsSpan()).WithSeparator(" ").WithMaxLength(16)
+               << ", size=" << msg.data.AsSpan().size() << "}";
+}
+
+auto BatchCallUuid(const Util::Uuid& batchUuid, size_t index) -> Util::Uuid
+{
+    return Util::Uuid{batchUuid.ab, batchUuid.cd + static_cast<uint64_t>(index)};
+}
+
+std::string to_string(const FunctionCallBatch& msg)
+{
+    std::stringstream out;
+    out << msg;
+    return out.str();
+}
+
+std::ostream& operator<<(std::ostream& out, const FunctionCallBatch& msg)
+{
+    return out << "rpc::FunctionCallBatch{batchUUID=" << msg.batchUuid << ", count=" << msg.data.size() << "}";
 }
 
 std::string to_string(const FunctionCallResponse::Status& status)
@@ -135,8 +181,8 @@ std::string to_string(const FunctionCallResponse& msg)
 std::ostream& operator<<(std::ostream& out, const FunctionCallResponse& msg)
 {
     return out << "rpc::FunctionCallResponse{callUUID=" << msg.callUuid
-               << ", data=" << Util::AsHexString(msg.data).WithSeparator(" ").WithMaxLength(16)
-               << ", size=" << msg.data.size() << ", status=" << msg.status << "}";
+               << ", data=" << Util::AsHexString(msg.data.AsSpan()).WithSeparator(" ").WithMaxLength(16)
+               << ", size=" << msg.data.AsSpan().size() << ", status=" << msg.status << "}";
 }
 
 } // namespace Rpc
@@ -23,66 +23,182 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "silkit/util/Span.hpp"
 
+#include <array>
 #include <chrono>
 #include <memory>
 #include <algorithm>
+#include <type_traits>
+#include <vector>
 
 namespace SilKit {
 namespace Util {
 
+//! Items of trivially copyable types are stored inline up to a total of 64 bytes, e.g., a CAN FD data field.
 template <typename T>
+constexpr size_t DefaultSharedVectorInlineCapacity()
+{
+    return std::is_trivially_copyable<T>::value ? 64 / sizeof(T) : 0;
+}
+
+//! \brief Immutable sequence of items, which is shared by its copies.
+//!
+//! Up to InlineCapacity items are stored inline and copied along with the SharedVector, without any heap allocation.
+//! Larger sequences, and views into items owned by another object, are shared by reference counting. A span obtained
+//! via AsSpan is valid as long as the SharedVector (or, for shared items, any of its copies) is alive. Moving from a
+//! SharedVector keeps inline items valid in the moved-from object.
+template <typename T, size_t InlineCapacity = DefaultSharedVectorInlineCapacity<T>()>
 class SharedVector
 {
     static_assert(!std::is_const<T>::value, "T must not be const");
     static_assert(!std::is_reference<T>::value, "T must not be a reference");
+    static_assert(InlineCapacity == 0 || std::is_trivially_copyable<T>::value,
+                  "only trivially copyable items can be stored inline");
 
 public:
     SharedVector() = default;
 
+    SharedVector(const SharedVector& other) = default;
+    SharedVector(SharedVector&& other) noexcept;
+
     SharedVector(std::initializer_list<T> initializerList);
 
     SharedVector(std::vector<T> vector);
 
     SharedVector(const Span<const T> span, size_t minimumSize = 0, T padValue = T{});
 
+    //! Refer to the items in view without copying them. The owner keeps the viewed items alive.
+    SharedVector(std::shared_ptr<const void> owner, const Span<const T> view);
+
+    auto operator=(const SharedVector& other) -> SharedVector& = default;
+    auto operator=(SharedVector&& other) noexcept -> SharedVector&;
+
     auto AsSpan() const& -> Span<const T>;
 
+    //! True if the items are stored inline, i.e., not shared with other SharedVectors.
+    bool IsInline() const;
+
 private:
-    std::shared_ptr<std::vector<T>> _data;
+    SharedVector(std::shared_ptr<std::vector<T>> vector);
+
+    template <typename IteratorT>
+    void AssignInline(IteratorT begin, IteratorT end, size_t size, const T& padValue = T{});
+
+private:
+    std::shared_ptr<const T> _data;
+    size_t _size{0};
+    std::array<T, InlineCapacity> _inline{};
 };
 
-template <typename T>
-bool ItemsAreEqual(const SharedVector<T>& lhs, const SharedVector<T>& rhs);
+template <typename T, size_t InlineCapacity>
+bool ItemsAreEqual(const SharedVector<T, InlineCapacity>& lhs, const SharedVector<T, InlineCapacity>& rhs);
 
 // ================================================================================
 //  Inline Implementations
 // ================================================================================
 
-template <typename T>
-SharedVector<T>::SharedVector(std::initializer_list<T> initializerList)
-    : SharedVector(std::vector<T>{initializerList})
+template <typename T, size_t InlineCapacity>
+SharedVector<T, InlineCapacity>::SharedVector(SharedVector&& other) noexcept
+    : _data{std::move(other._data)}
+    , _size{other._size}
+    , _inline(other._inline)
 {
+    if (_data)
+    {
+        other._size = 0;
+    }
 }
 
-template <typename T>
-SharedVector<T>::SharedVector(std::vector<T> vector)
-    : _data{std::make_shared<std::vector<T>>(std::move(vector))}
+template <typename T, size_t InlineCapacity>
+SharedVector<T, InlineCapacity>::SharedVector(std::initializer_list<T> initializerList)
 {
+    if (initializerList.size() <= InlineCapacity)
+    {
+        AssignInline(initializerList.begin(), initializerList.end(), initializerList.size());
+    }
+    else
+    {
+        *this = SharedVector(std::vector<T>{initializerList});
+    }
 }
 
-template <typename T>
-SharedVector<T>::SharedVector(const Span<const T> span, const size_t minimumSize, const T padValue)
-    : _data{std::make_shared<std::vector<T>>(span.begin(), span.end())}
+template <typename T, size_t InlineCapacity>
+SharedVector<T, InlineCapacity>::SharedVector(std::vector<T> vector)
 {
-    _data->resize((std::max)(_data->size(), minimumSize), padValue);
+    if (vector.size() <= InlineCapacity)
+    {
+        AssignInline(vector.begin(), vector.end(), vector.size());
+    }
+    else
+    {
+        *this = SharedVector(std::make_shared<std::vector<T>>(std::move(vector)));
+    }
 }
 
-template <typename T>
-auto SharedVector<T>::AsSpan() const& -> Span<const T>
+template <typename T, size_t InlineCapacity>
+SharedVector<T, InlineCapacity>::SharedVector(const Span<const T> span, const size_t minimumSize, const T padValue)
+{
+    const auto size = (std::max)(span.size(), minimumSize);
+    if (size <= InlineCapacity)
+    {
+        AssignInline(span.begin(), span.end(), size, padValue);
+    }
+    else
+    {
+        auto vector = std::make_shared<std::vector<T>>(span.begin(), span.end());
+        vector->resize(size, padValue);
+        *this = SharedVector(std::move(vector));
+    }
+}
+
+template <typename T, size_t InlineCapacity>
+SharedVector<T, InlineCapacity>::SharedVector(std::shared_ptr<const void> owner, const Span<const T> view)
+    : _data{std::move(owner), view.data()}
+    , _size{view.size()}
+{
+}
+
+template <typename T, size_t InlineCapacity>
+SharedVector<T, InlineCapacity>::SharedVector(std::shared_ptr<std::vector<T>> vector)
+    : _data{vector, vector->data()}
+    , _size{vector->size()}
+{
+}
+
+template <typename T, size_t InlineCapacity>
+auto SharedVector<T, InlineCapacity>::operator=(SharedVector&& other) noexcept -> SharedVector&
+{
+    if (this != &other)
+    {
+        _data = std::move(other._data);
+        _size = other._size;
+        _inline = other._inline;
+        if (_data)
+        {
+            other._size = 0;
+        }
+    }
+    return *this;
+}
+
+template <typename T, size_t InlineCapacity>
+template <typename IteratorT>
+void SharedVector<T, InlineCapacity>::AssignInline(IteratorT begin, IteratorT end, size_t size, const T& padValue)
+{
+    const auto last = std::copy(begin, end, _inline.begin());
+    std::fill(last, _inline.begin() + size, padValue);
+    _size = size;
+}
+
+template <typename T, size_t InlineCapacity>
+auto SharedVector<T, InlineCapacity>::AsSpan() const& -> Span<const T>
 {
     if (_data)
     {
-        return {_data->data(), _data->size()};
+        return {_data.get(), _size};
+    }
+    else if (_size != 0)
+    {
+        return {_inline.data(), _size};
     }
     else
     {
@@ -90,8 +206,14 @@ auto SharedVector<T>::AsSpan() const& -> Span<const T>
     }
 }
 
-template <typename T>
-bool ItemsAreEqual(const SharedVector<T>& lhs, const SharedVector<T>& rhs)
+template <typename T, size_t InlineCapacity>
+bool SharedVector<T, InlineCapacity>::IsInline() const
+{
+    return !_data && _size != 0;
+}
+
+template <typename T, size_t InlineCapacity>
+bool ItemsAreEqual(const SharedVector<T, InlineCapacity>& lhs, const SharedVector<T, InlineCapacity>& rhs)
 {
     return ItemsAreEqual(lhs.AsSpan(), rhs.AsSpan());
 }
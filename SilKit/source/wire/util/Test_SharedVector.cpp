@@ -0,0 +1,115 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "SharedVector.hpp"
+
+#include <numeric>
+
+#include "gtest/gtest.h"
+
+namespace {
+
+using SilKit::Util::SharedVector;
+using SilKit::Util::Span;
+
+auto MakeData(size_t size) -> std::vector<uint8_t>
+{
+    std::vector<uint8_t> data(size);
+    std::iota(data.begin(), data.end(), uint8_t{1});
+    return data;
+}
+
+TEST(Test_SharedVector, small_payloads_are_stored_inline)
+{
+    const auto data = MakeData(8);
+
+    SharedVector<uint8_t> fromVector{data};
+    SharedVector<uint8_t> fromSpan{SilKit::Util::ToSpan(data)};
+    SharedVector<uint8_t> fromInitializerList{1, 2, 3, 4, 5, 6, 7, 8};
+
+    EXPECT_TRUE(fromVector.IsInline());
+    EXPECT_TRUE(fromSpan.IsInline());
+    EXPECT_TRUE(fromInitializerList.IsInline());
+
+    EXPECT_TRUE(ItemsAreEqual(fromVector.AsSpan(), SilKit::Util::ToSpan(data)));
+    EXPECT_TRUE(ItemsAreEqual(fromVector, fromSpan));
+    EXPECT_TRUE(ItemsAreEqual(fromVector, fromInitializerList));
+
+    // a copy has its own items
+    auto copy = fromVector;
+    EXPECT_NE(copy.AsSpan().data(), fromVector.AsSpan().data());
+    EXPECT_TRUE(ItemsAreEqual(copy, fromVector));
+}
+
+TEST(Test_SharedVector, large_payloads_are_shared)
+{
+    const auto data = MakeData(65);
+
+    SharedVector<uint8_t> original{data};
+    EXPECT_FALSE(original.IsInline());
+
+    auto copy = original;
+    EXPECT_EQ(copy.AsSpan().data(), original.AsSpan().data());
+    EXPECT_TRUE(ItemsAreEqual(copy.AsSpan(), SilKit::Util::ToSpan(data)));
+
+    // the moved-from vector is empty, the items stay alive in the moved-to vector
+    const auto span = original.AsSpan();
+    auto moved = std::move(original);
+    EXPECT_EQ(moved.AsSpan().data(), span.data());
+    EXPECT_EQ(original.AsSpan().size(), 0u);
+}
+
+TEST(Test_SharedVector, inline_capacity_is_configurable)
+{
+    const auto data = MakeData(8);
+
+    SharedVector<uint8_t, 4> small{data};
+    EXPECT_FALSE(small.IsInline());
+    EXPECT_TRUE(ItemsAreEqual(small.AsSpan(), SilKit::Util::ToSpan(data)));
+
+    SharedVector<uint8_t, 0> none{MakeData(1)};
+    EXPECT_FALSE(none.IsInline());
+    EXPECT_EQ(none.AsSpan().size(), 1u);
+}
+
+TEST(Test_SharedVector, span_is_padded_up_to_the_minimum_size)
+{
+    const auto data = MakeData(3);
+
+    SharedVector<uint8_t> padded{SilKit::Util::ToSpan(data), 60, 0xFF};
+    EXPECT_TRUE(padded.IsInline());
+
+    SharedVector<uint8_t> paddedLarge{SilKit::Util::ToSpan(data), 100, 0xFF};
+    EXPECT_FALSE(paddedLarge.IsInline());
+
+    for (const auto& vector : {padded, paddedLarge})
+    {
+        const auto span = vector.AsSpan();
+        ASSERT_GE(span.size(), 60u);
+        EXPECT_TRUE(std::equal(data.begin(), data.end(), span.begin()));
+        EXPECT_TRUE(std::all_of(span.begin() + data.size(), span.end(), [](uint8_t value) { return value == 0xFF; }));
+    }
+}
+
+TEST(Test_SharedVector, view_refers_to_the_items_of_the_owner)
+{
+    auto owner = std::make_shared<std::vector<uint8_t>>(MakeData(8));
+
+    SharedVector<uint8_t> view{owner, Span<const uint8_t>{owner->data() + 2, 4}};
+    EXPECT_FALSE(view.IsInline());
+    EXPECT_EQ(view.AsSpan().data(), owner->data() + 2);
+    EXPECT_EQ(view.AsSpan().size(), 4u);
+}
+
+TEST(Test_SharedVector, empty_vector_has_an_empty_span)
+{
+    SharedVector<uint8_t> empty;
+    EXPECT_FALSE(empty.IsInline());
+    EXPECT_EQ(empty.AsSpan().size(), 0u);
+
+    SharedVector<uint8_t> fromEmptyVector{std::vector<uint8_t>{}};
+    EXPECT_EQ(fromEmptyVector.AsSpan().size(), 0u);
+}
+
+} // anonymous namespace
@@ -0,0 +1,209 @@
+// SPDX-FileCopyrightText: 2025 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <cctype>
+#include <future>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include "silkit/SilKitVersion.hpp"
+#include "silkit/SilKit.hpp"
+#include "silkit/services/orchestration/all.hpp"
+#include "silkit/services/orchestration/string_utils.hpp"
+
+#include "CommandlineParser.hpp"
+#include "SignalHandler.hpp"
+
+using namespace SilKit::Services::Orchestration;
+
+using CliParser = SilKit::Util::CommandlineParser;
+
+namespace {
+
+auto ToLowerCase(std::string s) -> std::string
+{
+    std::transform(s.begin(), s.end(), s.begin(), [](unsigned char c) { return (unsigned char)std::tolower(c); });
+    return s;
+}
+
+auto IsValidLogLevel(const std::string& levelStr) -> bool
+{
+    auto logLevel = ToLowerCase(levelStr);
+    return logLevel == "trace" || logLevel == "debug" || logLevel == "warn" || logLevel == "info" || logLevel == "error"
+           || logLevel == "critical" || logLevel == "off";
+}
+
+auto EscapeJsonString(const std::string& s) -> std::string
+{
+    std::string escaped;
+    for (const auto c : s)
+    {
+        if (c == '"' || c == '\\')
+        {
+            escaped.push_back('\\');
+        }
+        escaped.push_back(c);
+    }
+    return escaped;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    CliParser commandlineParser;
+    commandlineParser.Add<CliParser::Flag>("version", "v", "[--version]", "-v, --version: Get version info.");
+    commandlineParser.Add<CliParser::Flag>("help", "h", "[--help]", "-h, --help: Get this help.");
+    commandlineParser.Add<CliParser::Option>(
+        "connect-uri", "u", "silkit://localhost:8500", "[--connect-uri <silkitUri>]",
+        "-u, --connect-uri <silkitUri>: The registry URI to connect to. Defaults to 'silkit://localhost:8500'.");
+    commandlineParser.Add<CliParser::Option>("name", "n", "TimeSyncAggregator", "[--name <participantName>]",
+                                             "-n, --name <participantName>: The participant name used to take "
+                                             "part in the simulation. All participants must configure it as their "
+                                             "time synchronization aggregator. Defaults to 'TimeSyncAggregator'.");
+    commandlineParser.Add<CliParser::Option>(
+        "configuration", "c", "", "[--configuration <filePath>]",
+        "-c, --configuration <filePath>: Path to the Participant configuration YAML or JSON file. "
+        "Cannot be used together with the '--log' option.");
+    commandlineParser.Add<CliParser::Option>(
+        "log", "l", "info", "[--log <level>]",
+        "-l, --log <level>: Log to stdout with level 'trace', 'debug', 'warn', 'info', 'error', 'critical' or 'off'. "
+        "Defaults to 'info' if the '--configuration' option is not specified. Cannot be used together with the "
+        "'--configuration' option.");
+
+    std::cout << "Vector SIL Kit -- Time Sync Aggregator, SIL Kit version: " << SilKit::Version::String() << std::endl
+              << std::endl;
+
+    try
+    {
+        commandlineParser.ParseArguments(argc, argv);
+    }
+    catch (const SilKit::SilKitError& e)
+    {
+        std::cerr << "Error: " << e.what() << std::endl;
+        commandlineParser.PrintUsageInfo(std::cerr, argv[0]);
+
+        return -1;
+    }
+    catch (const std::runtime_error& e)
+    {
+        std::cerr << "Error: " << e.what() << std::endl;
+        commandlineParser.PrintUsageInfo(std::cerr, argv[0]);
+
+        return -1;
+    }
+
+    if (commandlineParser.Get<CliParser::Flag>("help").Value())
+    {
+        commandlineParser.PrintUsageInfo(std::cout, argv[0]);
+
+        return 0;
+    }
+
+    if (commandlineParser.Get<CliParser::Flag>("version").Value())
+    {
+        std::string hash{SilKit::Version::GitHash()};
+        auto shortHash = hash.substr(0, 7);
+        std::cout << "Version Info:" << std::endl
+                  << " - Vector SilKit: " << SilKit::Version::String() << ", #" << shortHash << std::endl;
+
+        return 0;
+    }
+
+    const auto participantName{commandlineParser.Get<CliParser::Option>("name").Value()};
+
+    const bool hasLogOption{commandlineParser.Get<CliParser::Option>("log").HasValue()};
+    const bool hasCfgOption{commandlineParser.Get<CliParser::Option>("configuration").HasValue()};
+    if (hasLogOption && hasCfgOption)
+    {
+        std::cerr << "Error: Options '--log' and '--configuration' cannot be used simultaneously" << std::endl;
+        commandlineParser.PrintUsageInfo(std::cerr, argv[0]);
+        return -1;
+    }
+
+    const auto configurationFilename{commandlineParser.Get<CliParser::Option>("configuration").Value()};
+    const auto connectUri{commandlineParser.Get<CliParser::Option>("connect-uri").Value()};
+
+    const auto logLevel{commandlineParser.Get<CliParser::Option>("log").Value()};
+    if (!IsValidLogLevel(logLevel))
+    {
+        std::cerr << "Error: Argument of the '--log' option must be one of 'trace', 'debug', 'warn', 'info', 'error', "
+                     "'critical', or 'off'"
+                  << std::endl;
+        return -1;
+    }
+
+    std::shared_ptr<SilKit::Config::IParticipantConfiguration> configuration;
+    try
+    {
+        // The participant acts as the aggregator, because its own name is configured as the aggregator
+        std::ostringstream ss;
+        ss << R"({"Experimental":{"TimeSynchronization":{"Aggregator":")" << EscapeJsonString(participantName)
+           << R"("}},)";
+        if (hasCfgOption)
+        {
+            ss << R"("Includes":{"Files":[")" << EscapeJsonString(configurationFilename) << R"("]}})";
+        }
+        else
+        {
+            std::string configLogLevel{logLevel};
+
+            // due to the validation, we know that the first character is ASCII
+            configLogLevel[0] = static_cast<char>(std::toupper(configLogLevel[0]));
+
+            ss << R"("Logging":{"Sinks":[{"Type":"Stdout","Level":")" << configLogLevel << R"("}]}})";
+        }
+
+        configuration = SilKit::Config::ParticipantConfigurationFromString(ss.str());
+    }
+    catch (const SilKit::ConfigurationError& error)
+    {
+        std::cerr << "Error: Failed to load configuration '" << configurationFilename << "', " << error.what()
+                  << std::endl;
+
+        return -2;
+    }
+
+    try
+    {
+        std::cout << "Creating participant '" << participantName << "' with registry " << connectUri << std::endl;
+
+        auto participant = SilKit::CreateParticipant(configuration, participantName, connectUri);
+        auto* logger{participant->GetLogger()};
+
+        // The aggregator joins and leaves the simulation on its own, it does not execute simulation steps
+        auto* lifecycleService = participant->CreateLifecycleService({OperationMode::Autonomous});
+        (void)lifecycleService->CreateTimeSyncService();
+        auto finalStateFuture = lifecycleService->StartLifecycle().share();
+
+        std::cout << "Press Ctrl-C to stop the time sync aggregator..." << std::endl;
+        SilKit::Util::RegisterSignalHandler([lifecycleService, logger](auto signalValue) {
+            std::ostringstream ss;
+            ss << "Signal " << signalValue << " received, stopping the time sync aggregator...";
+            logger->Info(ss.str());
+
+            lifecycleService->Stop("Stop via interaction in sil-kit-time-sync-aggregator");
+        });
+
+        const auto finalState = finalStateFuture.get();
+        if (finalState != ParticipantState::Shutdown)
+        {
+            std::ostringstream ss;
+            ss << "Time sync aggregator ended with an unexpected participant state: " << finalState;
+            logger->Warn(ss.str());
+        }
+
+        SilKit::Util::ShutdownSignalHandler();
+    }
+    catch (const std::exception& error)
+    {
+        std::cerr << "Something went wrong: " << error.what() << std::endl;
+
+        return -3;
+    }
+
+    return 0;
+}